@@ -105,6 +105,31 @@ namespace NEApplication
      **/
     constexpr unsigned short    DEFAULT_ROUTER_PORT         { 8181 };
 
+    /**
+     * \brief   NEApplication::DEFAULT_SERVICE_WORKERS
+     *          Default number of threads to send and receive messages of remote service.
+     **/
+    constexpr unsigned int      DEFAULT_SERVICE_WORKERS     { 1 };
+
+    /**
+     * \brief   NEApplication::DEFAULT_SERVICE_CHECKSUM
+     *          Default flag to verify the checksum of messages received by remote service.
+     **/
+    constexpr bool              DEFAULT_SERVICE_CHECKSUM    { true };
+
+    /**
+     * \brief   NEApplication::DEFAULT_SERVICE_BATCH
+     *          Default maximum number of queued messages of remote service sent by one system call.
+     **/
+    constexpr unsigned int      DEFAULT_SERVICE_BATCH       { 64 };
+
+    /**
+     * \brief   NEApplication::DEFAULT_SERVICE_LINGER
+     *          Default maximum time in milliseconds to wait for more messages of remote service
+     *          to send by one system call. If zero, sends as soon as there are no more queued messages.
+     **/
+    constexpr unsigned int      DEFAULT_SERVICE_LINGER      { 0 };
+
     /**
      * \brief   NEApplication::DEFAULT_LOGGER_SERVICE_NAME
      *          The default name of Log Collector.
@@ -0,0 +1,109 @@
+#ifndef AREG_BASE_BUFFERPOOL_HPP
+#define AREG_BASE_BUFFERPOOL_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/BufferPool.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pool of byte buffers cached in every thread.
+ *
+ ************************************************************************/
+
+ /************************************************************************
+  * Includes
+  ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NEMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// BufferPool class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The pool of the memory of byte buffers. The shared buffers, the remote
+ *          messages and the streams of event data allocate the memory of the buffers
+ *          in the pool, together with the control block of the shared pointer.
+ *
+ *          The blocks are sorted by size classes, which are powers of two from
+ *          MIN_BLOCK_SIZE to MAX_BLOCK_SIZE bytes, so that the growing buffer gets
+ *          twice bigger block. Every thread has own pool, the released block returns
+ *          to the pool of the thread, where it was allocated. The pool of a thread
+ *          caches up to MAX_CACHED_SIZE bytes of free blocks of every size class.
+ *          The bigger buffers are allocated in the heap.
+ **/
+class AREG_API BufferPool
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The size of the blocks of the smallest size class.
+    static constexpr uint32_t   MIN_BLOCK_SIZE      { 128u };
+
+    //!< The size of the blocks of the largest size class. The bigger buffers are allocated in the heap.
+    static constexpr uint32_t   MAX_BLOCK_SIZE      { 1024u * 1024u };
+
+    //!< The maximum size in bytes of free blocks of one size class cached in the pool of the thread.
+    static constexpr uint32_t   MAX_CACHED_SIZE     { 512u * 1024u };
+
+    //!< The maximum number of free blocks of one size class cached in the pool of the thread.
+    static constexpr uint32_t   MAX_CACHED_BLOCKS   { 256u };
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the memory of the buffer in the pool of the calling thread.
+     * \param   size    The size in bytes of the memory to allocate.
+     * \return  Returns the pointer to the allocated memory. Throws std::bad_alloc if failed.
+     **/
+    static void * allocate( size_t size );
+
+    /**
+     * \brief   Releases the memory of the buffer, allocated by the pool.
+     *          The memory block returns to the pool, where it was allocated.
+     * \param   ptr     The pointer to the memory to release. Ignored if nullptr.
+     **/
+    static void release( void * ptr );
+
+    /**
+     * \brief   Returns the size of the memory, which is allocated for the requested size.
+     *          The buffer can use the whole allocated memory.
+     * \param   size    The size in bytes of the memory to allocate.
+     **/
+    static size_t getCapacity( size_t size );
+
+    /**
+     * \brief   Enables or disables the pools. If disabled, the buffers are allocated
+     *          in the heap, the memory of the allocated buffers returns to the pools.
+     *          The pools are enabled by default.
+     **/
+    static void setPoolEnabled( bool enable );
+
+    /**
+     * \brief   Returns true if the buffers are allocated in the pools.
+     **/
+    static bool isPoolEnabled( void );
+
+    /**
+     * \brief   Returns the counters of the allocations, summed in the pools of all threads.
+     **/
+    static NEMemory::sPoolStatistics getStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden / Forbidden method calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    BufferPool( void ) = delete;
+    ~BufferPool( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( BufferPool );
+};
+
+#endif  // AREG_BASE_BUFFERPOOL_HPP
@@ -235,6 +235,21 @@ protected:
      **/
     virtual unsigned int getHeaderSize( void ) const = 0;
 
+/************************************************************************/
+// IEByteBuffer protected helpers
+/************************************************************************/
+
+    /**
+     * \brief   Allocates the memory of the byte buffer in the BufferPool. The control block
+     *          of the shared pointer is placed in the same memory block before the buffer,
+     *          so that the buffer is created by one allocation. The buffer is not initialized.
+     * \param   size        The size in bytes of the complete byte buffer to allocate.
+     * \param   capacity    On output, contains the size in bytes of the allocated byte buffer,
+     *                      which is equal or bigger than 'size'. The complete space can be used.
+     * \return  Returns the shared pointer to the allocated memory of the byte buffer.
+     **/
+    static std::shared_ptr<NEMemory::sByteBuffer> createBuffer( unsigned int size, unsigned int & OUT capacity );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -95,6 +95,7 @@ public:
 
     /**
      * \brief   Returns true if a synchronization object is valid.
+     *          The spin-lock has no system object and is always valid.
      **/
     inline bool isValid( void ) const;
 
@@ -177,7 +178,7 @@ inline IESynchObject::eSyncObject IESynchObject::getObjectType( void ) const
 
 inline bool IESynchObject::isValid( void ) const
 {
-    return (mSynchObjectType == IESynchObject::eSyncObject::SoNolock) || (mSynchObject != nullptr);
+    return (mSynchObjectType == IESynchObject::eSyncObject::SoNolock) || (mSynchObjectType == IESynchObject::eSyncObject::SoSpinlock) || (mSynchObject != nullptr);
 }
 
 #endif  // AREG_BASE_IESYNCHOBJECT_HPP
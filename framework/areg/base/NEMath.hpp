@@ -371,6 +371,8 @@ namespace NEMath
      * \brief	Cyclic Redundancy Check (CRC) calculation function on 
      *          standard IEEE 802.3, using lookup table (fast calculate).
      *          Calculates and returns 32-bit CRC value of a binary data in one step.
+     *          If the CPU supports carry-less multiplication, the large data is
+     *          calculated by the hardware instructions, see crc32IsAccelerated().
      * \param	data	Pointer to data to calculate CRC
      * \param	size	The size in bytes of given buffer
      * \return	32-bit value of Cyclic Redundancy Check (CRC)
@@ -459,6 +461,13 @@ namespace NEMath
      **/
     AREG_API unsigned int crc32Finish( unsigned int crc );
 
+    /**
+     * \brief   Returns true if the 32-bit CRC of binary data is calculated by the carry-less
+     *          multiplication instructions of the CPU. Otherwise, the CRC is calculated
+     *          by the lookup tables, processing 8 bytes per step.
+     **/
+    AREG_API bool crc32IsAccelerated( void );
+
     /**
      * \brief   Rounds passed double value to nearest integer
      * \param   val     A parameter to round. Normally float or double type.
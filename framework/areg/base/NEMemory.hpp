@@ -419,6 +419,21 @@ namespace NEMemory
         BufferData              rbData[4];
     } sRemoteMessage;
 
+    //////////////////////////////////////////////////////////////////////////
+    // NEMemory::sPoolStatistics structure declaration
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * \brief   NEMemory::sPoolStatistics
+     *          The counters of the pool of memory blocks, summed in the pools of all threads.
+     **/
+    struct sPoolStatistics
+    {
+        uint64_t    psAllocations   { 0u }; //!< The number of allocated blocks.
+        uint64_t    psHeapAllocs    { 0u }; //!< The number of blocks, for which the memory was allocated in the heap.
+        uint64_t    psReleases      { 0u }; //!< The number of released blocks.
+        uint64_t    psHeapReleases  { 0u }; //!< The number of blocks, for which the memory was released in the heap.
+    };
+
     /**
      * \brief   Returns the pointer to data buffer for writing. 
      *          Returns nullptr if pointer to byte buffer is invalid.
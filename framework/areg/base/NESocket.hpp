@@ -367,6 +367,25 @@ namespace NESocket
      **/
     extern AREG_API const int           MAXIMUM_LISTEN_QUEUE_SIZE   /*= SOMAXCONN*/;
 
+    /**
+     * \brief   NESocket::MAX_SEND_BUFFERS
+     *          The maximum number of buffers passed to the system at once
+     *          when sends the vector of buffers.
+     **/
+    constexpr uint32_t                  MAX_SEND_BUFFERS            { 1024 };
+
+    /**
+     * \brief   NESocket::sSendBuffer
+     *          The buffer of data to send in the single call together with other buffers.
+     **/
+    struct sSendBuffer
+    {
+        //!< The pointer to the data to send.
+        const unsigned char *   sbData      { nullptr };
+        //!< The length in bytes of the data to send.
+        uint32_t                sbLength    { 0u };
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // NESocket namespace functions
 //////////////////////////////////////////////////////////////////////////
@@ -492,6 +511,19 @@ namespace NESocket
      **/
     AREG_API SOCKETHANDLE serverAcceptConnection( SOCKETHANDLE serverSocket, const SOCKETHANDLE * masterList, int entriesCount, NESocket::SocketAddress * out_socketAddr = nullptr );
 
+    /**
+     * \brief   NESocket::serverAcceptPending
+     *          Called by server to accept the connection pending in the queue of listening socket.
+     *          The call does not wait for new connections. If there is no pending connection,
+     *          returns invalid socket handle. The accepted socket is in blocking mode.
+     * \param   serverSocket    The valid socket descriptor of server in listening mode.
+     * \param   out_socketAddr  If not nullptr and new connection is accepted, on output this will contain
+     *                          the IP address and port number of new accepted connection.
+     * \return  If succeeds to accept connection, returns valid accepted socket descriptor.
+     *          Returns NESocket::InvalidSocketHandle if there is no pending connection or failed to accept.
+     **/
+    AREG_API SOCKETHANDLE serverAcceptPending( SOCKETHANDLE serverSocket, NESocket::SocketAddress * out_socketAddr = nullptr );
+
     /**
      * \brief   NESocket::getMaxSendSize
      *          Returns the socket buffer size in bytes to send the packet at once.
@@ -544,6 +576,24 @@ namespace NESocket
      **/
     AREG_API int sendData( SOCKETHANDLE hSocket, const unsigned char * dataBuffer, uint32_t dataLength, uint32_t blockMaxSize );
 
+    /**
+     * \brief   NESocket::sendDataVector
+     *          Sends the list of buffers to specified socket in the order they are listed,
+     *          by passing as many buffers as possible to the system in one gathering call.
+     *          The partially sent buffers are continued until all data is sent or sending fails.
+     *          The passed socket descriptor should be valid.
+     * \param   hSocket     The valid socket descriptor to send data.
+     * \param   buffers     The list of buffers to send.
+     * \param   count       The number of buffers in the list.
+     * \param   out_sent    If not nullptr, on output contains the number of buffers from the
+     *                      beginning of the list, which are completely sent. If sending fails,
+     *                      the buffer at this index is the first, which is not completely sent.
+     * \return  If succeeds, returns the total number of bytes sent.
+     *          If fails, returns negative number.
+     *          Returns zero if the buffers are empty and nothing to sent.
+     **/
+    AREG_API int sendDataVector( SOCKETHANDLE hSocket, const NESocket::sSendBuffer * buffers, uint32_t count, uint32_t * out_sent = nullptr );
+
     /**
      * \brief   NESocket::receiveData
      *          Receives data on specified socket. The passed socket descriptor should be valid.
@@ -561,6 +611,21 @@ namespace NESocket
      **/
     AREG_API int receiveData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, uint32_t dataLength, uint32_t blockMaxSize );
 
+    /**
+     * \brief   NESocket::receiveAvailableData
+     *          Receives on specified socket the data, which is available, but not more than
+     *          the length of the buffer. Unlike receiveData(), makes a single receive call,
+     *          which blocks only until any data is available.
+     *          The passed socket descriptor should be valid.
+     * \param   hSocket     The valid socket descriptor to receive data.
+     * \param   dataBuffer  The pointer to data buffer, which should be filled.
+     * \param   dataLength  The length of buffer in bytes.
+     * \return  If succeeds, returns number of bytes received.
+     *          If fails, returns negative number. Returns zero if the opposite
+     *          side closed connection or the buffer is empty.
+     **/
+    AREG_API int receiveAvailableData( SOCKETHANDLE hSocket, unsigned char * dataBuffer, uint32_t dataLength );
+
     /**
      * \brief   NESocket::disableSend
      *          Sets socket read-only, i.e. it will not be possible to send messages anymore.
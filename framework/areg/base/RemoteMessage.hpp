@@ -209,8 +209,11 @@ public:
      *          based on available information in the buffer and it will set value.
      *          It is strongly recommended to call method again if the buffer was changed
      *          or before transferring buffer to remote target.
+     * \param   checksum    If false, the checksum is not calculated and the existing value
+     *                      in the header is not changed. Set false only if the receiver of the
+     *                      message does not verify the checksum.
      **/
-    void bufferCompletionFix( void ) const;
+    void bufferCompletionFix( bool checksum = true ) const;
 
     /**
      * \brief   Initializes new buffer based on given Byte Buffer Header data.
@@ -223,6 +226,19 @@ public:
      **/
     unsigned char * initMessage( const NEMemory::sRemoteMessageHeader & rmHeader, unsigned int reserve = 0 );
 
+    /**
+     * \brief   Initializes the message to refer to the received message placed in the shared
+     *          block of memory, without allocating and copying the data. The message keeps
+     *          the block alive until the message buffer is released. The header of the message
+     *          in the block is updated to describe the buffer of exact received length.
+     *          The message should have not empty data and should start at the offset
+     *          aligned to the message header.
+     * \param   block       The shared block of memory, which contains the received message.
+     * \param   msgOffset   The offset in the block, where the message header starts.
+     * \return  Returns true if succeeded to initialize the message.
+     **/
+    bool initMessage( const std::shared_ptr<unsigned char> & block, unsigned int msgOffset );
+
     /**
      * \brief   Clones the message buffer with the data.
      * \param   source  The ID of the source to set. Ignored if 0
@@ -77,17 +77,27 @@ public:
     explicit RuntimeClassID( const char * className );
     explicit RuntimeClassID( const String& className );
 
+    /**
+     * \brief   Initialization constructor of the class ID of runtime class hierarchy.
+     *          Additionally to the name, registers the base classes, so that the check
+     *          whether the class is an instance of another class is done in constant time.
+     *          Used by the runtime macros, see IMPLEMENT_RUNTIME.
+     * \param   className   The name of Runtime Class ID
+     * \param   baseClassId The Runtime Class ID of the direct base class.
+     **/
+    RuntimeClassID( const char * className, const RuntimeClassID & baseClassId );
+
     /**
      * \brief   Copy constructor.
      * \param   src     The source to copy data.
      **/
-    RuntimeClassID( const RuntimeClassID & src );
+    RuntimeClassID( const RuntimeClassID & src ) = default;
 
     /**
      * \brief   Move constructor.
      * \param   src     The source to move data.
      **/
-    RuntimeClassID( RuntimeClassID && src ) noexcept;
+    RuntimeClassID( RuntimeClassID && src ) noexcept = default;
 
     /**
      * \brief   Destructor
@@ -145,14 +155,14 @@ public:
      * \param   src     The source of Runtime Class ID to copy.
      * \return  Returns Runtime Class ID object.
      **/
-    inline RuntimeClassID & operator = ( const RuntimeClassID & src );
+    RuntimeClassID & operator = ( const RuntimeClassID & src ) = default;
 
     /**
      * \brief   Move operator. Moves Runtime Class ID name from given Runtime Class ID source.
      * \param   src     The source of Runtime Class ID to move.
      * \return  Returns Runtime Class ID object.
      **/
-    inline RuntimeClassID & operator = ( RuntimeClassID && src ) noexcept;
+    RuntimeClassID & operator = ( RuntimeClassID && src ) noexcept = default;
 
     /**
      * \brief   Assigning operator. Copies Runtime Class ID name from given string buffer source
@@ -219,6 +229,23 @@ public:
      **/
     inline unsigned getMagic( void ) const;
 
+    /**
+     * \brief   Returns the dense index of the runtime class, unique in the process.
+     *          The indexes are assigned sequentially starting from 1, when the class ID
+     *          of the new name is created. The invalid class ID has index 0.
+     *          Used as an index in the flat tables, for example to lookup event consumers.
+     **/
+    inline unsigned int getClassIndex( void ) const;
+
+    /**
+     * \brief   Returns true if the runtime class of this Class ID is same as or derives from
+     *          the runtime class of the given Class ID. The check is done in constant time
+     *          if this Class ID is created with the base class, i.e. by the runtime macros.
+     *          Otherwise, the Class IDs are compared.
+     * \param   classId     The Runtime Class ID of the class to check.
+     **/
+    inline bool isDerivedFrom( const RuntimeClassID & classId ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -234,13 +261,30 @@ private:
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Runtime Class ID value.
+     * \brief   Runtime Class ID value. Points to the name of registered runtime class,
+     *          so that the Class ID is copied without copying the name.
      **/
-    String          mClassName;
+    const String *          mClassName;
     /**
      * \brief   The calculated number of runtime class.
      **/
-    unsigned int    mMagicNum;
+    unsigned int            mMagicNum;
+
+    /**
+     * \brief   The dense index of the runtime class.
+     **/
+    unsigned int            mClassIndex;
+
+    /**
+     * \brief   The bits of dense indexes of the class and all base classes.
+     *          It is nullptr if the Class ID is not created with the base class.
+     **/
+    const unsigned char *   mAncestors;
+
+    /**
+     * \brief   The number of bits in the ancestors bit-set.
+     **/
+    unsigned int            mAncestorCount;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -271,22 +315,6 @@ inline RuntimeClassID RuntimeClassID::createEmptyClassID( void )
     return RuntimeClassID();
 }
 
-inline RuntimeClassID & RuntimeClassID::operator = ( const RuntimeClassID & src )
-{
-    this->mClassName= src.mClassName;
-    this->mMagicNum = src.mMagicNum;
-
-    return (*this);
-}
-
-inline RuntimeClassID & RuntimeClassID::operator = ( RuntimeClassID && src ) noexcept
-{
-    this->mClassName= std::move(src.mClassName);
-    this->mMagicNum = src.mMagicNum;
-
-    return (*this);
-}
-
 inline RuntimeClassID & RuntimeClassID::operator = ( const char * src )
 {
     setName(src);
@@ -306,12 +334,12 @@ inline bool RuntimeClassID::operator == ( const RuntimeClassID & other ) const
 
 inline bool RuntimeClassID::operator == ( const char * other ) const
 {
-    return mClassName == other;
+    return (*mClassName == other);
 }
 
 inline bool RuntimeClassID::operator == (const String& other) const
 {
-    return mClassName == other;
+    return (*mClassName == other);
 }
 
 inline bool RuntimeClassID::operator != ( const RuntimeClassID  & other ) const
@@ -321,12 +349,12 @@ inline bool RuntimeClassID::operator != ( const RuntimeClassID  & other ) const
 
 inline bool RuntimeClassID::operator != ( const char* other ) const
 {
-    return mClassName != other;
+    return (*mClassName != other);
 }
 
 inline bool RuntimeClassID::operator != (const String & other) const
 {
-    return mClassName != other;
+    return (*mClassName != other);
 }
 
 inline RuntimeClassID::operator unsigned int ( void ) const
@@ -341,7 +369,7 @@ inline bool RuntimeClassID::isValid( void ) const
 
 inline const String & RuntimeClassID::getName( void ) const
 {
-    return mClassName;
+    return *mClassName;
 }
 
 inline unsigned RuntimeClassID::getMagic(void) const
@@ -349,24 +377,36 @@ inline unsigned RuntimeClassID::getMagic(void) const
     return mMagicNum;
 }
 
+inline unsigned int RuntimeClassID::getClassIndex( void ) const
+{
+    return mClassIndex;
+}
+
+inline bool RuntimeClassID::isDerivedFrom( const RuntimeClassID & classId ) const
+{
+    return (mAncestors != nullptr)
+        ? (classId.mClassIndex < mAncestorCount) && ((mAncestors[classId.mClassIndex >> 3u] & (1u << (classId.mClassIndex & 7u))) != 0u)
+        : (mMagicNum == classId.mMagicNum);
+}
+
 inline bool operator == ( const char * lhs, const RuntimeClassID & rhs )
 {
-    return rhs.mClassName   == lhs;
+    return (*rhs.mClassName == lhs);
 }
 
 inline bool operator == ( const String & lhs, const RuntimeClassID & rhs )
 {
-    return rhs.mClassName   == lhs;
+    return (*rhs.mClassName == lhs);
 }
 
 inline bool operator != ( const char* lhs, const RuntimeClassID & rhs )
 {
-    return rhs.mClassName != lhs;
+    return (*rhs.mClassName != lhs);
 }
 
 inline bool operator != ( const String & lhs, const RuntimeClassID & rhs )
 {
-    return rhs.mClassName != lhs;
+    return (*rhs.mClassName != lhs);
 }
 
 inline bool operator == ( unsigned int lhs, const RuntimeClassID & rhs )
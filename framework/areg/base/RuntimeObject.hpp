@@ -114,7 +114,7 @@ public:
 #define IMPLEMENT_RUNTIME(ClassName, BaseClassName)                                                             \
 /** Return class identifier object **/                                                                          \
 const RuntimeClassID & ClassName::_getClassId( void )                                                           \
-{   static const RuntimeClassID _classId(#ClassName); return _classId;                                      }   \
+{   static const RuntimeClassID _classId(#ClassName, BaseClassName::_getClassId()); return _classId;        }   \
 /** Return class identifier object **/                                                                          \
 const RuntimeClassID & ClassName::getRuntimeClassId( void ) const                                               \
 {   return ClassName::_getClassId();                                                                        }   \
@@ -126,7 +126,7 @@ unsigned int ClassName::getRuntimeClassNumber( void ) const
 {   return ClassName::_getClassId().getMagic();                                                             }   \
 /** Check class instance by Class Identifier **/                                                                \
 bool ClassName::isInstanceOfRuntimeClass( const RuntimeClassID & classId ) const                                \
-{   return ((ClassName::_getClassId() == classId) || BaseClassName::isInstanceOfRuntimeClass(classId));     }   \
+{   return ClassName::_getClassId().isDerivedFrom(classId);                                                 }   \
 /** Check class instance by name **/                                                                            \
 bool ClassName::isInstanceOfRuntimeClass( const char * className ) const                                        \
 {   return ((className == ClassName::_getClassId()) || BaseClassName::isInstanceOfRuntimeClass(className)); }   \
@@ -151,7 +151,7 @@ bool ClassName::isInstanceOfRuntimeClass( unsigned int classMagic ) const
 #define IMPLEMENT_RUNTIME_TEMPLATE(Template, ClassName, BaseClassName, ClassIdType)                             \
 /** Return class identifier object **/                                                                          \
 Template const RuntimeClassID & ClassName::_getClassId( void )                                                  \
-{   static const RuntimeClassID _classId(#ClassName); return _classId;                                      }   \
+{   static const RuntimeClassID _classId(#ClassName, BaseClassName::_getClassId()); return _classId;        }   \
 /** Return class identifier object **/                                                                          \
 Template const RuntimeClassID& ClassName::getRuntimeClassId( void ) const                                       \
 {   return ClassName::_getClassId();                                                                        }   \
@@ -163,7 +163,7 @@ Template unsigned int ClassName::getRuntimeClassNumber( void ) const
 {   return ClassName::_getClassId().getMagic();                                                             }   \
 /** Check class instance by Class Identifier **/                                                                \
 Template bool ClassName::isInstanceOfRuntimeClass( const RuntimeClassID & classId ) const                       \
-{   return ((ClassName::_getClassId() == classId) || BaseClassName::isInstanceOfRuntimeClass(classId));     }   \
+{   return ClassName::_getClassId().isDerivedFrom(classId);                                                 }   \
 /** Check class instance by name**/                                                                             \
 Template bool ClassName::isInstanceOfRuntimeClass( const char * className ) const                               \
 {   return ((className == ClassName::_getClassId()) || BaseClassName::isInstanceOfRuntimeClass(className)); }   \
@@ -158,6 +158,21 @@ public:
      **/
     virtual int sendData( const unsigned char * buffer, int length ) const;
 
+    /**
+     * \brief   If socket is valid, sends the list of buffers using existing socket connection
+     *          in one gathering call and returns the total number of sent bytes.
+     *          Returns negative number if either socket is invalid, or failed to send data to remote host.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   buffers The list of buffers to send to remote target.
+     * \param   count       The number of buffers in the list.
+     * \param   out_sent    If not nullptr, on output contains the number of buffers from the
+     *                      beginning of the list, which are completely sent.
+     * \return  Returns number of bytes sent to remote target.
+     *          Returns negative number if socket is not valid of failed to send.
+     **/
+    int sendDataVector( const NESocket::sSendBuffer * buffers, uint32_t count, uint32_t * out_sent = nullptr ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns
      *          number of received bytes in buffer, which is equal to specified length parameter.
@@ -171,6 +186,18 @@ public:
      **/
     virtual int receiveData( unsigned char * buffer, int length ) const;
 
+    /**
+     * \brief   If socket is valid, receives the data, which is available, but not more than
+     *          the specified length, by the single receive call. The call is blocking until
+     *          any data is available.
+     * \param   buffer  The buffer to fill received data from remote target.
+     * \param   length  The length in bytes of allocated space in buffer.
+     * \return  Returns number of bytes received from remote target.
+     *          Returns zero if the remote target closed connection.
+     *          Returns negative number if socket is not valid of failed to receive data.
+     **/
+    int receiveAvailableData( unsigned char * buffer, int length ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Attributes and operations
 //////////////////////////////////////////////////////////////////////////
@@ -363,7 +390,7 @@ inline bool Socket::isAlive(void) const
 
 inline int Socket::pendingRead(void) const
 {
-    return (mSocket.get() != nullptr) && NESocket::pendingRead(*mSocket);
+    return (mSocket.get() != nullptr ? static_cast<int>(NESocket::pendingRead(*mSocket)) : -1);
 }
 
 inline bool Socket::disableSend( void ) const
@@ -0,0 +1,236 @@
+#ifndef AREG_BASE_SOCKETPOLLER_HPP
+#define AREG_BASE_SOCKETPOLLER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/SocketPoller.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the poller of socket read events.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NECommon.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class declaration.
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The socket poller waits for read events of many sockets at once.
+ *          On Linux it is the edge triggered epoll, where the cost of waiting
+ *          does not depend on the number of registered sockets, and the
+ *          event of socket is reported only once when new data arrives.
+ *          So that the socket is reported again only if new data is received,
+ *          the caller should read all available data or remember the socket
+ *          to read it later. On other platforms it falls back to select(),
+ *          which is limited by FD_SETSIZE sockets.
+ *          The sockets can be registered and unregistered by any thread,
+ *          the events should be waited by one thread.
+ **/
+class AREG_API SocketPoller
+{
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   SocketPoller::sSocketEvent
+     *          The read event of the socket.
+     **/
+    struct sSocketEvent
+    {
+        //!< The socket, which has data to read.
+        SOCKETHANDLE    seSocket;
+        //!< Flag, indicating that the remote side closed the connection or the socket failed.
+        //!< The data, which is still in the socket, can be read.
+        bool            seClosed;
+    };
+
+    /**
+     * \brief   SocketPoller::MAX_EVENTS
+     *          The maximum number of events to wait at once.
+     **/
+    static constexpr int    MAX_EVENTS  { 256 };
+
+    /**
+     * \brief   SocketPoller::IDLE_TIMEOUT
+     *          The timeout in milliseconds to wait when there are no sockets to select.
+     *          Used on the platforms without epoll.
+     **/
+    static constexpr unsigned int   IDLE_TIMEOUT    { 100 };
+
+private:
+    /**
+     * \brief   The list of registered sockets to select.
+     **/
+    using ListSockets   = TEArrayList<SOCKETHANDLE>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates the invalid poller. Call create() to initialize.
+     **/
+    SocketPoller( void );
+
+    /**
+     * \brief   Releases the resources.
+     **/
+    ~SocketPoller( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns true if the poller is created and can wait for events.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Creates the poller. If the poller is valid, releases and creates again.
+     * \return  Returns true if succeeded to create the poller.
+     **/
+    bool create( void );
+
+    /**
+     * \brief   Releases the poller and unregisters all sockets.
+     *          Should not be called while other thread waits for events.
+     **/
+    void release( void );
+
+    /**
+     * \brief   Registers the socket to wait for read events.
+     * \param   hSocket     The valid socket to register.
+     * \return  Returns true if succeeded to register the socket.
+     **/
+    bool addSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Unregisters the socket. Should be called before the socket is closed.
+     * \param   hSocket     The socket to unregister.
+     **/
+    void removeSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   Wakes up the thread waiting for events. The waiting call returns zero.
+     *          On platforms without epoll, closing the socket wakes up the waiting thread.
+     **/
+    void wakeUp( void );
+
+    /**
+     * \brief   Waits for read events of registered sockets.
+     * \param   out_events  The list to store the events.
+     * \param   maxEvents   The maximum number of events to store in the list.
+     * \param   timeout     The timeout in milliseconds to wait for events.
+     * \return  Returns the number of events stored in the list. Returns zero if the
+     *          timeout expired or the waiting thread was woken up, and negative
+     *          number if the poller is not valid or failed to wait. On the platforms
+     *          without epoll, if there are no registered sockets, returns zero
+     *          after waiting at most IDLE_TIMEOUT milliseconds.
+     **/
+    int waitEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout = NECommon::WAIT_INFINITE );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   OS specific implementation to create the poller.
+     **/
+    bool _osCreate( void );
+
+    /**
+     * \brief   OS specific implementation to release the poller.
+     **/
+    void _osRelease( void );
+
+    /**
+     * \brief   OS specific implementation to register the socket.
+     **/
+    bool _osAddSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   OS specific implementation to unregister the socket.
+     **/
+    void _osRemoveSocket( SOCKETHANDLE hSocket );
+
+    /**
+     * \brief   OS specific implementation to wake up the waiting thread.
+     **/
+    void _osWakeUp( void );
+
+    /**
+     * \brief   OS specific implementation to wait for events.
+     **/
+    int _osWaitEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout );
+
+    /**
+     * \brief   Waits for events of registered sockets by select(). Used on the platforms without epoll.
+     **/
+    int _selectEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Flag, indicating whether the poller is created.
+     **/
+    bool                    mIsValid;
+
+    /**
+     * \brief   The descriptor of epoll. Used only on Linux.
+     **/
+    int                     mPollHandle;
+
+    /**
+     * \brief   The descriptor of event to wake up waiting thread. Used only on Linux.
+     **/
+    int                     mWakeHandle;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The list of registered sockets. Used on platforms without epoll.
+     **/
+    ListSockets             mSockets;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   Synchronization object to access the list of sockets.
+     **/
+    mutable ResourceLock    mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( SocketPoller );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// SocketPoller class inline functions
+//////////////////////////////////////////////////////////////////////////
+
+inline bool SocketPoller::isValid( void ) const
+{
+    return mIsValid;
+}
+
+#endif  // AREG_BASE_SOCKETPOLLER_HPP
@@ -31,6 +31,7 @@
 #include "areg/base/TEResourceMap.hpp"
 #include "areg/base/String.hpp"
 
+#include <atomic>
 #include <string_view>
 
 /************************************************************************
@@ -394,6 +395,13 @@ public:
      **/
     static const ThreadAddress & getThreadAddress( id_type threadId );
 
+    /**
+     * \brief   Returns the number of threads unregistered since the process start.
+     *          The IDs of threads may be reused by new threads, so that the information
+     *          cached by thread ID is valid as long as this number is not changed.
+     **/
+    static uint32_t getUnregisteredCount( void );
+
     /**
      * \brief   Returns the stack size of the current thread in bytes.
      **/
@@ -688,6 +696,11 @@ private:
      **/
     static  Thread::MapThreadIDResource & _getMapThreadId();
 
+    /**
+     * \brief   Returns static counter of unregistered threads.
+     **/
+    static  std::atomic<uint32_t> & _getUnregisteredCount();
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/BufferPool.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pool of byte buffers cached in every thread.
+ *
+ ************************************************************************/
+#include "areg/base/BufferPool.hpp"
+
+#include "areg/base/private/TEBlockPool.hpp"
+
+namespace
+{
+    /**
+     * \brief   The size classes of the buffers, which are powers of two.
+     **/
+    struct BufferSizeClass
+    {
+        //!< The power of two of the smallest size class.
+        static constexpr uint32_t   MIN_SHIFT   { 7u };
+
+        //!< The number of size classes.
+        static constexpr uint32_t   COUNT       { 14u };
+
+        static inline uint32_t getClass( size_t size )
+        {
+            uint32_t result{ 0u };
+            if ( size > BufferPool::MAX_BLOCK_SIZE )
+            {
+                result = COUNT;
+            }
+            else
+            {
+                while ( (static_cast<size_t>(BufferPool::MIN_BLOCK_SIZE) << result) < size )
+                {
+                    ++ result;
+                }
+            }
+
+            return result;
+        }
+
+        static inline size_t getSize( uint32_t sizeClass )
+        {
+            return (static_cast<size_t>(1u) << (sizeClass + MIN_SHIFT));
+        }
+
+        static inline uint32_t getMaxCached( uint32_t sizeClass )
+        {
+            const size_t count{ static_cast<size_t>(BufferPool::MAX_CACHED_SIZE) / getSize( sizeClass ) };
+            return static_cast<uint32_t>(MACRO_MAX( MACRO_MIN( count, static_cast<size_t>(BufferPool::MAX_CACHED_BLOCKS) ), static_cast<size_t>(1u) ));
+        }
+    };
+
+    static_assert((static_cast<size_t>(1u) << BufferSizeClass::MIN_SHIFT) == BufferPool::MIN_BLOCK_SIZE, "Invalid smallest size class of buffers");
+    static_assert((static_cast<size_t>(BufferPool::MIN_BLOCK_SIZE) << (BufferSizeClass::COUNT - 1u)) == BufferPool::MAX_BLOCK_SIZE, "Invalid largest size class of buffers");
+
+    //!< The pool of byte buffers.
+    using BytePool  = TEBlockPool<BufferSizeClass>;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// BufferPool class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void * BufferPool::allocate( size_t size )
+{
+    return BytePool::allocate( size );
+}
+
+void BufferPool::release( void * ptr )
+{
+    BytePool::release( ptr );
+}
+
+size_t BufferPool::getCapacity( size_t size )
+{
+    return BytePool::getCapacity( size );
+}
+
+void BufferPool::setPoolEnabled( bool enable )
+{
+    BytePool::setEnabled( enable );
+}
+
+bool BufferPool::isPoolEnabled( void )
+{
+    return BytePool::isEnabled( );
+}
+
+NEMemory::sPoolStatistics BufferPool::getStatistics( void )
+{
+    return BytePool::getStatistics( );
+}
@@ -15,9 +15,72 @@
  ************************************************************************/
 #include "areg/base/IEByteBuffer.hpp"
 
+#include "areg/base/BufferPool.hpp"
+
+#include <cstddef>
 #include <utility>
 #include <string.h>
 
+namespace
+{
+    /**
+     * \brief   The allocator of the shared pointer of byte buffer. Allocates the control
+     *          block of the shared pointer and the byte buffer in one memory block of the
+     *          BufferPool, the byte buffer is placed after the control block.
+     **/
+    template<typename Type>
+    struct SharedBlockAllocator
+    {
+        using value_type = Type;
+
+        SharedBlockAllocator( unsigned int bufSize, unsigned char ** buffer, unsigned int * capacity )
+            : sbBufSize     ( bufSize )
+            , sbBuffer      ( buffer )
+            , sbCapacity    ( capacity )
+        {
+        }
+
+        template<typename Other>
+        SharedBlockAllocator( const SharedBlockAllocator<Other> & src )
+            : sbBufSize     ( src.sbBufSize )
+            , sbBuffer      ( src.sbBuffer )
+            , sbCapacity    ( src.sbCapacity )
+        {
+        }
+
+        Type * allocate( std::size_t count )
+        {
+            const std::size_t ctrlSize{ MACRO_ALIGN_SIZE( count * sizeof( Type ), alignof(std::max_align_t) ) };
+            const std::size_t blockSize{ ctrlSize + sbBufSize };
+            unsigned char * block{ static_cast<unsigned char *>(BufferPool::allocate( blockSize )) };
+            *sbBuffer   = block + ctrlSize;
+            *sbCapacity = static_cast<unsigned int>(BufferPool::getCapacity( blockSize ) - ctrlSize);
+            return reinterpret_cast<Type *>(block);
+        }
+
+        void deallocate( Type * ptr, std::size_t /*count*/ )
+        {
+            BufferPool::release( static_cast<void *>(ptr) );
+        }
+
+        unsigned int    sbBufSize;  //!< The size of the byte buffer to allocate after the control block.
+        unsigned char** sbBuffer;   //!< On output, the pointer to the allocated byte buffer.
+        unsigned int *  sbCapacity; //!< On output, the size of the allocated byte buffer.
+    };
+
+    template<typename Type, typename Other>
+    inline bool operator == ( const SharedBlockAllocator<Type> & /*lhs*/, const SharedBlockAllocator<Other> & /*rhs*/ )
+    {
+        return true;
+    }
+
+    template<typename Type, typename Other>
+    inline bool operator != ( const SharedBlockAllocator<Type> & /*lhs*/, const SharedBlockAllocator<Other> & /*rhs*/ )
+    {
+        return false;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // IEByteBuffer class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -63,18 +126,23 @@ unsigned int IEByteBuffer::reserve(unsigned int size, bool copy)
             {
                 unsigned int sizeAlign{ getAlignedSize() };
                 unsigned int sizeBuffer{ getHeaderSize() + size };
+                unsigned int sizeMax{ MACRO_ALIGN_SIZE(getHeaderSize() + IEByteBuffer::MAX_BUF_LENGTH, sizeAlign) };
 
                 sizeBuffer = MACRO_ALIGN_SIZE(sizeBuffer, sizeAlign);
-                unsigned char* buffer = DEBUG_NEW unsigned char[sizeBuffer];
-                int copied = static_cast<int>(initBuffer(buffer, sizeBuffer, copy));
-                if (static_cast<unsigned int>(copied) != IECursorPosition::INVALID_CURSOR_POSITION)
+                if (copy && isValid())
                 {
-                    NEMemory::sByteBuffer * temp = reinterpret_cast<NEMemory::sByteBuffer *>(buffer);
-                    mByteBuffer = std::shared_ptr<NEMemory::sByteBuffer>(temp, ByteBufferDeleter());
+                    // The data is appended, grow geometrically to avoid reallocation and copying on every write.
+                    unsigned int sizeGrow{ mByteBuffer->bufHeader.biBufSize + mByteBuffer->bufHeader.biBufSize / 2 };
+                    sizeBuffer = MACRO_MAX(sizeBuffer, MACRO_MIN(sizeGrow, sizeMax));
                 }
-                else
+
+                unsigned int capacity{ 0 };
+                std::shared_ptr<NEMemory::sByteBuffer> buffer{ IEByteBuffer::createBuffer(sizeBuffer, capacity) };
+                capacity = MACRO_MIN(capacity, sizeMax);
+                int copied = static_cast<int>(initBuffer(reinterpret_cast<unsigned char *>(buffer.get()), capacity, copy));
+                if (static_cast<unsigned int>(copied) != IECursorPosition::INVALID_CURSOR_POSITION)
                 {
-                    delete[] buffer;
+                    mByteBuffer = std::move(buffer);
                 }
             }
         }
@@ -127,3 +195,10 @@ unsigned int IEByteBuffer::getAlignedSize(void) const
 {
     return NEMemory::BLOCK_SIZE;
 }
+
+std::shared_ptr<NEMemory::sByteBuffer> IEByteBuffer::createBuffer(unsigned int size, unsigned int & OUT capacity)
+{
+    unsigned char * buffer{ nullptr };
+    std::shared_ptr<unsigned char> block{ std::allocate_shared<unsigned char>(SharedBlockAllocator<unsigned char>(size, &buffer, &capacity)) };
+    return std::shared_ptr<NEMemory::sByteBuffer>(std::move(block), reinterpret_cast<NEMemory::sByteBuffer *>(buffer));
+}
@@ -17,6 +17,17 @@
 
 #include "areg/base/NEMath.hpp"
 #include <math.h>
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    #define _CRC32_PCLMUL
+    #define _CRC32_PCLMUL_TARGET    __attribute__((target("pclmul,sse4.1")))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define _CRC32_PCLMUL
+    #define _CRC32_PCLMUL_TARGET
+#endif
 
 namespace
 {
@@ -154,14 +165,226 @@ namespace
         0x37, 0xBE, 0x0B, 0xB4, 0xA1, 0x8E, 0x0C, 0xC3,
         0x1B, 0xDF, 0x05, 0x5A, 0x8D, 0xEF, 0x02, 0x2D,
     };
+
+    /**
+     * \brief   The reflected polynomial of the IEEE 802.3 32-bit CRC.
+     **/
+    constexpr uint32_t  _crc32Polynomial{ 0xEDB88320u };
+
+    /**
+     * \brief   The lookup tables to calculate 32-bit CRC by slicing-by-8 algorithm.
+     *          The first table is the byte-wise lookup table, each next table
+     *          contains the CRC of the byte followed by one more zero byte.
+     **/
+    struct sCrc32SliceTables
+    {
+        uint32_t    sliceTable[8][256];
+    };
+
+    constexpr sCrc32SliceTables _createSliceTables( void )
+    {
+        sCrc32SliceTables result{ };
+        for ( uint32_t i = 0; i < 256u; ++ i )
+        {
+            uint32_t crc{ i };
+            for ( int bit = 0; bit < 8; ++ bit )
+            {
+                crc = (crc & 1u) != 0 ? (crc >> 1) ^ _crc32Polynomial : (crc >> 1);
+            }
+
+            result.sliceTable[0][i] = crc;
+        }
+
+        for ( uint32_t i = 0; i < 256u; ++ i )
+        {
+            for ( int slice = 1; slice < 8; ++ slice )
+            {
+                const uint32_t crc{ result.sliceTable[slice - 1][i] };
+                result.sliceTable[slice][i] = (crc >> 8) ^ result.sliceTable[0][crc & 0xFFu];
+            }
+        }
+
+        return result;
+    }
+
+    constexpr sCrc32SliceTables _crc32SliceTables{ _createSliceTables( ) };
+
+    /**
+     * \brief   Updates the CRC value by slicing-by-8 algorithm, which processes 8 bytes per step.
+     * \param   crc     The current CRC value.
+     * \param   data    The data to calculate CRC.
+     * \param   size    The size in bytes of the data.
+     * \return  Returns the updated CRC value.
+     **/
+    inline uint32_t _crc32SliceBy8( uint32_t crc, const unsigned char * data, uint32_t size )
+    {
+        const uint32_t (&table)[8][256] = _crc32SliceTables.sliceTable;
+
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        for ( ; size >= 8u; size -= 8u, data += 8u )
+        {
+            uint32_t low{ 0 };
+            uint32_t high{ 0 };
+            ::memcpy( &low , data     , sizeof( uint32_t ) );
+            ::memcpy( &high, data + 4u, sizeof( uint32_t ) );
+            low ^= crc;
+
+            crc = table[7][ low         & 0xFFu] ^ table[6][(low  >>  8) & 0xFFu] ^
+                  table[5][(low  >> 16) & 0xFFu] ^ table[4][ low  >> 24        ] ^
+                  table[3][ high        & 0xFFu] ^ table[2][(high >>  8) & 0xFFu] ^
+                  table[1][(high >> 16) & 0xFFu] ^ table[0][ high >> 24        ];
+        }
+#endif  // !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+
+        for ( ; size != 0u; -- size, ++ data )
+        {
+            crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xFFu];
+        }
+
+        return crc;
+    }
+
+#if defined(_CRC32_PCLMUL)
+
+    /**
+     * \brief   Returns true if the CPU supports carry-less multiplication and SSE 4.1 instructions.
+     **/
+    bool _crc32HasPclmul( void )
+    {
+    #if defined(_MSC_VER)
+        int cpuInfo[4]{ 0, 0, 0, 0 };
+        __cpuid( cpuInfo, 1 );
+        // ECX bit 1 is PCLMULQDQ, ECX bit 19 is SSE 4.1
+        return ((cpuInfo[2] & (1 << 1)) != 0) && ((cpuInfo[2] & (1 << 19)) != 0);
+    #else   // !defined(_MSC_VER)
+        __builtin_cpu_init( );
+        return (__builtin_cpu_supports( "pclmul" ) != 0) && (__builtin_cpu_supports( "sse4.1" ) != 0);
+    #endif  // defined(_MSC_VER)
+    }
+
+    /**
+     * \brief   The flag, indicating whether the CRC is calculated by carry-less multiplication.
+     **/
+    const bool _crc32Pclmul{ _crc32HasPclmul( ) };
+
+    /**
+     * \brief   Updates the CRC value by folding 64 bytes per step with carry-less multiplication,
+     *          as described in the Intel paper "Fast CRC Computation for Generic Polynomials
+     *          Using PCLMULQDQ Instruction". The size of data should be at least 64 bytes
+     *          and multiple of 16 bytes.
+     * \param   crc     The current CRC value.
+     * \param   data    The data to calculate CRC.
+     * \param   size    The size in bytes of the data, at least 64 and multiple of 16.
+     * \return  Returns the updated CRC value.
+     **/
+    _CRC32_PCLMUL_TARGET uint32_t _crc32Pclmul64( uint32_t crc, const unsigned char * data, uint32_t size )
+    {
+        // The constants of the reflected 32-bit CRC polynomial to fold and reduce.
+        const __m128i k1k2 = _mm_set_epi64x( 0x01c6e41596, 0x0154442bd4 );
+        const __m128i k3k4 = _mm_set_epi64x( 0x00ccaa009e, 0x01751997d0 );
+        const __m128i k5k0 = _mm_set_epi64x( 0x0000000000, 0x0163cd6124 );
+        const __m128i poly = _mm_set_epi64x( 0x01f7011641, 0x01db710641 );
+        const __m128i mask = _mm_setr_epi32( ~0, 0, ~0, 0 );
+
+        __m128i x1 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x00) );
+        __m128i x2 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x10) );
+        __m128i x3 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x20) );
+        __m128i x4 = _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x30) );
+        __m128i x5;
+        x1 = _mm_xor_si128( x1, _mm_cvtsi32_si128( static_cast<int>(crc) ) );
+
+        data += 64u;
+        size -= 64u;
+
+        // fold 4 blocks of 16 bytes in parallel.
+        for ( ; size >= 64u; size -= 64u, data += 64u )
+        {
+            __m128i x6 = _mm_clmulepi64_si128( x2, k1k2, 0x00 );
+            __m128i x7 = _mm_clmulepi64_si128( x3, k1k2, 0x00 );
+            __m128i x8 = _mm_clmulepi64_si128( x4, k1k2, 0x00 );
+            x5 = _mm_clmulepi64_si128( x1, k1k2, 0x00 );
+
+            x1 = _mm_clmulepi64_si128( x1, k1k2, 0x11 );
+            x2 = _mm_clmulepi64_si128( x2, k1k2, 0x11 );
+            x3 = _mm_clmulepi64_si128( x3, k1k2, 0x11 );
+            x4 = _mm_clmulepi64_si128( x4, k1k2, 0x11 );
+
+            x1 = _mm_xor_si128( _mm_xor_si128( x1, x5 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x00) ) );
+            x2 = _mm_xor_si128( _mm_xor_si128( x2, x6 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x10) ) );
+            x3 = _mm_xor_si128( _mm_xor_si128( x3, x7 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x20) ) );
+            x4 = _mm_xor_si128( _mm_xor_si128( x4, x8 ), _mm_loadu_si128( reinterpret_cast<const __m128i *>(data + 0x30) ) );
+        }
+
+        // fold 4 blocks into one.
+        x5 = _mm_clmulepi64_si128( x1, k3k4, 0x00 );
+        x1 = _mm_clmulepi64_si128( x1, k3k4, 0x11 );
+        x1 = _mm_xor_si128( _mm_xor_si128( x1, x2 ), x5 );
+
+        x5 = _mm_clmulepi64_si128( x1, k3k4, 0x00 );
+        x1 = _mm_clmulepi64_si128( x1, k3k4, 0x11 );
+        x1 = _mm_xor_si128( _mm_xor_si128( x1, x3 ), x5 );
+
+        x5 = _mm_clmulepi64_si128( x1, k3k4, 0x00 );
+        x1 = _mm_clmulepi64_si128( x1, k3k4, 0x11 );
+        x1 = _mm_xor_si128( _mm_xor_si128( x1, x4 ), x5 );
+
+        // fold the remaining blocks of 16 bytes.
+        for ( ; size >= 16u; size -= 16u, data += 16u )
+        {
+            x5 = _mm_clmulepi64_si128( x1, k3k4, 0x00 );
+            x1 = _mm_clmulepi64_si128( x1, k3k4, 0x11 );
+            x1 = _mm_xor_si128( _mm_xor_si128( x1, _mm_loadu_si128( reinterpret_cast<const __m128i *>(data) ) ), x5 );
+        }
+
+        // fold 128 bits to 64 bits.
+        x2 = _mm_clmulepi64_si128( x1, k3k4, 0x10 );
+        x1 = _mm_xor_si128( _mm_srli_si128( x1, 8 ), x2 );
+
+        x2 = _mm_srli_si128( x1, 4 );
+        x1 = _mm_and_si128( x1, mask );
+        x1 = _mm_clmulepi64_si128( x1, k5k0, 0x00 );
+        x1 = _mm_xor_si128( x1, x2 );
+
+        // Barrett reduction to 32 bits.
+        x2 = _mm_and_si128( x1, mask );
+        x2 = _mm_clmulepi64_si128( x2, poly, 0x10 );
+        x2 = _mm_and_si128( x2, mask );
+        x2 = _mm_clmulepi64_si128( x2, poly, 0x00 );
+        x1 = _mm_xor_si128( x1, x2 );
+
+        return static_cast<uint32_t>(_mm_extract_epi32( x1, 1 ));
+    }
+
+#endif  // defined(_CRC32_PCLMUL)
+
+    /**
+     * \brief   Updates the CRC value of the binary data. If the CPU supports carry-less multiplication,
+     *          the blocks of 16 bytes are folded by hardware, the rest is calculated by slicing-by-8.
+     **/
+    inline uint32_t _crc32Update( uint32_t crc, const unsigned char * data, uint32_t size )
+    {
+#if defined(_CRC32_PCLMUL)
+        if ( _crc32Pclmul && (size >= 64u) )
+        {
+            const uint32_t blocks{ size & ~static_cast<uint32_t>(15u) };
+            crc = _crc32Pclmul64( crc, data, blocks );
+            data += blocks;
+            size -= blocks;
+        }
+#endif  // defined(_CRC32_PCLMUL)
+
+        return _crc32SliceBy8( crc, data, size );
+    }
 }
 
 AREG_API_IMPL unsigned int NEMath::crc32Calculate( const unsigned char* data, int size )
 {
     unsigned int result = static_cast<unsigned int>(~0);   // initialize
-    const unsigned int* crc32Tab = reinterpret_cast<const unsigned int *>(::_crc32LookupTable);   // get converted lookup table
-    for ( int count = size ; count != 0; -- count, ++ data )
-        result = (result >> 8) ^ crc32Tab[*data ^ static_cast<unsigned char>(result & 0x000000FF)];  // calculate
+    if ( (data != nullptr) && (size > 0) )
+    {
+        result = ::_crc32Update( result, data, static_cast<uint32_t>(size) );
+    }
+
     return (~result);   // return result
 }
 
@@ -212,34 +435,21 @@ AREG_API_IMPL unsigned int NEMath::crc32Start( unsigned int crcInit, const unsig
     unsigned int result = crcInit;
     if ( data != nullptr && size > 0)
     {
-        const unsigned int* crc32Table = reinterpret_cast<const unsigned int *>(::_crc32LookupTable);  // get converted lookup table
-        for ( ; size > 0; -- size, ++ data )
-        {
-            result  = (result >> 8) ^ crc32Table[ *data ^ static_cast<unsigned char>(result & 0x000000FF)];
-            /************************************************************************
-             * This calculation is similar as following algorithm:
-             ************************************************************************/
-            /************************************************************************
-             *  unsigned char tmpCRC32[4];
-             *  unsigned char* crc32 = reinterpret_cast<unsigned char *>(&result);
-             *  for(int i = 0; i < size; i++)
-             *  {
-             *      tmpCRC32[0] = crc32[0];
-             *      tmpCRC32[1] = crc32[1];
-             *      tmpCRC32[2] = crc32[2];
-             *      tmpCRC32[3] = crc32[3];
-             *
-             *      crc32[3]   =               ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 3];
-             *      crc32[2]   = tmpCRC32[3] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 2];
-             *      crc32[1]   = tmpCRC32[2] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 1];
-             *      crc32[0]   = tmpCRC32[1] ^ ::_crc32LookupTable[ ((data[i] ^ tmpCRC32[0]) * 4) + 0];
-             *  }
-             ************************************************************************/
-        }
+        result = ::_crc32Update( result, data, static_cast<uint32_t>(size) );
     }
+
     return result;
 }
 
+AREG_API_IMPL bool NEMath::crc32IsAccelerated( void )
+{
+#if defined(_CRC32_PCLMUL)
+    return ::_crc32Pclmul;
+#else   // defined(_CRC32_PCLMUL)
+    return false;
+#endif  // defined(_CRC32_PCLMUL)
+}
+
 AREG_API_IMPL unsigned int NEMath::crc32Start(unsigned int crcInit, const char * data)
 {
     unsigned int result = crcInit;
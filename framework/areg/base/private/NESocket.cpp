@@ -29,6 +29,7 @@
     #include <ctype.h>      // IEEE Std 1003.1-2001
     #include <netinet/in.h>
     #include <netdb.h>
+    #include <poll.h>
     #include <sys/socket.h>
     #include <sys/ioctl.h>
     #include <sys/select.h>
@@ -65,6 +66,14 @@ namespace NESocket
      */
     int _osSendData(SOCKETHANDLE hSocket, const unsigned char* dataBuffer, int dataLength, int blockMaxSize);
 
+    /**
+     * \brief   OS specific implementation to send the list of buffers by gathering call.
+     *          All checkups and validations should be done before calling the method.
+     * \param   out_sent    On output contains the number of buffers, which are completely sent.
+     * \return  Returns number of bytes sent via network.
+     */
+    int _osSendDataVector(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, uint32_t count, uint32_t & out_sent);
+
     /**
      * \brief   OS specific receive data implementation. All checkups and validations should
      *          be done before calling the method.
@@ -706,6 +715,46 @@ AREG_API_IMPL SOCKETHANDLE NESocket::serverAcceptConnection(SOCKETHANDLE serverS
     return result;
 }
 
+AREG_API_IMPL SOCKETHANDLE NESocket::serverAcceptPending(SOCKETHANDLE serverSocket, NESocket::SocketAddress * out_socketAddr /*= nullptr*/)
+{
+    SOCKETHANDLE result = NESocket::InvalidSocketHandle;
+    if (out_socketAddr != nullptr)
+    {
+        out_socketAddr->resetAddress();
+    }
+
+    if (isSocketHandleValid(serverSocket) == false)
+    {
+        return result;
+    }
+
+    // check whether there is a pending connection without waiting, so that the accept does not block.
+#ifdef  _WIN32
+    fd_set readList { };
+    FD_ZERO(&readList);
+    FD_SET(serverSocket, &readList);
+    timeval noWait{ 0, 0 };
+    bool isPending = (::select(0, &readList, nullptr, nullptr, &noWait) > 0);
+#else   // !_WIN32
+    struct pollfd pending { serverSocket, POLLIN, 0 };
+    bool isPending = (::poll(&pending, 1, 0) > 0) && ((pending.revents & POLLIN) != 0);
+#endif  // !_WIN32
+
+    if (isPending)
+    {
+        struct sockaddr_in acceptAddr;
+        NEMemory::memZero(&acceptAddr, sizeof(sockaddr_in));
+        socklen_t len = sizeof(sockaddr_in);
+        result = ::accept(serverSocket, reinterpret_cast<sockaddr *>(&acceptAddr), &len);
+        if ((result != NESocket::InvalidSocketHandle) && (out_socketAddr != nullptr))
+        {
+            out_socketAddr->setAddress(acceptAddr);
+        }
+    }
+
+    return result;
+}
+
 AREG_API_IMPL bool NESocket::isSocketAlive(SOCKETHANDLE hSocket)
 {
     unsigned long error = 0;
@@ -751,6 +800,27 @@ AREG_API_IMPL int NESocket::sendData(SOCKETHANDLE hSocket, const unsigned char*
     return result;
 }
 
+AREG_API_IMPL int NESocket::sendDataVector(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, uint32_t count, uint32_t* out_sent /*= nullptr*/)
+{
+    int result = -1;
+    uint32_t sent{ 0 };
+    if (isSocketHandleValid(hSocket))
+    {
+        result = 0;
+        if ((buffers != nullptr) && (count != 0))
+        {
+            result = _osSendDataVector(hSocket, buffers, count, sent);
+        }
+    }
+
+    if (out_sent != nullptr)
+    {
+        *out_sent = sent;
+    }
+
+    return result;
+}
+
 AREG_API_IMPL int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, uint32_t dataLength, uint32_t blockMaxSize )
 {
     int result = -1;
@@ -767,6 +837,23 @@ AREG_API_IMPL int NESocket::receiveData(SOCKETHANDLE hSocket, unsigned char* dat
     return result;
 }
 
+AREG_API_IMPL int NESocket::receiveAvailableData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, uint32_t dataLength)
+{
+    int result = -1;
+
+    if (isSocketHandleValid(hSocket))
+    {
+        result = 0;
+        if ((dataBuffer != nullptr) && (static_cast<int32_t>(dataLength) > 0))
+        {
+            result = static_cast<int>(::recv(hSocket, reinterpret_cast<char*>(dataBuffer), static_cast<int>(dataLength), 0));
+            result = result >= 0 ? result : -1;
+        }
+    }
+
+    return result;
+}
+
 AREG_API_IMPL bool NESocket::disableSend(SOCKETHANDLE hSocket)
 {
 #ifdef _WIN32
@@ -24,6 +24,24 @@
 
 #include <string.h>
 #include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    /**
+     * \brief   The deleter of the message, which refers to the block of received data.
+     *          Releases the block when the message buffer is released.
+     **/
+    struct BlockReleaser
+    {
+        std::shared_ptr<unsigned char> mBlock;
+
+        inline void operator ( ) ( NEMemory::sByteBuffer * /*buffer*/ )
+        {
+            mBlock.reset( );
+        }
+    };
+}
 
 inline unsigned int RemoteMessage::_checksumCalculate( const NEMemory::sRemoteMessage & remoteMessage )
 {
@@ -104,14 +122,14 @@ bool RemoteMessage::isChecksumValid(void) const
     return isValid() ? getChecksum() == RemoteMessage::_checksumCalculate( _getRemoteMessage() ) : false;
 }
 
-void RemoteMessage::bufferCompletionFix(void) const
+void RemoteMessage::bufferCompletionFix( bool checksum /*= true*/ ) const
 {
     if ( isValid() )
     {
         const NEMemory::sRemoteMessage & msg = _getRemoteMessage();
         const NEMemory::sRemoteMessageHeader & header = msg.rbHeader;
 
-        unsigned int checksum   = RemoteMessage::_checksumCalculate( msg );
+        unsigned int crc32      = checksum ? RemoteMessage::_checksumCalculate( msg ) : header.rbhChecksum;
         unsigned int dataUsed   = header.rbhBufHeader.biUsed;
         unsigned int dataLen    = header.rbhBufHeader.biUsed;
         unsigned int bufSize    = header.rbhBufHeader.biOffset + dataUsed;
@@ -124,9 +142,13 @@ void RemoteMessage::bufferCompletionFix(void) const
 
         ASSERT(dataLen <= header.rbhBufHeader.biLength);
 
-        const_cast<NEMemory::sRemoteMessageHeader &>(header).rbhBufHeader.biBufSize   = bufSize;
-        const_cast<NEMemory::sRemoteMessageHeader &>(header).rbhBufHeader.biLength    = dataLen;
-        const_cast<NEMemory::sRemoteMessageHeader &>(header).rbhChecksum              = checksum;
+        // The complete message can be shared and sent by several threads, do not modify it.
+        if ((header.rbhBufHeader.biBufSize != bufSize) || (header.rbhBufHeader.biLength != dataLen) || (header.rbhChecksum != crc32))
+        {
+            const_cast<NEMemory::sRemoteMessageHeader &>(header).rbhBufHeader.biBufSize   = bufSize;
+            const_cast<NEMemory::sRemoteMessageHeader &>(header).rbhBufHeader.biLength    = dataLen;
+            const_cast<NEMemory::sRemoteMessageHeader &>(header).rbhChecksum              = crc32;
+        }
     }
 }
 
@@ -139,8 +161,9 @@ unsigned char * RemoteMessage::initMessage(const NEMemory::sRemoteMessageHeader
     unsigned int hdrSize    = getHeaderSize();
     unsigned int msgSize    = hdrSize + sizeUsed;
     unsigned int sizeBuffer = MACRO_ALIGN_SIZE(msgSize, mBlockSize);
+    std::shared_ptr<NEMemory::sByteBuffer> buffer{ IEByteBuffer::createBuffer(sizeBuffer, sizeBuffer) };
     unsigned int sizeData   = sizeBuffer - hdrSize;
-    unsigned char * result  = DEBUG_NEW unsigned char[sizeBuffer];
+    unsigned char * result  = reinterpret_cast<unsigned char *>(buffer.get());
     if ( result != nullptr )
     {
         NEMemory::memZero(result, sizeof(NEMemory::sRemoteMessage));
@@ -159,12 +182,36 @@ unsigned char * RemoteMessage::initMessage(const NEMemory::sRemoteMessageHeader
         dst.rbhSequenceNr           = rmHeader.rbhSequenceNr;
         msg->rbData[0]              = static_cast<NEMemory::BufferData>(0);
 
-        mByteBuffer = std::shared_ptr<NEMemory::sByteBuffer>(reinterpret_cast<NEMemory::sByteBuffer *>(msg), ByteBufferDeleter());
+        mByteBuffer = std::move(buffer);
     }
 
     return getBuffer();
 }
 
+bool RemoteMessage::initMessage( const std::shared_ptr<unsigned char> & block, unsigned int msgOffset )
+{
+    invalidate( );
+
+    unsigned char * data = block != nullptr ? block.get( ) + msgOffset : nullptr;
+    bool result{ (data != nullptr) && (getDataOffset( ) == sizeof( NEMemory::sRemoteMessageHeader )) };
+    result = result && (reinterpret_cast<std::uintptr_t>(data) % alignof( NEMemory::sRemoteMessageHeader ) == 0);
+    if ( result )
+    {
+        NEMemory::sRemoteMessageHeader & header = *reinterpret_cast<NEMemory::sRemoteMessageHeader *>(data);
+        result = (header.rbhBufHeader.biUsed != 0) && (header.rbhBufHeader.biLength >= header.rbhBufHeader.biUsed);
+        if ( result )
+        {
+            header.rbhBufHeader.biBufSize   = getDataOffset( ) + header.rbhBufHeader.biLength;
+            header.rbhBufHeader.biOffset    = getDataOffset( );
+            header.rbhBufHeader.biBufType   = NEMemory::eBufferType::BufferRemote;
+
+            mByteBuffer = std::shared_ptr<NEMemory::sByteBuffer>(reinterpret_cast<NEMemory::sByteBuffer *>(data), BlockReleaser{ block });
+        }
+    }
+
+    return result;
+}
+
 RemoteMessage RemoteMessage::clone(const ITEM_ID & source /*= 0*/, const ITEM_ID & target /*= 0*/) const
 {
     RemoteMessage result;
@@ -21,9 +21,9 @@
 //////////////////////////////////////////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////
-// Hidden static calls.
+// Static calls.
 //////////////////////////////////////////////////////////////////////////
-inline const RuntimeClassID & RuntimeBase::_getClassId( void )
+const RuntimeClassID & RuntimeBase::_getClassId( void )
 {
     static const RuntimeClassID _classId("RuntimeBase");
     return _classId;
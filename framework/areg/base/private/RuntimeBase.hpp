@@ -40,11 +40,12 @@ class String;
 class AREG_API RuntimeBase
 {
 //////////////////////////////////////////////////////////////////////////
-// Hidden static calls.
+// Static calls.
 //////////////////////////////////////////////////////////////////////////
-private:
+protected:
     /**
      * \brief   Returns the ClassID object of RuntimeBase class.
+     *          The derived runtime classes register it as the root of the class hierarchy.
      **/
     static const RuntimeClassID & _getClassId( void );
 
@@ -20,7 +20,12 @@
 #include "areg/base/NEString.hpp"
 #include "areg/base/NEMath.hpp"
 
+#include <deque>
+#include <string.h>
+#include <mutex>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
@@ -29,6 +34,85 @@ namespace
      *          Bad Class ID. Defined as constant. Used to indicate invalid class ID name.
      **/
     constexpr std::string_view BAD_CLASS_ID { "_BAD_RUNTIME_CLASS_ID_" };
+
+    /**
+     * \brief   The index of the invalid class ID.
+     **/
+    constexpr unsigned int BAD_CLASS_INDEX  { 0u };
+
+    /**
+     * \brief   The registered runtime class.
+     **/
+    struct sClassEntry
+    {
+        const String *  ceName  { nullptr };            //!< The name of the runtime class.
+        unsigned int    ceMagic { NEMath::CHECKSUM_IGNORE };    //!< The calculated number of the runtime class.
+        unsigned int    ceIndex { BAD_CLASS_INDEX };    //!< The dense index of the runtime class.
+    };
+
+    /**
+     * \brief   The registry of runtime classes. The names and the bit-sets of class hierarchies
+     *          are never removed, so that the Class IDs can refer to them without copying.
+     **/
+    struct sClassRegistry
+    {
+        std::mutex                                                      crLock;         //!< The registry lock.
+        std::unordered_map<unsigned int, std::pair<String, unsigned int>> crClasses;    //!< The names and indexes by the calculated number.
+        std::deque<std::vector<unsigned char>>                          crHierarchies;  //!< The bit-sets of class hierarchies.
+    };
+
+    /**
+     * \brief   Returns the registry of runtime classes.
+     **/
+    sClassRegistry & _getRegistry( void )
+    {
+        static sClassRegistry _registry;
+        return _registry;
+    }
+
+    /**
+     * \brief   Returns the entry of invalid class ID.
+     **/
+    const sClassEntry & _getBadClass( void )
+    {
+        static const String _badName( BAD_CLASS_ID );
+        static const sClassEntry _badClass{ &_badName, NEMath::CHECKSUM_IGNORE, BAD_CLASS_INDEX };
+        return _badClass;
+    }
+
+    /**
+     * \brief   Registers the runtime class of the given name and returns the entry.
+     *          The dense index is assigned when the class is registered first time.
+     **/
+    sClassEntry _registerClass( const char * className )
+    {
+        if ( NEString::isEmpty<char>( className ) || (BAD_CLASS_ID == className) )
+            return _getBadClass( );
+
+        sClassRegistry & registry = _getRegistry( );
+        const unsigned int magic = NEMath::crc32Calculate( className );
+
+        std::lock_guard<std::mutex> lock( registry.crLock );
+        auto pos = registry.crClasses.find( magic );
+        if ( pos == registry.crClasses.end( ) )
+        {
+            const unsigned int index = static_cast<unsigned int>(registry.crClasses.size( )) + 1u;
+            pos = registry.crClasses.emplace( magic, std::make_pair( String( className ), index ) ).first;
+        }
+
+        return sClassEntry{ &pos->second.first, magic, pos->second.second };
+    }
+
+    /**
+     * \brief   Registers the bit-set of the class hierarchy and returns the pointer to the bits.
+     **/
+    const unsigned char * _registerHierarchy( std::vector<unsigned char> && bits )
+    {
+        sClassRegistry & registry = _getRegistry( );
+        std::lock_guard<std::mutex> lock( registry.crLock );
+        registry.crHierarchies.push_back( std::move( bits ) );
+        return registry.crHierarchies.back( ).data( );
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -39,45 +123,61 @@ namespace
 // Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
 RuntimeClassID::RuntimeClassID( void )
-    : mClassName(BAD_CLASS_ID)
-    , mMagicNum (NEMath::CHECKSUM_IGNORE)
+    : mClassName    ( _getBadClass( ).ceName )
+    , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mClassIndex   ( BAD_CLASS_INDEX )
+    , mAncestors    ( nullptr )
+    , mAncestorCount( 0u )
 {
 }
 
 RuntimeClassID::RuntimeClassID( const char * className )
-    : mClassName(BAD_CLASS_ID)
-    , mMagicNum (NEMath::CHECKSUM_IGNORE)
+    : mClassName    ( nullptr )
+    , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mClassIndex   ( BAD_CLASS_INDEX )
+    , mAncestors    ( nullptr )
+    , mAncestorCount( 0u )
 {
-    if (NEString::isEmpty<char>(className) == false)
-    {
-        mClassName  = className;
-        mMagicNum   = NEMath::crc32Calculate(className);
-    }
+    setName( className );
 }
 
 RuntimeClassID::RuntimeClassID( const String& className )
-    : mClassName(BAD_CLASS_ID)
-    , mMagicNum (NEMath::CHECKSUM_IGNORE)
+    : mClassName    ( nullptr )
+    , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mClassIndex   ( BAD_CLASS_INDEX )
+    , mAncestors    ( nullptr )
+    , mAncestorCount( 0u )
 {
-    if (className.isEmpty() == false)
-    {
-        mClassName  = className;
-        mMagicNum   = NEMath::crc32Calculate(className);
-    }
+    setName( className.getString( ) );
 }
 
-RuntimeClassID::RuntimeClassID( const RuntimeClassID & src )
-    : mClassName(src.mClassName)
-    , mMagicNum (src.mMagicNum)
+RuntimeClassID::RuntimeClassID( const char * className, const RuntimeClassID & baseClassId )
+    : mClassName    ( nullptr )
+    , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mClassIndex   ( BAD_CLASS_INDEX )
+    , mAncestors    ( nullptr )
+    , mAncestorCount( 0u )
 {
-    ASSERT(src.mClassName.isEmpty() == false);
-}
+    setName( className );
+    if ( mClassIndex != BAD_CLASS_INDEX )
+    {
+        // The bit-set contains the bits of the base class hierarchy and the own bit.
+        unsigned int count = MACRO_MAX( mClassIndex, baseClassId.mClassIndex ) + 1u;
+        count = MACRO_MAX( count, baseClassId.mAncestorCount );
+        std::vector<unsigned char> bits( (count + 7u) / 8u, static_cast<unsigned char>(0u) );
+        if ( baseClassId.mAncestors != nullptr )
+        {
+            ::memcpy( bits.data( ), baseClassId.mAncestors, (baseClassId.mAncestorCount + 7u) / 8u );
+        }
+        else if ( baseClassId.mClassIndex != BAD_CLASS_INDEX )
+        {
+            bits[baseClassId.mClassIndex >> 3u] |= static_cast<unsigned char>(1u << (baseClassId.mClassIndex & 7u));
+        }
 
-RuntimeClassID::RuntimeClassID( RuntimeClassID && src ) noexcept
-    : mClassName( std::move(src.mClassName) )
-    , mMagicNum ( src.mMagicNum )
-{
-    ASSERT( src.mClassName.isEmpty( ) == false );
+        bits[mClassIndex >> 3u] |= static_cast<unsigned char>(1u << (mClassIndex & 7u));
+        mAncestors      = _registerHierarchy( std::move( bits ) );
+        mAncestorCount  = count;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -86,28 +186,15 @@ RuntimeClassID::RuntimeClassID( RuntimeClassID && src ) noexcept
 
 void RuntimeClassID::setName( const String& className )
 {
-    if ( className.isEmpty() || (className == BAD_CLASS_ID))
-    {
-        mClassName  = BAD_CLASS_ID;
-        mMagicNum   = NEMath::CHECKSUM_IGNORE;
-    }
-    else
-    {
-        mClassName  = className;
-        mMagicNum   = NEMath::crc32Calculate(className.getString());
-    }
+    setName( className.getString( ) );
 }
 
 void RuntimeClassID::setName( const char* className )
 {
-    if ( NEString::isEmpty<char>(className) || (BAD_CLASS_ID == className) )
-    {
-        mClassName  = BAD_CLASS_ID;
-        mMagicNum   = NEMath::CHECKSUM_IGNORE;
-    }
-    else
-    {
-        mClassName  = className;
-        mMagicNum   = NEMath::crc32Calculate(className);
-    }
+    const sClassEntry entry{ _registerClass( className ) };
+    mClassName      = entry.ceName;
+    mMagicNum       = entry.ceMagic;
+    mClassIndex     = entry.ceIndex;
+    mAncestors      = nullptr;
+    mAncestorCount  = 0u;
 }
@@ -109,11 +109,21 @@ int Socket::sendData( const unsigned char * buffer, int length ) const
     return (isValid() ? NESocket::sendData( *mSocket, buffer, static_cast<uint32_t>(length), static_cast<uint32_t>(mSendSize) ) : -1);
 }
 
+int Socket::sendDataVector( const NESocket::sSendBuffer * buffers, uint32_t count, uint32_t * out_sent /*= nullptr*/ ) const
+{
+    return NESocket::sendDataVector( isValid() ? *mSocket : NESocket::InvalidSocketHandle, buffers, count, out_sent );
+}
+
 int Socket::receiveData( unsigned char * buffer, int length ) const
 {
     return (isValid( ) ? NESocket::receiveData( *mSocket, buffer, static_cast<uint32_t>(length), static_cast<uint32_t>(mRecvSize) ) : -1);
 }
 
+int Socket::receiveAvailableData( unsigned char * buffer, int length ) const
+{
+    return (isValid( ) ? NESocket::receiveAvailableData( *mSocket, buffer, static_cast<uint32_t>(length) ) : -1);
+}
+
 bool Socket::setAddress(const char * hostName, unsigned short portNr, bool isServer)
 {
     if ( isValid() && (mAddress.isEqualAddress(hostName, portNr) == false))
@@ -0,0 +1,140 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/SocketPoller.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the poller of socket read events.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#include "areg/base/NESocket.hpp"
+#include "areg/base/Thread.hpp"
+
+#ifdef  _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif  // WIN32_LEAN_AND_MEAN
+    #include <WinSock2.h>
+#else   // !_WIN32
+    #include <sys/select.h>
+#endif  // _WIN32
+
+SocketPoller::SocketPoller( void )
+    : mIsValid      ( false )
+    , mPollHandle   ( -1 )
+    , mWakeHandle   ( -1 )
+    , mSockets      ( )
+    , mLock         ( )
+{
+}
+
+SocketPoller::~SocketPoller( void )
+{
+    release( );
+}
+
+bool SocketPoller::create( void )
+{
+    release( );
+    mIsValid = _osCreate( );
+    return mIsValid;
+}
+
+void SocketPoller::release( void )
+{
+    Lock lock( mLock );
+    if ( mIsValid )
+    {
+        _osRelease( );
+        mIsValid = false;
+    }
+
+    mSockets.clear( );
+}
+
+bool SocketPoller::addSocket( SOCKETHANDLE hSocket )
+{
+    return mIsValid && NESocket::isSocketHandleValid( hSocket ) && _osAddSocket( hSocket );
+}
+
+void SocketPoller::removeSocket( SOCKETHANDLE hSocket )
+{
+    if ( mIsValid && NESocket::isSocketHandleValid( hSocket ) )
+    {
+        _osRemoveSocket( hSocket );
+    }
+}
+
+void SocketPoller::wakeUp( void )
+{
+    if ( mIsValid )
+    {
+        _osWakeUp( );
+    }
+}
+
+int SocketPoller::waitEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout /*= NECommon::WAIT_INFINITE*/ )
+{
+    return (mIsValid && (out_events != nullptr) && (maxEvents > 0) ? _osWaitEvents( out_events, maxEvents, timeout ) : -1);
+}
+
+int SocketPoller::_selectEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout )
+{
+    fd_set readList{ };
+    FD_ZERO( &readList );
+    SOCKETHANDLE maxSocket{ 0 };
+    uint32_t count{ 0 };
+
+    do
+    {
+        Lock lock( mLock );
+        count = MACRO_MIN( mSockets.getSize( ), static_cast<uint32_t>(FD_SETSIZE) );
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            SOCKETHANDLE hSocket = mSockets[i];
+            FD_SET( hSocket, &readList );
+            maxSocket = MACRO_MAX( maxSocket, hSocket );
+        }
+    } while ( false );
+
+    if ( count == 0 )
+    {
+        // select() cannot wait without sockets, check again later.
+        Thread::sleep( MACRO_MIN( timeout, SocketPoller::IDLE_TIMEOUT ) );
+        return 0;
+    }
+
+    timeval waitTime{ static_cast<long>(timeout / 1'000), static_cast<long>((timeout % 1'000) * 1'000) };
+    int selected = ::select( static_cast<int>(maxSocket) + 1 /* param is ignored in Win32*/
+                           , &readList
+                           , nullptr
+                           , nullptr
+                           , timeout == NECommon::WAIT_INFINITE ? nullptr : &waitTime );
+
+    int result{ selected > 0 ? 0 : selected };
+    if ( selected > 0 )
+    {
+        Lock lock( mLock );
+        count = MACRO_MIN( mSockets.getSize( ), static_cast<uint32_t>(FD_SETSIZE) );
+        for ( uint32_t i = 0; (i < count) && (result < maxEvents); ++ i )
+        {
+            SOCKETHANDLE hSocket = mSockets[i];
+            if ( FD_ISSET( hSocket, &readList ) != 0 )
+            {
+                // The readable socket without data is closed by the remote side.
+                out_events[result].seSocket = hSocket;
+                out_events[result].seClosed = (NESocket::pendingRead( hSocket ) == 0);
+                ++ result;
+            }
+        }
+    }
+
+    return result;
+}
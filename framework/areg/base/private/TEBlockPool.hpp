@@ -0,0 +1,510 @@
+#ifndef AREG_BASE_PRIVATE_TEBLOCKPOOL_HPP
+#define AREG_BASE_PRIVATE_TEBLOCKPOOL_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/TEBlockPool.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pool of memory blocks of size classes,
+ *              cached in every thread.
+ *
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NEMemory.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+//////////////////////////////////////////////////////////////////////////
+// TEBlockPool class template declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The pool of memory blocks sorted by size classes. Every thread has own
+ *          pool with the free lists of blocks. The thread allocates the block in own
+ *          pool and the released block returns to the pool where it was allocated:
+ *          the owner thread puts it in the free list without locking, and other
+ *          threads push it to the lock-free return list of the pool, which the owner
+ *          thread takes when the free list is empty. The blocks bigger than the
+ *          largest size class are allocated in the heap.
+ *
+ *          When the thread exits, the free blocks of the pool are released and the
+ *          pool is reused by the next thread. The pools are never deleted, so that
+ *          the blocks can be returned at any time.
+ *
+ *          The size classes are defined by the SizeClass type, which contains:
+ *              - SizeClass::COUNT              The number of size classes.
+ *              - SizeClass::getClass(size)     Returns the size class of the block of the given size,
+ *                                              or SizeClass::COUNT if the block is allocated in the heap.
+ *              - SizeClass::getSize(cls)       Returns the size of the blocks of the size class.
+ *              - SizeClass::getMaxCached(cls)  Returns the maximum number of free blocks of the size class,
+ *                                              cached in the pool of one thread.
+ *
+ *          Every instantiation of the template has own pools. The template should be
+ *          instantiated only in one module.
+ *
+ * \tparam  SizeClass   The type, which defines the size classes of the pool.
+ **/
+template<class SizeClass>
+class TEBlockPool
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    class ThreadPool;
+
+    /**
+     * \brief   The header of the memory block, placed before the allocated memory.
+     *          While the block is allocated, it refers to the pool, where the block
+     *          is allocated. While the block is free, it is linked in the free or
+     *          return list of the pool.
+     **/
+    struct alignas(std::max_align_t) sBlockHeader
+    {
+        union
+        {
+            ThreadPool *    bhPool;     //!< The owner pool of the allocated block, nullptr if allocated in the heap.
+            sBlockHeader *  bhNext;     //!< The next free block in the list.
+        };
+
+        uint32_t            bhClass;    //!< The size class of the block.
+    };
+
+    /**
+     * \brief   The counters of allocations. The counters of the pool are modified only by the owner thread.
+     **/
+    struct sCounters
+    {
+        std::atomic<uint64_t>   cntAllocations  { 0u }; //!< The number of allocated blocks.
+        std::atomic<uint64_t>   cntHeapAllocs   { 0u }; //!< The number of blocks allocated in the heap.
+        std::atomic<uint64_t>   cntReleases     { 0u }; //!< The number of released blocks.
+        std::atomic<uint64_t>   cntHeapReleases { 0u }; //!< The number of blocks released in the heap.
+    };
+
+    /**
+     * \brief   The pool of the memory blocks of the thread. The free lists are accessed
+     *          only by the owner thread, the other threads return the blocks in the
+     *          lock-free return list.
+     **/
+    class ThreadPool
+    {
+    public:
+        ThreadPool( void );
+
+        //!< Allocates the block of the size class. Called by the owner thread.
+        sBlockHeader * allocate( uint32_t sizeClass );
+
+        //!< Puts the block in the free list. Called by the owner thread.
+        void releaseOwn( sBlockHeader * block );
+
+        //!< Pushes the block to the return list. Can be called by any thread.
+        void releaseForeign( sBlockHeader * block );
+
+        //!< Releases the free blocks in the heap and marks the pool as free to reuse. Called by the owner thread when it exits.
+        void abandon( void );
+
+        //!< Takes the ownership of the abandoned pool. Returns false if the pool is not abandoned.
+        bool adopt( void );
+
+    private:
+        //!< Moves the blocks of the return list in the free lists.
+        void _takeReturned( void );
+
+        //!< Puts the block in the free list of the size class, or releases it in the heap if the list is full.
+        void _cacheBlock( sBlockHeader * block );
+
+    public:
+        sCounters                   mCounters;                      //!< The counters of allocations of the pool.
+        ThreadPool *                mNextPool;                      //!< The next pool in the list of all pools.
+
+    private:
+        sBlockHeader *              mFreeList[SizeClass::COUNT];    //!< The free blocks of the size classes.
+        uint32_t                    mFreeCount[SizeClass::COUNT];   //!< The number of free blocks of the size classes.
+        std::atomic<sBlockHeader *> mReturned;                      //!< The blocks returned by other threads.
+        std::atomic_bool            mIsAbandoned;                   //!< The flag, indicating that the owner thread has exited.
+    };
+
+    /**
+     * \brief   The pool of the thread, which is abandoned when the thread exits.
+     **/
+    struct sThreadPool
+    {
+        ~sThreadPool( void );
+
+        ThreadPool *    tpPool  { nullptr };    //!< The pool of the thread.
+    };
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the memory block in the pool of the calling thread.
+     * \param   size    The size in bytes of the memory to allocate.
+     * \return  Returns the pointer to the allocated memory. Throws std::bad_alloc if failed.
+     **/
+    static void * allocate( size_t size );
+
+    /**
+     * \brief   Releases the memory block, allocated by the pool.
+     *          The memory block returns to the pool, where it was allocated.
+     * \param   ptr     The pointer to the memory to release. Ignored if nullptr.
+     **/
+    static void release( void * ptr );
+
+    /**
+     * \brief   Returns the size of the memory, which is allocated when the given size is requested.
+     *          It is the size of the blocks of the size class or the requested size if the
+     *          size is bigger than the largest size class. The size does not depend on
+     *          whether the pools are enabled.
+     * \param   size    The size in bytes of the memory to allocate.
+     **/
+    static size_t getCapacity( size_t size );
+
+    /**
+     * \brief   Enables or disables the pools. If disabled, the memory is allocated in the heap,
+     *          the memory, which is already allocated, returns to the pools.
+     **/
+    static void setEnabled( bool enable );
+
+    /**
+     * \brief   Returns true if the memory is allocated in the pools.
+     **/
+    static bool isEnabled( void );
+
+    /**
+     * \brief   Returns the counters of the allocations, summed in the pools of all threads.
+     **/
+    static NEMemory::sPoolStatistics getStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< Increments the counter, which is modified only by one thread.
+    static inline void _increment( std::atomic<uint64_t> & counter );
+
+    //!< Allocates the block in the heap.
+    static inline sBlockHeader * _heapAllocate( size_t size );
+
+    //!< Releases the block in the heap.
+    static inline void _heapRelease( sBlockHeader * block );
+
+    //!< Returns the abandoned pool or creates new pool for the calling thread.
+    static ThreadPool * _adoptPool( void );
+
+    //!< Returns the pool of the calling thread or nullptr if the thread exits.
+    static inline ThreadPool * _getThreadPool( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The list of pools of all threads.
+    static inline std::atomic<ThreadPool *>     _allPools       { nullptr };
+
+    //!< The counters of the threads, which have no pool.
+    static inline sCounters                     _noPoolCounters { };
+
+    //!< The flag, indicating whether the memory is allocated in the pools.
+    static inline std::atomic_bool              _isEnabled      { true };
+
+    //!< The flag, indicating that the thread exits and the pool is abandoned.
+    static inline thread_local bool             _isThreadExited { false };
+
+    //!< The pool of the calling thread.
+    static inline thread_local sThreadPool      _threadPool     { };
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden / Forbidden method calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    TEBlockPool( void ) = delete;
+    ~TEBlockPool( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( TEBlockPool );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// TEBlockPool class template implementation
+//////////////////////////////////////////////////////////////////////////
+
+template<class SizeClass>
+TEBlockPool<SizeClass>::ThreadPool::ThreadPool( void )
+    : mCounters     ( )
+    , mNextPool     ( nullptr )
+    , mFreeList     { }
+    , mFreeCount    { }
+    , mReturned     ( nullptr )
+    , mIsAbandoned  ( false )
+{
+}
+
+template<class SizeClass>
+typename TEBlockPool<SizeClass>::sBlockHeader * TEBlockPool<SizeClass>::ThreadPool::allocate( uint32_t sizeClass )
+{
+    if ( (mFreeList[sizeClass] == nullptr) && (mReturned.load( std::memory_order_relaxed ) != nullptr) )
+    {
+        _takeReturned( );
+    }
+
+    sBlockHeader * block{ mFreeList[sizeClass] };
+    if ( block != nullptr )
+    {
+        mFreeList[sizeClass] = block->bhNext;
+        -- mFreeCount[sizeClass];
+    }
+    else
+    {
+        block = TEBlockPool<SizeClass>::_heapAllocate( sizeof( sBlockHeader ) + SizeClass::getSize( sizeClass ) );
+        TEBlockPool<SizeClass>::_increment( mCounters.cntHeapAllocs );
+    }
+
+    block->bhPool   = this;
+    block->bhClass  = sizeClass;
+    TEBlockPool<SizeClass>::_increment( mCounters.cntAllocations );
+    return block;
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::ThreadPool::releaseOwn( sBlockHeader * block )
+{
+    _cacheBlock( block );
+    TEBlockPool<SizeClass>::_increment( mCounters.cntReleases );
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::ThreadPool::releaseForeign( sBlockHeader * block )
+{
+    sBlockHeader * head{ mReturned.load( std::memory_order_relaxed ) };
+    do
+    {
+        block->bhNext = head;
+    } while ( mReturned.compare_exchange_weak( head, block, std::memory_order_release, std::memory_order_relaxed ) == false );
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::ThreadPool::abandon( void )
+{
+    for ( uint32_t i = 0; i < SizeClass::COUNT; ++ i )
+    {
+        while ( mFreeList[i] != nullptr )
+        {
+            sBlockHeader * block{ mFreeList[i] };
+            mFreeList[i] = block->bhNext;
+            TEBlockPool<SizeClass>::_heapRelease( block );
+            TEBlockPool<SizeClass>::_increment( mCounters.cntHeapReleases );
+        }
+
+        mFreeCount[i] = 0u;
+    }
+
+    mIsAbandoned.store( true, std::memory_order_release );
+}
+
+template<class SizeClass>
+bool TEBlockPool<SizeClass>::ThreadPool::adopt( void )
+{
+    bool expected{ true };
+    return mIsAbandoned.compare_exchange_strong( expected, false, std::memory_order_acq_rel );
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::ThreadPool::_takeReturned( void )
+{
+    sBlockHeader * block{ mReturned.exchange( nullptr, std::memory_order_acquire ) };
+    while ( block != nullptr )
+    {
+        sBlockHeader * next{ block->bhNext };
+        _cacheBlock( block );
+        block = next;
+    }
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::ThreadPool::_cacheBlock( sBlockHeader * block )
+{
+    const uint32_t sizeClass{ block->bhClass };
+    if ( mFreeCount[sizeClass] < SizeClass::getMaxCached( sizeClass ) )
+    {
+        block->bhNext = mFreeList[sizeClass];
+        mFreeList[sizeClass] = block;
+        ++ mFreeCount[sizeClass];
+    }
+    else
+    {
+        TEBlockPool<SizeClass>::_heapRelease( block );
+        TEBlockPool<SizeClass>::_increment( mCounters.cntHeapReleases );
+    }
+}
+
+template<class SizeClass>
+TEBlockPool<SizeClass>::sThreadPool::~sThreadPool( void )
+{
+    TEBlockPool<SizeClass>::_isThreadExited = true;
+    if ( tpPool != nullptr )
+    {
+        tpPool->abandon( );
+        tpPool = nullptr;
+    }
+}
+
+template<class SizeClass>
+void * TEBlockPool<SizeClass>::allocate( size_t size )
+{
+    const uint32_t sizeClass{ SizeClass::getClass( size ) };
+    ThreadPool * pool{ _isEnabled.load( std::memory_order_relaxed ) ? _getThreadPool( ) : nullptr };
+    sBlockHeader * block{ nullptr };
+    if ( (pool != nullptr) && (sizeClass < SizeClass::COUNT) )
+    {
+        block = pool->allocate( sizeClass );
+    }
+    else
+    {
+        block = _heapAllocate( sizeof( sBlockHeader ) + getCapacity( size ) );
+        block->bhPool   = nullptr;
+        block->bhClass  = SizeClass::COUNT;
+
+        sCounters & counters{ pool != nullptr ? pool->mCounters : _noPoolCounters };
+        counters.cntAllocations.fetch_add( 1u, std::memory_order_relaxed );
+        counters.cntHeapAllocs.fetch_add( 1u, std::memory_order_relaxed );
+    }
+
+    return static_cast<void *>(block + 1);
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::release( void * ptr )
+{
+    if ( ptr == nullptr )
+        return;
+
+    sBlockHeader * block{ static_cast<sBlockHeader *>(ptr) - 1 };
+    ThreadPool * owner{ block->bhPool };
+    ThreadPool * pool{ _getThreadPool( ) };
+    if ( (owner != nullptr) && (owner == pool) )
+    {
+        pool->releaseOwn( block );
+    }
+    else
+    {
+        sCounters & counters{ pool != nullptr ? pool->mCounters : _noPoolCounters };
+        if ( owner != nullptr )
+        {
+            owner->releaseForeign( block );
+        }
+        else
+        {
+            _heapRelease( block );
+            counters.cntHeapReleases.fetch_add( 1u, std::memory_order_relaxed );
+        }
+
+        counters.cntReleases.fetch_add( 1u, std::memory_order_relaxed );
+    }
+}
+
+template<class SizeClass>
+size_t TEBlockPool<SizeClass>::getCapacity( size_t size )
+{
+    const uint32_t sizeClass{ SizeClass::getClass( size ) };
+    return (sizeClass < SizeClass::COUNT ? SizeClass::getSize( sizeClass ) : size);
+}
+
+template<class SizeClass>
+void TEBlockPool<SizeClass>::setEnabled( bool enable )
+{
+    _isEnabled.store( enable, std::memory_order_relaxed );
+}
+
+template<class SizeClass>
+bool TEBlockPool<SizeClass>::isEnabled( void )
+{
+    return _isEnabled.load( std::memory_order_relaxed );
+}
+
+template<class SizeClass>
+NEMemory::sPoolStatistics TEBlockPool<SizeClass>::getStatistics( void )
+{
+    NEMemory::sPoolStatistics result;
+    result.psAllocations    = _noPoolCounters.cntAllocations.load( std::memory_order_relaxed );
+    result.psHeapAllocs     = _noPoolCounters.cntHeapAllocs.load( std::memory_order_relaxed );
+    result.psReleases       = _noPoolCounters.cntReleases.load( std::memory_order_relaxed );
+    result.psHeapReleases   = _noPoolCounters.cntHeapReleases.load( std::memory_order_relaxed );
+
+    for ( const ThreadPool * pool = _allPools.load( std::memory_order_acquire ); pool != nullptr; pool = pool->mNextPool )
+    {
+        result.psAllocations    += pool->mCounters.cntAllocations.load( std::memory_order_relaxed );
+        result.psHeapAllocs     += pool->mCounters.cntHeapAllocs.load( std::memory_order_relaxed );
+        result.psReleases       += pool->mCounters.cntReleases.load( std::memory_order_relaxed );
+        result.psHeapReleases   += pool->mCounters.cntHeapReleases.load( std::memory_order_relaxed );
+    }
+
+    return result;
+}
+
+template<class SizeClass>
+inline void TEBlockPool<SizeClass>::_increment( std::atomic<uint64_t> & counter )
+{
+    counter.store( counter.load( std::memory_order_relaxed ) + 1u, std::memory_order_relaxed );
+}
+
+template<class SizeClass>
+inline typename TEBlockPool<SizeClass>::sBlockHeader * TEBlockPool<SizeClass>::_heapAllocate( size_t size )
+{
+    return static_cast<sBlockHeader *>(::operator new( size ));
+}
+
+template<class SizeClass>
+inline void TEBlockPool<SizeClass>::_heapRelease( sBlockHeader * block )
+{
+    ::operator delete( static_cast<void *>(block) );
+}
+
+template<class SizeClass>
+typename TEBlockPool<SizeClass>::ThreadPool * TEBlockPool<SizeClass>::_adoptPool( void )
+{
+    for ( ThreadPool * pool = _allPools.load( std::memory_order_acquire ); pool != nullptr; pool = pool->mNextPool )
+    {
+        if ( pool->adopt( ) )
+        {
+            return pool;
+        }
+    }
+
+    ThreadPool * pool{ DEBUG_NEW ThreadPool( ) };
+    ThreadPool * head{ _allPools.load( std::memory_order_relaxed ) };
+    do
+    {
+        pool->mNextPool = head;
+    } while ( _allPools.compare_exchange_weak( head, pool, std::memory_order_release, std::memory_order_relaxed ) == false );
+
+    return pool;
+}
+
+template<class SizeClass>
+inline typename TEBlockPool<SizeClass>::ThreadPool * TEBlockPool<SizeClass>::_getThreadPool( void )
+{
+    if ( _isThreadExited )
+    {
+        return nullptr;
+    }
+    else if ( _threadPool.tpPool == nullptr )
+    {
+        _threadPool.tpPool = _adoptPool( );
+    }
+
+    return _threadPool.tpPool;
+}
+
+#endif  // AREG_BASE_PRIVATE_TEBLOCKPOOL_HPP
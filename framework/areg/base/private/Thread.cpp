@@ -70,6 +70,12 @@ Thread::MapThreadIDResource& Thread::_getMapThreadId()
     return _mapThreadId;
 }
 
+std::atomic<uint32_t>& Thread::_getUnregisteredCount()
+{
+    static std::atomic<uint32_t> _unregisteredCount{ 0u };
+    return _unregisteredCount;
+}
+
 /************************************************************************/
 // Default thread procedure
 /************************************************************************/
@@ -203,6 +209,11 @@ void Thread::triggerExit( void )
 Thread::eCompletionStatus Thread::shutdownThread( unsigned int waitForStopMs /* = NECommon::DO_NOT_WAIT */ )
 {
     Thread::eCompletionStatus result{ _osDestroyThread( waitForStopMs ) };
+    if ( (result == Thread::eCompletionStatus::ThreadInvalid) && (waitForStopMs != NECommon::DO_NOT_WAIT) )
+    {
+        // The thread could release the handle and still be exiting, wait until the thread function ends.
+        mWaitForExit.lock( waitForStopMs );
+    }
 
     if ( mSynchObject.tryLock( ) )
     {
@@ -253,6 +264,11 @@ const String & Thread::getThreadName( id_type threadId )
     return (threadObj != nullptr ? threadObj->getName() : String::getEmptyString());
 }
 
+uint32_t Thread::getUnregisteredCount( void )
+{
+    return Thread::_getUnregisteredCount().load(std::memory_order_acquire);
+}
+
 const ThreadAddress & Thread::getThreadAddress( id_type threadId )
 {
     Thread* threadObj = Thread::findThreadById( threadId);
@@ -330,6 +346,7 @@ void Thread::_unregisterThread( void )
         Thread::_getMapThreadhHandle().unregisterResourceObject(mThreadHandle);
         Thread::_getMapThreadName().unregisterResourceObject(mThreadAddress.getThreadName());
         Thread::_getMapThreadId().unregisterResourceObject(mThreadId);
+        Thread::_getUnregisteredCount().fetch_add(1u, std::memory_order_release);
 
         if (Thread::_getMapThreadhHandle().isEmpty())
         {
@@ -29,12 +29,15 @@
 
 IEWaitableBaseIX::IEWaitableBaseIX( NESynchTypesIX::eSynchObject synchType, bool isRecursive, const char* asciiName /* = nullptr */ )
     : MutexIX     ( synchType, isRecursive, asciiName )
+    , mWaitList   ( )
 {
+    SynchLockAndWaitIX::initWaitList(mWaitList);
 }
 
 IEWaitableBaseIX::~IEWaitableBaseIX( void )
 {
     ASSERT(SynchLockAndWaitIX::isWaitableRegistered(*this) == false);
+    SynchLockAndWaitIX::releaseWaitList(mWaitList);
 }
 
 void IEWaitableBaseIX::freeResources(void)
@@ -24,6 +24,7 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/base/private/posix/MutexIX.hpp"
+#include "areg/base/private/posix/SynchLockAndWaitIX.hpp"
 #include <pthread.h>
 
 //////////////////////////////////////////////////////////////////////////
@@ -39,6 +40,8 @@
  **/
 class IEWaitableBaseIX : public MutexIX
 {
+    friend class SynchLockAndWaitIX;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -96,6 +99,15 @@ public:
      **/
     virtual void freeResources( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The list of threads waiting for the object to be signaled.
+     **/
+    SynchLockAndWaitIX::sWaitList   mWaitList;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
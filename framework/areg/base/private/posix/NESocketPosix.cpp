@@ -23,6 +23,7 @@
 
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/select.h>
 #include <sys/ioctl.h>
 #include <netinet/in.h>
@@ -93,6 +94,66 @@ namespace NESocket
         return result;
     }
 
+    int _osSendDataVector(SOCKETHANDLE hSocket, const NESocket::sSendBuffer* buffers, uint32_t count, uint32_t & out_sent)
+    {
+        ASSERT(hSocket != NESocket::InvalidSocketHandle);
+        ASSERT((buffers != nullptr) && (count > 0));
+
+        struct iovec vector[NESocket::MAX_SEND_BUFFERS];
+        int result{ 0 };
+        uint32_t index{ 0 };    // the index of first buffer, which is not sent yet.
+        uint32_t offset{ 0 };   // the length of data, which is already sent in the buffer at index.
+
+        while (index < count)
+        {
+            uint32_t used{ 0 };
+            for (uint32_t i = index; (i < count) && (used < NESocket::MAX_SEND_BUFFERS); ++i)
+            {
+                uint32_t skip = i == index ? offset : 0u;
+                if (buffers[i].sbLength > skip)
+                {
+                    vector[used].iov_base = const_cast<unsigned char *>(buffers[i].sbData + skip);
+                    vector[used].iov_len  = static_cast<size_t>(buffers[i].sbLength - skip);
+                    ++ used;
+                }
+            }
+
+            if (used == 0)
+            {
+                break; // the rest of buffers are empty
+            }
+
+            struct msghdr message{ };
+            message.msg_iov     = vector;
+            message.msg_iovlen  = used;
+            ssize_t written = ::sendmsg(hSocket, &message, 0);
+            if (written > 0)
+            {
+                result += static_cast<int>(written);
+
+                // skip the buffers sent completely and remember the sent part of the next buffer.
+                uint32_t sent = static_cast<uint32_t>(written);
+                while ((index < count) && (sent >= buffers[index].sbLength - offset))
+                {
+                    sent -= buffers[index].sbLength - offset;
+                    offset = 0;
+                    ++ index;
+                }
+
+                offset += sent;
+            }
+            else if (errno != EINTR)
+            {
+                // in all other cases
+                result = -1;     // notify failure
+                break;
+            }
+        }
+
+        out_sent = index;
+        return result;
+    }
+
     int _osRecvData(SOCKETHANDLE hSocket, unsigned char* dataBuffer, int dataLength, int blockMaxSize)
     {
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
@@ -0,0 +1,152 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/posix/SocketPollerPosix.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the poller of socket read events, POSIX specific.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/base/NESocket.hpp"
+
+#include <errno.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+#endif // defined(__linux__)
+
+#if defined(__linux__)
+
+bool SocketPoller::_osCreate( void )
+{
+    mPollHandle = ::epoll_create1( EPOLL_CLOEXEC );
+    mWakeHandle = mPollHandle != -1 ? ::eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC ) : -1;
+    if ( mWakeHandle != -1 )
+    {
+        struct epoll_event wakeEvent { };
+        wakeEvent.events    = EPOLLIN | EPOLLET;
+        wakeEvent.data.fd   = mWakeHandle;
+        if ( ::epoll_ctl( mPollHandle, EPOLL_CTL_ADD, mWakeHandle, &wakeEvent ) == 0 )
+        {
+            return true;
+        }
+    }
+
+    _osRelease( );
+    return false;
+}
+
+void SocketPoller::_osRelease( void )
+{
+    if ( mWakeHandle != -1 )
+    {
+        ::close( mWakeHandle );
+        mWakeHandle = -1;
+    }
+
+    if ( mPollHandle != -1 )
+    {
+        ::close( mPollHandle );
+        mPollHandle = -1;
+    }
+}
+
+bool SocketPoller::_osAddSocket( SOCKETHANDLE hSocket )
+{
+    struct epoll_event sockEvent { };
+    sockEvent.events    = EPOLLIN | EPOLLRDHUP | EPOLLET;
+    sockEvent.data.fd   = hSocket;
+    return (::epoll_ctl( mPollHandle, EPOLL_CTL_ADD, hSocket, &sockEvent ) == 0);
+}
+
+void SocketPoller::_osRemoveSocket( SOCKETHANDLE hSocket )
+{
+    struct epoll_event sockEvent { };
+    ::epoll_ctl( mPollHandle, EPOLL_CTL_DEL, hSocket, &sockEvent );
+}
+
+void SocketPoller::_osWakeUp( void )
+{
+    const uint64_t value{ 1 };
+    static_cast<void>(::write( mWakeHandle, &value, sizeof( value ) ));
+}
+
+int SocketPoller::_osWaitEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout )
+{
+    struct epoll_event events[SocketPoller::MAX_EVENTS];
+    maxEvents = MACRO_MIN( maxEvents, SocketPoller::MAX_EVENTS );
+
+    int waitTime{ timeout == NECommon::WAIT_INFINITE ? -1 : static_cast<int>(timeout) };
+    int count = ::epoll_wait( mPollHandle, events, maxEvents, waitTime );
+    if ( count < 0 )
+    {
+        // interrupted by signal, nothing to report.
+        return (errno == EINTR ? 0 : -1);
+    }
+
+    int result{ 0 };
+    for ( int i = 0; i < count; ++ i )
+    {
+        const struct epoll_event & entry = events[i];
+        if ( entry.data.fd == mWakeHandle )
+        {
+            uint64_t value{ 0 };
+            static_cast<void>(::read( mWakeHandle, &value, sizeof( value ) ));
+        }
+        else
+        {
+            out_events[result].seSocket = entry.data.fd;
+            out_events[result].seClosed = (entry.events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0;
+            ++ result;
+        }
+    }
+
+    return result;
+}
+
+#else   // !defined(__linux__)
+
+bool SocketPoller::_osCreate( void )
+{
+    return true;
+}
+
+void SocketPoller::_osRelease( void )
+{
+}
+
+bool SocketPoller::_osAddSocket( SOCKETHANDLE hSocket )
+{
+    Lock lock( mLock );
+    return mSockets.addIfUnique( hSocket );
+}
+
+void SocketPoller::_osRemoveSocket( SOCKETHANDLE hSocket )
+{
+    Lock lock( mLock );
+    mSockets.removeElem( hSocket );
+}
+
+void SocketPoller::_osWakeUp( void )
+{
+}
+
+int SocketPoller::_osWaitEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout )
+{
+    return _selectEvents( out_events, maxEvents, timeout );
+}
+
+#endif  // defined(__linux__)
+
+#endif  // defined(_POSIX) || defined(POSIX)
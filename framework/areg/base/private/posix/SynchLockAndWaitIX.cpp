@@ -18,25 +18,46 @@
 
 #if defined(_POSIX) || defined(POSIX)
 
+
 #include "areg/base/private/posix/IEWaitableBaseIX.hpp"
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/Thread.hpp"
 #include <errno.h>
+#include <sched.h>
+
+#if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif // defined(__linux__)
 
 //////////////////////////////////////////////////////////////////////////
 // SynchLockAndWaitIX class implementation
 //////////////////////////////////////////////////////////////////////////
 
-SynchLockAndWaitIX::MapWaitIDResource & SynchLockAndWaitIX::_mapWaitResourceIds( void )
+SynchLockAndWaitIX::sWaiterBucket & SynchLockAndWaitIX::_waiterBucket( id_type threadId )
 {
-    static SynchLockAndWaitIX::MapWaitIDResource _mapWaitIdResource;
-    return _mapWaitIdResource;
+    static SynchLockAndWaitIX::sWaiterBucket _waiterBuckets[SynchLockAndWaitIX::WAITER_BUCKETS];
+
+    // The POSIX thread IDs are addresses of aligned thread control blocks, skip the lowest bits.
+    uint64_t key = static_cast<uint64_t>(threadId);
+    return _waiterBuckets[static_cast<uint32_t>((key >> 4) ^ (key >> 12)) % SynchLockAndWaitIX::WAITER_BUCKETS];
 }
 
-SynchLockAndWaitIX::SynchResourceMapIX & SynchLockAndWaitIX::_mapSynchResources( void )
+void SynchLockAndWaitIX::initWaitList( SynchLockAndWaitIX::sWaitList & waitList )
 {
-    static SynchLockAndWaitIX::SynchResourceMapIX _theSynchResourceMapIX;
-    return _theSynchResourceMapIX;
+    ::pthread_mutex_init( &waitList.wlLock, nullptr );
+    waitList.wlHead = nullptr;
+    waitList.wlTail = nullptr;
+}
+
+void SynchLockAndWaitIX::releaseWaitList( SynchLockAndWaitIX::sWaitList & waitList )
+{
+    // wait until the thread, which signaled the waitable, releases the list.
+    ::pthread_mutex_lock( &waitList.wlLock );
+    ASSERT( waitList.wlHead == nullptr );
+    ::pthread_mutex_unlock( &waitList.wlLock );
+    ::pthread_mutex_destroy( &waitList.wlLock );
 }
 
 int SynchLockAndWaitIX::waitForSingleObject( IEWaitableBaseIX & synchWait, unsigned int msTimeout /* = NECommon::WAIT_INFINITE */ )
@@ -56,31 +77,14 @@ int SynchLockAndWaitIX::waitForMultipleObjects( IEWaitableBaseIX ** listWaitable
                                         , waitAll ? NESynchTypesIX::eMatchCondition::MatchConditionExact : NESynchTypesIX::eMatchCondition::MatchConditionAny
                                         , msTimeout);
 
-        if ( (lockAndWait._isEmpty() == false) && lockAndWait._lock( ) )
+        if ( lockAndWait._isValid( ) && lockAndWait._noEventFired( ) )
         {
-            SynchLockAndWaitIX::MapWaitIDResource & mapReousrces { SynchLockAndWaitIX::_mapWaitResourceIds() };
-            mapReousrces.registerResourceObject(reinterpret_cast<ptr_type>(lockAndWait.mContext), &lockAndWait);
-
-            int waitResult = ENOLCK;
-            bool makeLoop = true;
-            while ( makeLoop && lockAndWait._noEventFired( ) )
-            {
-                waitResult = lockAndWait._waitCondition( );
-                mapReousrces.lock();
-                if ( (RETURNED_OK  != waitResult) && (lockAndWait.mFiredEntry == NESynchTypesIX::SynchObjectInvalid) )
-                {
-                    lockAndWait.mFiredEntry = (waitResult == ETIMEDOUT) || (waitResult == EBUSY) ? NESynchTypesIX::SynchObjectTimeout : NESynchTypesIX::SynchWaitInterrupted;
-                    makeLoop = false;
-                }
-                mapReousrces.unlock();
-            }
-
-            mapReousrces.unregisterResourceObject(reinterpret_cast<ptr_type>(lockAndWait.mContext));
-
-            lockAndWait._unlock( );
+            lockAndWait._registerWaiter( );
+            lockAndWait._waitForEvent( );
+            lockAndWait._unregisterWaiter( );
         }
 
-        result = static_cast<int>(lockAndWait.mFiredEntry);
+        result = static_cast<int>(lockAndWait.mFiredEntry.load( ));
     }
 
     return result;
@@ -90,327 +94,333 @@ int SynchLockAndWaitIX::eventSignaled( IEWaitableBaseIX & synchWaitable )
 {
     int result = 0;
 
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
+    SynchLockAndWaitIX::sWaitList & waitList = synchWaitable.mWaitList;
+    ::pthread_mutex_lock( &waitList.wlLock );
 
-    ListLockAndWait * waitList = mapResource.getResource( &synchWaitable );
-    if ( waitList != nullptr)
+    for ( sWaitEntry * entry = waitList.wlHead; entry != nullptr; )
     {
-        ASSERT( waitList->isEmpty( ) == false );
-        OUTPUT_DBG("Waitable [ %s ] ID [ %p ] is signaled, there are [ %d ] locks associated with it."
-                    , synchWaitable.getName().getString()
-                    , &synchWaitable
-                    , waitList->getSize());
+        SynchLockAndWaitIX & lockAndWait = *entry->weWaiter;
+        if ( synchWaitable.checkSignaled( lockAndWait.mContext ) == false )
+            break;
 
-        ListLockAndWait::LISTPOS end = waitList->invalidPosition();
-        for ( ListLockAndWait::LISTPOS pos = waitList->firstPosition( ); pos != end; )
+        sWaitEntry * next = entry->weNext;
+        lockAndWait._lock( );
+        if ( lockAndWait._noEventFired( ) )
         {
-            SynchLockAndWaitIX * lockAndWait = waitList->valueAtPosition(pos);
-            ASSERT(lockAndWait != nullptr);
-
-            if (synchWaitable.checkSignaled(lockAndWait->mContext) == false)
-                break;
-
-            pos = waitList->nextPosition( pos );
-            NESynchTypesIX::eSynchObjectFired fired = lockAndWait->_checkEventFired(synchWaitable);
-            if ( fired >= NESynchTypesIX::SynchObject0 && fired <= NESynchTypesIX::SynchObjectAll )
+            if ( lockAndWait._isWaitAll( ) )
             {
-                if (lockAndWait->_requestOwnership(fired))
+                SynchLockAndWaitIX::eCheckAll checkAll = lockAndWait._checkAllFired( &synchWaitable );
+                if ( checkAll == SynchLockAndWaitIX::eCheckAll::CheckAllFired )
                 {
-                    OUTPUT_DBG(   "The waitable [ %s ] [ %p ] is fired, unlocking thread [ %p ] with fired event reason [ %d ]"
-                                , synchWaitable.getName().getString()
-                                , &synchWaitable
-                                , lockAndWait->mContext
-                                , static_cast<int>(fired));
-
                     ++ result;
-                    lockAndWait->mFiredEntry = fired;
-                    lockAndWait->_notifyEvent();
+                    lockAndWait._notifyEvent( );
                 }
-#ifdef  DEBUG
-                else
+                else if ( checkAll == SynchLockAndWaitIX::eCheckAll::CheckAllBusy )
                 {
-                    OUTPUT_WARN("The waitable [ %p ] is marked as signaled, but it rejected lock [ %p ], ignoring notifying", &synchWaitable, lockAndWait);
+                    // other waitable is in use, let the waiting thread check again.
+                    lockAndWait.mCheckAll = true;
+                    lockAndWait._notifyEvent( );
                 }
-#endif // DEBUG
             }
-#ifdef DEBUG
-            else if (fired > NESynchTypesIX::SynchObjectAll)
+            else if ( synchWaitable.notifyRequestOwnership( lockAndWait.mContext ) )
+            {
+                OUTPUT_DBG(   "The waitable [ %s ] [ %p ] is fired, unlocking thread [ %p ] with fired event reason [ %d ]"
+                            , synchWaitable.getName().getString()
+                            , &synchWaitable
+                            , reinterpret_cast<id_type>(lockAndWait.mContext)
+                            , entry->weIndex);
+
+                ++ result;
+                lockAndWait.mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(entry->weIndex);
+                SynchLockAndWaitIX::_unlinkEntry( synchWaitable, *entry );
+                lockAndWait._notifyEvent( );
+            }
+#ifdef  DEBUG
+            else
             {
-                OUTPUT_ERR("Lock and Wait object detected unexpected fired event [ %d ]", static_cast<int>(fired));
+                OUTPUT_WARN("The waitable [ %p ] is marked as signaled, but it rejected lock [ %p ], ignoring notifying", &synchWaitable, &lockAndWait);
             }
 #endif // DEBUG
-
         }
 
+        // the next entry is unlinked if the thread waits more than once for the same waitable.
+        next = (next != nullptr) && (next->weWaitable == nullptr) ? waitList.wlHead : next;
+        lockAndWait._unlock( );
+        entry = next;
+    }
+
+    if ( result > 0 )
+    {
         OUTPUT_DBG("Waitable [ %s ] ID [ %p ] released [ %d ] threads.", synchWaitable.getName().getString(), &synchWaitable, result);
         synchWaitable.notifyReleasedThreads(result);
     }
 
-    mapResource.unlock( );
+    ::pthread_mutex_unlock( &waitList.wlLock );
     return result;
 }
 
 void SynchLockAndWaitIX::eventRemove( IEWaitableBaseIX & synchWaitable )
 {
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
-
-    ListLockAndWait * waitList = mapResource.getResource( &synchWaitable );
-    if ( waitList != nullptr )
-    {
-        OUTPUT_ERR("The event [ %p / %s] is cleaning resource, there is still wait list, going to notify error [ %d ] locked threads and clean resources."
-                    , &synchWaitable
-                    , NESynchTypesIX::getString(synchWaitable.getSynchType())
-                    , waitList->getSize());
-        ASSERT( waitList->isEmpty( ) == false );
-
-        ListLockAndWait::LISTPOS end = waitList->invalidPosition();
-        for ( ListLockAndWait::LISTPOS pos = waitList->firstPosition( ); pos != end ; pos = waitList->nextPosition(pos))
-        {
-            SynchLockAndWaitIX * lockAndWait = waitList->valueAtPosition(pos);
-            ASSERT(lockAndWait != nullptr);
-            if (synchWaitable.checkSignaled(lockAndWait->mContext) == false)
-                break;
+    SynchLockAndWaitIX::_releaseWithError( synchWaitable );
+}
 
-            int index = lockAndWait->_getWaitableIndex( synchWaitable );
-            lockAndWait->mFiredEntry = index != NECommon::INVALID_INDEX ? static_cast<NESynchTypesIX::eSynchObjectFired>(index + NESynchTypesIX::SynchObject0Error) : NESynchTypesIX::eSynchObjectFired::SynchWaitInterrupted;
-            lockAndWait->_notifyEvent();
-        }
+void SynchLockAndWaitIX::eventFailed( IEWaitableBaseIX & synchWaitable )
+{
+    SynchLockAndWaitIX::_releaseWithError( synchWaitable );
+}
 
-        mapResource.unregisterResource(&synchWaitable);
-    }
+bool SynchLockAndWaitIX::isWaitableRegistered( IEWaitableBaseIX & synchWaitable )
+{
+    SynchLockAndWaitIX::sWaitList & waitList = synchWaitable.mWaitList;
+    ::pthread_mutex_lock( &waitList.wlLock );
+    bool result = waitList.wlHead != nullptr;
+    ::pthread_mutex_unlock( &waitList.wlLock );
 
-    mapResource.unlock( );
+    return result;
 }
 
-void SynchLockAndWaitIX::eventFailed( IEWaitableBaseIX & synchWaitable )
+bool SynchLockAndWaitIX::notifyAsynchSignal( id_type threadId )
 {
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
+    bool result{false};
 
-    ListLockAndWait * waitList = mapResource.getResource( &synchWaitable );
-    if ( waitList != nullptr )
-    {
-        OUTPUT_WARN("The event [ %p ] failed, going to notify error [ %d ] locked threads.", &synchWaitable, waitList->getSize());
-        ASSERT( waitList->isEmpty( ) == false );
+    SynchLockAndWaitIX::sWaiterBucket & bucket = SynchLockAndWaitIX::_waiterBucket( threadId );
+    ::pthread_mutex_lock( &bucket.wbLock );
 
-        ListLockAndWait::LISTPOS end = waitList->invalidPosition();
-        for ( ListLockAndWait::LISTPOS pos = waitList->firstPosition( ); pos != end; pos = waitList->nextPosition(pos))
+    for ( SynchLockAndWaitIX * lockAndWait = bucket.wbHead; lockAndWait != nullptr; lockAndWait = lockAndWait->mNextWaiter )
+    {
+        if ( reinterpret_cast<id_type>(lockAndWait->mContext) == threadId )
         {
-            SynchLockAndWaitIX * lockAndWait = waitList->valueAtPosition(pos);
-            ASSERT(lockAndWait != nullptr);
-            if (synchWaitable.checkSignaled(lockAndWait->mContext) == false)
-                break;
+            lockAndWait->_lock( );
+            if ( lockAndWait->_noEventFired( ) )
+            {
+                lockAndWait->mFiredEntry = NESynchTypesIX::SynchAsynchSignal;
+                lockAndWait->_notifyEvent( );
+                result = true;
+            }
 
-            int index = lockAndWait->_getWaitableIndex( synchWaitable );
-            ASSERT(index != NECommon::INVALID_INDEX);
-            lockAndWait->mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(index + NESynchTypesIX::SynchObject0Error);
-            lockAndWait->_notifyEvent();
+            lockAndWait->_unlock( );
+            break;
         }
     }
 
-    mapResource.unlock( );
+    ::pthread_mutex_unlock( &bucket.wbLock );
+
+    return result;
 }
 
-bool SynchLockAndWaitIX::isWaitableRegistered( IEWaitableBaseIX & synchWaitable )
+void SynchLockAndWaitIX::_linkEntry( IEWaitableBaseIX & synchWaitable, SynchLockAndWaitIX::sWaitEntry & entry )
 {
-    bool result = false;
+    ASSERT( entry.weWaitable == nullptr );
+    SynchLockAndWaitIX::sWaitList & waitList = synchWaitable.mWaitList;
 
-    SynchResourceMapIX & mapResources { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResources.lock();
+    entry.weWaitable= &synchWaitable;
+    entry.wePrev    = waitList.wlTail;
+    entry.weNext    = nullptr;
+    if ( waitList.wlTail != nullptr )
+    {
+        waitList.wlTail->weNext = &entry;
+    }
+    else
+    {
+        waitList.wlHead = &entry;
+    }
 
-    result = mapResources.existResource(&synchWaitable);
+    waitList.wlTail = &entry;
+}
 
-    mapResources.unlock();
+void SynchLockAndWaitIX::_unlinkEntry( IEWaitableBaseIX & synchWaitable, SynchLockAndWaitIX::sWaitEntry & entry )
+{
+    ASSERT( entry.weWaitable == &synchWaitable );
+    SynchLockAndWaitIX::sWaitList & waitList = synchWaitable.mWaitList;
 
-    return result;
+    if ( entry.wePrev != nullptr )
+    {
+        entry.wePrev->weNext = entry.weNext;
+    }
+    else
+    {
+        waitList.wlHead = entry.weNext;
+    }
+
+    if ( entry.weNext != nullptr )
+    {
+        entry.weNext->wePrev = entry.wePrev;
+    }
+    else
+    {
+        waitList.wlTail = entry.wePrev;
+    }
+
+    entry.weWaitable= nullptr;
+    entry.wePrev    = nullptr;
+    entry.weNext    = nullptr;
 }
 
-bool SynchLockAndWaitIX::notifyAsynchSignal( id_type threadId )
+void SynchLockAndWaitIX::_releaseWithError( IEWaitableBaseIX & synchWaitable )
 {
-    bool result{false};
+    SynchLockAndWaitIX::sWaitList & waitList = synchWaitable.mWaitList;
+    ::pthread_mutex_lock( &waitList.wlLock );
 
-    SynchResourceMapIX & mapResource { SynchLockAndWaitIX::_mapSynchResources() };
-    mapResource.lock( );
-    do 
+    while ( waitList.wlHead != nullptr )
     {
-        SynchLockAndWaitIX::MapWaitIDResource & mapReousrces { SynchLockAndWaitIX::_mapWaitResourceIds() };
-        mapReousrces.lock();
-        SynchLockAndWaitIX * lockAndWait = mapReousrces.findResourceObject(static_cast<ptr_type>(threadId));
-        if (lockAndWait != nullptr)
+        sWaitEntry & entry = *waitList.wlHead;
+        SynchLockAndWaitIX & lockAndWait = *entry.weWaiter;
+
+        lockAndWait._lock( );
+        if ( lockAndWait._noEventFired( ) )
         {
-            lockAndWait->mFiredEntry = NESynchTypesIX::SynchAsynchSignal;
-            result = lockAndWait->_notifyEvent();
-        }
+            OUTPUT_WARN("The waitable [ %p / %s ] failed, notifying error to locked thread [ %p ]."
+                        , &synchWaitable
+                        , NESynchTypesIX::getString(synchWaitable.getSynchType())
+                        , reinterpret_cast<id_type>(lockAndWait.mContext));
 
-        mapReousrces.unlock();
-    } while (false);
+            lockAndWait.mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(entry.weIndex + NESynchTypesIX::SynchObject0Error);
+            lockAndWait._notifyEvent( );
+        }
 
-    mapResource.unlock();
+        SynchLockAndWaitIX::_unlinkEntry( synchWaitable, entry );
+        lockAndWait._unlock( );
+    }
 
-    return result;
+    ::pthread_mutex_unlock( &waitList.wlLock );
 }
 
 SynchLockAndWaitIX::SynchLockAndWaitIX(   IEWaitableBaseIX ** listWaitables
-                                            , int count
-                                            , NESynchTypesIX::eMatchCondition matchCondition
-                                            , unsigned int msTimeout )
+                                        , int count
+                                        , NESynchTypesIX::eMatchCondition matchCondition
+                                        , unsigned int msTimeout )
     : mDescribe         ( count > 1 ? SynchLockAndWaitIX::eWaitType::WaitMultipleObjects : SynchLockAndWaitIX::eWaitType::WaitSingleObject )
     , mMatchCondition   ( matchCondition )
     , mWaitTimeout      ( msTimeout )
     , mContext          ( pthread_self() )
     , mPosixMutex       ( )
     , mMutexValid       ( false )
-    , mPosixMutexAttr   ( )
-    , mMutexAttrValid   ( false )
+#if !defined(__linux__)
     , mCondVariable     ( )
     , mCondVarValid     ( false )
-    , mCondAttribute    ( )
-    , mCondAttrValid    ( false )
+#endif  // !defined(__linux__)
+    , mWakeSequence     ( 0 )
+    , mWaitExpires      ( )
     , mFiredEntry       ( NESynchTypesIX::SynchObjectInvalid )
-    , mWaitingList      ( count )
+    , mCheckAll         ( false )
+    , mCount            ( MACRO_MIN(NECommon::MAXIMUM_WAITING_OBJECTS, count) )
+    , mNextWaiter       ( nullptr )
+    , mWaitEntries      ( )
 {
     ASSERT( listWaitables  != nullptr);
 
-    if ( _initPosixSynchObjects() )
+    for ( int i = 0; i < mCount; ++ i )
     {
-        SynchResourceMapIX & mapResources { SynchLockAndWaitIX::_mapSynchResources() };
-        mapResources.lock();
-        count = MACRO_MIN(NECommon::MAXIMUM_WAITING_OBJECTS, count);
+        sWaitEntry & entry  = mWaitEntries[i];
+        entry.weWaiter      = this;
+        entry.weWaitable    = nullptr;
+        entry.weIndex       = i;
+        entry.wePrev        = nullptr;
+        entry.weNext        = nullptr;
+    }
 
-        if ( (mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny ) || (mDescribe == SynchLockAndWaitIX::eWaitType::WaitSingleObject) )
+    if ( _initPosixSynchObjects() )
+    {
+        for ( int i = 0; i < mCount; ++ i, ++ listWaitables )
         {
-            for ( uint32_t i = 0; i < static_cast<uint32_t>(count); ++ i, ++ listWaitables )
+            IEWaitableBaseIX * synchWaitable = *listWaitables;
+            if ( synchWaitable == nullptr )
             {
-                IEWaitableBaseIX * synchWaitable = *listWaitables;
-                if (synchWaitable != nullptr)
-                {
-                    ASSERT( (static_cast<unsigned int>(synchWaitable->getSynchType()) & static_cast<unsigned int>(NESynchTypesIX::eSynchObject::SoWaitable)) != 0);
-
-                    mapResources.registerResourceObject(synchWaitable, this);
-                    // OUTPUT_DBG("Waitable [ %p ] is [ %s ]", synchWaitable, synchWaitable->IsSignaled() ? "signaled" : "not signaled");
-
-                    if (synchWaitable->checkSignaled(mContext) && synchWaitable->notifyRequestOwnership(mContext))
-                    {
-                        OUTPUT_DBG("Waitable [ %s ] with ID [ %p ] of type [ %s ] is signaled, going unlock thread [ %p ]"
-                                    , synchWaitable->getName().getString()
-                                    , synchWaitable
-                                    , NESynchTypesIX::getString(synchWaitable->getSynchType())
-                                    , reinterpret_cast<id_type>(mContext));
-
-                        mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i);
-                        synchWaitable->notifyReleasedThreads(1);
-                        mWaitingList.resize(i);
-                        break;
-                    }
-
-                    mWaitingList[i] = synchWaitable;
-                }
-                else
-                {
-                    mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i + NESynchTypesIX::SynchObject0Error);
-                    mWaitingList.resize(i);
-                    break;
-                }
+                mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i + NESynchTypesIX::SynchObject0Error);
+                mCount      = i;
+                break;
             }
-        }
-        else
-        {
-            bool eventFired = true;
 
-            for ( uint32_t i = 0; i < static_cast<uint32_t>(count); ++ i, ++ listWaitables )
+            ASSERT( (static_cast<unsigned int>(synchWaitable->getSynchType()) & static_cast<unsigned int>(NESynchTypesIX::eSynchObject::SoWaitable)) != 0);
+            if ( _isWaitAll( ) )
             {
-                IEWaitableBaseIX * synchWaitable = *listWaitables;
-                if ( synchWaitable != nullptr )
-                {
-                    mapResources.registerResourceObject(synchWaitable, this);
-                    if ( (eventFired) && (synchWaitable->checkSignaled(mContext) == false) )
-                    {
-                        eventFired = false;
-                    }
-
-                    mWaitingList[i] = synchWaitable;
-                }
-                else
-                {
-                    mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(i + NESynchTypesIX::SynchObject0Error);
-                    mWaitingList.resize(i);
-                    break;
-                }
+                // the signaled state of all waitables is checked at once when start waiting.
+                ::pthread_mutex_lock( &synchWaitable->mWaitList.wlLock );
+                _lock( );
+                SynchLockAndWaitIX::_linkEntry( *synchWaitable, mWaitEntries[i] );
+                _unlock( );
+                ::pthread_mutex_unlock( &synchWaitable->mWaitList.wlLock );
             }
-
-            if (eventFired && _requestOwnership(NESynchTypesIX::SynchObjectAll))
+            else if ( _registerWaitable( *synchWaitable, i ) )
             {
-                OUTPUT_DBG("Releasing thread [ %p ], all events are fired.", reinterpret_cast<id_type>(mContext));
-
-                mFiredEntry = NESynchTypesIX::SynchObjectAll;
-                for (uint32_t i = 0; i < mWaitingList.getSize(); ++ i)
-                {
-                    mWaitingList[i]->notifyReleasedThreads(1);
-                }
+                break;
             }
         }
 
-        mapResources.unlock();
+        _lock( );
+        mCheckAll = _isWaitAll( ) && _noEventFired( );
+        _unlock( );
     }
     else
     {
         _releasePosixSynchObjects();
+        mCount = 0;
     }
 }
 
 SynchLockAndWaitIX::~SynchLockAndWaitIX( void )
 {
-	SynchLockAndWaitIX::_mapSynchResources().removeResourceObject(this, true);
-}
+    for ( int i = 0; i < mCount; ++ i )
+    {
+        sWaitEntry & entry = mWaitEntries[i];
+        for ( ; ; )
+        {
+            // The waiting list is locked before the waiter, here the order is reverse.
+            // Try to lock the list and back off on failure to avoid deadlock.
+            _lock( );
+            IEWaitableBaseIX * synchWaitable = entry.weWaitable;
+            if ( synchWaitable == nullptr )
+            {
+                _unlock( );
+                break;
+            }
+            else if ( RETURNED_OK == ::pthread_mutex_trylock( &synchWaitable->mWaitList.wlLock ) )
+            {
+                SynchLockAndWaitIX::_unlinkEntry( *synchWaitable, entry );
+                ::pthread_mutex_unlock( &synchWaitable->mWaitList.wlLock );
+                _unlock( );
+                break;
+            }
 
-inline bool SynchLockAndWaitIX::_noEventFired( void ) const
-{
-    return (mFiredEntry == NESynchTypesIX::SynchObjectInvalid);
+            _unlock( );
+            ::sched_yield( );
+        }
+    }
+
+    _releasePosixSynchObjects( );
 }
 
-inline bool SynchLockAndWaitIX::_isEmpty( void ) const
+inline bool SynchLockAndWaitIX::_noEventFired( void ) const
 {
-    return mWaitingList.isEmpty();
+    return (mFiredEntry.load( ) == NESynchTypesIX::SynchObjectInvalid);
 }
 
-inline bool SynchLockAndWaitIX::_notifyEvent( void )
+inline bool SynchLockAndWaitIX::_isWaitAll( void ) const
 {
-    bool result = false;
-
-    if (_isValid() && _lock())
-    {
-        result = RETURNED_OK == pthread_cond_signal(&mCondVariable);
-        _unlock();
-    }
-
-    return result;
+    return (mDescribe == SynchLockAndWaitIX::eWaitType::WaitMultipleObjects) && (mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionExact);
 }
 
 inline bool SynchLockAndWaitIX::_initPosixSynchObjects( void )
 {
-    // Init POSIX mutex
-    if (RETURNED_OK == ::pthread_mutexattr_init( &mPosixMutexAttr ))
-    {
-        mMutexAttrValid = true;
-        if (RETURNED_OK == ::pthread_mutexattr_settype( &mPosixMutexAttr, PTHREAD_MUTEX_NORMAL ))
-        {
-            mMutexValid = (RETURNED_OK == ::pthread_mutex_init( &mPosixMutex, &mPosixMutexAttr ));
-        }
-    }
+    mMutexValid = (RETURNED_OK == ::pthread_mutex_init( &mPosixMutex, nullptr ));
 
-    // Init POSIX condition variable
-    if (RETURNED_OK == ::pthread_condattr_init( &mCondAttribute ))
+    if ( mWaitTimeout != NECommon::WAIT_INFINITE )
     {
-        mCondAttrValid = true;
-        if (RETURNED_OK == ::pthread_condattr_setpshared( &mCondAttribute, PTHREAD_PROCESS_PRIVATE ))
-        {
-            mCondVarValid = (RETURNED_OK == ::pthread_cond_init( &mCondVariable, &mCondAttribute ));
-        }
+#if defined(__linux__)
+        // the futex waits for the absolute time of monotonic clock.
+        ::clock_gettime( CLOCK_MONOTONIC, &mWaitExpires );
+        NESynchTypesIX::convTimeout( mWaitExpires, mWaitTimeout );
+#else   // !defined(__linux__)
+        NESynchTypesIX::timeoutFromNow( mWaitExpires, mWaitTimeout );
+#endif  // defined(__linux__)
     }
 
+#if defined(__linux__)
+    return mMutexValid;
+#else   // !defined(__linux__)
+    mCondVarValid = (RETURNED_OK == ::pthread_cond_init( &mCondVariable, nullptr ));
     return (mMutexValid && mCondVarValid);
+#endif  // defined(__linux__)
 }
 
 inline void SynchLockAndWaitIX::_releasePosixSynchObjects( void )
@@ -421,175 +431,244 @@ inline void SynchLockAndWaitIX::_releasePosixSynchObjects( void )
         mMutexValid = false;
     }
 
-    if (mMutexAttrValid)
-    {
-        ::pthread_mutexattr_destroy(&mPosixMutexAttr);
-        mMutexAttrValid = false;
-    }
-
+#if !defined(__linux__)
     if (mCondVarValid)
     {
         ::pthread_cond_destroy(&mCondVariable);
         mCondVarValid = false;
     }
-
-    if (mCondAttrValid)
-    {
-        ::pthread_condattr_destroy(&mCondAttribute);
-        mCondAttrValid = false;
-    }
+#endif  // !defined(__linux__)
 }
 
 inline bool SynchLockAndWaitIX::_isValid( void ) const
 {
-    return ((mMutexValid && mCondVarValid) && (mWaitingList.isEmpty() == false));
+    return (mMutexValid && (mCount > 0));
 }
 
-inline bool SynchLockAndWaitIX::_lock( void )
+inline void SynchLockAndWaitIX::_lock( void )
 {
-    return (mMutexValid && (RETURNED_OK == pthread_mutex_lock(&mPosixMutex)));
+    ::pthread_mutex_lock( &mPosixMutex );
 }
 
 inline void SynchLockAndWaitIX::_unlock( void )
 {
-    if (mMutexValid)
-    {
-        ::pthread_mutex_unlock( &mPosixMutex );
-    }
+    ::pthread_mutex_unlock( &mPosixMutex );
 }
 
 inline int SynchLockAndWaitIX::_waitCondition( void )
 {
+#if defined(__linux__)
+
+    // The notifying thread changes the sequence when the waiter is locked,
+    // the futex does not block if the sequence changed after unlocking.
+    int result = RETURNED_OK;
+    uint32_t sequence = mWakeSequence.load( std::memory_order_relaxed );
+    const timespec * expires = mWaitTimeout != NECommon::WAIT_INFINITE ? &mWaitExpires : nullptr;
+    _unlock( );
+
+    if ( ::syscall( SYS_futex, reinterpret_cast<uint32_t *>(&mWakeSequence), FUTEX_WAIT_BITSET_PRIVATE, sequence, expires, nullptr, FUTEX_BITSET_MATCH_ANY ) != 0 )
+    {
+        result = errno != EAGAIN ? errno : RETURNED_OK;
+    }
+
+    _lock( );
+    return result;
+
+#else   // !defined(__linux__)
+
     if ( mWaitTimeout == NECommon::WAIT_INFINITE)
     {
         return ::pthread_cond_wait(&mCondVariable, &mPosixMutex);
     }
     else
     {
-        timespec waitTimeout;
-        NESynchTypesIX::timeoutFromNow(waitTimeout, mWaitTimeout);
-        return ::pthread_cond_timedwait( &mCondVariable, &mPosixMutex, &waitTimeout );
+        return ::pthread_cond_timedwait( &mCondVariable, &mPosixMutex, &mWaitExpires );
     }
+
+#endif  // defined(__linux__)
 }
 
-inline int SynchLockAndWaitIX::_getWaitableIndex( const IEWaitableBaseIX & synchWaitable ) const
+inline void SynchLockAndWaitIX::_notifyEvent( void )
 {
-    int result = NECommon::INVALID_INDEX;
-    for ( uint32_t i = 0; i < mWaitingList.getSize(); ++ i )
+#if defined(__linux__)
+    mWakeSequence.fetch_add( 1, std::memory_order_relaxed );
+    ::syscall( SYS_futex, reinterpret_cast<uint32_t *>(&mWakeSequence), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0 );
+#else   // !defined(__linux__)
+    ::pthread_cond_signal( &mCondVariable );
+#endif  // defined(__linux__)
+}
+
+void SynchLockAndWaitIX::_registerWaiter( void )
+{
+    SynchLockAndWaitIX::sWaiterBucket & bucket = SynchLockAndWaitIX::_waiterBucket( reinterpret_cast<id_type>(mContext) );
+    ::pthread_mutex_lock( &bucket.wbLock );
+    mNextWaiter = bucket.wbHead;
+    bucket.wbHead = this;
+    ::pthread_mutex_unlock( &bucket.wbLock );
+}
+
+void SynchLockAndWaitIX::_unregisterWaiter( void )
+{
+    SynchLockAndWaitIX::sWaiterBucket & bucket = SynchLockAndWaitIX::_waiterBucket( reinterpret_cast<id_type>(mContext) );
+    ::pthread_mutex_lock( &bucket.wbLock );
+    for ( SynchLockAndWaitIX ** next = &bucket.wbHead; *next != nullptr; next = &(*next)->mNextWaiter )
     {
-        if (mWaitingList[i] == &synchWaitable)
+        if ( *next == this )
         {
-            result = i;
+            *next = mNextWaiter;
             break;
         }
     }
 
+    mNextWaiter = nullptr;
+    ::pthread_mutex_unlock( &bucket.wbLock );
+}
+
+bool SynchLockAndWaitIX::_registerWaitable( IEWaitableBaseIX & synchWaitable, int index )
+{
+    bool result = true;
+
+    ::pthread_mutex_lock( &synchWaitable.mWaitList.wlLock );
+    _lock( );
+
+    if ( _noEventFired( ) == false )
+    {
+        // nothing to do, the thread is already released.
+    }
+    else if ( synchWaitable.checkSignaled( mContext ) && synchWaitable.notifyRequestOwnership( mContext ) )
+    {
+        OUTPUT_DBG("Waitable [ %s ] with ID [ %p ] of type [ %s ] is signaled, going unlock thread [ %p ]"
+                    , synchWaitable.getName().getString()
+                    , &synchWaitable
+                    , NESynchTypesIX::getString(synchWaitable.getSynchType())
+                    , reinterpret_cast<id_type>(mContext));
+
+        mFiredEntry = static_cast<NESynchTypesIX::eSynchObjectFired>(index);
+        synchWaitable.notifyReleasedThreads(1);
+    }
+    else
+    {
+        SynchLockAndWaitIX::_linkEntry( synchWaitable, mWaitEntries[index] );
+        result = false;
+    }
+
+    _unlock( );
+    ::pthread_mutex_unlock( &synchWaitable.mWaitList.wlLock );
+
     return result;
 }
 
-NESynchTypesIX::eSynchObjectFired SynchLockAndWaitIX::SynchLockAndWaitIX::_checkEventFired( IEWaitableBaseIX & synchObject )
+SynchLockAndWaitIX::eCheckAll SynchLockAndWaitIX::_checkAllFired( IEWaitableBaseIX * lockedWaitable )
 {
-    NESynchTypesIX::eSynchObjectFired result = NESynchTypesIX::SynchObjectInvalid;
+    IEWaitableBaseIX * lockedList[NECommon::MAXIMUM_WAITING_OBJECTS];
+    int lockedCount = 0;
+    bool isBusy     = false;
+    bool isLinked   = true;
 
-    if (synchObject.checkSignaled(mContext) && (mWaitingList.getSize() != 0) && (mFiredEntry == NESynchTypesIX::SynchObjectInvalid))
+    for ( int i = 0; (i < mCount) && (isBusy == false) && isLinked; ++ i )
     {
-        if (mDescribe == SynchLockAndWaitIX::eWaitType::WaitSingleObject)
+        IEWaitableBaseIX * synchWaitable = mWaitEntries[i].weWaitable;
+        if ( synchWaitable == nullptr )
         {
-            result = NESynchTypesIX::SynchObject0;
+            // the waiter is not registered in all waiting lists yet and checks later.
+            isLinked = false;
+            break;
         }
-        else if (mMatchCondition == NESynchTypesIX::eMatchCondition::MatchConditionAny)
+
+        bool isLocked = (synchWaitable == lockedWaitable);
+        for ( int j = 0; (j < lockedCount) && (isLocked == false); ++ j )
         {
-            result = static_cast<NESynchTypesIX::eSynchObjectFired>(_getWaitableIndex(synchObject));
+            isLocked = (lockedList[j] == synchWaitable);
         }
-        else
+
+        if ( isLocked == false )
         {
-            uint32_t i = 0;
-#ifdef _DEBUG
-            for ( ; i < mWaitingList.getSize(); ++ i)
+            if ( RETURNED_OK == ::pthread_mutex_trylock( &synchWaitable->mWaitList.wlLock ) )
             {
-                IEWaitableBaseIX *waitable = mWaitingList[i];
-                ASSERT(waitable != nullptr);
-                if (waitable->checkSignaled(mContext) == false)
-                {
-                    OUTPUT_DBG( "Waitable [ %s ] ID [ %p ] type [ %s ] is NOT signaled yet, interrupting checkup."
-                        , waitable->getName( ).getString( )
-                        , waitable
-                        , NESynchTypesIX::getString( waitable->getSynchType( ) ) );
-                    break;
-                }
-#ifdef DEBUG
-                else
+                lockedList[lockedCount ++] = synchWaitable;
+            }
+            else
+            {
+                isBusy = true;
+            }
+        }
+    }
+
+    SynchLockAndWaitIX::eCheckAll result = isBusy ? SynchLockAndWaitIX::eCheckAll::CheckAllBusy : SynchLockAndWaitIX::eCheckAll::CheckAllNotSignaled;
+    if ( (isBusy == false) && isLinked )
+    {
+        int i = 0;
+        for ( ; (i < mCount) && mWaitEntries[i].weWaitable->checkSignaled( mContext ); ++ i)
+            ;
+
+        if ( (i == mCount) && _requestOwnershipAll( ) )
+        {
+            OUTPUT_DBG("Releasing thread [ %p ], all events are fired.", reinterpret_cast<id_type>(mContext));
+
+            result      = SynchLockAndWaitIX::eCheckAll::CheckAllFired;
+            mFiredEntry = NESynchTypesIX::SynchObjectAll;
+            for ( i = 0; i < mCount; ++ i )
+            {
+                IEWaitableBaseIX * synchWaitable = mWaitEntries[i].weWaitable;
+                if ( synchWaitable != lockedWaitable )
                 {
-                    OUTPUT_DBG( "Waitable [ %s ] ID [ %p ] type [ %s ] is signaled."
-                        , waitable->getName( ).getString( )
-                        , waitable
-                        , NESynchTypesIX::getString( waitable->getSynchType( ) ) );
+                    // the caller notifies the waitable which list it has locked.
+                    synchWaitable->notifyReleasedThreads( 1 );
                 }
-#endif // DEBUG
-            }
-#else   // !_DEBUG
-            for (  ; (i < mWaitingList.getSize()) && mWaitingList.valueAtPosition(i)->checkSignaled(mContext); ++ i)
-                ;
-#endif  // !_DEBUG
 
-            if (i == mWaitingList.getSize())
-                result = NESynchTypesIX::SynchObjectAll;
+                SynchLockAndWaitIX::_unlinkEntry( *synchWaitable, mWaitEntries[i] );
+            }
         }
     }
 
+    for ( int j = 0; j < lockedCount; ++ j )
+    {
+        ::pthread_mutex_unlock( &lockedList[j]->mWaitList.wlLock );
+    }
+
     return result;
 }
 
-bool SynchLockAndWaitIX::_requestOwnership( const NESynchTypesIX::eSynchObjectFired firedEvent )
+void SynchLockAndWaitIX::_waitForEvent( void )
 {
-    bool result = false;
+    _lock( );
 
-    ASSERT(firedEvent >= NESynchTypesIX::SynchObject0 && firedEvent <= NESynchTypesIX::SynchObjectAll);
-    if ( firedEvent != NESynchTypesIX::SynchObjectAll )
+    while ( _noEventFired( ) )
     {
-        ASSERT(mWaitingList.getSize() > static_cast<uint32_t>(firedEvent));
-        IEWaitableBaseIX *waitable = mWaitingList[static_cast<uint32_t>(firedEvent)];
-        
-#ifdef DEBUG
-        if (waitable == nullptr)
+        if ( mCheckAll )
+        {
+            mCheckAll = false;
+            if ( _checkAllFired( nullptr ) == SynchLockAndWaitIX::eCheckAll::CheckAllBusy )
+            {
+                mCheckAll = true;
+                _unlock( );
+                ::sched_yield( );
+                _lock( );
+            }
+        }
+        else
         {
-            OUTPUT_ERR("Attention! A waitable at index [ %d ] in the list [ %p ] having size [ %d] of thread [ %p ] has address [ %p ]"
-                        , static_cast<int>(firedEvent)
-                        , this
-                        , mWaitingList.getSize()
-                        , Thread::getCurrentThread()
-                        , waitable);
+            int waitResult = _waitCondition( );
+            if ( (waitResult != RETURNED_OK) && (waitResult != EINTR) && _noEventFired( ) )
+            {
+                mFiredEntry = (waitResult == ETIMEDOUT) || (waitResult == EBUSY) ? NESynchTypesIX::SynchObjectTimeout : NESynchTypesIX::SynchWaitInterrupted;
+            }
         }
+    }
 
-        ASSERT(waitable != nullptr);
-#endif // DEBUG
+    _unlock( );
+}
 
-        OUTPUT_DBG("Thread [ %p ] requests ownership of waitable [ %s ], thread waits no more waitables."
-                    , reinterpret_cast<id_type>(mContext)
-                    , NESynchTypesIX::getString(waitable->getSynchType()));
+bool SynchLockAndWaitIX::_requestOwnershipAll( void )
+{
+    OUTPUT_DBG("Thread [ %p ] requests ownership of [ %d ] waitables.", reinterpret_cast<id_type>(mContext), mCount);
 
-        result = waitable->notifyRequestOwnership(mContext);
-    }
-    else
+    bool result = true;
+    for ( int i = 0; (i < mCount) && result; ++ i )
     {
-        ASSERT(mWaitingList.getSize() <= static_cast<uint32_t>(firedEvent));
-        OUTPUT_DBG("Thread [ %p ] requests ownership of [ %d ] waitables.", reinterpret_cast<id_type>(mContext), mWaitingList.getSize());
-
-        result = true;
-        for (uint32_t i = 0; (i < mWaitingList.getSize()) && result; ++ i)
-        {
-            IEWaitableBaseIX *waitable = mWaitingList[i];
-            ASSERT(waitable != nullptr);
-            result = waitable->notifyRequestOwnership(mContext);
-
-            OUTPUT_DBG("Thread [ %p ] requested ownership of waitable [ %s ] listed [ %d of %d ], the ownership is [ %s ], the current state of waitable [ %s ]"
-                        , reinterpret_cast<id_type>(mContext)
-                        , NESynchTypesIX::getString(waitable->getSynchType())
-                        , i + 1
-                        , mWaitingList.getSize()
-                        , result ? "taken" : "rejected"
-                        , waitable->checkSignaled(mContext) ? "signaled" : "not signaled");
-        }
+        IEWaitableBaseIX * synchWaitable = mWaitEntries[i].weWaitable;
+        ASSERT( synchWaitable != nullptr );
+        result = synchWaitable->notifyRequestOwnership( mContext );
     }
 
     return result;
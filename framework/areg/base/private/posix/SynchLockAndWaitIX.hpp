@@ -26,20 +26,14 @@
 #include "areg/base/NECommon.hpp"
 #include "areg/base/private/posix/NESynchTypesIX.hpp"
 #include "areg/base/IESynchObject.hpp"
-#include "areg/base/TEHashMap.hpp"
-#include "areg/base/TELinkedList.hpp"
-#include "areg/base/TEFixedArray.hpp"
-#include "areg/base/TEResourceMap.hpp"
-#include "areg/base/TEResourceListMap.hpp"
 
+#include <atomic>
 #include <pthread.h>
 
  /************************************************************************
   * dependencies.
   ************************************************************************/
 class IEWaitableBaseIX;
-class SynchLockAndWaitIX;
-class SynchLockAndWaitIX;
 
 //////////////////////////////////////////////////////////////////////////
 // SynchLockAndWaitIX class declaration
@@ -50,89 +44,51 @@ class SynchLockAndWaitIX;
  *          There is a limitation of waiting objects at once, and the maximum numbers are
  *          equal to NECommon::MAXIMUM_WAITING_OBJECTS.
  *          Use static methods for waiting functionalities. The internal methods are hidden.
+ *
+ *          Every waitable object keeps its own list of waiters, protected by its own lock,
+ *          so that signaling a waitable touches only the threads that wait for it.
+ *          Every waiter blocks on its own wake word (a futex on Linux, a condition
+ *          variable on other POSIX systems) and is released by the thread that
+ *          gave it the ownership of the waitable. The locking order is always
+ *          the waiting list of waitable first, then the waiter.
  **/
 class SynchLockAndWaitIX
 {
-    /**
-     * \brief   The list of LockAndWait objects.
-     **/
-    using ListLockAndWait       = TELinkedList<SynchLockAndWaitIX *>;
-    /**
-     * \brief   The hash map container of waitable object and LockAndWait lists.
-     **/
-    using MapLockAndWait        = TEMap<IEWaitableBaseIX *, ListLockAndWait>;
+//////////////////////////////////////////////////////////////////////////
+// Friend classes
+//////////////////////////////////////////////////////////////////////////
+    friend class TimerManager;
+    friend class WaitableTimerIX;
 
 //////////////////////////////////////////////////////////////////////////
-// ImplResourceListMap class declaration
+// Internal types
 //////////////////////////////////////////////////////////////////////////
+public:
     /**
-     * \brief   The helper class of resource list map that contains helper functions implementation.
+     * \brief   SynchLockAndWaitIX::sWaitEntry
+     *          The entry in the waiting list of a waitable object. Every waiter has
+     *          one entry per waitable it waits for. The entry is linked only
+     *          while the waitable is able to release the waiter.
      **/
-    class ImplResourceListMap : public TEResourceListMapImpl<IEWaitableBaseIX *, SynchLockAndWaitIX, ListLockAndWait>
+    struct sWaitEntry
     {
-    public:
-        /**
-         * \brief   Called when all resources are removed.
-         *          This function is called from RemoveAllResources() for every single
-         *          resource being unregistered.
-         * \param   Key     The Key value of resource.
-         * \param   List    The list of resource objects.
-         **/
-        inline void implCleanResourceList( IEWaitableBaseIX * & /* Key */, ListLockAndWait & List )
-        {
-        	List.clear();
-        }
-
-        /**
-         * \brief   Called when need to add resource object to the list.
-         * \param   List        The list of resource objects.
-         * \param   Resource    The resource object to add to the list.
-         **/
-        inline void implAddResource( ListLockAndWait & List, SynchLockAndWaitIX * Resource )
-        {
-        	List.pushLast(Resource);
-        }
-
-        /**
-         * \brief   Called when need to remove resource object from the list.
-         * \param   List        The list of resource objects.
-         * \param   Resource    The resource object to remove from the list.
-         **/
-        inline bool implRemoveResource( ListLockAndWait & List, SynchLockAndWaitIX * Resource )
-        {
-        	return List.removeEntry( Resource );
-        }
+        SynchLockAndWaitIX *    weWaiter;   //!< The waiter that owns the entry.
+        IEWaitableBaseIX *      weWaitable; //!< The waitable where entry is linked, or nullptr if not linked.
+        int                     weIndex;    //!< The index of waitable in the waiting list.
+        sWaitEntry *            wePrev;     //!< The previous entry in the waiting list of waitable.
+        sWaitEntry *            weNext;     //!< The next entry in the waiting list of waitable.
     };
 
     /**
-     * \brief   The resource list map of waitable object where the keys are waitable objects
-     *          and the resource objects are WaitAndLock objects in the list. The WaitAndLock
-     *          objects in the entire map are not unique, but should be unique in the list.
-     **/
-    using SynchResourceMapIX = TELockResourceListMap<IEWaitableBaseIX *, SynchLockAndWaitIX *, ListLockAndWait, MapLockAndWait, ImplResourceListMap>;
-
-//////////////////////////////////////////////////////////////////////////
-// The resource map for timer.
-//////////////////////////////////////////////////////////////////////////
-    /**
-     * \brief   The resource map of waitable, where keys are id_type and the values are WaitAndLock objects
+     * \brief   SynchLockAndWaitIX::sWaitList
+     *          The list of waiters of a waitable object. Each waitable has its own list.
      **/
-    using MapWaitID         = TEIdHashMap<SynchLockAndWaitIX *>;
-    /**
-     * \brief   Helper object for resource map basic method implementations
-     **/
-    using ImplWaitIDResource= TEResourceMapImpl<ptr_type, SynchLockAndWaitIX *>;
-    /**
-     * \brief   Resource map of waitable where the keys are pthread_t (thread ID) and the values are
-     *          LockAndWait objects. It is used in the timer.
-     **/
-    using MapWaitIDResource = TELockResourceMap<ptr_type, SynchLockAndWaitIX *, MapWaitID, ImplWaitIDResource>;
-
-//////////////////////////////////////////////////////////////////////////
-// Friend classes
-//////////////////////////////////////////////////////////////////////////
-    friend class TimerManager;
-    friend class WaitableTimerIX;
+    struct sWaitList
+    {
+        pthread_mutex_t         wlLock;     //!< The lock of the waiting list.
+        sWaitEntry *            wlHead;     //!< The first waiter in the list.
+        sWaitEntry *            wlTail;     //!< The last waiter in the list.
+    };
 
 //////////////////////////////////////////////////////////////////////////
 // Constants and statics
@@ -150,20 +106,31 @@ private:
     } eWaitType;
 
     /**
-     * \brief   SynchLockAndWaitIX::eEventFired
-     *          Describes the fired state of each event.
+     * \brief   SynchLockAndWaitIX::eCheckAll
+     *          The result of checking whether all waitables are signaled.
      **/
-    typedef enum class E_EventFired
+    typedef enum class E_CheckAll
     {
-          EventFiredNone        //!< No event has been fired.
-        , EventFiredOne         //!< Fired one event.
-        , EventFiredAll         //!< All waiting events are fired.
+          CheckAllNotSignaled   //!< Not all waitables are signaled.
+        , CheckAllFired         //!< All waitables are signaled and the ownership is taken.
+        , CheckAllBusy          //!< The waiting lists are locked by other threads, should check later.
+
+    } eCheckAll;
 
-    } eEventFired;
     /**
-     * \brief   The fixed array of waitable. The maximum size of array is NECommon::MAXIMUM_WAITING_OBJECTS
+     * \brief   The number of buckets to lookup waiters by thread ID.
      **/
-    using WaitingList   = TEFixedArray<IEWaitableBaseIX *>;
+    static constexpr uint32_t   WAITER_BUCKETS  { 64 };
+
+    /**
+     * \brief   SynchLockAndWaitIX::sWaiterBucket
+     *          The bucket of waiters to lookup by thread ID, used by asynchronous signals.
+     **/
+    struct sWaiterBucket
+    {
+        pthread_mutex_t         wbLock  = PTHREAD_MUTEX_INITIALIZER;    //!< The lock of the bucket.
+        SynchLockAndWaitIX *    wbHead  { nullptr };                    //!< The first waiter in the bucket.
+    };
 
 //////////////////////////////////////////////////////////////////////////
 // Public static methods.
@@ -251,12 +218,25 @@ public:
      **/
     static bool notifyAsynchSignal( id_type threadId );
 
+    /**
+     * \brief   Initializes the waiting list of a waitable object.
+     * \param   waitList    The waiting list to initialize.
+     **/
+    static void initWaitList( sWaitList & waitList );
+
+    /**
+     * \brief   Releases the waiting list of a waitable object.
+     * \param   waitList    The waiting list to release.
+     **/
+    static void releaseWaitList( sWaitList & waitList );
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden constructor / destructor
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Initializes WaitAndLock object, sets flags and checks signaled sate of waitables.
+     * \brief   Initializes WaitAndLock object, sets flags, registers in the waiting lists
+     *          of waitables and checks signaled sate of waitables.
      * \param   listWaitables   The list of waitables. The maximum number of entries should be NECommon::MAXIMUM_WAITING_OBJECTS
      * \param   count           The number of waitables in the list. The maximum number of entries should be NECommon::MAXIMUM_WAITING_OBJECTS.
      * \param   matchCondition  The signaled state matching criteria. Either it should have exact match, i.e. wait all events to be signaled,
@@ -266,7 +246,7 @@ private:
     SynchLockAndWaitIX( IEWaitableBaseIX ** listWaitables, int count, NESynchTypesIX::eMatchCondition matchCondition, unsigned int msTimeout );
 
     /**
-     * \brief   Destructor.
+     * \brief   Destructor. Unregisters from the waiting lists of waitables.
      **/
     ~SynchLockAndWaitIX( void );
 
@@ -275,20 +255,37 @@ private:
 //////////////////////////////////////////////////////////////////////////
 
     /**
-     * \brief   Returns static list of waitables, where keys are id_type and values are waitables.
+     * \brief   Returns the bucket of waiters of the specified thread.
      **/
-    static SynchLockAndWaitIX::MapWaitIDResource& _mapWaitResourceIds(void);
+    static SynchLockAndWaitIX::sWaiterBucket & _waiterBucket( id_type threadId );
 
     /**
-     * \brief   Returns the static instance of synchronization resource map.
-     */
-    static SynchResourceMapIX& _mapSynchResources(void);
+     * \brief   Links the entry to the end of waiting list of waitable.
+     *          Both, the waiting list and the waiter of the entry should be locked.
+     **/
+    static void _linkEntry( IEWaitableBaseIX & synchWaitable, sWaitEntry & entry );
+
+    /**
+     * \brief   Unlinks the entry from the waiting list of waitable.
+     *          Both, the waiting list and the waiter of the entry should be locked.
+     **/
+    static void _unlinkEntry( IEWaitableBaseIX & synchWaitable, sWaitEntry & entry );
+
+    /**
+     * \brief   Releases with error all waiters of waitable and unlinks them from the waiting list.
+     **/
+    static void _releaseWithError( IEWaitableBaseIX & synchWaitable );
 
     /**
      * \brief   Returns true if no event in the list is fired.
      **/
     inline bool _noEventFired( void ) const;
 
+    /**
+     * \brief   Returns true if the waiter waits for all waitables to be signaled.
+     **/
+    inline bool _isWaitAll( void ) const;
+
     /**
      * \brief   Initializes internal POSIX objects. Returns true if initialization succeeded.
      **/
@@ -306,11 +303,9 @@ private:
     inline bool _isValid( void ) const;
 
     /**
-     * \brief   Locks the WaitAndLock object, waits for event fired criteria.
-     *          This may block the calling thread.
-     * \return  Returns true if locking succeeded.
+     * \brief   Locks the WaitAndLock object.
      **/
-    inline bool _lock( void );
+    inline void _lock( void );
 
     /**
      * \brief   Unlocks WaitAndLock object.
@@ -318,41 +313,56 @@ private:
     inline void _unlock( void );
 
     /**
-     * \brief   Called to wait for condition variable. Either it waits with infinite wait flag or with timeout.
+     * \brief   Blocks the thread until it is notified or the timeout expires.
+     *          The WaitAndLock object should be locked, it is unlocked while waiting.
      * \return  Returns POSIX error code. If 0, the waiting method succeeded.
      **/
     inline int _waitCondition( void );
 
     /**
-     * \brief   Returns the index of registered waitable in the list.
-     * \param   synchWaitable   The instance of waitable object to lookup in the list.
+     * \brief   Wakes up the waiting thread. The WaitAndLock object should be locked.
      **/
-    inline int _getWaitableIndex( const IEWaitableBaseIX & synchWaitable ) const;
+    inline void _notifyEvent( void );
 
     /**
-     * \brief   Called to notify the event has been fired.
-     * \return  Returns true if succeeded to notify.
+     * \brief   Registers the waiter to be found by thread ID.
      **/
-    inline bool _notifyEvent( void );
+    void _registerWaiter( void );
 
     /**
-     * \brief   Checks whether the waiting list is empty.
+     * \brief   Unregisters the waiter, so that it cannot be found by thread ID anymore.
      **/
-    inline bool _isEmpty( void ) const;
+    void _unregisterWaiter( void );
 
     /**
-     * \brief   Checks whether the waitable event is fired or not.
-     * \param   synchObject The waitable object to check.
-     * \return  Returns one of event fired state.
+     * \brief   Links the waiter in the waiting list of waitable, checks the signaled state
+     *          and takes the ownership if waitable is signaled.
+     * \param   synchWaitable   The waitable to wait for.
+     * \param   index           The index of the waitable in the list.
+     * \return  Returns true if waiting is completed and there is no need to check other waitables.
      **/
-    NESynchTypesIX::eSynchObjectFired _checkEventFired( IEWaitableBaseIX & synchObject );
+    bool _registerWaitable( IEWaitableBaseIX & synchWaitable, int index );
 
     /**
-     * \brief   Called to notify threads to take fired event ownership.
-     * \param   firedEvent  The index of fired event in the list that notifies the threads to take ownership.
-     * \return  Returns true if threads are notified or took ownership.
+     * \brief   Checks whether all waitables are signaled and takes ownership of them.
+     *          The WaitAndLock object should be locked. The waiting lists are not blocked,
+     *          if any of them is locked by other thread, the check should be repeated later.
+     * \param   lockedWaitable  The waitable which waiting list is already locked by caller or nullptr.
+     * \return  Returns the result of checkup.
      **/
-    bool _requestOwnership( const NESynchTypesIX::eSynchObjectFired firedEvent );
+    eCheckAll _checkAllFired( IEWaitableBaseIX * lockedWaitable );
+
+    /**
+     * \brief   Waits until an event is fired, timeout expires or waiting is interrupted.
+     **/
+    void _waitForEvent( void );
+
+    /**
+     * \brief   Requests the ownership of all waitables in the list.
+     *          The waiting lists of all waitables should be locked.
+     * \return  Returns true if the thread took ownership of all waitables.
+     **/
+    bool _requestOwnershipAll( void );
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden member variables.
@@ -382,14 +392,7 @@ private:
      * \brief   The POSIX mutex validity flag.
      **/
     mutable bool                            mMutexValid;
-    /**
-     * \brief   Internal POSIX mutex attribute to initialize mutex.
-     **/
-    mutable pthread_mutexattr_t             mPosixMutexAttr;
-    /**
-     * \brief   The POSIX mutex attribute validity flag.
-     **/
-    mutable bool                            mMutexAttrValid;
+#if !defined(__linux__)
     /**
      * \brief   Internal POSIX conditional variable.
      **/
@@ -398,22 +401,36 @@ private:
      * \brief   The POSIX conditional variable validity flag.
      **/
     bool                                    mCondVarValid;
+#endif  // !defined(__linux__)
     /**
-     * \brief   Internal POSIX conditional variable attribute
+     * \brief   The wake sequence, increased on every notification. On Linux it is the futex word.
      **/
-    pthread_condattr_t                      mCondAttribute;
+    std::atomic_uint32_t                    mWakeSequence;
     /**
-     * \brief   The POSIX conditional variable attribute validity flag.
+     * \brief   The absolute time when the waiting expires.
      **/
-    bool                                    mCondAttrValid;
+    timespec                                mWaitExpires;
     /**
      * \brief   Indicates the fired event object or error code.
      **/
-    NESynchTypesIX::eSynchObjectFired       mFiredEntry;
+    std::atomic<NESynchTypesIX::eSynchObjectFired> mFiredEntry;
+    /**
+     * \brief   Flag, indicating that the waitable of the waiter for all objects is signaled
+     *          and the waiter should check the state of all waitables.
+     **/
+    bool                                    mCheckAll;
+    /**
+     * \brief   The number of waitables in the list.
+     **/
+    int                                     mCount;
+    /**
+     * \brief   The next waiter in the bucket to lookup by thread ID.
+     **/
+    SynchLockAndWaitIX *                    mNextWaiter;
     /**
-     * \brief   The list of waitables.
+     * \brief   The entries in the waiting lists of waitables.
      **/
-    WaitingList                             mWaitingList;
+    sWaitEntry                              mWaitEntries[NECommon::MAXIMUM_WAITING_OBJECTS];
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -0,0 +1,49 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/base/private/win32/SocketPollerWin32.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the poller of socket read events, Windows specific.
+ ************************************************************************/
+#include "areg/base/SocketPoller.hpp"
+
+#ifdef  _WIN32
+
+bool SocketPoller::_osCreate( void )
+{
+    return true;
+}
+
+void SocketPoller::_osRelease( void )
+{
+}
+
+bool SocketPoller::_osAddSocket( SOCKETHANDLE hSocket )
+{
+    Lock lock( mLock );
+    return mSockets.addIfUnique( hSocket );
+}
+
+void SocketPoller::_osRemoveSocket( SOCKETHANDLE hSocket )
+{
+    Lock lock( mLock );
+    mSockets.removeElem( hSocket );
+}
+
+void SocketPoller::_osWakeUp( void )
+{
+}
+
+int SocketPoller::_osWaitEvents( sSocketEvent * out_events, int maxEvents, unsigned int timeout )
+{
+    return _selectEvents( out_events, maxEvents, timeout );
+}
+
+#endif  // _WIN32
@@ -111,6 +111,7 @@ public:
 class IEEventConsumer;
 class EventDispatcher;
 class DispatcherThread;
+class SortedEventStack;
 class Thread;
 
 //////////////////////////////////////////////////////////////////////////
@@ -320,6 +321,51 @@ protected:
      **/
     virtual ~Event( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Allocation of events
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Overloaded new() operator. Allocates the event in the pool
+     *          of the calling thread, so that all events, including the events
+     *          declared by DECLARE_EVENT macro, are allocated by EventAllocator.
+     * \param   size    The size of the event object to allocate.
+     * \return  Valid pointer to a memory block of size 'size'.
+     **/
+    void * operator new( size_t size );
+
+    /**
+     * \brief   Overloaded new() operator, used by DEBUG_NEW. Allocates the event
+     *          in the pool of the calling thread, the source code information is ignored.
+     * \param   size    The size of the event object to allocate.
+     * \return  Valid pointer to a memory block of size 'size'.
+     **/
+    void * operator new( size_t size, int /*block*/, const char * /*file*/, int /*line*/ );
+
+    /**
+     * \brief   Overloaded placement new.
+     * \param   ptr     Pointer to the memory block where the event is located
+     * \return  Pointer to the memory block where the event is located, same as 'ptr'
+     **/
+    void * operator new( size_t /*size*/, void * ptr );
+
+    /**
+     * \brief   Overloaded delete() operator. Returns the memory of the event to the pool.
+     * \param   ptr     Pointer to the event memory block to delete.
+     **/
+    void operator delete( void * ptr );
+
+    /**
+     * \brief   Overloaded delete() operator, matching the new() operator used by DEBUG_NEW.
+     * \param   ptr     Pointer to the event memory block to delete.
+     **/
+    void operator delete( void * ptr, int, const char *, int );
+
+    /**
+     * \brief   Overloaded placement delete, does nothing.
+     **/
+    void operator delete( void * /*ptr*/, void * /*place*/ );
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -544,6 +590,15 @@ protected:
      **/
     DispatcherThread*   mTargetThread;
 
+private:
+    /**
+     * \brief   The intrusive link of the event in the lock-free event queue.
+     *          Only the event queue of the dispatcher is allowed to access it.
+     **/
+    Event*              mQueueNext;
+
+    friend class SortedEventStack;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden method calls.
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+#ifndef AREG_COMPONENT_EVENTALLOCATOR_HPP
+#define AREG_COMPONENT_EVENTALLOCATOR_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/EventAllocator.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pooled allocator of the memory of event objects.
+ *
+ ************************************************************************/
+
+ /************************************************************************
+  * Includes
+  ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/NEMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////
+// EventAllocator class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The allocator of the memory of event objects. The Event class
+ *          overloads the new and delete operators to allocate the events
+ *          by this allocator, so that every event, including the events
+ *          declared by DECLARE_EVENT macro, is allocated in the pool.
+ *
+ *          Every thread has own pool with the free lists of memory blocks,
+ *          sorted by size classes. The thread allocates the event in own pool
+ *          and the block of the released event returns to the pool where it
+ *          was allocated: the owner thread puts it in the free list without
+ *          locking, and other threads push it to the lock-free return list of
+ *          the pool, which the owner thread takes when the free list is empty.
+ *          Normally, the events are sent by one thread and released by the
+ *          dispatcher thread, so that the blocks go back to the sender and
+ *          are reused in the next events. The events bigger than the largest
+ *          size class are allocated in the heap.
+ *
+ *          When the thread exits, the free blocks of the pool are released
+ *          and the pool is reused by the next created thread.
+ **/
+class AREG_API EventAllocator
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The size of the memory blocks of the first size class, and the step of the size classes.
+    static constexpr uint32_t   BLOCK_GRANULARITY   { 64u };
+
+    //!< The number of size classes. The events of bigger size are allocated in the heap.
+    static constexpr uint32_t   SIZE_CLASS_COUNT    { 16u };
+
+    //!< The maximum number of free blocks of one size class cached in the pool of the thread.
+    static constexpr uint32_t   MAX_CACHED_BLOCKS   { 512u };
+
+//////////////////////////////////////////////////////////////////////////
+// Static methods
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the memory for the event object in the pool of the calling thread.
+     * \param   size    The size in bytes of the event object.
+     * \return  Returns the pointer to the allocated memory. Throws std::bad_alloc if failed.
+     **/
+    static void * allocate( size_t size );
+
+    /**
+     * \brief   Releases the memory of the event object, allocated by the allocator.
+     *          The memory block returns to the pool, where it was allocated.
+     * \param   ptr     The pointer to the memory to release. Ignored if nullptr.
+     **/
+    static void release( void * ptr );
+
+    /**
+     * \brief   Enables or disables the pools. If disabled, the events are allocated
+     *          in the heap, the memory of the allocated events returns to the pools.
+     *          The pools are enabled by default.
+     **/
+    static void setPoolEnabled( bool enable );
+
+    /**
+     * \brief   Returns true if the events are allocated in the pools.
+     **/
+    static bool isPoolEnabled( void );
+
+    /**
+     * \brief   Returns the counters of the allocator, summed in the pools of all threads.
+     **/
+    static NEMemory::sPoolStatistics getStatistics( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden / Forbidden method calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    EventAllocator( void ) = delete;
+    ~EventAllocator( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( EventAllocator );
+};
+
+#endif  // AREG_COMPONENT_EVENTALLOCATOR_HPP
@@ -454,6 +454,12 @@ namespace NEService
      **/
     constexpr unsigned int  INVALID_MESSAGE_ID  { static_cast<unsigned int>(~0) };    /*0xFFFFFFFF*/
 
+    /**
+     * \brief   NEService::INVALID_HANDLE
+     *          The invalid handle of stub or proxy address on the wire.
+     **/
+    constexpr uint32_t      INVALID_HANDLE      { 0u };
+
     /**
      * \brief   Predefined range of function calls
      **/
@@ -522,6 +528,12 @@ namespace NEService
         , ServiceLogConfigurationSaved
         //!< Sent by log collector service or client applications to log the messages.
         , ServiceLogMessage
+        //!< Sent by service provider to the message router to deliver the same message to several remote targets.
+        , ServiceMulticastMessage
+        //!< Sent by client applications to log the batch of messages with compact encoded log records.
+        , ServiceLogMessageBatch
+        //!< Sent by observer to the log collector service to set the filter of log messages to forward to the observer.
+        , ServiceLogObserverFilter
         //!< The last ID of service calls.
         , ServiceLastId         = SERVICE_ID_LAST  //!< Servicing call last ID
 
@@ -1653,6 +1665,12 @@ inline const char * NEService::getString( NEService::eFuncIdRange funcId )
         return "NEService::eFuncIdRange::ServiceLogConfigurationSaved";
     case NEService::eFuncIdRange::ServiceLogMessage:
         return "NEService::eFuncIdRange::ServiceLogMessage";
+    case NEService::eFuncIdRange::ServiceMulticastMessage:
+        return "NEService::eFuncIdRange::ServiceMulticastMessage";
+    case NEService::eFuncIdRange::ServiceLogMessageBatch:
+        return "NEService::eFuncIdRange::ServiceLogMessageBatch";
+    case NEService::eFuncIdRange::ServiceLogObserverFilter:
+        return "NEService::eFuncIdRange::ServiceLogObserverFilter";
     case NEService::eFuncIdRange::RequestFirstId:
         return "NEService::eFuncIdRange::RequestFirstId";
     case NEService::eFuncIdRange::ResponseFirstId:
@@ -76,6 +76,46 @@ public:
      **/
     static const ProxyAddress & getInvalidProxyAddress( void );
 
+    /**
+     * \brief   Creates and returns the handle of the proxy address created in the process.
+     *          The handle is sent to the router when the proxy is registered and
+     *          the other processes use it instead of the address when send messages.
+     * \param   addrProxy    The address of the proxy created in the process.
+     * \return  Returns the handle of the address or NEService::INVALID_HANDLE if failed.
+     **/
+    static uint32_t createHandle( const ProxyAddress & addrProxy );
+
+    /**
+     * \brief   Releases the handle of the proxy address created in the process.
+     * \param   handle  The handle to release.
+     **/
+    static void releaseHandle( uint32_t handle );
+
+    /**
+     * \brief   Updates the proxy address data of the handle created in the process.
+     * \param   addrProxy    The address of the proxy, which contains the handle.
+     **/
+    static void updateHandle( const ProxyAddress & addrProxy );
+
+    /**
+     * \brief   Sets the cookie of the process, which owns the handles of local
+     *          proxy addresses, and removes the handles of other processes.
+     * \param   cookie  The cookie of the process or NEService::COOKIE_UNKNOWN if disconnected.
+     **/
+    static void setHandleOwner( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Saves the handle of the proxy address of other process published by the router.
+     * \param   addrProxy    The address of proxy, which contains the handle and the cookie of owner process.
+     **/
+    static void registerRemoteHandle( const ProxyAddress & addrProxy );
+
+    /**
+     * \brief   Removes the handle of the proxy address of other process.
+     * \param   addrProxy    The address of proxy, which contains the handle and the cookie of owner process.
+     **/
+    static void unregisterRemoteHandle( const ProxyAddress & addrProxy );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -270,6 +310,15 @@ public:
      * \brief   Sets Proxy cookie value
      **/
     inline void setCookie(const ITEM_ID & cookie );
+    /**
+     * \brief   Returns the handle of proxy address used on the wire instead of
+     *          address data. NEService::INVALID_HANDLE if the address has no handle.
+     **/
+    inline uint32_t getHandle( void ) const;
+    /**
+     * \brief   Sets the handle of proxy address used on the wire instead of address data.
+     **/
+    inline void setHandle( uint32_t handle );
     /**
      * \brief   Returns Proxy source ID
      **/
@@ -343,6 +392,16 @@ public:
      **/
     void convFromString(const char * pathProxy, const char** out_nextPart = nullptr);
 
+    /**
+     * \brief   Writes the proxy address into the stream. If the address has a handle
+     *          known by the other processes, writes only the handle and the cookie
+     *          of the process owning the address. Otherwise, writes the address data.
+     *          The streaming operators read both forms.
+     * \param   stream  The streaming object to write data.
+     * \return  Returns the streaming object.
+     **/
+    IEOutStream & writeCompact( IEOutStream & stream ) const;
+
 protected:
     /**
      * \brief   Returns true if proxy address data is valid.
@@ -369,6 +428,13 @@ private:
      **/
     static unsigned int _magicNumber( const ProxyAddress & proxy );
 
+    /**
+     * \brief   Reads the proxy address data or the handle of the address from the stream.
+     *          If the stream contains the handle, searches the address data of the handle.
+     *          Returns the cookie read from the stream. The cookie is not set.
+     **/
+    ITEM_ID _readAddress( const IEInStream & stream );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -390,6 +456,10 @@ private:
      * \brief   The calculated number of proxy address
      **/
     unsigned int    mMagicNum;
+    /**
+     * \brief   The handle of the address on the wire.
+     **/
+    uint32_t        mHandle;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -428,6 +498,7 @@ inline ProxyAddress & ProxyAddress::operator = ( const ProxyAddress & source )
         mThreadName = source.mThreadName;
         mChannel    = source.mChannel;
         mMagicNum   = source.mMagicNum;
+        mHandle     = source.mHandle;
     }
 
     return (*this);
@@ -441,6 +512,7 @@ inline ProxyAddress & ProxyAddress::operator = ( ProxyAddress && source )noexcep
         mThreadName = std::move(source.mThreadName);
         mChannel    = std::move(source.mChannel);
         mMagicNum   = source.mMagicNum;
+        mHandle     = source.mHandle;
     }
 
     return (*this);
@@ -536,6 +608,16 @@ inline void ProxyAddress::setTarget(const ITEM_ID & target )
     return mChannel.setTarget(target);
 }
 
+inline uint32_t ProxyAddress::getHandle( void ) const
+{
+    return mHandle;
+}
+
+inline void ProxyAddress::setHandle( uint32_t handle )
+{
+    mHandle = handle;
+}
+
 inline ProxyAddress& ProxyAddress::self(void)
 {
     return (*this);
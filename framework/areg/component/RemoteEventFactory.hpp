@@ -19,6 +19,7 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
+#include "areg/base/TEArrayList.hpp"
 
 /************************************************************************
  * Dependencies
@@ -83,6 +84,40 @@ public:
      **/
     static StreamableEvent * createRequestFailedEvent( const RemoteMessage & stream, const Channel & comChannel );
 
+    /**
+     * \brief   Call to create the events of the multicast message for each target proxy,
+     *          which is reachable via specified communication channel. The multicast
+     *          message is created from the remote response event, which has additional
+     *          targets. All created events share the same data.
+     * \param   stream          The streaming object of multicast message.
+     * \param   comChannel      The communication channel object, which received the message.
+     * \param   out_events      On output, contains the list of created events, one per target proxy.
+     *                          The events should be delivered to the targets.
+     * \return  Returns the number of created events.
+     **/
+    static uint32_t createEventsFromMulticastStream( const RemoteMessage & stream, const Channel & comChannel, TEArrayList<StreamableEvent *> & OUT out_events );
+
+    /**
+     * \brief   Call to extract the list of unique cookies of the target connections of the multicast message.
+     *          The message router sends the multicast message once to each connection in the list.
+     * \param   stream          The streaming object of multicast message.
+     * \param   out_targets     On output, contains the list of unique cookies of target connections.
+     * \return  Returns the number of target connections.
+     **/
+    static uint32_t getMulticastTargets( const RemoteMessage & stream, TEArrayList<ITEM_ID> & OUT out_targets );
+
+    /**
+     * \brief   Call to create the messages of the multicast message for each target proxy,
+     *          which is reachable via specified target connection. The message router uses
+     *          it to send one message per target proxy to the connections, which do not
+     *          process the multicast messages. Each message is same as sent for a single target.
+     * \param   stream          The streaming object of multicast message.
+     * \param   target          The cookie of the target connection.
+     * \param   out_streams     On output, contains the list of created messages, one per target proxy.
+     * \return  Returns the number of created messages.
+     **/
+    static uint32_t createStreamsFromMulticastStream( const RemoteMessage & stream, const ITEM_ID & target, TEArrayList<RemoteMessage> & OUT out_streams );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor. Hidden
 //////////////////////////////////////////////////////////////////////////
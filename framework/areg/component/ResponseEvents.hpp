@@ -22,6 +22,7 @@
 #include "areg/component/ServiceResponseEvent.hpp"
 
 #include "areg/component/EventData.hpp"
+#include "areg/base/TEArrayList.hpp"
 
 /************************************************************************
  * List of declared classes:
@@ -335,6 +336,31 @@ protected:
      **/
     virtual ~RemoteResponseEvent( void ) = default;
 
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Adds the proxy to the list of additional targets of the event.
+     *          The event with additional targets is sent once as a multicast message,
+     *          and the message router delivers it to the connections of the targets.
+     *          All targets should be reachable via the same communication channel.
+     * \param   proxy   The address of the additional remote target proxy.
+     **/
+    inline void addMulticastTarget( const ProxyAddress & proxy );
+
+    /**
+     * \brief   Returns the list of additional targets of the event.
+     *          The list does not contain the target proxy of the event.
+     **/
+    inline const TEArrayList<ProxyAddress> & getMulticastTargets( void ) const;
+
+    /**
+     * \brief   Returns true if the event has additional targets and is sent as multicast message.
+     **/
+    inline bool isMulticast( void ) const;
+
 //////////////////////////////////////////////////////////////////////////////
 // Protected operations
 //////////////////////////////////////////////////////////////////////////////
@@ -351,6 +377,15 @@ protected:
      **/
     inline const Channel & getTargetChannel( void ) const;
 
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The additional targets of the multicast event.
+     **/
+    TEArrayList<ProxyAddress>   mMulticastTargets;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -402,4 +437,19 @@ inline const Channel & RemoteResponseEvent::getTargetChannel( void ) const
     return mTargetProxyAddress.getChannel();
 }
 
+inline void RemoteResponseEvent::addMulticastTarget( const ProxyAddress & proxy )
+{
+    mMulticastTargets.add( proxy );
+}
+
+inline const TEArrayList<ProxyAddress> & RemoteResponseEvent::getMulticastTargets( void ) const
+{
+    return mMulticastTargets;
+}
+
+inline bool RemoteResponseEvent::isMulticast( void ) const
+{
+    return (mMulticastTargets.isEmpty( ) == false);
+}
+
 #endif  // AREG_COMPONENT_RESPONSEEVENTS_HPP
@@ -77,6 +77,46 @@ public:
      **/
     static const StubAddress & getInvalidStubAddress(void);
 
+    /**
+     * \brief   Creates and returns the handle of the stub address created in the process.
+     *          The handle is sent to the router when the stub is registered and
+     *          the other processes use it instead of the address when send messages.
+     * \param   addrStub    The address of the stub created in the process.
+     * \return  Returns the handle of the address or NEService::INVALID_HANDLE if failed.
+     **/
+    static uint32_t createHandle( const StubAddress & addrStub );
+
+    /**
+     * \brief   Releases the handle of the stub address created in the process.
+     * \param   handle  The handle to release.
+     **/
+    static void releaseHandle( uint32_t handle );
+
+    /**
+     * \brief   Updates the stub address data of the handle created in the process.
+     * \param   addrStub    The address of the stub, which contains the handle.
+     **/
+    static void updateHandle( const StubAddress & addrStub );
+
+    /**
+     * \brief   Sets the cookie of the process, which owns the handles of local
+     *          stub addresses, and removes the handles of other processes.
+     * \param   cookie  The cookie of the process or NEService::COOKIE_UNKNOWN if disconnected.
+     **/
+    static void setHandleOwner( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Saves the handle of the stub address of other process published by the router.
+     * \param   addrStub    The address of stub, which contains the handle and the cookie of owner process.
+     **/
+    static void registerRemoteHandle( const StubAddress & addrStub );
+
+    /**
+     * \brief   Removes the handle of the stub address of other process.
+     * \param   addrStub    The address of stub, which contains the handle and the cookie of owner process.
+     **/
+    static void unregisterRemoteHandle( const StubAddress & addrStub );
+
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -278,6 +318,17 @@ public:
      **/
     inline void setCookie(const ITEM_ID & cookie );
 
+    /**
+     * \brief   Returns the handle of stub address used on the wire instead of
+     *          address data. NEService::INVALID_HANDLE if the address has no handle.
+     **/
+    inline uint32_t getHandle( void ) const;
+
+    /**
+     * \brief   Sets the handle of stub address used on the wire instead of address data.
+     **/
+    inline void setHandle( uint32_t handle );
+
     /**
      * \brief   Returns the ID of source set in communication channel
      **/
@@ -342,6 +393,16 @@ public:
      **/
     void convFromString(const char* pathStub, const char** out_nextPart = nullptr);
 
+    /**
+     * \brief   Writes the stub address into the stream. If the address has a handle
+     *          known by the other processes, writes only the handle and the cookie
+     *          of the process owning the address. Otherwise, writes the address data.
+     *          The streaming operators read both forms.
+     * \param   stream  The streaming object to write data.
+     * \return  Returns the streaming object.
+     **/
+    IEOutStream & writeCompact( IEOutStream & stream ) const;
+
 protected:
     /**
      * \brief   Returns true if stub address data is valid.
@@ -358,6 +419,13 @@ private:
      **/
     static unsigned int _magicNumber( const StubAddress & addrStub );
 
+    /**
+     * \brief   Reads the stub address data or the handle of the address from the stream.
+     *          If the stream contains the handle, searches the address data of the handle.
+     *          Returns the cookie read from the stream. The cookie is not set.
+     **/
+    ITEM_ID _readAddress( const IEInStream & stream );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -376,6 +444,10 @@ private:
      * \brief   The calculated number of stub address.
      **/
     unsigned int    mMagicNum;
+    /**
+     * \brief   The handle of the address on the wire.
+     **/
+    uint32_t        mHandle;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -423,6 +495,7 @@ inline StubAddress & StubAddress::operator = ( const StubAddress & source )
         mThreadName = source.mThreadName;
         mChannel    = source.mChannel;
         mMagicNum   = source.mMagicNum;
+        mHandle     = source.mHandle;
     }
 
     return (*this);
@@ -436,6 +509,7 @@ inline StubAddress & StubAddress::operator = ( StubAddress && source ) noexcept
         mThreadName = std::move(source.mThreadName);
         mChannel    = std::move(source.mChannel);
         mMagicNum   = source.mMagicNum;
+        mHandle     = source.mHandle;
     }
 
     return (*this);
@@ -449,6 +523,7 @@ inline StubAddress & StubAddress::operator = (const ServiceAddress & addrService
         mThreadName = String::getEmptyString();
         mChannel    = Channel();
         mMagicNum   = StubAddress::_magicNumber(*this);
+        mHandle     = NEService::INVALID_HANDLE;
     }
 
     return (*this);
@@ -462,6 +537,7 @@ inline StubAddress & StubAddress::operator = ( ServiceAddress && addrService ) n
         mThreadName = String::getEmptyString();
         mChannel    = Channel( );
         mMagicNum   = StubAddress::_magicNumber( *this );
+        mHandle     = NEService::INVALID_HANDLE;
     }
 
     return (*this);
@@ -552,6 +628,16 @@ inline void StubAddress::setSource(const ITEM_ID & source )
     return mChannel.setSource(source);
 }
 
+inline uint32_t StubAddress::getHandle( void ) const
+{
+    return mHandle;
+}
+
+inline void StubAddress::setHandle( uint32_t handle )
+{
+    mHandle = handle;
+}
+
 inline StubAddress& StubAddress::self(void)
 {
     return (*this);
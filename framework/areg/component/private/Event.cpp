@@ -16,6 +16,7 @@
 #include "areg/component/Event.hpp"
 
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/component/EventAllocator.hpp"
 #include "areg/component/IEEventConsumer.hpp"
 
 //////////////////////////////////////////////////////////////////////////
@@ -76,6 +77,7 @@ Event::Event( void )
     , mEventPrio    ( DefaultPriority )
     , mConsumer     ( nullptr )
     , mTargetThread ( nullptr )
+    , mQueueNext    ( nullptr )
 {
 }
 
@@ -85,6 +87,7 @@ Event::Event( Event::eEventType eventType )
     , mEventPrio    ( DefaultPriority )
     , mConsumer     ( nullptr )
     , mTargetThread ( nullptr )
+    , mQueueNext    ( nullptr )
 {
 }
 
@@ -92,6 +95,7 @@ Event::~Event( void )
 {
     mConsumer       = nullptr;
     mTargetThread   = nullptr;
+    mQueueNext      = nullptr;
 }
 
 inline Event & Event::self( void )
@@ -103,6 +107,35 @@ inline Event & Event::self( void )
 // Event class, methods
 //////////////////////////////////////////////////////////////////////////
 
+void * Event::operator new( size_t size )
+{
+    return EventAllocator::allocate( size );
+}
+
+void * Event::operator new( size_t size, int /*block*/, const char * /*file*/, int /*line*/ )
+{
+    return EventAllocator::allocate( size );
+}
+
+void * Event::operator new( size_t /*size*/, void * ptr )
+{
+    return ptr;
+}
+
+void Event::operator delete( void * ptr )
+{
+    EventAllocator::release( ptr );
+}
+
+void Event::operator delete( void * ptr, int, const char *, int )
+{
+    EventAllocator::release( ptr );
+}
+
+void Event::operator delete( void * /*ptr*/, void * /*place*/ )
+{
+}
+
 void Event::destroy( void )
 {
     delete this;
@@ -0,0 +1,80 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/EventAllocator.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the pooled allocator of the memory of event objects.
+ *
+ ************************************************************************/
+#include "areg/component/EventAllocator.hpp"
+
+#include "areg/base/private/TEBlockPool.hpp"
+
+namespace
+{
+    /**
+     * \brief   The size classes of the events, linearly growing by BLOCK_GRANULARITY bytes.
+     **/
+    struct EventSizeClass
+    {
+        //!< The number of size classes.
+        static constexpr uint32_t   COUNT       { EventAllocator::SIZE_CLASS_COUNT };
+
+        //!< The size of the biggest event allocated in the pool.
+        static constexpr size_t     MAX_SIZE    { static_cast<size_t>(EventAllocator::BLOCK_GRANULARITY) * EventAllocator::SIZE_CLASS_COUNT };
+
+        static inline uint32_t getClass( size_t size )
+        {
+            return ((size != 0u) && (size <= MAX_SIZE) ? static_cast<uint32_t>((size - 1u) / EventAllocator::BLOCK_GRANULARITY) : COUNT);
+        }
+
+        static inline size_t getSize( uint32_t sizeClass )
+        {
+            return static_cast<size_t>(sizeClass + 1u) * EventAllocator::BLOCK_GRANULARITY;
+        }
+
+        static inline uint32_t getMaxCached( uint32_t /*sizeClass*/ )
+        {
+            return EventAllocator::MAX_CACHED_BLOCKS;
+        }
+    };
+
+    //!< The pool of events.
+    using EventPool = TEBlockPool<EventSizeClass>;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EventAllocator class implementation
+//////////////////////////////////////////////////////////////////////////
+
+void * EventAllocator::allocate( size_t size )
+{
+    return EventPool::allocate( size );
+}
+
+void EventAllocator::release( void * ptr )
+{
+    EventPool::release( ptr );
+}
+
+void EventAllocator::setPoolEnabled( bool enable )
+{
+    EventPool::setEnabled( enable );
+}
+
+bool EventAllocator::isPoolEnabled( void )
+{
+    return EventPool::isEnabled( );
+}
+
+NEMemory::sPoolStatistics EventAllocator::getStatistics( void )
+{
+    return EventPool::getStatistics( );
+}
@@ -97,3 +97,118 @@ void ImplEventConsumerMap::implCleanResource( RuntimeClassID & /*Key*/, EventCon
 }
 
 #endif  // defined(DEBUG) && defined(OUTPUT_DEBUG_LEVEL) && (OUTPUT_DEBUG_LEVEL >= OUTPUT_DEBUG_LEVEL_DEBUG)
+
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerTable class implementation
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerTable class, Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+EventConsumerTable::EventConsumerTable( void )
+    : mTable        ( DEBUG_NEW ConsumerTable( ) )
+    , mReaders      ( 0u )
+    , mHasRetired   ( false )
+    , mRetiredTables( )
+    , mRetiredArrays( )
+    , mLock         ( false )
+{
+}
+
+EventConsumerTable::~EventConsumerTable( void )
+{
+    ASSERT( mReaders.load( ) == 0u );
+    removeAllConsumers( );
+    _releaseRetired( );
+    delete mTable.load( );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerTable class, methods
+//////////////////////////////////////////////////////////////////////////
+void EventConsumerTable::updateConsumers( const RuntimeClassID & whichClass, const EventConsumerList * listConsumers )
+{
+    Lock lock( mLock );
+
+    const ConsumerTable * oldTable = mTable.load( );
+    const unsigned int index = whichClass.getClassIndex( );
+    const ConsumerArray * oldArray = index < static_cast<unsigned int>(oldTable->size( )) ? (*oldTable)[index] : nullptr;
+
+    ConsumerArray * newArray{ nullptr };
+    if ( (listConsumers != nullptr) && (listConsumers->isEmpty( ) == false) )
+    {
+        newArray = DEBUG_NEW ConsumerArray( );
+        newArray->reserve( listConsumers->getSize( ) );
+        for ( EventConsumerList::LISTPOS pos = listConsumers->firstPosition( ); listConsumers->isValidPosition( pos ); pos = listConsumers->nextPosition( pos ) )
+        {
+            newArray->push_back( listConsumers->valueAtPosition( pos ) );
+        }
+    }
+
+    if ( (oldArray != nullptr) || (newArray != nullptr) )
+    {
+        ConsumerTable * newTable = DEBUG_NEW ConsumerTable( *oldTable );
+        if ( index >= static_cast<unsigned int>(newTable->size( )) )
+        {
+            newTable->resize( static_cast<size_t>(index) + 1u, nullptr );
+        }
+
+        (*newTable)[index] = newArray;
+        mTable.store( newTable );
+
+        mRetiredTables.push_back( oldTable );
+        if ( oldArray != nullptr )
+        {
+            mRetiredArrays.push_back( oldArray );
+        }
+
+        mHasRetired.store( true );
+        _releaseRetired( );
+    }
+}
+
+void EventConsumerTable::removeAllConsumers( void )
+{
+    Lock lock( mLock );
+
+    const ConsumerTable * oldTable = mTable.load( );
+    if ( oldTable->empty( ) == false )
+    {
+        mTable.store( DEBUG_NEW ConsumerTable( ) );
+        mRetiredTables.push_back( oldTable );
+        for ( const ConsumerArray * oldArray : *oldTable )
+        {
+            if ( oldArray != nullptr )
+            {
+                mRetiredArrays.push_back( oldArray );
+            }
+        }
+
+        mHasRetired.store( true );
+        _releaseRetired( );
+    }
+}
+
+void EventConsumerTable::_releaseRetired( void ) const
+{
+    Lock lock( mLock );
+
+    // The replaced entries are not reachable anymore by the new dispatching,
+    // so that they can be released if no dispatching is in progress.
+    if ( mReaders.load( ) == 0u )
+    {
+        for ( const ConsumerArray * oldArray : mRetiredArrays )
+        {
+            delete oldArray;
+        }
+
+        for ( const ConsumerTable * oldTable : mRetiredTables )
+        {
+            delete oldTable;
+        }
+
+        mRetiredArrays.clear( );
+        mRetiredTables.clear( );
+        mHasRetired.store( false );
+    }
+}
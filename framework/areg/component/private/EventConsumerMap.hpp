@@ -14,6 +14,7 @@
  * \author      Artak Avetyan
  * \brief       AREG Platform, Event Consumer Resources Object declaration.
  *              This Resource Map object contains information of Event Consumers
+ *              and the copy-on-write table of consumers to dispatch events.
  *
  ************************************************************************/
 
@@ -23,11 +24,16 @@
 #include "areg/base/TERuntimeResourceMap.hpp"
 #include "areg/base/Containers.hpp"
 #include "areg/base/TEResourceMap.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+#include <vector>
 
 /************************************************************************
  * Declared classes
  ************************************************************************/
 class EventConsumerList;
+class EventConsumerTable;
 
 /************************************************************************
  * Dependencies
@@ -38,6 +44,7 @@ class IEEventConsumer;
  * \brief   In this file are declared Event Consumer contain classes:
  *              1. EventConsumerList  -- List of Event Consumers
  *              2. EventConsumerMap   -- Map of Event Consumer.
+ *              3. EventConsumerTable -- Table of Event Consumers to dispatch.
  *          These are helper classes used in Dispatcher object.
  *          For details, see description bellow.
  ************************************************************************/
@@ -156,6 +163,130 @@ public:
  **/
 using EventConsumerMap  = TELockRuntimeResourceMap<EventConsumerList *, ImplEventConsumerMap>;
 
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerTable class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   Event Consumer Table is a helper class containing immutable arrays
+ *          of Event Consumers to dispatch the Events. The arrays are indexed by
+ *          the dense index of the Runtime Class ID of Event object. The table
+ *          and the arrays are never modified, but replaced when the consumers
+ *          are registered or unregistered (copy-on-write), so that the lookup
+ *          of consumers to dispatch event neither locks nor allocates memory.
+ *          The replaced table and arrays are released as soon as there is no
+ *          dispatching in progress, which may still refer to them.
+ *          The table is updated by the Event Dispatcher when it modifies the
+ *          Event Consumer Map. For use, see implementation of EventDispatcherBase class
+ **/
+class EventConsumerTable
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The immutable array of consumers registered for one Event class.
+     **/
+    using ConsumerArray = std::vector<IEEventConsumer *>;
+
+private:
+    /**
+     * \brief   The immutable table of consumer arrays indexed by the dense index of Event class.
+     **/
+    using ConsumerTable = std::vector<const ConsumerArray *>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    EventConsumerTable( void );
+
+    ~EventConsumerTable( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Starts dispatching and returns the array of consumers registered for
+     *          the specified Event class. The array remains valid until endDispatch()
+     *          is called, even if the consumers are registered or unregistered meanwhile.
+     *          Each call of the method must be followed by the call of endDispatch().
+     * \param   whichClass  The Runtime Class ID of Event object to dispatch.
+     * \return  Returns the array of consumers or nullptr if there is no registered consumer.
+     **/
+    inline const ConsumerArray * beginDispatch( const RuntimeClassID & whichClass ) const;
+
+    /**
+     * \brief   Ends the dispatching started by beginDispatch(). If there is no other
+     *          dispatching in progress, releases the replaced tables and arrays.
+     **/
+    inline void endDispatch( void ) const;
+
+    /**
+     * \brief   Replaces the array of consumers of the specified Event class by the
+     *          entries of the given list. If the list is nullptr or empty, the Event
+     *          class has no consumers anymore.
+     * \param   whichClass      The Runtime Class ID of Event object.
+     * \param   listConsumers   The list of consumers registered for the Event class.
+     **/
+    void updateConsumers( const RuntimeClassID & whichClass, const EventConsumerList * listConsumers );
+
+    /**
+     * \brief   Removes the consumers of all Event classes.
+     **/
+    void removeAllConsumers( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Releases the replaced tables and arrays if there is no dispatching in progress.
+     **/
+    void _releaseRetired( void ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The current table of consumer arrays.
+     **/
+    std::atomic<const ConsumerTable *>  mTable;
+
+    /**
+     * \brief   The number of dispatching in progress, which refer to the table.
+     **/
+    mutable std::atomic_uint32_t        mReaders;
+
+    /**
+     * \brief   The flag, indicating whether there are replaced tables and arrays to release.
+     **/
+    mutable std::atomic_bool            mHasRetired;
+
+    /**
+     * \brief   The replaced tables waiting to be released.
+     **/
+    mutable std::vector<const ConsumerTable *>  mRetiredTables;
+
+    /**
+     * \brief   The replaced arrays waiting to be released.
+     **/
+    mutable std::vector<const ConsumerArray *>  mRetiredArrays;
+
+    /**
+     * \brief   The lock to replace the table and to release the replaced entries.
+     **/
+    mutable ResourceLock                mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( EventConsumerTable );
+};
+
 //////////////////////////////////////////////////////////////////////////
 // Inline functions implementation
 //////////////////////////////////////////////////////////////////////////
@@ -168,4 +299,23 @@ inline bool EventConsumerList::existConsumer( IEEventConsumer & whichConsumer )
     return EventConsumerListBase::contains( &whichConsumer);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// EventConsumerTable class inline functions
+//////////////////////////////////////////////////////////////////////////
+inline const EventConsumerTable::ConsumerArray * EventConsumerTable::beginDispatch( const RuntimeClassID & whichClass ) const
+{
+    mReaders.fetch_add( 1u );
+    const ConsumerTable * table = mTable.load( );
+    const unsigned int index = whichClass.getClassIndex( );
+    return (index < static_cast<unsigned int>(table->size( )) ? (*table)[index] : nullptr);
+}
+
+inline void EventConsumerTable::endDispatch( void ) const
+{
+    if ( (mReaders.fetch_sub( 1u ) == 1u) && mHasRetired.load( ) )
+    {
+        _releaseRetired( );
+    }
+}
+
 #endif  // AREG_COMPONENT_PRIVATE_EVENTCONSUMERMAP_HPP
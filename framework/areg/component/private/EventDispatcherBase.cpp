@@ -34,6 +34,7 @@ EventDispatcherBase::EventDispatcherBase(const String & name )
     , mExternaEvents    ( static_cast<IEQueueListener &>(self()) )
     , mInternalEvents   ( )
     , mConsumerMap      ( )
+    , mConsumerTable    ( )
     , mEventExit        ( false, false )
     , mEventQueue       ( true, false )
     , mHasStarted       ( false )
@@ -136,6 +137,7 @@ bool EventDispatcherBase::registerEventConsumer( const RuntimeClassID& whichClas
     if ( (listConsumers != nullptr) && (listConsumers->existConsumer(whichConsumer) == false) )
     {
         result = listConsumers->addConsumer(whichConsumer);
+        mConsumerTable.updateConsumers(whichClass, listConsumers);
     }
 
     mConsumerMap.unlock();
@@ -155,7 +157,10 @@ bool EventDispatcherBase::unregisterEventConsumer( const RuntimeClassID & whichC
         {
             mConsumerMap.unregisterResourceObject(whichClass);
             delete listConsumers;
+            listConsumers = nullptr;
         }
+
+        mConsumerTable.updateConsumers(whichClass, listConsumers);
     }
     else
     {
@@ -184,7 +189,12 @@ int EventDispatcherBase::removeConsumer( IEEventConsumer & whichConsumer )
     while (Value != nullptr)
     {
         ASSERT(Value->isEmpty() == false);
-        result += Value->removeConsumer(whichConsumer) ? 1 : 0;
+        if (Value->removeConsumer(whichConsumer))
+        {
+            ++ result;
+            mConsumerTable.updateConsumers(Key, Value);
+        }
+
         if (Value->isEmpty())
         {
             removedList.pushFirst(Key);
@@ -292,35 +302,32 @@ void EventDispatcherBase::postDispatchEvent( Event* eventElem )
 
 bool EventDispatcherBase::dispatchEvent( Event& eventElem )
 {
-    EventConsumerList processingList;
+    bool result{ false };
     IEEventConsumer* consumer = eventElem.getEventConsumer();
     if ( consumer != nullptr)
     {
-        processingList.pushFirst(consumer);
+        eventElem.dispatchSelf(consumer);
+        result = true;
     }
     else
     {
-        // Lock resource, before get any information
-        mConsumerMap.lock();
-
-        EventConsumerList* listConsumers = mConsumerMap.findResourceObject(eventElem.getRuntimeClassId());
-        if (listConsumers != nullptr)
-            processingList = *listConsumers;
+        // The array of consumers is not modified while dispatching. The consumers
+        // registered or unregistered meanwhile are applied to the next events.
+        const EventConsumerTable::ConsumerArray* consumers = mConsumerTable.beginDispatch(eventElem.getRuntimeClassId());
+        if (consumers != nullptr)
+        {
+            for (IEEventConsumer* elem : *consumers)
+            {
+                eventElem.dispatchSelf(elem);
+            }
 
-        // Unlock resource as soon as possible. Otherwise we may block other threads
-        // on registering / unregistering consumer.
-        mConsumerMap.unlock();
-    }
+            result = consumers->empty() == false;
+        }
 
-    EventConsumerList::LISTPOS pos = processingList.firstPosition();
-    while (processingList.isValidPosition(pos))
-    {
-        consumer = processingList.getNext(pos);
-        eventElem.dispatchSelf(consumer);
-        consumer = nullptr;
+        mConsumerTable.endDispatch();
     }
 
-    return (processingList.isEmpty() == false);
+    return result;
 }
 
 bool EventDispatcherBase::hasRegisteredConsumer( const RuntimeClassID& whichClass ) const
@@ -341,6 +348,7 @@ inline void EventDispatcherBase::_clean()
         delete Value;
     }
 
+    mConsumerTable.removeAllConsumers();
     mConsumerMap.unlock();
 }
 
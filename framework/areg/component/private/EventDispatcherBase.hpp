@@ -330,6 +330,11 @@ protected:
      **/
     EventConsumerMap    mConsumerMap;
 
+    /**
+     * \brief   Copy-on-write table of registered consumers to dispatch events.
+     **/
+    EventConsumerTable  mConsumerTable;
+
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
 #endif  // _MSC_VER
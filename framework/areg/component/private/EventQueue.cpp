@@ -40,7 +40,12 @@ EventQueue::EventQueue( IEQueueListener & eventListener, SortedEventStack & even
 //////////////////////////////////////////////////////////////////////////
 void EventQueue::pushEvent( Event& evendElem )
 {
-    mEventListener.signalEvent( mEventQueue.pushEvent(&evendElem) );
+    // Wake up the consumer only if the queue was empty.
+    // Otherwise, the listener is already signaled.
+    if ( mEventQueue.pushEvent( &evendElem ) == 1u )
+    {
+        mEventListener.signalEvent( 1u );
+    }
 }
 
 Event* EventQueue::popEvent( void )
@@ -49,7 +54,7 @@ Event* EventQueue::popEvent( void )
     uint32_t size = mEventQueue.popEvent(&result);
     if (size == 0)
     {
-        mEventListener.signalEvent(0);
+        _signalEmpty();
     }
 
     return result;
@@ -58,19 +63,31 @@ Event* EventQueue::popEvent( void )
 void EventQueue::removeAllEvents(void)
 {
     mEventQueue.deleteAllEvents();
-    mEventListener.signalEvent(0);
+    _signalEmpty();
 }
 
 void EventQueue::removeEvents( bool keepSpecials /*= false*/ )
 {
     uint32_t remain = mEventQueue.deleteAllLowerPriority(keepSpecials ? Event::eEventPriority::EventPriorityHigh : Event::eEventPriority::EventPriorityCritical);
-    mEventListener.signalEvent(remain);
+    remain != 0 ? mEventListener.signalEvent(remain) : _signalEmpty();
 }
 
 void EventQueue::removeEvents( const RuntimeClassID & eventClassId )
 {
     uint32_t remain = mEventQueue.deleteAllMatchClass(eventClassId);
-    mEventListener.signalEvent(remain);
+    remain != 0 ? mEventListener.signalEvent(remain) : _signalEmpty();
+}
+
+inline void EventQueue::_signalEmpty( void )
+{
+    mEventListener.signalEvent( 0u );
+    // The producers do not lock the queue. If an event was pushed after the queue became empty,
+    // but before the listener has been reset, the producer's wake up signal is lost. Restore it.
+    uint32_t count = mEventQueue.getCount( );
+    if ( count != 0u )
+    {
+        mEventListener.signalEvent( count );
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
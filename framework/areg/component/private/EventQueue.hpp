@@ -87,7 +87,9 @@ public:
 
     /**
      * \brief   Pushes new Event in the Queue and notifies Event Listener
-     *          about new Event element availability.
+     *          about new Event element availability. The Event Listener is
+     *          notified only if the queue was empty before the push.
+     *          The method does not lock the queue.
      **/
     void pushEvent( Event & evendElem );
 
@@ -129,13 +131,23 @@ public:
      **/
     void removeAllEvents( void );
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Notifies the listener that the queue is empty and signals it
+     *          again if an event was pushed in the meantime by another thread.
+     **/
+    inline void _signalEmpty( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Queue Listener object, which is signaled every time 
-     *          new Event is pushed or removed.
+     * \brief   Queue Listener object, which is signaled when the queue
+     *          becomes not empty or when it becomes empty.
      **/
     IEQueueListener &   mEventListener;
     /**
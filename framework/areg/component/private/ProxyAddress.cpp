@@ -20,6 +20,7 @@
 #include "areg/component/ServiceResponseEvent.hpp"
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/component/private/TEAddressHandleTable.hpp"
 #include "areg/component/StubAddress.hpp"
 
 #include <string_view>
@@ -42,6 +43,14 @@ namespace
      **/
     constexpr std::string_view  EXTENTION_PROXY         { "proxy" };
 
+    /**
+     * \brief   Returns the table of handles of proxy addresses.
+     **/
+    inline TEAddressHandleTable<ProxyAddress> & _handleTable( void )
+    {
+        static TEAddressHandleTable<ProxyAddress> _table;
+        return _table;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -75,6 +84,42 @@ ProxyAddress ProxyAddress::convPathToAddress( const char* pathProxy, const char*
     return result;
 }
 
+uint32_t ProxyAddress::createHandle( const ProxyAddress & addrProxy )
+{
+    return _handleTable( ).createHandle( addrProxy );
+}
+
+void ProxyAddress::releaseHandle( uint32_t handle )
+{
+    _handleTable( ).releaseHandle( handle );
+}
+
+void ProxyAddress::updateHandle( const ProxyAddress & addrProxy )
+{
+    _handleTable( ).updateAddress( addrProxy.mHandle, addrProxy );
+}
+
+void ProxyAddress::setHandleOwner( const ITEM_ID & cookie )
+{
+    _handleTable( ).setOwner( cookie );
+}
+
+void ProxyAddress::registerRemoteHandle( const ProxyAddress & addrProxy )
+{
+    if ( addrProxy.mHandle != NEService::INVALID_HANDLE )
+    {
+        _handleTable( ).registerRemote( addrProxy.mHandle, addrProxy.getCookie( ), addrProxy );
+    }
+}
+
+void ProxyAddress::unregisterRemoteHandle( const ProxyAddress & addrProxy )
+{
+    if ( addrProxy.mHandle != NEService::INVALID_HANDLE )
+    {
+        _handleTable( ).unregisterRemote( addrProxy.mHandle, addrProxy.getCookie( ) );
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -84,6 +129,7 @@ ProxyAddress::ProxyAddress( void )
     , mThreadName   ( ThreadAddress::getInvalidThreadAddress().getThreadName() )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
 }
 
@@ -96,6 +142,7 @@ ProxyAddress::ProxyAddress( const String & serviceName
     , mThreadName   ( threadName )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     setThread( threadName );
     if ( ServiceAddress::isValid() )
@@ -107,6 +154,7 @@ ProxyAddress::ProxyAddress( const ServiceItem & service, const String & roleName
     , mThreadName   ( "" )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     setThread( threadName );
     if ( ServiceAddress::isValid() )
@@ -118,6 +166,7 @@ ProxyAddress::ProxyAddress(const NEService::SInterfaceData & siData, const Strin
     , mThreadName   ( "" )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     setThread(threadName);
     if ( ServiceAddress::isValid() )
@@ -129,6 +178,7 @@ ProxyAddress::ProxyAddress( const ProxyAddress & source )
     , mThreadName   ( source.mThreadName )
     , mChannel      ( source.mChannel )
     , mMagicNum     ( source.mMagicNum )
+    , mHandle       ( source.mHandle )
 {
 }
 
@@ -137,6 +187,7 @@ ProxyAddress::ProxyAddress( ProxyAddress && source ) noexcept
     , mThreadName   ( std::move(source.mThreadName) )
     , mChannel      ( std::move(source.mChannel) )
     , mMagicNum     ( source.mMagicNum )
+    , mHandle       ( source.mHandle )
 {
 }
 
@@ -145,6 +196,7 @@ ProxyAddress::ProxyAddress(const ServiceAddress & source)
     , mThreadName   ("")
     , mChannel      ( )
     , mMagicNum     (static_cast<unsigned int>(source))
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
 }
 
@@ -153,21 +205,20 @@ ProxyAddress::ProxyAddress( ServiceAddress && source)
     , mThreadName   ("")
     , mChannel      ( )
     , mMagicNum     (static_cast<unsigned int>(static_cast<const ServiceAddress &>(self())))
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
 }
 
 ProxyAddress::ProxyAddress( const IEInStream & stream )
-    : ServiceAddress( stream )
-    , mThreadName   ( stream )
+    : ServiceAddress( )
+    , mThreadName   ( )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
-    ITEM_ID cookie = NEService::COOKIE_LOCAL;
-    stream >> cookie;
+    ITEM_ID cookie = _readAddress( stream );
     if ( ServiceAddress::isValid() )
         mChannel.setCookie(cookie);
-
-    mMagicNum = ProxyAddress::_magicNumber(*this);
 }
 
 bool ProxyAddress::isStubCompatible(const StubAddress & addrStub ) const
@@ -282,6 +333,66 @@ void ProxyAddress::convFromString(const char * pathProxy, const char** out_nextP
         *out_nextPart = strSource;
 }
 
+IEOutStream & ProxyAddress::writeCompact( IEOutStream & stream ) const
+{
+    // the local address is written with the cookie of the process published to other processes.
+    const ITEM_ID cookie{ isLocalAddress( ) ? _handleTable( ).getOwner( ) : mChannel.getCookie( ) };
+    if ( (mHandle != NEService::INVALID_HANDLE) && (cookie >= NEService::COOKIE_REMOTE_SERVICE) )
+    {
+        const std::string_view & marker{ TEAddressHandleTable<ProxyAddress>::HANDLE_MARKER };
+        stream.write( reinterpret_cast<const unsigned char *>(marker.data( )), static_cast<unsigned int>(marker.size( )) );
+        stream << mHandle;
+        stream << cookie;
+    }
+    else
+    {
+        stream << *this;
+    }
+
+    return stream;
+}
+
+ITEM_ID ProxyAddress::_readAddress( const IEInStream & stream )
+{
+    ITEM_ID cookie{ NEService::COOKIE_LOCAL };
+    String serviceName;
+    stream >> serviceName;
+    if ( serviceName == TEAddressHandleTable<ProxyAddress>::HANDLE_MARKER.data( ) )
+    {
+        stream >> mHandle;
+        stream >> cookie;
+
+        ProxyAddress addrProxy;
+        if ( _handleTable( ).findAddress( mHandle, cookie, addrProxy ) )
+        {
+            static_cast<ServiceAddress &>(*this) = static_cast<const ServiceAddress &>(addrProxy);
+            mThreadName = addrProxy.mThreadName;
+            mMagicNum   = addrProxy.mMagicNum;
+        }
+        else
+        {
+            *this = ProxyAddress::getInvalidProxyAddress( );
+        }
+    }
+    else
+    {
+        Version version;
+        NEService::eServiceType serviceType{ NEService::eServiceType::ServiceInvalid };
+        String roleName;
+        stream >> version;
+        stream >> serviceType;
+        stream >> roleName;
+        stream >> mThreadName;
+        stream >> cookie;
+
+        static_cast<ServiceAddress &>(*this) = ServiceAddress( serviceName, version, serviceType, roleName );
+        mMagicNum   = ProxyAddress::_magicNumber( *this );
+        mHandle     = NEService::INVALID_HANDLE;
+    }
+
+    return cookie;
+}
+
 bool ProxyAddress::isValidated(void) const
 {
     return ServiceAddress::isValidated() && (mThreadName.isEmpty() == false) && (mThreadName != ThreadAddress::getInvalidThreadAddress().getThreadName());
@@ -289,13 +400,8 @@ bool ProxyAddress::isValidated(void) const
 
 AREG_API_IMPL const IEInStream & operator >> ( const IEInStream & stream, ProxyAddress & input )
 {
-    ITEM_ID cookie = NEService::COOKIE_LOCAL;
-    stream >> static_cast<ServiceAddress &>(input);
-    stream >> input.mThreadName;
-    stream >> cookie;
-
+    ITEM_ID cookie = input._readAddress( stream );
     input.setCookie(cookie);
-    input.mMagicNum = ProxyAddress::_magicNumber(input);
 
     return stream;
 }
@@ -195,6 +195,7 @@ std::shared_ptr<ProxyBase> ProxyBase::findOrCreateProxy( const String & roleName
             if ( newProxy.get() != nullptr )
             {
                 proxy.swap( newProxy );
+                proxy->mProxyAddress.setHandle( ProxyAddress::createHandle( proxy->mProxyAddress ) );
                 _mapRegisteredProxies.registerResourceObject( proxy->mProxyAddress, proxy );
                 _mapThreadProxies.registerResourceObject( proxy->mDispatcherThread.getName( ), proxy );
             }
@@ -333,6 +334,8 @@ void ProxyBase::freeProxy( IEProxyListener & connect )
         mProxyInstCount = 0;
         _mapRegisteredProxies.unregisterResourceObject( mProxyAddress );
         _mapThreadProxies.unregisterResourceObject( mDispatcherThread.getName( ), proxy, true );
+        ProxyAddress::releaseHandle( mProxyAddress.getHandle( ) );
+        mProxyAddress.setHandle( NEService::INVALID_HANDLE );
     }
     else if ( mProxyInstCount > 0 )
     {
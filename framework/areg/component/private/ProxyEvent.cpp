@@ -76,7 +76,7 @@ const IEInStream & ProxyEvent::readStream( const IEInStream & stream )
 IEOutStream & ProxyEvent::writeStream( IEOutStream & stream ) const
 {
     StreamableEvent::writeStream(stream);
-    stream << mTargetProxyAddress;
+    mTargetProxyAddress.writeCompact(stream);
     return stream;
 }
 
@@ -29,6 +29,7 @@
 DEF_LOG_SCOPE(areg_component_RemoteEventFactory_createEventFromStream);
 DEF_LOG_SCOPE(areg_component_RemoteEventFactory_createStreamFromEvent);
 DEF_LOG_SCOPE(areg_component_RemoteEventFactory_createRequestFailedEvent);
+DEF_LOG_SCOPE(areg_component_RemoteEventFactory_createEventsFromMulticastStream);
 
 StreamableEvent * RemoteEventFactory::createEventFromStream( const RemoteMessage & stream, const Channel & comChannel )
 {
@@ -226,7 +227,30 @@ bool RemoteEventFactory::createStreamFromEvent( RemoteMessage & stream, const St
     case Event::eEventType::EventRemoteServiceResponse:
         {
             const ServiceResponseEvent * proxyEvent = RUNTIME_CONST_CAST(&eventStreamable, ServiceResponseEvent);
-            if ( proxyEvent != nullptr )
+            const RemoteResponseEvent * multicastEvent = RUNTIME_CONST_CAST(&eventStreamable, RemoteResponseEvent);
+            if ( (multicastEvent != nullptr) && multicastEvent->isMulticast() )
+            {
+                // The list of targets is followed by the event data, which is sent once for all targets.
+                const TEArrayList<ProxyAddress> & targets = multicastEvent->getMulticastTargets();
+                stream << static_cast<uint32_t>(targets.getSize() + 1);
+                stream << multicastEvent->getTargetProxy();
+                for ( uint32_t i = 0; i < targets.getSize(); ++ i )
+                {
+                    stream << targets[i];
+                }
+
+                eventStreamable.writeStream(stream);
+                if ( stream.isValid() )
+                {
+                    result = true;
+                    stream.setSource( comChannel.getCookie() );
+                    stream.setTarget( NEService::COOKIE_ROUTER );
+                    stream.setMessageId( static_cast<unsigned int>(NEService::eFuncIdRange::ServiceMulticastMessage) );
+                    stream.setResult( NEMemory::MESSAGE_SUCCESS );
+                    stream.setSequenceNr( multicastEvent->getSequenceNumber() );
+                }
+            }
+            else if ( proxyEvent != nullptr )
             {
                 eventStreamable.writeStream(stream);
                 if ( stream.isValid() )
@@ -361,3 +385,134 @@ StreamableEvent * RemoteEventFactory::createRequestFailedEvent( const RemoteMess
 
     return result;
 }
+
+uint32_t RemoteEventFactory::createEventsFromMulticastStream( const RemoteMessage & stream, const Channel & comChannel, TEArrayList<StreamableEvent *> & OUT out_events )
+{
+    LOG_SCOPE(areg_component_RemoteEventFactory_createEventsFromMulticastStream);
+
+    out_events.clear();
+    if ( stream.getMessageId() != static_cast<unsigned int>(NEService::eFuncIdRange::ServiceMulticastMessage) )
+        return 0;
+
+    stream.moveToBegin();
+    uint32_t count{ 0 };
+    stream >> count;
+
+    TEArrayList<ProxyAddress> targets;
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        ProxyAddress addrProxy( stream );
+        if ( comChannel.getCookie() == addrProxy.getCookie() )
+        {
+            addrProxy.setCookie( NEService::COOKIE_LOCAL );
+            targets.add( addrProxy );
+        }
+    }
+
+    ProxyBase::lockProxyResource();
+    RemoteResponseEvent * eventMaster{ nullptr };
+    for ( uint32_t i = 0; i < targets.getSize(); ++ i )
+    {
+        std::shared_ptr<ProxyBase> proxy = ProxyBase::findProxyByAddress(targets[i]);
+        if ( proxy == nullptr )
+            continue;
+
+        if ( eventMaster == nullptr )
+        {
+            // the event data follows the list of targets.
+            eventMaster = proxy->createRemoteResponseEvent(stream);
+            if ( eventMaster == nullptr )
+                break;
+        }
+
+        ServiceResponseEvent * eventResponse = eventMaster->cloneForTarget(proxy->getProxyAddress());
+        if ( eventResponse != nullptr )
+        {
+            LOG_DBG("Created multicast event [ %s ] for target proxy [ %s ]."
+                        , eventResponse->getRuntimeClassName().getString()
+                        , ProxyAddress::convAddressToPath(eventResponse->getTargetProxy()).getString());
+
+            out_events.add( static_cast<StreamableEvent *>(eventResponse) );
+        }
+    }
+
+    ProxyBase::unlockProxyResource();
+
+    if ( eventMaster != nullptr )
+    {
+        eventMaster->destroy();
+    }
+
+    return out_events.getSize();
+}
+
+uint32_t RemoteEventFactory::getMulticastTargets( const RemoteMessage & stream, TEArrayList<ITEM_ID> & OUT out_targets )
+{
+    out_targets.clear();
+    if ( stream.getMessageId() == static_cast<unsigned int>(NEService::eFuncIdRange::ServiceMulticastMessage) )
+    {
+        stream.moveToBegin();
+        uint32_t count{ 0 };
+        stream >> count;
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            ProxyAddress addrProxy( stream );
+            out_targets.addIfUnique( addrProxy.getCookie() );
+        }
+    }
+
+    return out_targets.getSize();
+}
+
+uint32_t RemoteEventFactory::createStreamsFromMulticastStream( const RemoteMessage & stream, const ITEM_ID & target, TEArrayList<RemoteMessage> & OUT out_streams )
+{
+    out_streams.clear();
+    if ( stream.getMessageId() != static_cast<unsigned int>(NEService::eFuncIdRange::ServiceMulticastMessage) )
+        return 0;
+
+    stream.moveToBegin();
+    uint32_t count{ 0 };
+    stream >> count;
+
+    TEArrayList<ProxyAddress> targets;
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        ProxyAddress addrProxy( stream );
+        if ( addrProxy.getCookie() == target )
+        {
+            targets.add( addrProxy );
+        }
+    }
+
+    // The event data starts with the type of event and the first target proxy, followed by the response ID.
+    Event::eEventType eventType{ Event::eEventType::EventUnknown };
+    stream >> eventType;
+    ProxyAddress addrFirst;
+    stream >> addrFirst;
+    const unsigned int position{ stream.getPosition() };
+    if ( position >= stream.getSizeUsed() )
+        return 0;
+
+    unsigned int respId{ static_cast<unsigned int>(NEService::eFuncIdRange::EmptyFunctionId) };
+    stream >> respId;
+
+    for ( uint32_t i = 0; i < targets.getSize(); ++ i )
+    {
+        // the target proxy is written in full form, which is readable by any client.
+        RemoteMessage msgTarget;
+        msgTarget << eventType;
+        msgTarget << targets[i];
+        msgTarget.write( stream.getBuffer() + position, stream.getSizeUsed() - position );
+        if ( msgTarget.isValid() )
+        {
+            msgTarget.setSource( stream.getSource() );
+            msgTarget.setTarget( target );
+            msgTarget.setMessageId( respId );
+            msgTarget.setResult( stream.getResult() );
+            msgTarget.setSequenceNr( stream.getSequenceNr() );
+            out_streams.add( msgTarget );
+        }
+    }
+
+    return out_streams.getSize();
+}
@@ -133,6 +133,7 @@ RemoteResponseEvent::RemoteResponseEvent( const ProxyAddress & proxyTarget
                                         , unsigned int respId
                                         , const SequenceNumber & seqNr  /*= NEService::SEQUENCE_NUMBER_NOTIFY*/)
     : ResponseEvent(proxyTarget, result, respId, Event::eEventType::EventRemoteServiceResponse, seqNr)
+    , mMulticastTargets()
 {
     ASSERT(getData().getDataStream().isExternalDataStream());
 }
@@ -144,18 +145,21 @@ RemoteResponseEvent::RemoteResponseEvent( const EventDataStream & args
                                         , const SequenceNumber & seqNr  /*= NEService::SEQUENCE_NUMBER_NOTIFY*/
                                         , const String & name /*= String::getEmptyString()*/ )
     : ResponseEvent(args, proxyTarget, result, respId, Event::eEventType::EventRemoteServiceResponse, seqNr, name)
+    , mMulticastTargets()
 {
     ASSERT(getData().getDataStream().isExternalDataStream());
 }
 
 RemoteResponseEvent::RemoteResponseEvent( const ProxyAddress& proxyTarget, const RemoteResponseEvent & src )
     : ResponseEvent(proxyTarget, static_cast<const ResponseEvent &>(src))
+    , mMulticastTargets()
 {
     ASSERT(getData().getDataStream().isExternalDataStream());
 }
 
 RemoteResponseEvent::RemoteResponseEvent( const IEInStream & stream )
     : ResponseEvent(stream)
+    , mMulticastTargets()
 {
     ASSERT(getData().getDataStream().isExternalDataStream());
 }
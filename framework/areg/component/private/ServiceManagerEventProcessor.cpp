@@ -93,9 +93,12 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
         {
             ProxyAddress  addrProxy;
             Channel       channel;
+            uint32_t      handle{ NEService::INVALID_HANDLE };
             stream >> addrProxy;
             stream >> channel;
+            stream >> handle;
             addrProxy.setChannel( channel );
+            addrProxy.setHandle( handle );
             _registerClient( addrProxy, registerProvider);
         }
         break;
@@ -105,10 +108,13 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
             ProxyAddress  addrProxy;
             Channel       channel;
             NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
+            uint32_t      handle{ NEService::INVALID_HANDLE };
             stream >> addrProxy;
             stream >> channel;
             stream >> reason;
+            stream >> handle;
             addrProxy.setChannel( channel );
+            addrProxy.setHandle( handle );
             _unregisterClient( addrProxy, reason, registerProvider);
         }
         break;
@@ -117,9 +123,12 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
         {
             StubAddress   addrstub;
             Channel       channel;
+            uint32_t      handle{ NEService::INVALID_HANDLE };
             stream >> addrstub;
             stream >> channel;
+            stream >> handle;
             addrstub.setChannel( channel );
+            addrstub.setHandle( handle );
             _registerServer( addrstub, registerProvider);
         }
         break;
@@ -129,10 +138,13 @@ void ServiceManagerEventProcessor::processServiceEvent(   ServiceManagerEventDat
             StubAddress   addrstub;
             Channel       channel;
             NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
+            uint32_t      handle{ NEService::INVALID_HANDLE };
             stream >> addrstub;
             stream >> channel;
             stream >> reason;
+            stream >> handle;
             addrstub.setChannel( channel );
+            addrstub.setHandle( handle );
             _unregisterServer( addrstub, reason, registerProvider);
         }
         break;
@@ -40,6 +40,7 @@ ServiceManagerEventData ServiceManagerEventData::registerProxy(const ProxyAddres
     IEOutStream & stream = data.getWriteStream();
     stream << addrProxy;
     stream << addrProxy.getChannel();
+    stream << addrProxy.getHandle();
     return data;
 }
 
@@ -50,6 +51,7 @@ ServiceManagerEventData ServiceManagerEventData::unregisterProxy( const ProxyAdd
     stream << addrProxy;
     stream << addrProxy.getChannel();
     stream << reason;
+    stream << addrProxy.getHandle();
     return data;
 }
 
@@ -59,6 +61,7 @@ ServiceManagerEventData ServiceManagerEventData::registerStub(const StubAddress
     IEOutStream & stream = data.getWriteStream();
     stream << addrStub;
     stream << addrStub.getChannel();
+    stream << addrStub.getHandle();
     return data;
 }
 
@@ -69,6 +72,7 @@ ServiceManagerEventData ServiceManagerEventData::unregisterStub( const StubAddre
     stream << addrStub;
     stream << addrStub.getChannel();
     stream << reason;
+    stream << addrStub.getHandle();
     return data;
 }
 
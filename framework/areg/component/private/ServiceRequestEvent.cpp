@@ -66,7 +66,16 @@ const IEInStream & ServiceRequestEvent::readStream(const IEInStream & stream)
 IEOutStream & ServiceRequestEvent::writeStream(IEOutStream & stream) const
 {
     StubEvent::writeStream(stream);
-    stream << mProxySource;
+    // the process of target stub knows the handle of source proxy only if it supports handles.
+    if ( getTargetStub().getHandle() != NEService::INVALID_HANDLE )
+    {
+        mProxySource.writeCompact(stream);
+    }
+    else
+    {
+        stream << mProxySource;
+    }
+
     stream << mMessageId;
     stream << mRequestType;
     stream << mSequenceNr;
@@ -20,224 +20,291 @@
 #include "areg/component/private/SortedEventStack.hpp"
 
 #include "areg/component/Event.hpp"
+#include "areg/base/RuntimeClassID.hpp"
+
+SortedEventStack::SortedEventStack(void)
+    : mLock     ( false )
+    , mIncoming { }
+    , mQueued   { }
+    , mExitEvent( nullptr )
+    , mExitCount( 0u )
+    , mCount    ( 0u )
+{
+    for (auto & incoming : mIncoming)
+    {
+        incoming.store(nullptr, std::memory_order_relaxed);
+    }
+}
 
 SortedEventStack::~SortedEventStack(void)
 {
-    for (auto evt : mValueList)
+    Lock lock(mLock);
+
+    _collectIncoming();
+    for (auto & list : mQueued)
     {
-        evt->destroy();
+        _deleteList(list);
     }
 
-    mValueList.clear();
+    mExitCount.store(0u);
+    mCount.store(0u);
 }
 
 void SortedEventStack::deleteAllEvents(void)
 {
-    Lock lock( mSynchObject );
+    Lock lock( mLock );
 
-    while ( mValueList.empty( ) == false )
+    _collectIncoming();
+    uint32_t removed{ 0u };
+    for (auto & list : mQueued)
     {
-        Event * evt = mValueList.back( );
-        ASSERT( evt != nullptr );
-        evt->destroy( );
-        mValueList.pop_back( );
+        removed += _deleteList(list);
     }
+
+    removed += mExitCount.exchange(0u);
+    _removed(removed);
 }
 
 uint32_t SortedEventStack::deleteAllLowerPriority(Event::eEventPriority eventPrio)
 {
-    Lock lock(mSynchObject);
-
-    while (mValueList.empty() == false)
+    Lock lock(mLock);
+
+    _collectIncoming();
+    uint32_t removed{ 0u };
+    for (auto prio : { Event::eEventPriority::EventPriorityLow
+                     , Event::eEventPriority::EventPriorityNormal
+                     , Event::eEventPriority::EventPriorityHigh
+                     , Event::eEventPriority::EventPriorityCritical })
     {
-        Event* evt = mValueList.back();
-        ASSERT(evt != nullptr);
-        if (evt->getEventPriority() < eventPrio)
+        if (prio < eventPrio)
         {
-            evt->destroy();
-            mValueList.pop_back();
-        }
-        else
-        {
-            // Since the queue is sorted, ignore the rest
-            break;
+            removed += _deleteList(mQueued[_priorityIndex(prio)]);
         }
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return _removed(removed);
 }
 
 uint32_t SortedEventStack::deleteAllExceptClass(const RuntimeClassID& eventClassId)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    _collectIncoming();
+    uint32_t removed{ 0u };
+    for (auto & list : mQueued)
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventClassId != (*it)->getRuntimeClassId())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        removed += _deleteMatch(list, [&eventClassId](const Event* evt) { return (eventClassId != evt->getRuntimeClassId()); });
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return _removed(removed);
 }
 
 uint32_t SortedEventStack::deleteAllMatchPriority(Event::eEventPriority eventPrio)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    _collectIncoming();
+    uint32_t removed{ 0u };
+    if ((eventPrio >= Event::eEventPriority::EventPriorityLow) && (eventPrio <= Event::eEventPriority::EventPriorityCritical))
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventPrio == (*it)->getEventPriority())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        removed = _deleteList(mQueued[_priorityIndex(eventPrio)]);
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return _removed(removed);
 }
 
 uint32_t SortedEventStack::deleteAllMatchClass(const RuntimeClassID& eventClassId)
 {
-    Lock lock(mSynchObject);
+    Lock lock(mLock);
 
-    auto end = mValueList.end();
-    for (auto it = mValueList.begin(); it != end; )
+    _collectIncoming();
+    uint32_t removed{ 0u };
+    for (auto & list : mQueued)
     {
-        if ((*it)->getEventPriority() == Event::eEventPriority::EventPriorityExit)
-        {
-            it = std::next(it);
-        }
-        else if (eventClassId == (*it)->getRuntimeClassId())
-        {
-            (*it)->destroy();
-            it = mValueList.erase(it);
-        }
-        else
-        {
-            it = std::next(it);
-        }
+        removed += _deleteMatch(list, [&eventClassId](const Event* evt) { return (eventClassId == evt->getRuntimeClassId()); });
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return _removed(removed);
 }
 
 uint32_t SortedEventStack::pushEvent(Event * newEvent)
 {
     ASSERT(newEvent != nullptr);
-    Lock lock(mSynchObject);
-    switch (newEvent->getEventPriority())
-    {
-    case Event::eEventPriority::EventPriorityLow:
-        _insertAtEnd(newEvent);
-        break;
-
-    case Event::eEventPriority::EventPriorityNormal:
-        _insertAfterPrio(newEvent, Event::eEventPriority::EventPriorityNormal);
-        break;
 
-    case Event::eEventPriority::EventPriorityHigh:
-        _insertBeforePrio(newEvent, Event::eEventPriority::EventPriorityNormal);
-        break;
+    // Count the event before it becomes visible to the consumer.
+    // The consumer may see a non-zero count while the event is not linked yet,
+    // but it never sees a linked event, which is not counted.
+    uint32_t result = mCount.fetch_add(1u, std::memory_order_acq_rel) + 1u;
 
+    Event::eEventPriority prio = newEvent->getEventPriority();
+    switch (prio)
+    {
+    case Event::eEventPriority::EventPriorityLow:       // fall through
+    case Event::eEventPriority::EventPriorityNormal:    // fall through
+    case Event::eEventPriority::EventPriorityHigh:      // fall through
     case Event::eEventPriority::EventPriorityCritical:
-        _insertBeforePrio(newEvent, Event::eEventPriority::EventPriorityHigh);
+        {
+            std::atomic<Event*> & incoming = mIncoming[_priorityIndex(prio)];
+            Event* head = incoming.load(std::memory_order_relaxed);
+            do
+            {
+                newEvent->mQueueNext = head;
+            } while (incoming.compare_exchange_weak(head, newEvent, std::memory_order_release, std::memory_order_relaxed) == false);
+        }
         break;
 
     case Event::eEventPriority::EventPriorityExit:
-        _insertAtBegin(newEvent);
+        mExitEvent.store(newEvent, std::memory_order_relaxed);
+        mExitCount.fetch_add(1u, std::memory_order_release);
         break;
 
     case Event::eEventPriority::EventPriorityUndefined: // fall through
     case Event::eEventPriority::EventPriorityIgnore:    // fall through
     default:
         ASSERT(false);
+        result = mCount.fetch_sub(1u, std::memory_order_acq_rel) - 1u;
         break;
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    return result;
 }
 
 uint32_t  SortedEventStack::popEvent(Event** stackEvent)
 {
     ASSERT(stackEvent != nullptr);
 
-    Lock lock(mSynchObject);
-    if (mValueList.empty() == false)
+    Lock lock(mLock);
+    *stackEvent = nullptr;
+
+    uint32_t exitCount = mExitCount.load(std::memory_order_acquire);
+    while (exitCount != 0u)
     {
-        *stackEvent = mValueList.front();
-        mValueList.pop_front();
+        if (mExitCount.compare_exchange_weak(exitCount, exitCount - 1u, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            *stackEvent = mExitEvent.load(std::memory_order_relaxed);
+            return _removed(1u);
+        }
     }
-    else
+
+    _collectIncoming();
+    for (auto & list : mQueued)
     {
-        *stackEvent = nullptr;
+        Event* evt = list.evHead;
+        if (evt != nullptr)
+        {
+            list.evHead = evt->mQueueNext;
+            if (list.evHead == nullptr)
+            {
+                list.evTail = nullptr;
+            }
+
+            evt->mQueueNext = nullptr;
+            *stackEvent = evt;
+            return _removed(1u);
+        }
     }
 
-    return static_cast<uint32_t>(mValueList.size());
+    // Either empty, or the producer has counted, but not linked the event yet.
+    return mCount.load(std::memory_order_acquire);
 }
 
-inline void SortedEventStack::_insertAtEnd(Event* newEvent)
+inline uint32_t SortedEventStack::_priorityIndex(Event::eEventPriority eventPrio)
 {
-    mValueList.push_back(newEvent);
+    // Critical -> 0, High -> 1, Normal -> 2, Low -> 3
+    return (static_cast<uint32_t>(Event::eEventPriority::EventPriorityCritical) - static_cast<uint32_t>(eventPrio));
 }
 
-inline void SortedEventStack::_insertAfterPrio(Event* newEvent, Event::eEventPriority eventPrio)
+inline void SortedEventStack::_collectIncoming(void)
 {
-    auto it = mValueList.end();
-    if (mValueList.empty() == false)
+    for (uint32_t i = 0; i < PRIORITY_COUNT; ++ i)
     {
-        const auto begin = mValueList.begin();
-        it = std::prev(it);
-        while ( (it != begin) && ((*it)->getEventPriority() < eventPrio) )
+        if (mIncoming[i].load(std::memory_order_relaxed) == nullptr)
+            continue;
+
+        // Take all pushed events at once, they are in LIFO order.
+        Event* lifo = mIncoming[i].exchange(nullptr, std::memory_order_acquire);
+        Event* head = nullptr;
+        Event* tail = lifo;
+        while (lifo != nullptr)
         {
-            it = std::prev(it);
+            Event* next = lifo->mQueueNext;
+            lifo->mQueueNext = head;
+            head = lifo;
+            lifo = next;
         }
 
-        if ((*it)->getEventPriority() >= eventPrio)
+        sEventList & list = mQueued[i];
+        if (list.evTail != nullptr)
         {
-            it = std::next(it);
+            list.evTail->mQueueNext = head;
+        }
+        else
+        {
+            list.evHead = head;
         }
-    }
 
-    mValueList.insert(it, newEvent);
+        list.evTail = tail;
+    }
 }
 
-inline void SortedEventStack::_insertBeforePrio(Event* newEvent, Event::eEventPriority eventPrio)
+template<typename Predicate>
+inline uint32_t SortedEventStack::_deleteMatch(SortedEventStack::sEventList& list, Predicate doDelete)
 {
-    auto it = mValueList.begin();
-    if (mValueList.empty() == false)
+    uint32_t result{ 0u };
+    Event* prev = nullptr;
+    Event* evt  = list.evHead;
+    while (evt != nullptr)
     {
-        const auto end = mValueList.end();
-        while ((it != end) && ((*it)->getEventPriority() > eventPrio))
+        Event* next = evt->mQueueNext;
+        if (doDelete(evt))
+        {
+            if (prev != nullptr)
+            {
+                prev->mQueueNext = next;
+            }
+            else
+            {
+                list.evHead = next;
+            }
+
+            if (list.evTail == evt)
+            {
+                list.evTail = prev;
+            }
+
+            evt->mQueueNext = nullptr;
+            evt->destroy();
+            ++ result;
+        }
+        else
         {
-            it = std::next(it);
+            prev = evt;
         }
+
+        evt = next;
+    }
+
+    return result;
+}
+
+inline uint32_t SortedEventStack::_deleteList(SortedEventStack::sEventList& list)
+{
+    uint32_t result{ 0u };
+    Event* evt = list.evHead;
+    list.evHead = list.evTail = nullptr;
+    while (evt != nullptr)
+    {
+        Event* next = evt->mQueueNext;
+        evt->mQueueNext = nullptr;
+        evt->destroy();
+        evt = next;
+        ++ result;
     }
 
-    mValueList.insert(it, newEvent);
+    return result;
 }
 
-inline void SortedEventStack::_insertAtBegin(Event* newEvent)
+inline uint32_t SortedEventStack::_removed(uint32_t count)
 {
-    mValueList.push_front(newEvent);
+    return (count != 0u ? mCount.fetch_sub(count, std::memory_order_acq_rel) - count : mCount.load(std::memory_order_acquire));
 }
@@ -20,9 +20,11 @@
   * Includes
   ************************************************************************/
 #include "areg/base/GEGlobal.h"
-#include "areg/base/TEStack.hpp"
+#include "areg/base/SynchObjects.hpp"
 #include "areg/component/Event.hpp"
 
+#include <atomic>
+
 class RuntimeClassID;
 
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
@@ -47,14 +49,37 @@ class RuntimeClassID;
  *          The "Exit" events have reserved "Exit" priority. This priority is only for internal use and should not be used
  *          by other developers. The "Exit" events should be immediately processed and they are not removed from the 
  *          stack until they are not processed by thread dispatcher.
+ *
+ *          The stack is a multiple-producer / single-consumer queue. Every priority has own
+ *          lock-free incoming list, where the producers push the events without locking and
+ *          without allocating nodes (the events are linked intrusively). The consumer moves
+ *          the incoming events in the FIFO order of the priority and pops them by priority.
+ *          The lock of the stack synchronizes only the consumer side operations (pop and remove),
+ *          so that the threads that push events never wait for each other or for the consumer.
  **/
-class SortedEventStack  : protected TELockStack<Event *>
+class SortedEventStack
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The number of queued priorities: Low, Normal, High and Critical.
+    static constexpr uint32_t   PRIORITY_COUNT  { 4u };
+
+    /**
+     * \brief   The FIFO list of events of the same priority, owned by the consumer.
+     **/
+    struct sEventList
+    {
+        Event*  evHead  { nullptr };    //!< The first event in the list.
+        Event*  evTail  { nullptr };    //!< The last event in the list.
+    };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
 public:
-    SortedEventStack( void ) = default;
+    SortedEventStack( void );
 
     ~SortedEventStack(void);
 
@@ -99,8 +124,10 @@ public:
     /**
      * \brief   Pushes the event in the stack considering the priority, so that the events
      *          with the higher priority can be processed earlier.
+     *          The method does not lock the stack and can be called from any thread.
      * \param   newEvent    The pointer to the event with the priority.
-     * \return  Returns the number of elements in the stack.
+     * \return  Returns the number of elements in the stack. The value 1 means that
+     *          the stack was empty before the event has been pushed.
      **/
     uint32_t pushEvent(Event * newEvent);
 
@@ -123,7 +150,8 @@ public:
     inline uint32_t getCount(void) const;
 
     /**
-     * \brief   Locks the stack, so that the all other threads cannot access.
+     * \brief   Locks the stack, so that the all other threads cannot pop or remove elements.
+     *          The lock does not prevent other threads to push the events.
      * \return  Returns true, if succeeded to lock the stack.
      **/
     inline bool lockStack(void);
@@ -138,36 +166,54 @@ public:
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Inserts the event at the end of the stack. No priority is considered.
-     *          For example, the events with low priority are inserted at the end of the stack.
+     * \brief   Returns the index of the list of events of specified priority.
+     *          The higher priorities have lower index to be popped earlier.
+     **/
+    static inline uint32_t _priorityIndex(Event::eEventPriority eventPrio);
+
+    /**
+     * \brief   Moves all events pushed by producers into the FIFO list of the priority,
+     *          keeping the order in which they have been pushed.
+     *          Should be called only by the consumer, when the stack is locked.
      **/
-    inline void _insertAtEnd(Event * newEvent);
+    inline void _collectIncoming(void);
 
     /**
-     * \brief   Inserts the event object at the end of the event elements list of specified priority.
-     *          The function compares the priority of the events and inserts the element
-     *          at the end of the list with events of the specified priority.
-     *          The search is started at the end.
-     * \param   newEvent    The event object to insert.
-     * \param   eventPrio   The priority of event to search in the stack.
+     * \brief   Deletes all events in the given list, which match the specified condition.
+     * \param   list        The list of events to search.
+     * \param   doDelete    The condition to check.
+     * \return  Returns the number of deleted events.
      **/
-    inline void _insertAfterPrio(Event * newEvent, Event::eEventPriority eventPrio);
+    template<typename Predicate>
+    inline uint32_t _deleteMatch(sEventList& list, Predicate doDelete);
 
     /**
-     * \brief   Inserts the event object before the elements of specified are queued.
-     *          The function compares the priority of the events and inserts the element
-     *          at the position before the events of specified priority start.
-     *          The search is started at the begin.
-     * \param   newEvent    The event object to insert.
-     * \param   eventPrio   The priority of event to search in the stack.
+     * \brief   Deletes all events of the specified list.
+     * \return  Returns the number of deleted events.
      **/
-    inline void _insertBeforePrio(Event * newEvent, Event::eEventPriority eventPrio);
+    inline uint32_t _deleteList(sEventList& list);
 
     /**
-     * \brief   Inserts the event element at the very begin of the stack, so that it is
-     *          processed as soon as possible.
+     * \brief   Decreases the number of events in the stack and returns the rest.
      **/
-    inline void _insertAtBegin(Event * newEvent);
+    inline uint32_t _removed(uint32_t count);
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The synchronization object of the consumer side operations.
+    ResourceLock            mLock;
+    //!< Lock-free lists of pushed events, a list per priority. The events are in LIFO order.
+    std::atomic<Event*>     mIncoming[PRIORITY_COUNT];
+    //!< The FIFO lists of the events sorted by priority, accessed only by the consumer.
+    sEventList              mQueued[PRIORITY_COUNT];
+    //!< The pending "Exit" event. The exit event is a singleton shared by all dispatchers, so it is not linked.
+    std::atomic<Event*>     mExitEvent;
+    //!< The number of pending "Exit" events.
+    std::atomic_uint32_t    mExitCount;
+    //!< The total number of events in the stack, including pushed, but not collected yet.
+    std::atomic_uint32_t    mCount;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden methods
@@ -187,23 +233,22 @@ private:
 
 inline bool SortedEventStack::isEmpty(void) const
 {
-    Lock lock(mSynchObject);
-    return mValueList.empty();
+    return (mCount.load(std::memory_order_acquire) == 0u);
 }
 
 inline uint32_t SortedEventStack::getCount(void) const
 {
-    return static_cast<uint32_t>(mValueList.size());
+    return mCount.load(std::memory_order_acquire);
 }
 
 inline bool SortedEventStack::lockStack(void)
 {
-    return lock();
+    return mLock.lock(NECommon::WAIT_INFINITE);
 }
 
 inline void SortedEventStack::unlockStack(void)
 {
-    unlock();
+    mLock.unlock();
 }
 
 #endif  // AREG_COMPONENT_PRIVATE_SORTEDEVENTSTACK_HPP
@@ -17,6 +17,7 @@
 
 #include "areg/component/ServiceRequestEvent.hpp"
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/component/private/TEAddressHandleTable.hpp"
 #include "areg/component/ProxyAddress.hpp"
 #include "areg/base/ThreadAddress.hpp"
 #include "areg/base/IEIOStream.hpp"
@@ -34,6 +35,15 @@ namespace
      * \brief   Extension to add to Stub path.
      **/
     constexpr std::string_view  EXTENTION_STUB      { "stub" };
+
+    /**
+     * \brief   Returns the table of handles of stub addresses.
+     **/
+    inline TEAddressHandleTable<StubAddress> & _handleTable( void )
+    {
+        static TEAddressHandleTable<StubAddress> _table;
+        return _table;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -61,6 +71,42 @@ const StubAddress & StubAddress::getInvalidStubAddress( void )
     return _invalidStubAddress;
 }
 
+uint32_t StubAddress::createHandle( const StubAddress & addrStub )
+{
+    return _handleTable( ).createHandle( addrStub );
+}
+
+void StubAddress::releaseHandle( uint32_t handle )
+{
+    _handleTable( ).releaseHandle( handle );
+}
+
+void StubAddress::updateHandle( const StubAddress & addrStub )
+{
+    _handleTable( ).updateAddress( addrStub.mHandle, addrStub );
+}
+
+void StubAddress::setHandleOwner( const ITEM_ID & cookie )
+{
+    _handleTable( ).setOwner( cookie );
+}
+
+void StubAddress::registerRemoteHandle( const StubAddress & addrStub )
+{
+    if ( addrStub.mHandle != NEService::INVALID_HANDLE )
+    {
+        _handleTable( ).registerRemote( addrStub.mHandle, addrStub.getCookie( ), addrStub );
+    }
+}
+
+void StubAddress::unregisterRemoteHandle( const StubAddress & addrStub )
+{
+    if ( addrStub.mHandle != NEService::INVALID_HANDLE )
+    {
+        _handleTable( ).unregisterRemote( addrStub.mHandle, addrStub.getCookie( ) );
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -69,6 +115,7 @@ StubAddress::StubAddress( void )
     , mThreadName   ( ThreadAddress::getInvalidThreadAddress().getThreadName() )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
 }
 
@@ -81,6 +128,7 @@ StubAddress::StubAddress( const String & serviceName
     , mThreadName   ( )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     setThread(threadName); // don't change this to fix channel source.
     if ( ServiceAddress::isValid() )
@@ -96,6 +144,7 @@ StubAddress::StubAddress(const ServiceItem & service, const String & roleName, c
     , mThreadName   ( )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     setThread(threadName); // don't change this to fix channel source.
     if ( ServiceAddress::isValid() )
@@ -111,6 +160,7 @@ StubAddress::StubAddress(const NEService::SInterfaceData & siData, const String
     , mThreadName   ( )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     setThread(threadName); // don't change this to fix channel source.
     if ( ServiceAddress::isValid() )
@@ -124,6 +174,7 @@ StubAddress::StubAddress( const StubAddress & source )
     , mThreadName   ( source.mThreadName )
     , mChannel      ( source.mChannel )
     , mMagicNum     ( source.mMagicNum )
+    , mHandle       ( source.mHandle )
 {
 }
 
@@ -132,6 +183,7 @@ StubAddress::StubAddress( StubAddress && source ) noexcept
     , mThreadName   ( std::move(source.mThreadName) )
     , mChannel      ( std::move(source.mChannel) )
     , mMagicNum     ( source.mMagicNum )
+    , mHandle       ( source.mHandle )
 {
 }
 
@@ -140,6 +192,7 @@ StubAddress::StubAddress(const ServiceAddress & source)
     , mThreadName   (ThreadAddress::getInvalidThreadAddress().getThreadName())
     , mChannel      ( )
     , mMagicNum     (static_cast<unsigned int>(source))
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     if (ServiceAddress::isValid())
         mChannel.setCookie(NEService::COOKIE_LOCAL);
@@ -150,23 +203,22 @@ StubAddress::StubAddress( ServiceAddress && source)
     , mThreadName   (ThreadAddress::getInvalidThreadAddress().getThreadName())
     , mChannel      ( )
     , mMagicNum     (static_cast<unsigned int>(static_cast<const ServiceAddress &>(self())))
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
     if (ServiceAddress::isValid())
         mChannel.setCookie(NEService::COOKIE_LOCAL);
 }
 
 StubAddress::StubAddress( const IEInStream & stream )
-    : ServiceAddress( stream )
-    , mThreadName   ( stream )
+    : ServiceAddress( )
+    , mThreadName   ( )
     , mChannel      ( )
     , mMagicNum     ( NEMath::CHECKSUM_IGNORE )
+    , mHandle       ( NEService::INVALID_HANDLE )
 {
-    ITEM_ID cookie = NEService::COOKIE_LOCAL;
-    stream >> cookie;
+    ITEM_ID cookie = _readAddress( stream );
     if ( ServiceAddress::isValid() )
         mChannel.setCookie(cookie);
-
-    mMagicNum = StubAddress::_magicNumber(*this);
 }
 
 bool StubAddress::isProxyCompatible(const ProxyAddress & proxyAddress) const
@@ -276,6 +328,66 @@ unsigned int StubAddress::_magicNumber(const StubAddress & addrStub)
     return result;
 }
 
+IEOutStream & StubAddress::writeCompact( IEOutStream & stream ) const
+{
+    // the local address is written with the cookie of the process published to other processes.
+    const ITEM_ID cookie{ isLocalAddress( ) ? _handleTable( ).getOwner( ) : mChannel.getCookie( ) };
+    if ( (mHandle != NEService::INVALID_HANDLE) && (cookie >= NEService::COOKIE_REMOTE_SERVICE) )
+    {
+        const std::string_view & marker{ TEAddressHandleTable<StubAddress>::HANDLE_MARKER };
+        stream.write( reinterpret_cast<const unsigned char *>(marker.data( )), static_cast<unsigned int>(marker.size( )) );
+        stream << mHandle;
+        stream << cookie;
+    }
+    else
+    {
+        stream << *this;
+    }
+
+    return stream;
+}
+
+ITEM_ID StubAddress::_readAddress( const IEInStream & stream )
+{
+    ITEM_ID cookie{ NEService::COOKIE_LOCAL };
+    String serviceName;
+    stream >> serviceName;
+    if ( serviceName == TEAddressHandleTable<StubAddress>::HANDLE_MARKER.data( ) )
+    {
+        stream >> mHandle;
+        stream >> cookie;
+
+        StubAddress addrStub;
+        if ( _handleTable( ).findAddress( mHandle, cookie, addrStub ) )
+        {
+            static_cast<ServiceAddress &>(*this) = static_cast<const ServiceAddress &>(addrStub);
+            mThreadName = addrStub.mThreadName;
+            mMagicNum   = addrStub.mMagicNum;
+        }
+        else
+        {
+            *this = StubAddress::getInvalidStubAddress( );
+        }
+    }
+    else
+    {
+        Version version;
+        NEService::eServiceType serviceType{ NEService::eServiceType::ServiceInvalid };
+        String roleName;
+        stream >> version;
+        stream >> serviceType;
+        stream >> roleName;
+        stream >> mThreadName;
+        stream >> cookie;
+
+        static_cast<ServiceAddress &>(*this) = ServiceAddress( serviceName, version, serviceType, roleName );
+        mMagicNum   = StubAddress::_magicNumber( *this );
+        mHandle     = NEService::INVALID_HANDLE;
+    }
+
+    return cookie;
+}
+
 bool StubAddress::isValidated(void) const
 {
     return ServiceAddress::isValidated() && (mThreadName.isEmpty() == false) && (mThreadName != ThreadAddress::getInvalidThreadAddress().getThreadName());
@@ -283,14 +395,9 @@ bool StubAddress::isValidated(void) const
 
 AREG_API_IMPL const IEInStream & operator >> ( const IEInStream & stream, StubAddress & input )
 {
-    ITEM_ID cookie = NEService::COOKIE_LOCAL;
-    stream >> static_cast<ServiceAddress &>(input);
-    stream >> input.mThreadName;
-    stream >> cookie;
-
+    ITEM_ID cookie = input._readAddress( stream );
     input.setCookie(cookie);
-    input.mMagicNum = StubAddress::_magicNumber(input);
-    
+
     return stream;
 }
 
@@ -84,6 +84,7 @@ StubBase::StubBase( Component & masterComp, const NEService::SInterfaceData & si
     , mSessionId            (0)
     , mMapSessions          ( )
 {
+    mAddress.setHandle( StubAddress::createHandle(mAddress) );
     _mapRegisteredStubs.registerResourceObject(mAddress, this);
     masterComp.registerServerItem(self());
 }
@@ -91,6 +92,7 @@ StubBase::StubBase( Component & masterComp, const NEService::SInterfaceData & si
 StubBase::~StubBase( void )
 {
     _mapRegisteredStubs.unregisterResourceObject(mAddress);
+    StubAddress::releaseHandle( mAddress.getHandle() );
 }
 
 bool StubBase::isBusy( unsigned int requestId ) const
@@ -239,15 +241,43 @@ void StubBase::sendErrorNotification( const StubListenerList & whichListeners, c
 
 void StubBase::sendUpdateNotification( const StubListenerList & whichListeners, const ServiceResponseEvent & masterEvent ) const
 {
+    // The remote proxies of the same channel receive one multicast event, so that the data is sent once.
+    TEArrayList<RemoteResponseEvent *> multicastEvents;
     for (StubListenerList::LISTPOS pos = whichListeners.firstPosition(); whichListeners.isValidPosition(pos); pos = whichListeners.nextPosition(pos))
     {
         const StubBase::Listener& listener = whichListeners[pos];
+        const bool isRemote{ listener.mProxy.isRemoteAddress() };
+        RemoteResponseEvent* eventMulticast{ nullptr };
+        for (uint32_t i = 0; isRemote && (eventMulticast == nullptr) && (i < multicastEvents.getSize()); ++ i)
+        {
+            if (multicastEvents[i]->getTargetProxy().getSource() == listener.mProxy.getSource())
+            {
+                eventMulticast = multicastEvents[i];
+            }
+        }
+
+        if (eventMulticast != nullptr)
+        {
+            eventMulticast->addMulticastTarget(listener.mProxy);
+            continue;
+        }
+
         ServiceResponseEvent* eventResp = masterEvent.cloneForTarget(listener.mProxy);
-        if ( eventResp != nullptr )
+        RemoteResponseEvent* eventRemote = isRemote ? RUNTIME_CAST(eventResp, RemoteResponseEvent) : nullptr;
+        if (eventRemote != nullptr)
+        {
+            multicastEvents.add(eventRemote);
+        }
+        else if ( eventResp != nullptr )
         {
             sendServiceResponse( *eventResp );
         }
     }
+
+    for (uint32_t i = 0; i < multicastEvents.getSize(); ++ i)
+    {
+        sendServiceResponse( *multicastEvents[i] );
+    }
 }
 
 void StubBase::sendServiceResponse( ServiceResponseEvent & eventElem ) const
@@ -513,7 +543,11 @@ void StubBase::processStubRegisteredEvent(const StubAddress & stubTarget, NEServ
         _mapRegisteredStubs.lock();
         _mapRegisteredStubs.unregisterResourceObject(mAddress);
 
+        // the stub keeps the handle created for the address.
+        const uint32_t handle{ mAddress.getHandle() };
         mAddress = stubTarget;
+        mAddress.setHandle( handle );
+        StubAddress::updateHandle( mAddress );
         
         _mapRegisteredStubs.registerResourceObject(mAddress, this);
         _mapRegisteredStubs.unlock();
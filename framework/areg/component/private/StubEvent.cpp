@@ -59,7 +59,7 @@ const IEInStream & StubEvent::readStream( const IEInStream & stream )
 IEOutStream & StubEvent::writeStream( IEOutStream & stream ) const
 {
     StreamableEvent::writeStream(stream);
-    stream << mTargetStubAddress;
+    mTargetStubAddress.writeCompact(stream);
     return stream;
 }
 
@@ -0,0 +1,353 @@
+#ifndef AREG_COMPONENT_PRIVATE_TEADDRESSHANDLETABLE_HPP
+#define AREG_COMPONENT_PRIVATE_TEADDRESSHANDLETABLE_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/TEAddressHandleTable.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the table of numeric handles of stub and
+ *              proxy addresses used on the wire after registration.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEHashMap.hpp"
+#include "areg/component/NEService.hpp"
+
+#include <string_view>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// TEAddressHandleTable class template declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The table of numeric handles of stub or proxy addresses.
+ *          The handles of addresses created in the process are indexes
+ *          of the entries in the array of local addresses. The handles
+ *          of addresses of other processes are published by the router
+ *          when the service is registered and are saved in the arrays
+ *          of the process cookies. The address is found by the handle
+ *          and the cookie of the process owning the address.
+ *
+ *          The lower bits of the handle are the entry index plus one,
+ *          the higher bits are the generation of the entry, which
+ *          changes each time the entry is reused. The handle never is
+ *          equal to NEService::INVALID_HANDLE.
+ *
+ * \tparam  ADDRESS     The type of address, either StubAddress or ProxyAddress.
+ **/
+template<class ADDRESS>
+class TEAddressHandleTable
+{
+//////////////////////////////////////////////////////////////////////////
+// Constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The string written in the stream instead of service name,
+     *          which indicates that the address handle and the owner cookie
+     *          follow instead of address data. The null-terminating symbol
+     *          is part of the marker.
+     **/
+    static constexpr std::string_view   HANDLE_MARKER   { "\x01", 2 };
+
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The number of bits of the entry index in the handle.
+    static constexpr uint32_t   INDEX_BITS      { 20u };
+    //!< The mask of the entry index in the handle.
+    static constexpr uint32_t   INDEX_MASK      { (1u << INDEX_BITS) - 1u };
+    //!< The maximum number of entries in one array.
+    static constexpr uint32_t   MAX_ENTRIES     { INDEX_MASK };
+
+    //!< The entry of the table.
+    struct sEntry
+    {
+        //!< The handle of the entry, or invalid if the entry is free.
+        uint32_t    seHandle    { NEService::INVALID_HANDLE };
+        //!< The generation of the entry, changed each time the entry is reused.
+        uint32_t    seGeneration{ 0u };
+        //!< The address of the entry.
+        ADDRESS     seAddress   { };
+    };
+
+    //!< The array of entries.
+    using EntryList = std::vector<sEntry>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    TEAddressHandleTable( void );
+    ~TEAddressHandleTable( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Creates and returns the handle of the address created in the process.
+     *          Returns NEService::INVALID_HANDLE if the table is full.
+     * \param   address     The address to create handle.
+     **/
+    uint32_t createHandle( const ADDRESS & address );
+
+    /**
+     * \brief   Releases the handle of the address created in the process.
+     *          The entry can be reused by the next created handle.
+     * \param   handle      The handle to release.
+     **/
+    void releaseHandle( uint32_t handle );
+
+    /**
+     * \brief   Updates the address of the handle created in the process.
+     * \param   handle      The handle of the address.
+     * \param   address     The new address data.
+     **/
+    void updateAddress( uint32_t handle, const ADDRESS & address );
+
+    /**
+     * \brief   Sets the cookie of the process, which owns the handles of
+     *          the local addresses, and removes all handles of other processes.
+     *          Called when the process is connected or disconnected from the router.
+     * \param   cookie      The cookie of the process assigned by the router.
+     *                      NEService::COOKIE_UNKNOWN if disconnected.
+     **/
+    void setOwner( const ITEM_ID & cookie );
+
+    /**
+     * \brief   Returns the cookie of the process, which owns the handles of local addresses.
+     **/
+    inline ITEM_ID getOwner( void ) const;
+
+    /**
+     * \brief   Saves the handle of the address of other process published by the router.
+     * \param   handle      The handle of the address in the owner process.
+     * \param   cookie      The cookie of the owner process.
+     * \param   address     The address of the handle.
+     **/
+    void registerRemote( uint32_t handle, const ITEM_ID & cookie, const ADDRESS & address );
+
+    /**
+     * \brief   Removes the handle of the address of other process.
+     * \param   handle      The handle of the address in the owner process.
+     * \param   cookie      The cookie of the owner process.
+     **/
+    void unregisterRemote( uint32_t handle, const ITEM_ID & cookie );
+
+    /**
+     * \brief   Searches the address by the handle and the cookie of the owner process.
+     * \param   handle          The handle of the address.
+     * \param   cookie          The cookie of the process, which owns the handle.
+     * \param   out_address     On output contains the address if found.
+     * \return  Returns true if found the address of the handle.
+     **/
+    bool findAddress( uint32_t handle, const ITEM_ID & cookie, ADDRESS & OUT out_address ) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the index of the entry of the handle.
+     **/
+    static inline uint32_t _index( uint32_t handle );
+
+    /**
+     * \brief   Returns the entry of the handle in the list, or nullptr if the handle is not valid.
+     **/
+    static inline const sEntry * _findEntry( const EntryList & entries, uint32_t handle );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The entries of the addresses created in the process.
+    EntryList                       mLocal;
+    //!< The indexes of free entries of the addresses created in the process.
+    std::vector<uint32_t>           mFreeList;
+    //!< The entries of the addresses of other processes, where the key is the cookie of the process.
+    TEHashMap<ITEM_ID, EntryList>   mRemote;
+    //!< The cookie of the process, which owns the local addresses.
+    ITEM_ID                         mOwner;
+    //!< The synchronization object.
+    mutable SpinLock                mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( TEAddressHandleTable );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// TEAddressHandleTable class template implementation
+//////////////////////////////////////////////////////////////////////////
+
+template<class ADDRESS>
+TEAddressHandleTable<ADDRESS>::TEAddressHandleTable( void )
+    : mLocal    ( )
+    , mFreeList ( )
+    , mRemote   ( )
+    , mOwner    ( NEService::COOKIE_UNKNOWN )
+    , mLock     ( )
+{
+}
+
+template<class ADDRESS>
+uint32_t TEAddressHandleTable<ADDRESS>::createHandle( const ADDRESS & address )
+{
+    Lock lock( mLock );
+
+    uint32_t index{ static_cast<uint32_t>(mLocal.size( )) };
+    if ( mFreeList.empty( ) == false )
+    {
+        index = mFreeList.back( );
+        mFreeList.pop_back( );
+    }
+    else if ( index < MAX_ENTRIES )
+    {
+        mLocal.emplace_back( );
+    }
+    else
+    {
+        return NEService::INVALID_HANDLE;
+    }
+
+    sEntry & entry = mLocal[index];
+    entry.seHandle  = (entry.seGeneration << INDEX_BITS) | (index + 1u);
+    entry.seAddress = address;
+    return entry.seHandle;
+}
+
+template<class ADDRESS>
+void TEAddressHandleTable<ADDRESS>::releaseHandle( uint32_t handle )
+{
+    Lock lock( mLock );
+
+    const uint32_t index{ _index( handle ) };
+    if ( (index < mLocal.size( )) && (mLocal[index].seHandle == handle) )
+    {
+        sEntry & entry = mLocal[index];
+        entry.seHandle      = NEService::INVALID_HANDLE;
+        entry.seGeneration  = (entry.seGeneration + 1u) & (~0u >> INDEX_BITS);
+        entry.seAddress     = ADDRESS( );
+        mFreeList.push_back( index );
+    }
+}
+
+template<class ADDRESS>
+void TEAddressHandleTable<ADDRESS>::updateAddress( uint32_t handle, const ADDRESS & address )
+{
+    Lock lock( mLock );
+
+    const uint32_t index{ _index( handle ) };
+    if ( (index < mLocal.size( )) && (mLocal[index].seHandle == handle) )
+    {
+        mLocal[index].seAddress = address;
+    }
+}
+
+template<class ADDRESS>
+void TEAddressHandleTable<ADDRESS>::setOwner( const ITEM_ID & cookie )
+{
+    Lock lock( mLock );
+
+    mOwner = cookie;
+    mRemote.clear( );
+}
+
+template<class ADDRESS>
+inline ITEM_ID TEAddressHandleTable<ADDRESS>::getOwner( void ) const
+{
+    Lock lock( mLock );
+    return mOwner;
+}
+
+template<class ADDRESS>
+void TEAddressHandleTable<ADDRESS>::registerRemote( uint32_t handle, const ITEM_ID & cookie, const ADDRESS & address )
+{
+    const uint32_t index{ _index( handle ) };
+    if ( index < MAX_ENTRIES )
+    {
+        Lock lock( mLock );
+
+        EntryList & entries = mRemote[cookie];
+        if ( index >= entries.size( ) )
+        {
+            entries.resize( index + 1u );
+        }
+
+        entries[index].seHandle     = handle;
+        entries[index].seAddress    = address;
+    }
+}
+
+template<class ADDRESS>
+void TEAddressHandleTable<ADDRESS>::unregisterRemote( uint32_t handle, const ITEM_ID & cookie )
+{
+    Lock lock( mLock );
+
+    auto pos = mRemote.find( cookie );
+    if ( mRemote.isValidPosition( pos ) )
+    {
+        EntryList & entries = mRemote.valueAtPosition( pos );
+        const uint32_t index{ _index( handle ) };
+        if ( (index < entries.size( )) && (entries[index].seHandle == handle) )
+        {
+            entries[index].seHandle     = NEService::INVALID_HANDLE;
+            entries[index].seAddress    = ADDRESS( );
+        }
+    }
+}
+
+template<class ADDRESS>
+bool TEAddressHandleTable<ADDRESS>::findAddress( uint32_t handle, const ITEM_ID & cookie, ADDRESS & OUT out_address ) const
+{
+    Lock lock( mLock );
+
+    const sEntry * entry{ nullptr };
+    if ( cookie == mOwner )
+    {
+        entry = _findEntry( mLocal, handle );
+    }
+    else
+    {
+        auto pos = mRemote.find( cookie );
+        entry = mRemote.isValidPosition( pos ) ? _findEntry( mRemote.valueAtPosition( pos ), handle ) : nullptr;
+    }
+
+    if ( entry != nullptr )
+    {
+        out_address = entry->seAddress;
+    }
+
+    return (entry != nullptr);
+}
+
+template<class ADDRESS>
+inline uint32_t TEAddressHandleTable<ADDRESS>::_index( uint32_t handle )
+{
+    // the invalid handle results the maximum index
+    return ((handle & INDEX_MASK) - 1u);
+}
+
+template<class ADDRESS>
+inline const typename TEAddressHandleTable<ADDRESS>::sEntry * TEAddressHandleTable<ADDRESS>::_findEntry( const EntryList & entries, uint32_t handle )
+{
+    const uint32_t index{ _index( handle ) };
+    return ((index < entries.size( )) && (entries[index].seHandle == handle) ? &entries[index] : nullptr);
+}
+
+#endif  // AREG_COMPONENT_PRIVATE_TEADDRESSHANDLETABLE_HPP
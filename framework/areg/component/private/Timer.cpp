@@ -89,6 +89,8 @@ bool Timer::startTimer(unsigned int timeoutInMs, DispatcherThread & whichThread,
 
         if (TimerBase::createWaitableTimer())
         {
+            // Set the target thread before starting, the timer may expire before the call returns.
+            mDispatchThread = &whichThread;
             mStarted = TimerManager::startTimer(self(), whichThread);
             mDispatchThread = mStarted ? &whichThread : nullptr;
         }
@@ -76,10 +76,18 @@ bool TimerManager::startTimer(Timer &timer, const DispatcherThread & whichThread
     {
         if ( timerManager._registerTimer( timer, whichThread ) )
         {
-            LOG_DBG( "Registered timer [ %s ] for thread [ %p ], sending event to start timer", timer.getName( ).getString( ), whichThread.getId( ) );
-            result = TimerManagerEvent::sendEvent( TimerManagerEventData(&timer)
-                                                 , static_cast<IETimerManagerEventConsumer &>(timerManager)
-                                                 , static_cast<DispatcherThread &>(timerManager) );
+            if ( TimerManager::_osSystemTimerQueue( timer ) )
+            {
+                LOG_DBG( "Registered timer [ %s ] for thread [ %p ], sending event to start timer", timer.getName( ).getString( ), whichThread.getId( ) );
+                result = TimerManagerEvent::sendEvent( TimerManagerEventData(&timer)
+                                                     , static_cast<IETimerManagerEventConsumer &>(timerManager)
+                                                     , static_cast<DispatcherThread &>(timerManager) );
+            }
+            else
+            {
+                LOG_DBG( "Registered and queued timer [ %s ] for thread [ %p ]", timer.getName( ).getString( ), whichThread.getId( ) );
+                result = true;
+            }
         }
         else
         {
@@ -107,6 +115,11 @@ TimerManager::TimerManager( void )
     : TimerManagerBase  ( TimerManager::TIMER_THREAD_NAME )
 
     , mTimerResource( )
+#ifdef _POSIX
+    , mTimerWheel   ( )
+    , mExpiredTimers( )
+    , mFiredTimers  ( )
+#endif  // _POSIX
 {
 }
 
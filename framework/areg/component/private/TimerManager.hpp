@@ -25,6 +25,10 @@
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/TEResourceMap.hpp"
 
+#ifdef _POSIX
+    #include "areg/component/private/posix/TimerWheelPosix.hpp"
+#endif  // _POSIX
+
 /************************************************************************
  * Dependencies
  ************************************************************************/
@@ -57,13 +61,14 @@ class TimerManager  : protected TimerManagerBase
 //////////////////////////////////////////////////////////////////////////
 // Predefined constants and types
 //////////////////////////////////////////////////////////////////////////    
-private:
+public:
     /**
      * \brief   TimerManager::TIMER_THREAD_NAME
      *          Timer Manager thread name
      **/
     static constexpr std::string_view TIMER_THREAD_NAME { "_AREG_TIMER_THREAD_NAME_" };
 
+private:
     using MapTimerResource  = TEHashMap<TIMERHANDLE, Timer *>;
     using TimerResource     = TELockResourceMap<TIMERHANDLE, Timer *, MapTimerResource>;
 
@@ -180,6 +185,21 @@ protected:
      **/
     virtual void readyForEvents( bool isReady ) override;
 
+#ifdef _POSIX
+
+/************************************************************************/
+// TimerManagerBase overrides
+/************************************************************************/
+
+    /**
+     * \brief   Expires the timers of the timing wheel, sends timer events to
+     *          the target threads and schedules the periodic timers again.
+     * \return  Returns the timeout in milliseconds until next timer expires.
+     **/
+    virtual unsigned int processTimers( void ) override;
+
+#endif  // _POSIX
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden operations. Called from Timer Thread.
 //////////////////////////////////////////////////////////////////////////
@@ -241,16 +261,12 @@ private:
 #endif // !_WIN32
 
 
-#ifdef _POSIX
-
     /**
-     * \brief   POSIX timer routine function. Triggered, when one of timer is expired.
-     * \param   argSig          The value passed to thread signal when the timer was created.
-     *                          This value is passed to routine callback.
+     * \brief   Queues the timer to start in the calling thread, if supported by the system.
+     * \param   timer   The timer object.
+     * \return  Returns true if the Timer Manager thread should be notified to start the timer.
      **/
-    static void _posixTimerExpiredRoutine( union sigval argSig );
-
-#endif  // !_POSIX
+    static bool _osSystemTimerQueue( Timer & timer );
 
     /**
      * \brief   Starts system timer and returns true if timer started with success.
@@ -274,6 +290,25 @@ private:
      **/
     TimerResource	mTimerResource;
 
+#ifdef _POSIX
+
+    /**
+     * \brief   The timing wheel, which runs all timers in the Timer Manager thread.
+     **/
+    TimerWheelPosix mTimerWheel;
+
+    /**
+     * \brief   The list of expired timer handles, reused on each expiration.
+     **/
+    TimerWheelPosix::ExpiredList    mExpiredTimers;
+
+    /**
+     * \brief   The list of expired timers to notify, reused on each expiration.
+     **/
+    std::vector<Timer *>            mFiredTimers;
+
+#endif  // _POSIX
+
 //////////////////////////////////////////////////////////////////////////
 //  Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -43,7 +43,7 @@ bool TimerManagerBase::runDispatcher(void)
 
     do
     {
-        whichEvent = multiLock.lock(NECommon::WAIT_INFINITE, false, true);
+        whichEvent = multiLock.lock(processTimers(), false, true);
         Event* eventElem = whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) ? pickEvent() : nullptr;
         if (static_cast<const Event*>(eventElem) != static_cast<const Event*>(&exitEvent))
         {
@@ -65,7 +65,7 @@ bool TimerManagerBase::runDispatcher(void)
             whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventExit);
         }
 
-    } while (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) || (whichEvent == MultiLock::LOCK_INDEX_COMPLETION));
+    } while (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue) || (whichEvent == MultiLock::LOCK_INDEX_COMPLETION) || (whichEvent == MultiLock::LOCK_INDEX_TIMEOUT));
 
     readyForEvents(false);
     removeAllEvents();
@@ -89,6 +89,11 @@ void TimerManagerBase::readyForEvents(bool isReady)
     DispatcherThread::readyForEvents( true );
 }
 
+unsigned int TimerManagerBase::processTimers(void)
+{
+    return NECommon::WAIT_INFINITE;
+}
+
 bool TimerManagerBase::startTimerManagerThread(void)
 {
     ASSERT(isReady() || (isRunning() == false));
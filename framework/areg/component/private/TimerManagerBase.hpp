@@ -88,6 +88,19 @@ protected:
      **/
     virtual void readyForEvents( bool isReady ) override;
 
+/************************************************************************/
+// TimerManagerBase overrides
+/************************************************************************/
+
+    /**
+     * \brief   Triggered by the Timer Manager Thread before it waits for the next event.
+     *          Override to process the expired timers in the Timer Manager Thread.
+     * \return  Returns the timeout in milliseconds to wait for the next event before
+     *          the timers should be processed again. By default, it returns
+     *          NECommon::WAIT_INFINITE, so that the thread is waiting only for events.
+     **/
+    virtual unsigned int processTimers( void );
+
     /**
      * \brief   Starts Timer Manager Thread it is not started yet.
      * \return  Returns true if Timer Manager Thread is started and ready to process events.
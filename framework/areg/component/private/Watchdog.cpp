@@ -20,6 +20,7 @@
 #include "areg/component/private/WatchdogManager.hpp"
 
 #include <atomic>
+#include <chrono>
 
 Watchdog::GUARD_ID Watchdog::_generateId(void)
 {
@@ -27,12 +28,20 @@ Watchdog::GUARD_ID Watchdog::_generateId(void)
     return (++_id);
 }
 
+uint64_t Watchdog::getGuardTick(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 Watchdog::Watchdog(ComponentThread& thread, uint32_t msTimeout /*= NECommon::WATCHDOG_IGNORE*/)
     : TimerBase         (TimerBase::eTimerType::TimerTypeWatchdog, thread.getName(), msTimeout, TimerBase::ONE_TIME)
     , mGuardId          ( _generateId() )
     , mSequence         ( 0u )
     , mComponentThread  ( thread )
+    , mGuardStarted     ( 0u )
+    , mGuardExpired     ( 0u )
 {
+    WatchdogManager::registerWatchdog(*this);
 }
 
 Watchdog::Watchdog(WorkerThread& thread, uint32_t msTimeout /*= NECommon::WATCHDOG_IGNORE*/)
@@ -40,22 +49,24 @@ Watchdog::Watchdog(WorkerThread& thread, uint32_t msTimeout /*= NECommon::WATCHD
     , mGuardId          ( _generateId() )
     , mSequence         ( 0u )
     , mComponentThread  ( thread.getBindingComponentThread() )
+    , mGuardStarted     ( 0u )
+    , mGuardExpired     ( 0u )
 {
+    WatchdogManager::registerWatchdog(*this);
 }
 
 Watchdog::~Watchdog(void)
 {
-    WatchdogManager::stopTimer(*this);
+    WatchdogManager::unregisterWatchdog(*this);
 }
 
 void Watchdog::startGuard(void)
 {
     if (mTimeoutInMs != NECommon::WATCHDOG_IGNORE)
     {
-        Lock lock(mLock);
-        ASSERT(mHandle != nullptr);
+        // Only the guarded thread changes the state, the Watchdog Manager checks it periodically.
         ++mSequence;
-        mActive = WatchdogManager::startTimer(*this);
+        mGuardStarted.store(Watchdog::getGuardTick(), std::memory_order_release);
     }
 }
 
@@ -63,9 +74,6 @@ void Watchdog::stopGuard( void )
 {
     if (mTimeoutInMs != NECommon::WATCHDOG_IGNORE)
     {
-        Lock lock(mLock);
-        ASSERT(mHandle != nullptr);
-        mActive = false;
-        WatchdogManager::stopTimer(*this);
+        mGuardStarted.store(0u, std::memory_order_release);
     }
 }
@@ -20,6 +20,8 @@
   ************************************************************************/
 #include "areg/component/TimerBase.hpp"
 
+#include <atomic>
+
  /************************************************************************
   * Dependencies.
   ************************************************************************/
@@ -29,9 +31,11 @@ class WorkerThread;
 /**
  * \brief   Watchdog is a guarding object to track thread execution.
  *          It is instantiated in threads and triggered each time the thread
- *          starts to process an event. If the watchdog timeout expired before
- *          the thread could process an event, it riggers procedure to
- *          terminate the component thread and restarts again.
+ *          starts to process an event. The guarded thread only stores the
+ *          time when it starts and stops processing the event, and the
+ *          Watchdog Manager thread periodically checks the guards. If the
+ *          watchdog timeout expired before the thread could process an event,
+ *          it triggers procedure to terminate the component thread and restarts again.
  *          There is no guarantee that terminated thread will make all memory
  *          and stack cleanups. The terminated thread cleans up all components
  *          and proxies registered in the thread, all worker threads and then
@@ -43,6 +47,8 @@ class WorkerThread;
  **/
 class AREG_API Watchdog  : public TimerBase
 {
+    friend class WatchdogManager;
+
 //////////////////////////////////////////////////////////////////////////
 // Object specific types and constants
 //////////////////////////////////////////////////////////////////////////
@@ -118,6 +124,17 @@ public:
      **/
     void stopGuard(void);
 
+    /**
+     * \brief   Returns true if the watchdog guards the thread, i.e. the thread started
+     *          and has not finished yet to process the event.
+     **/
+    inline bool isGuarding( void ) const;
+
+    /**
+     * \brief   Returns the monotonic time in milliseconds used by watchdog guards.
+     **/
+    static uint64_t getGuardTick( void );
+
     /**
      * \brief   Returns true if watchdog object is valid and can start timer.
      *          The Watchdog is valid if the timeout is not zero.
@@ -198,6 +215,16 @@ private:
      * \brief   The valid instance of the component thread to trigger restart if timeout expired.
      **/
     ComponentThread &   mComponentThread;
+    /**
+     * \brief   The monotonic time in milliseconds when the thread started to process the event.
+     *          The value is zero if the thread does not process any event.
+     **/
+    std::atomic<uint64_t>   mGuardStarted;
+    /**
+     * \brief   The start time of the guarded event, which timeout already expired.
+     *          Accessed only by Watchdog Manager thread to report the expired event once.
+     **/
+    uint64_t            mGuardExpired;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -216,6 +243,11 @@ inline bool Watchdog::isValid(void) const
     return (mHandle != nullptr);
 }
 
+inline bool Watchdog::isGuarding( void ) const
+{
+    return (mGuardStarted.load( std::memory_order_acquire ) != 0u);
+}
+
 inline Watchdog::GUARD_ID Watchdog::getId(void) const
 {
     return mGuardId;
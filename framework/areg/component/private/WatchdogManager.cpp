@@ -22,7 +22,7 @@
 
 #include "areg/logging/GELog.h"
 
-DEF_LOG_SCOPE(areg_component_private_WatchdogManager__processExpiredTimers);
+DEF_LOG_SCOPE(areg_component_private_WatchdogManager__processExpiredWatchdog);
 
 //////////////////////////////////////////////////////////////////////////
 // WatchdogManager class implementation
@@ -58,27 +58,27 @@ bool WatchdogManager::isWatchdogManagerStarted(void)
     return getInstance().isReady();
 }
 
-bool WatchdogManager::startTimer(Watchdog& watchdog)
+void WatchdogManager::registerWatchdog(Watchdog& watchdog)
 {
-    bool result = false;
-    ASSERT(watchdog.getHandle() != nullptr);
-    WatchdogManager& watchdogManager = getInstance();
-
-    if (watchdogManager.isWatchdogManagerStarted())
+    if (watchdog.getTimeout() != NECommon::WATCHDOG_IGNORE)
     {
-        watchdogManager._registerWatchdog(watchdog);
-        result = TimerManagerEvent::sendEvent( TimerManagerEventData(&watchdog)
-                                             , static_cast<IETimerManagerEventConsumer&>(watchdogManager)
-                                             , static_cast<DispatcherThread&>(watchdogManager));
+        WatchdogManager& watchdogManager = getInstance();
+        watchdogManager.mWatchdogResource.registerResourceObject(watchdog.getId(), &watchdog);
+        if (watchdogManager.isWatchdogManagerStarted())
+        {
+            TimerManagerEvent::sendEvent( TimerManagerEventData(&watchdog)
+                                        , static_cast<IETimerManagerEventConsumer&>(watchdogManager)
+                                        , static_cast<DispatcherThread&>(watchdogManager));
+        }
     }
-
-    return result;
 }
 
-void WatchdogManager::stopTimer(Watchdog& watchdog)
+void WatchdogManager::unregisterWatchdog(Watchdog& watchdog)
 {
-    getInstance()._unregisterWatchdog(watchdog);
-    WatchdogManager::_osSystemTimerStop(watchdog.getHandle());
+    if (watchdog.getTimeout() != NECommon::WATCHDOG_IGNORE)
+    {
+        getInstance().mWatchdogResource.unregisterResourceObject(watchdog.getId());
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -94,74 +94,65 @@ WatchdogManager::WatchdogManager(void)
 
 WatchdogManager::~WatchdogManager(void)
 {
-    _removeAllWatchdogs();
+    mWatchdogResource.removeAllResources();
 }
 
 //////////////////////////////////////////////////////////////////////////
 // Methods
 //////////////////////////////////////////////////////////////////////////
 
-inline void WatchdogManager::_registerWatchdog(Watchdog & watchdog)
+void WatchdogManager::processEvent(const TimerManagerEventData & /*data*/)
 {
-    mWatchdogResource.registerResourceObject(watchdog.getId(), &watchdog);
+    // Nothing to do, the guards are checked before waiting for the next event.
 }
 
-inline void WatchdogManager::_unregisterWatchdog(Watchdog& watchdog)
+unsigned int WatchdogManager::processTimers(void)
 {
-    mWatchdogResource.unregisterResourceObject(watchdog.getId());
-    WatchdogManager::_osSystemTimerStop(watchdog.getHandle());
-}
+    uint64_t now = Watchdog::getGuardTick();
+    uint64_t next = static_cast<uint64_t>(~0ull);
 
-void WatchdogManager::_removeAllWatchdogs(void)
-{
     mWatchdogResource.lock();
 
-    std::pair< Watchdog::GUARD_ID, Watchdog*> elem;
-    while (mWatchdogResource.isEmpty() == false)
+    Watchdog::GUARD_ID guardId{ 0 };
+    Watchdog* watchdog = mWatchdogResource.resourceFirstKey(guardId);
+    while (watchdog != nullptr)
     {
-        mWatchdogResource.removeResourceFirstElement(elem);
-        ASSERT(elem.second != nullptr);
-        WatchdogManager::_osSystemTimerStop(elem.second->getHandle());
+        // The idle guard may start any time, check it not later than after its timeout.
+        uint64_t timeout = watchdog->getTimeout();
+        uint64_t started = watchdog->mGuardStarted.load(std::memory_order_acquire);
+        uint64_t expires = now + timeout;
+        if (started != 0u)
+        {
+            if (started + timeout <= now)
+            {
+                if (watchdog->mGuardExpired != started)
+                {
+                    watchdog->mGuardExpired = started;
+                    _processExpiredWatchdog(*watchdog);
+                }
+            }
+            else
+            {
+                expires = started + timeout;
+            }
+        }
+
+        next = MACRO_MIN(next, expires);
+        watchdog = mWatchdogResource.resourceNextKey(guardId);
     }
 
     mWatchdogResource.unlock();
-}
 
-void WatchdogManager::processEvent(const TimerManagerEventData & data)
-{
-    Watchdog* watchdog = static_cast<Watchdog*>(data.getTimer());
-    ASSERT(watchdog != nullptr);
-    if (mWatchdogResource.existResource(watchdog->getId()))
-    {
-        WatchdogManager::_osSystemTimerStart(*watchdog);
-    }
+    return (next != static_cast<uint64_t>(~0ull) ? static_cast<unsigned int>(next - now) : NECommon::WAIT_INFINITE);
 }
 
-void WatchdogManager::_processExpiredTimer(Watchdog* watchdog, Watchdog::WATCHDOG_ID watchdogId, uint32_t /* hiBytes */, uint32_t /* loBytes */)
+void WatchdogManager::_processExpiredWatchdog(Watchdog & watchdog)
 {
-    LOG_SCOPE(areg_component_private_WatchdogManager__processExpiredTimers);
-
-    mWatchdogResource.lock();
-
-    Watchdog::SEQUENCE_ID sequence  = Watchdog::makeSequenceId(watchdogId);
-    if ((watchdog != nullptr) && (watchdog->getSequence() == sequence))
-    {
-        LOG_WARN("The watchdog [ %s ] has expired, terminating component thread [ %s ]"
-                        , watchdog->getName().getString()
-                        , watchdog->getComponentThread().getName().getString());
+    LOG_SCOPE(areg_component_private_WatchdogManager__processExpiredWatchdog);
 
-        ServiceManager::requestRecreateThread(watchdog->getComponentThread());
-    }
-
-    mWatchdogResource.unlock();
-}
-
-void WatchdogManager::readyForEvents(bool isReady)
-{
-    if (isReady == false)
-    {
-        _removeAllWatchdogs();
-    }
+    LOG_WARN("The watchdog [ %s ] has expired, terminating component thread [ %s ]"
+                    , watchdog.getName().getString()
+                    , watchdog.getComponentThread().getName().getString());
 
-    TimerManagerBase::readyForEvents(isReady);
+    ServiceManager::requestRecreateThread(watchdog.getComponentThread());
 }
@@ -24,6 +24,15 @@
 
 #include "areg/component/private/Watchdog.hpp"
 
+/**
+ * \brief   The Watchdog Manager runs a single thread, which periodically
+ *          checks the registered watchdog guards. The guarded threads only
+ *          store the time when they start and stop to process an event.
+ *          The Watchdog Manager thread wakes up either when the earliest
+ *          guarded event should expire, or after the smallest configured
+ *          timeout, and requests to restart the component thread if the
+ *          event is processed longer than the watchdog timeout.
+ **/
 class WatchdogManager   : protected TimerManagerBase
 {
 //////////////////////////////////////////////////////////////////////////
@@ -89,19 +98,19 @@ public:
     static bool isWatchdogManagerStarted( void );
 
     /**
-     * \brief   Starts the watchdog timer. If succeeds, returns true.
-     *          When timer event is fired, it will be dispatched in the
-     *          thread where it was started, i.e. in the current thread.
-     * \param   watchdog    The watchdog object that should be started.
-     * \return  Returns true if timer was successfully created.
+     * \brief   Registers the watchdog to check. The watchdogs with timeout
+     *          NECommon::WATCHDOG_IGNORE are ignored and not registered.
+     *          If the Watchdog Manager is running, it is notified to
+     *          recalculate the period to check the guards.
+     * \param   watchdog    The watchdog object to register.
      **/
-    static bool startTimer(Watchdog& watchdog);
+    static void registerWatchdog(Watchdog& watchdog);
 
     /**
-     * \brief   Stops the watchdog timer. Returns true if timer successfully was stopped.
-     * \param   watchdog    The watchdog object that should be stopped.
+     * \brief   Unregisters the watchdog, so that it is not checked anymore.
+     * \param   watchdog    The watchdog object to unregister.
      **/
-    static void stopTimer(Watchdog& watchdog);
+    static void unregisterWatchdog(Watchdog& watchdog);
 
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
@@ -125,88 +134,33 @@ protected:
 /************************************************************************/
 
     /**
-     * \brief   Automatically triggered when event is dispatched by timer thread
+     * \brief   Automatically triggered when event is dispatched by timer thread.
+     *          The event is sent when new watchdog is registered to wake up
+     *          the thread and recalculate the period to check the guards.
      * \param   data    The data object passed in event.
      **/
     virtual void processEvent( const TimerManagerEventData & data) override;
 
 /************************************************************************/
-// DispatcherThread overrides
+// TimerManagerBase overrides
 /************************************************************************/
 
     /**
-     * \brief   Call to enable or disable event dispatching threads to receive events.
-     *          Override if need to make event dispatching preparation job.
-     * \param   isReady     The flag to indicate whether the dispatcher is ready for events.
+     * \brief   Checks the registered watchdog guards and requests to restart
+     *          the component threads, which guarded event is expired.
+     * \return  Returns the timeout in milliseconds to check the guards again.
      **/
-    virtual void readyForEvents( bool isReady ) override;
+    virtual unsigned int processTimers( void ) override;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden operations. Called from Watchdog Thread.
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   Called when expired timers should be processed.
+     * \brief   Called when the guarded event of the watchdog is expired.
+     *          Requests to restart the component thread of the watchdog.
      **/
-    void _processExpiredTimer(Watchdog* watchdog, Watchdog::WATCHDOG_ID watchdogId, uint32_t hiBytes, uint32_t loBytes);
-
-    /**
-     * \brief   Stops and removes all watchdog timers.
-     **/
-    void _removeAllWatchdogs( void );
-
-    /**
-     * \brief   Creates system timer for watchdog and registers it in the resource map.
-     * \param   watchdog       The Watchdog object that should be registered.
-     **/
-    inline void _registerWatchdog( Watchdog & watchdog);
-
-    /**
-     * \brief   Stop watchdog timer and unregister from the resource map.
-     * \param   watchdog   The instance of watchdog object to unregister.
-     **/
-    inline void _unregisterWatchdog( Watchdog & watchdog );
-
-//////////////////////////////////////////////////////////////////////////
-//  OS specific hidden methods
-//////////////////////////////////////////////////////////////////////////
-private:
-
-#ifdef _WIN32
-
-    /**
-     * \brief   Windows OS specific timer routine function. Triggered, when one of timer is expired.
-     * \param   argPtr          The pointer of argument passed to timer expired callback function
-     * \param   timerLowValue   The low value of timer expiration
-     * \param   timerHighValue  The high value of timer expiration.
-     **/
-    static void _windowsWatchdogExpiredRoutine( void * argPtr, unsigned long timerLowValue, unsigned long timerHighValue );
-
-#endif // _WIN32
-
-#ifdef _POSIX
-
-    /**
-     * \brief   POSIX timer routine function. Triggered, when one of timer is expired.
-     * \param   argSig          The value passed to thread signal when the timer was created.
-     *                          This value is passed to routine callback.
-     **/
-    static void _posixWatchdogExpiredRoutine( union sigval argSig );
-
-#endif // _POSIX
-
-    /**
-     * \brief   Starts system Watchdog and returns true if Watchdog started with success.
-     * \param   watchdog    The Watchdog  object with timer information.
-     * \return  Returns true if system Watchdog started with success.
-     **/
-    static bool _osSystemTimerStart( Watchdog & watchdog );
-
-    /**
-     * \brief   Stops previously started waitable timer.
-     * \param   handle      The waitable timer handle to destroy.
-     **/
-    static void _osSystemTimerStop(TIMERHANDLE handle);
+    void _processExpiredWatchdog(Watchdog & watchdog);
 
 //////////////////////////////////////////////////////////////////////////
 //  Member variables.
@@ -20,31 +20,79 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/component/private/posix/TimerPosix.hpp"
-#include "areg/base/private/posix/SynchLockAndWaitIX.hpp"
 #include "areg/component/Timer.hpp"
 #include "areg/base/NEUtilities.hpp"
-#include <signal.h>
+
+#include <algorithm>
 #include <time.h>
-#include <errno.h>
 
 //////////////////////////////////////////////////////////////////////////
 // POSIX specific methods
 //////////////////////////////////////////////////////////////////////////
 
-void TimerManager::_posixTimerExpiredRoutine( union sigval argSig )
+unsigned int TimerManager::processTimers( void )
 {
-    TimerManager & timerManager = TimerManager::getInstance( );
-    TimerPosix * posixTimer = reinterpret_cast<TimerPosix *>(argSig.sival_ptr);
-    ASSERT( posixTimer != nullptr );
-    Timer * timer = timerManager.mTimerResource.findResourceObject( reinterpret_cast<TIMERHANDLE>(posixTimer) );
+    uint64_t now = TimerWheelPosix::getTickCount( );
+
+    mTimerResource.lock( );
+
+    mExpiredTimers.clear( );
+    mTimerWheel.expire( now, mExpiredTimers );
 
-    if ( (timer != nullptr) && (posixTimer->isValid( )) )
+    mFiredTimers.clear( );
+    for ( TIMERHANDLE handle : mExpiredTimers )
     {
-        unsigned int highValue = static_cast<unsigned int>(posixTimer->mDueTime.tv_sec);
-        unsigned int lowValue = static_cast<unsigned int>(posixTimer->mDueTime.tv_nsec);
-        posixTimer->timerExpired( );
-        timerManager._processExpiredTimer( timer, reinterpret_cast<TIMERHANDLE>(posixTimer), highValue, lowValue );
+        // The timer could be stopped or deleted after it expired, check before accessing.
+        Timer * timer = mTimerResource.findResourceObject( handle );
+        if ( (timer != nullptr) && (timer->mDispatchThread != nullptr) )
+        {
+            mFiredTimers.push_back( timer );
+        }
     }
+
+    if ( mFiredTimers.empty( ) == false )
+    {
+        // Send the events of the same target thread one after another,
+        // so that the target dispatcher is woken up once for the batch.
+        std::stable_sort( mFiredTimers.begin( ), mFiredTimers.end( )
+                        , []( const Timer * lhs, const Timer * rhs ) -> bool
+                            {
+                                return (lhs->mDispatchThread < rhs->mDispatchThread);
+                            } );
+
+        struct timespec expiredAt { 0 };
+        ::clock_gettime( CLOCK_REALTIME, &expiredAt );
+        uint32_t highValue  = static_cast<uint32_t>(expiredAt.tv_sec);
+        uint32_t lowValue   = static_cast<uint32_t>(expiredAt.tv_nsec);
+
+        for ( Timer * timer : mFiredTimers )
+        {
+            TimerPosix * posixTimer = reinterpret_cast<TimerPosix *>(timer->getHandle( ));
+            ASSERT( posixTimer != nullptr );
+            TimerWheelPosix::sTimerEntry & entry = posixTimer->mWheelEntry;
+            if ( mTimerWheel.getState( entry ) != TimerWheelPosix::eEntryState::EntryFired )
+            {
+                continue;
+            }
+
+            if ( timer->timerIsExpired( highValue, lowValue, reinterpret_cast<ptr_type>(posixTimer) ) )
+            {
+                // Keep the period of the timer, unless it is too late to catch up.
+                uint64_t timeout = timer->getTimeout( );
+                uint64_t expires = entry.teExpires + timeout;
+                mTimerWheel.reschedule( entry, expires > now ? expires : now + timeout );
+            }
+            else
+            {
+                _unregisterTimer( *timer );
+                timer->mStarted = false;
+            }
+        }
+    }
+
+    mTimerResource.unlock( );
+
+    return mTimerWheel.nextTimeout( TimerWheelPosix::getTickCount( ) );
 }
 
 void TimerManager::_osSsystemTimerStop( TIMERHANDLE timerHandle )
@@ -52,26 +100,37 @@ void TimerManager::_osSsystemTimerStop( TIMERHANDLE timerHandle )
     TimerPosix * posixTimer = reinterpret_cast<TimerPosix *>(timerHandle);
     if ( posixTimer != nullptr )
     {
-        posixTimer->stopTimer();
+        TimerManager::getInstance( ).mTimerWheel.cancel( posixTimer->mWheelEntry );
     }
 }
 
-bool TimerManager::_osSystemTimerStart( Timer & timer )
+bool TimerManager::_osSystemTimerQueue( Timer & timer )
 {
     bool result{ false };
     TimerPosix * posixTimer   = reinterpret_cast<TimerPosix *>(timer.getHandle());
     ASSERT(posixTimer != nullptr);
 
-    struct timespec startTime;
-    ::clock_gettime( CLOCK_REALTIME, &startTime );
-    timer.timerStarting(startTime.tv_sec, startTime.tv_nsec, reinterpret_cast<ptr_type>(posixTimer));
-
-    if (posixTimer->startTimer(timer, 0, &TimerManager::_posixTimerExpiredRoutine))
+    if ( (timer.getTimeout( ) != 0) && (timer.getEventCount( ) != 0) )
     {
-        result = true;
+        struct timespec startTime;
+        ::clock_gettime( CLOCK_REALTIME, &startTime );
+        timer.timerStarting(startTime.tv_sec, startTime.tv_nsec, reinterpret_cast<ptr_type>(posixTimer));
+
+        // Notify the Timer Manager thread only if it should wake up earlier.
+        result = TimerManager::getInstance( ).mTimerWheel.schedule( posixTimer->mWheelEntry, TimerWheelPosix::getExpireTick( timer.getTimeout( ) ) );
     }
 
     return result;
 }
 
+bool TimerManager::_osSystemTimerStart( Timer & timer )
+{
+    TimerPosix * posixTimer   = reinterpret_cast<TimerPosix *>(timer.getHandle());
+    ASSERT(posixTimer != nullptr);
+
+    // The timer is already queued in the timing wheel, the Timer Manager
+    // thread only recalculates the timeout to wait for the next timer.
+    return (TimerManager::getInstance( ).mTimerWheel.getState( posixTimer->mWheelEntry ) == TimerWheelPosix::eEntryState::EntryScheduled);
+}
+
 #endif  // defined(_POSIX) || defined(POSIX)
@@ -49,7 +49,9 @@ TimerPosix::TimerPosix( void )
     , mContextId    ( 0u        )
     , mDueTime      (           )
     , mLock         (           )
+    , mWheelEntry   (           )
 {
+    mWheelEntry.teHandle = static_cast<TIMERHANDLE>(this);
 }
 
 TimerPosix::~TimerPosix(void)
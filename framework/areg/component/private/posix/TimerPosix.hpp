@@ -23,6 +23,7 @@
 #if defined(_POSIX) || defined(POSIX)
 
 #include "areg/base/private/posix/SpinLockIX.hpp"
+#include "areg/component/private/posix/TimerWheelPosix.hpp"
 #include <sys/types.h>
 #include <time.h>
 
@@ -48,7 +49,6 @@ class TimerPosix
 // Friend class and constants
 //////////////////////////////////////////////////////////////////////////
     friend class TimerManager;
-    friend class WatchdogManager;
 
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor.
@@ -233,6 +233,12 @@ private:
      */
     mutable SpinLockIX      mLock;
 
+    /**
+     * \brief   The entry of the timer in the timing wheel of Timer Manager.
+     *          The entry is used instead of POSIX timer when the timer runs in the wheel.
+     **/
+    TimerWheelPosix::sTimerEntry    mWheelEntry;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,288 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/posix/TimerWheelPosix.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, POSIX specific hierarchical timing wheel,
+ *              which runs all timers in the Timer Manager thread.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/component/private/posix/TimerWheelPosix.hpp"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/base/NEUtilities.hpp"
+
+#include <time.h>
+
+//////////////////////////////////////////////////////////////////////////
+// TimerWheelPosix class implementation
+//////////////////////////////////////////////////////////////////////////
+
+uint64_t TimerWheelPosix::getTickCount( void )
+{
+    struct timespec ts { 0 };
+    ::clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ((static_cast<uint64_t>(ts.tv_sec) * NEUtilities::SEC_TO_MILLISECS) + static_cast<uint64_t>(ts.tv_nsec / NEUtilities::MILLISEC_TO_NS));
+}
+
+uint64_t TimerWheelPosix::getExpireTick( unsigned int msTimeout )
+{
+    struct timespec ts { 0 };
+    ::clock_gettime( CLOCK_MONOTONIC, &ts );
+    uint64_t now = (static_cast<uint64_t>(ts.tv_sec) * NEUtilities::SEC_TO_MILLISECS) +
+                   static_cast<uint64_t>((ts.tv_nsec + NEUtilities::MILLISEC_TO_NS - 1) / NEUtilities::MILLISEC_TO_NS);
+    return (now + msTimeout);
+}
+
+inline uint32_t TimerWheelPosix::_levelShift( uint32_t level )
+{
+    return (ROOT_BITS + level * LEVEL_BITS);
+}
+
+TimerWheelPosix::TimerWheelPosix( void )
+    : mRoot     { nullptr }
+    , mLevels   { { nullptr } }
+    , mCurrent  ( TimerWheelPosix::getTickCount( ) )
+    , mWakeup   ( static_cast<uint64_t>(~0ull) )
+    , mCount    ( 0u )
+    , mLock     ( )
+{
+}
+
+bool TimerWheelPosix::schedule( sTimerEntry & entry, uint64_t expires )
+{
+    Lock lock( mLock );
+
+    if ( entry.teState == eEntryState::EntryScheduled )
+    {
+        _removeEntry( entry );
+        -- mCount;
+    }
+
+    if ( mCount == 0u )
+    {
+        // The wheel was idle, move it to the current time to avoid stepping through the empty slots.
+        mCurrent = MACRO_MAX( mCurrent, TimerWheelPosix::getTickCount( ) );
+    }
+
+    entry.teExpires = expires;
+    entry.teState   = eEntryState::EntryScheduled;
+    _addEntry( entry );
+    ++ mCount;
+
+    bool result{ expires < mWakeup };
+    mWakeup = MACRO_MIN( mWakeup, expires );
+    return result;
+}
+
+bool TimerWheelPosix::reschedule( sTimerEntry & entry, uint64_t expires )
+{
+    Lock lock( mLock );
+
+    bool result{ false };
+    if ( entry.teState == eEntryState::EntryFired )
+    {
+        if ( mCount == 0u )
+        {
+            mCurrent = MACRO_MAX( mCurrent, TimerWheelPosix::getTickCount( ) );
+        }
+
+        entry.teExpires = expires;
+        entry.teState   = eEntryState::EntryScheduled;
+        _addEntry( entry );
+        ++ mCount;
+        result = true;
+    }
+
+    return result;
+}
+
+void TimerWheelPosix::cancel( sTimerEntry & entry )
+{
+    Lock lock( mLock );
+
+    if ( entry.teState == eEntryState::EntryScheduled )
+    {
+        _removeEntry( entry );
+        -- mCount;
+    }
+
+    entry.teState = eEntryState::EntryIdle;
+}
+
+TimerWheelPosix::eEntryState TimerWheelPosix::getState( const sTimerEntry & entry ) const
+{
+    Lock lock( mLock );
+    return entry.teState;
+}
+
+void TimerWheelPosix::expire( uint64_t now, ExpiredList & OUT expired )
+{
+    Lock lock( mLock );
+
+    while ( (mCount != 0u) && (mCurrent <= now) )
+    {
+        uint32_t index = static_cast<uint32_t>(mCurrent & ROOT_MASK);
+        if ( index == 0u )
+        {
+            // The first level wraps, cascade the higher levels until the slot index is not zero.
+            for ( uint32_t level = 0u; (level < LEVEL_COUNT) && (_cascade( level ) == 0u); ++ level )
+                ;
+        }
+
+        sTimerEntry * entry = mRoot[index];
+        mRoot[index] = nullptr;
+        while ( entry != nullptr )
+        {
+            sTimerEntry * next = entry->teNext;
+            entry->teNext   = nullptr;
+            entry->tePrev   = nullptr;
+            entry->teSlot   = nullptr;
+            entry->teState  = eEntryState::EntryFired;
+            expired.push_back( entry->teHandle );
+            -- mCount;
+
+            entry = next;
+        }
+
+        ++ mCurrent;
+    }
+
+    if ( mCount == 0u )
+    {
+        mCurrent = MACRO_MAX( mCurrent, now + 1u );
+    }
+}
+
+unsigned int TimerWheelPosix::nextTimeout( uint64_t now )
+{
+    Lock lock( mLock );
+
+    if ( mCount == 0u )
+    {
+        mWakeup = static_cast<uint64_t>(~0ull);
+        return NECommon::WAIT_INFINITE;
+    }
+
+    uint64_t next{ static_cast<uint64_t>(~0ull) };
+    for ( uint32_t i = 0u; i < ROOT_SIZE; ++ i )
+    {
+        if ( mRoot[(mCurrent + i) & ROOT_MASK] != nullptr )
+        {
+            next = mCurrent + i;
+            break;
+        }
+    }
+
+    // The entries of higher levels are moved to the first level when the slot is cascaded.
+    for ( uint32_t level = 0u; level < LEVEL_COUNT; ++ level )
+    {
+        uint32_t shift  = _levelShift( level );
+        uint64_t gran   = 1ull << shift;
+        uint64_t first  = (mCurrent + gran - 1u) & ~(gran - 1u);
+        uint64_t base   = (first >> shift) & LEVEL_MASK;
+        for ( uint64_t i = 0u; i < LEVEL_SIZE; ++ i )
+        {
+            if ( mLevels[level][(base + i) & LEVEL_MASK] != nullptr )
+            {
+                next = MACRO_MIN( next, first + i * gran );
+                break;
+            }
+        }
+    }
+
+    mWakeup = next;
+    uint64_t timeout = next > now ? next - now : 0u;
+    return static_cast<unsigned int>(MACRO_MIN( timeout, static_cast<uint64_t>(NECommon::WAIT_INFINITE - 1u) ));
+}
+
+void TimerWheelPosix::_addEntry( sTimerEntry & entry )
+{
+    sTimerEntry ** slot{ nullptr };
+    uint64_t expires = entry.teExpires;
+
+    if ( expires < mCurrent )
+    {
+        // Already expired, fire on next tick.
+        slot = &mRoot[mCurrent & ROOT_MASK];
+    }
+    else if ( (expires - mCurrent) < ROOT_SIZE )
+    {
+        slot = &mRoot[expires & ROOT_MASK];
+    }
+    else
+    {
+        uint64_t delta = MACRO_MIN( expires - mCurrent, MAX_TIMEOUT );
+        expires = mCurrent + delta;
+
+        uint32_t level = 0u;
+        while ( (level < LEVEL_COUNT - 1u) && (delta >= (1ull << (_levelShift( level ) + LEVEL_BITS))) )
+        {
+            ++ level;
+        }
+
+        slot = &mLevels[level][(expires >> _levelShift( level )) & LEVEL_MASK];
+    }
+
+    entry.teSlot    = slot;
+    entry.tePrev    = nullptr;
+    entry.teNext    = *slot;
+    if ( *slot != nullptr )
+    {
+        (*slot)->tePrev = &entry;
+    }
+
+    *slot = &entry;
+}
+
+inline void TimerWheelPosix::_removeEntry( sTimerEntry & entry )
+{
+    ASSERT( entry.teSlot != nullptr );
+
+    if ( entry.tePrev != nullptr )
+    {
+        entry.tePrev->teNext = entry.teNext;
+    }
+    else
+    {
+        *entry.teSlot = entry.teNext;
+    }
+
+    if ( entry.teNext != nullptr )
+    {
+        entry.teNext->tePrev = entry.tePrev;
+    }
+
+    entry.teNext = nullptr;
+    entry.tePrev = nullptr;
+    entry.teSlot = nullptr;
+}
+
+uint32_t TimerWheelPosix::_cascade( uint32_t level )
+{
+    uint32_t index = static_cast<uint32_t>((mCurrent >> _levelShift( level )) & LEVEL_MASK);
+    sTimerEntry * entry = mLevels[level][index];
+    mLevels[level][index] = nullptr;
+
+    while ( entry != nullptr )
+    {
+        sTimerEntry * next = entry->teNext;
+        _addEntry( *entry );
+        entry = next;
+    }
+
+    return index;
+}
+
+#endif  // defined(_POSIX) || defined(POSIX)
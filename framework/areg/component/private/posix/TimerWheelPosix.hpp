@@ -0,0 +1,261 @@
+#ifndef AREG_COMPONENT_PRIVATE_POSIX_TIMERWHEELPOSIX_HPP
+#define AREG_COMPONENT_PRIVATE_POSIX_TIMERWHEELPOSIX_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/component/private/posix/TimerWheelPosix.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, POSIX specific hierarchical timing wheel,
+ *              which runs all timers in the Timer Manager thread.
+ *
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#if defined(_POSIX) || defined(POSIX)
+
+#include "areg/base/SynchObjects.hpp"
+
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// TimerWheelPosix class declaration.
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The hierarchical timing wheel with the resolution of 1 millisecond.
+ *          The first level has 256 slots of 1 millisecond, each next of 4 levels
+ *          has 64 slots, where each slot covers the complete range of previous
+ *          level. The timers of higher levels are cascaded to the lower level
+ *          when the lower level wraps. Scheduling, canceling and expiring a timer
+ *          cost O(1), independent of the number of running timers.
+ *          The timing wheel uses monotonic clock, so that the timers do not
+ *          jump when the system wall-clock time is changed.
+ **/
+class TimerWheelPosix
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants.
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   TimerWheelPosix::eEntryState
+     *          The state of the timer entry.
+     **/
+    enum class eEntryState : uint8_t
+    {
+          EntryIdle         //!< The entry is not scheduled.
+        , EntryScheduled    //!< The entry is scheduled in the wheel.
+        , EntryFired        //!< The entry is expired and removed from the wheel.
+    };
+
+    /**
+     * \brief   TimerWheelPosix::sTimerEntry
+     *          The entry of the timer embedded in the timer object.
+     *          The entries of the same slot are linked in the list.
+     **/
+    struct sTimerEntry
+    {
+        sTimerEntry *   teNext      { nullptr };                //!< The next entry in the slot.
+        sTimerEntry *   tePrev      { nullptr };                //!< The previous entry in the slot.
+        sTimerEntry **  teSlot      { nullptr };                //!< The head of the slot, where the entry is linked.
+        uint64_t        teExpires   { 0u };                     //!< The monotonic time in milliseconds when the entry expires.
+        eEntryState     teState     { eEntryState::EntryIdle }; //!< The state of the entry.
+        TIMERHANDLE     teHandle    { nullptr };                //!< The handle of the timer to report when expired.
+    };
+
+    /**
+     * \brief   The list of expired timer handles.
+     **/
+    using ExpiredList   = std::vector<TIMERHANDLE>;
+
+private:
+    //!< The number of bits of the first level.
+    static constexpr uint32_t   ROOT_BITS   { 8u };
+    //!< The number of bits of other levels.
+    static constexpr uint32_t   LEVEL_BITS  { 6u };
+    //!< The number of slots in the first level.
+    static constexpr uint32_t   ROOT_SIZE   { 1u << ROOT_BITS };
+    //!< The number of slots in other levels.
+    static constexpr uint32_t   LEVEL_SIZE  { 1u << LEVEL_BITS };
+    //!< The mask to get the slot index in the first level.
+    static constexpr uint64_t   ROOT_MASK   { ROOT_SIZE - 1u };
+    //!< The mask to get the slot index in other levels.
+    static constexpr uint64_t   LEVEL_MASK  { LEVEL_SIZE - 1u };
+    //!< The number of levels except the first.
+    static constexpr uint32_t   LEVEL_COUNT { 4u };
+    //!< The maximum timeout in milliseconds the wheel can hold.
+    static constexpr uint64_t   MAX_TIMEOUT { (1ull << (ROOT_BITS + LEVEL_BITS * LEVEL_COUNT)) - 1u };
+
+//////////////////////////////////////////////////////////////////////////
+// Statics.
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the monotonic time in milliseconds.
+     **/
+    static uint64_t getTickCount( void );
+
+    /**
+     * \brief   Returns the monotonic time in milliseconds when the timer
+     *          started now should expire. The fraction of current millisecond
+     *          is rounded up, so that the timer never expires earlier.
+     * \param   msTimeout   The timeout in milliseconds.
+     **/
+    static uint64_t getExpireTick( unsigned int msTimeout );
+
+//////////////////////////////////////////////////////////////////////////
+// Constructors / Destructor.
+//////////////////////////////////////////////////////////////////////////
+public:
+    TimerWheelPosix( void );
+
+    ~TimerWheelPosix( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes / Operations.
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Returns true if there is no scheduled timer entry.
+     **/
+    inline bool isEmpty( void ) const;
+
+    /**
+     * \brief   Schedules the timer entry to expire at specified monotonic time.
+     *          If the entry is already scheduled, it is rescheduled.
+     *          The entry, which expire time is already passed, expires on next call of expire().
+     * \param   entry   The timer entry to schedule.
+     * \param   expires The monotonic time in milliseconds when the entry should expire.
+     * \return  Returns true if the entry expires before the time returned by last call
+     *          of nextTimeout(), i.e. the waiting thread should be woken up.
+     **/
+    bool schedule( sTimerEntry & entry, uint64_t expires );
+
+    /**
+     * \brief   Schedules again the fired timer entry to expire at specified monotonic time.
+     *          The entry is not scheduled if it was canceled after it has been fired.
+     * \param   entry   The fired timer entry to schedule.
+     * \param   expires The monotonic time in milliseconds when the entry should expire.
+     * \return  Returns true if the entry is scheduled.
+     **/
+    bool reschedule( sTimerEntry & entry, uint64_t expires );
+
+    /**
+     * \brief   Removes the timer entry from the wheel and resets the state.
+     * \param   entry   The timer entry to cancel.
+     **/
+    void cancel( sTimerEntry & entry );
+
+    /**
+     * \brief   Returns the state of the timer entry.
+     * \param   entry   The timer entry to check.
+     **/
+    eEntryState getState( const sTimerEntry & entry ) const;
+
+    /**
+     * \brief   Removes from the wheel all entries that expire until the
+     *          given monotonic time, marks them as fired and adds the handles
+     *          to the list in the order of expiration.
+     * \param   now     The current monotonic time in milliseconds.
+     * \param   expired On output, contains the handles of expired entries.
+     **/
+    void expire( uint64_t now, ExpiredList & OUT expired );
+
+    /**
+     * \brief   Returns the timeout in milliseconds to wait for the next entry to expire
+     *          or the next cascade of the wheel. Returns NECommon::WAIT_INFINITE if
+     *          there is no scheduled entry. The wheel remembers the time to wake up
+     *          to report the entries scheduled to expire earlier.
+     * \param   now     The current monotonic time in milliseconds.
+     **/
+    unsigned int nextTimeout( uint64_t now );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Adds the entry to the slot depending on the distance of expiration.
+     **/
+    void _addEntry( sTimerEntry & entry );
+
+    /**
+     * \brief   Unlinks the entry from the slot.
+     **/
+    inline void _removeEntry( sTimerEntry & entry );
+
+    /**
+     * \brief   Moves the entries of the current slot at specified level to lower levels.
+     *          Returns the index of cascaded slot.
+     **/
+    uint32_t _cascade( uint32_t level );
+
+    /**
+     * \brief   Returns the shift of the time to get the slot index of the level.
+     **/
+    static inline uint32_t _levelShift( uint32_t level );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   The heads of the first level slots with resolution of 1 millisecond.
+     **/
+    sTimerEntry *       mRoot[ROOT_SIZE];
+
+    /**
+     * \brief   The heads of the slots of other levels.
+     **/
+    sTimerEntry *       mLevels[LEVEL_COUNT][LEVEL_SIZE];
+
+    /**
+     * \brief   The monotonic time in milliseconds of the next slot to expire.
+     **/
+    uint64_t            mCurrent;
+
+    /**
+     * \brief   The monotonic time in milliseconds when the waiting thread wakes up.
+     **/
+    uint64_t            mWakeup;
+
+    /**
+     * \brief   The number of scheduled entries.
+     **/
+    uint32_t            mCount;
+
+    /**
+     * \brief   The synchronization object.
+     **/
+    mutable CriticalSection mLock;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls.
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( TimerWheelPosix );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// TimerWheelPosix class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool TimerWheelPosix::isEmpty( void ) const
+{
+    Lock lock( mLock );
+    return (mCount == 0u);
+}
+
+#endif  // defined(_POSIX) || defined(POSIX)
+
+#endif  // AREG_COMPONENT_PRIVATE_POSIX_TIMERWHEELPOSIX_HPP
@@ -54,6 +54,12 @@ void TimerManager::_osSsystemTimerStop( TIMERHANDLE timerHandle )
     ::CancelWaitableTimer( static_cast<HANDLE>(timerHandle) );
 }
 
+bool TimerManager::_osSystemTimerQueue( Timer & /*timer*/ )
+{
+    // The waitable timer is set in the Timer Manager thread to run the APC routine there.
+    return true;
+}
+
 bool TimerManager::_osSystemTimerStart( Timer & timer )
 {
     ASSERT(timer.getHandle() != nullptr);
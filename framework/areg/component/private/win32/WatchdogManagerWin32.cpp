@@ -1,76 +0,0 @@
-/************************************************************************
- * This file is part of the AREG SDK core engine.
- * AREG SDK is dual-licensed under Free open source (Apache version 2.0
- * License) and Commercial (with various pricing models) licenses, depending
- * on the nature of the project (commercial, research, academic or free).
- * You should have received a copy of the AREG SDK license description in LICENSE.txt.
- * If not, please contact to info[at]aregtech.com
- *
- * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
- * \file        areg/component/private/WatchdogManagerWin.cpp
- * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
- * \author      Artak Avetyan
- * \brief       AREG Platform, The Thread Watchdog Manager.
- *              Controlling, triggering and stopping timer to check threads.
- *              Windows OS specific calls.
- *
- ************************************************************************/
-#include "areg/component/private/WatchdogManager.hpp"
-
-#ifdef  _WIN32
-
-#include "areg/component/private/Watchdog.hpp"
-#include "areg/base/NEUtilities.hpp"
-
-#include <Windows.h>
-
- //////////////////////////////////////////////////////////////////////////
- //  Windows OS specific methods
- //////////////////////////////////////////////////////////////////////////
-
-void WatchdogManager::_osSystemTimerStop(TIMERHANDLE handle)
-{
-
-    if (handle != nullptr)
-    {
-        ::CancelWaitableTimer(handle);
-    }
-}
-
-bool WatchdogManager::_osSystemTimerStart(Watchdog& watchdog)
-{
-    // the period of time. If should be fired several times, set the period value. Otherwise set zero to fire once.
-    long period = 0;
-    int64_t dueTime = static_cast<int64_t>(static_cast<TIME64>(watchdog.getTimeout()) * NEUtilities::MILLISEC_TO_100NS);  // timer from now
-    dueTime *= static_cast<int64_t>(-1);
-    LARGE_INTEGER timeTrigger{ };
-    timeTrigger.LowPart  = static_cast<DWORD>(MACRO_64_LO_BYTE32(dueTime));
-    timeTrigger.HighPart = static_cast<LONG >(MACRO_64_HI_BYTE32(dueTime));
-
-    return (::SetWaitableTimer(   watchdog.getHandle()
-                                , &timeTrigger
-                                , period
-                                , (PTIMERAPCROUTINE)(&WatchdogManager::_windowsWatchdogExpiredRoutine)
-                                , reinterpret_cast<void*>(watchdog.makeWatchdogId(watchdog.getId(), watchdog.getSequence())), FALSE) == TRUE);
-}
-
-/**
- * \brief   Windows OS timer routine function. Triggered, when one of timer is expired.
- * \param   argPtr      The pointer of argument passed to timer expired callback function
- * \param   lowValue    The low value of timer expiration
- * \param   highValue   The high value of timer expiration.
- **/
-void WatchdogManager::_windowsWatchdogExpiredRoutine(void* argPtr, unsigned long lowValue, unsigned long highValue)
-{
-    ASSERT(argPtr != nullptr);
-    WatchdogManager& watchdogManager = WatchdogManager::getInstance();
-    Watchdog::WATCHDOG_ID watchdogId = reinterpret_cast<Watchdog::WATCHDOG_ID>(argPtr);
-    Watchdog::GUARD_ID guardId = Watchdog::makeGuardId(watchdogId);
-    Watchdog* watchdog = watchdogManager.mWatchdogResource.findResourceObject(guardId);
-    if (watchdog != nullptr)
-    {
-        watchdogManager._processExpiredTimer(watchdog, watchdogId, highValue, lowValue);
-    }
-}
-
-#endif // _WIN32
@@ -23,6 +23,8 @@
 
 #include "areg/base/SocketClient.hpp"
 
+#include <atomic>
+
 //////////////////////////////////////////////////////////////////////////
 // ClientConnection class declaration
 //////////////////////////////////////////////////////////////////////////
@@ -126,6 +128,29 @@ public:
      **/
     Socket & getSocket( void );
 
+    /**
+     * \brief   Sets the flag, indicating whether the checksum of received messages is verified.
+     *          If false, the remote host is notified not to calculate the checksum of sent messages.
+     **/
+    inline void setVerifyChecksum( bool verify );
+
+    /**
+     * \brief   Returns true if the checksum of received messages is verified.
+     **/
+    inline bool isVerifyChecksum( void ) const;
+
+    /**
+     * \brief   Sets the flag, indicating whether the checksum of sent messages is calculated.
+     *          Set false only if the remote host does not verify the checksum.
+     *          The flag is reset when the socket is closed.
+     **/
+    inline void setCalculateChecksum( bool calculate );
+
+    /**
+     * \brief   Returns true if the checksum of sent messages is calculated.
+     **/
+    inline bool isCalculateChecksum( void ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -176,6 +201,22 @@ public:
      **/
     int sendMessage( const RemoteMessage & in_message ) const;
 
+    /**
+     * \brief   If socket is valid, sends the list of messages using existing socket connection
+     *          by as few system calls as possible and returns total length in bytes of sent data.
+     *          The invalid messages are skipped. Returns negative number if either socket is invalid,
+     *          or failed to send data to remote host.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   messages    The list of messages to send.
+     * \param   count       The number of messages in the list.
+     * \param   out_sent    If not nullptr, on output contains the number of messages from the
+     *                      beginning of the list, which are completely sent.
+     * \return  Returns total length in bytes of messages sent to remote host.
+     *          Returns negative number if socket is not valid of failed to send.
+     **/
+    inline int sendMessages( const RemoteMessage * messages, uint32_t count, uint32_t * out_sent = nullptr ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -193,6 +234,19 @@ public:
      **/
     int receiveMessage( RemoteMessage & out_message ) const;
 
+    /**
+     * \brief   Extracts the next message from the receive buffer of the connection. If the buffer
+     *          does not contain the complete message, receives available data from the socket until
+     *          the message is complete. The extracted message refers to the received data without copying.
+     * \param   out_message The instance of Remote Buffer to receive data. If checksum is invalid,
+     *                      the data will invalidated and dropped.
+     * \param   recvBuffer  The receive buffer of the connection.
+     * \return  Returns length in bytes of data in Remote Buffer received from remote host.
+     *          Returns negative number if socket is not valid, the connection is closed or failed to receive.
+     *          Returns zero, if checksum in Remote Buffer was not validated.
+     **/
+    inline int receiveMessage( RemoteMessage & out_message, MessageReceiveBuffer & recvBuffer ) const;
+
     /**
      * \brief   Sets socket in read-only more, i.e. no send message is possible anymore.
      * \return  Returns true if operation succeeds.
@@ -219,6 +273,24 @@ private:
      **/
     ITEM_ID         mCookie;
 
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The flag, indicating whether the checksum of received messages is verified.
+     **/
+    std::atomic_bool    mVerifyChecksum;
+
+    /**
+     * \brief   The flag, indicating whether the checksum of sent messages is calculated.
+     **/
+    std::atomic_bool    mCalculateChecksum;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -275,14 +347,44 @@ inline Socket & ClientConnection::getSocket( void )
     return mClientSocket;
 }
 
+inline void ClientConnection::setVerifyChecksum( bool verify )
+{
+    mVerifyChecksum.store( verify, std::memory_order_relaxed );
+}
+
+inline bool ClientConnection::isVerifyChecksum( void ) const
+{
+    return mVerifyChecksum.load( std::memory_order_relaxed );
+}
+
+inline void ClientConnection::setCalculateChecksum( bool calculate )
+{
+    mCalculateChecksum.store( calculate, std::memory_order_relaxed );
+}
+
+inline bool ClientConnection::isCalculateChecksum( void ) const
+{
+    return mCalculateChecksum.load( std::memory_order_relaxed );
+}
+
 inline int ClientConnection::sendMessage(const RemoteMessage & in_message) const
 {
-    return SocketConnectionBase::sendMessage(in_message, mClientSocket);
+    return SocketConnectionBase::sendMessage(in_message, mClientSocket, isCalculateChecksum());
+}
+
+inline int ClientConnection::receiveMessage(RemoteMessage & out_message, MessageReceiveBuffer & recvBuffer) const
+{
+    return SocketConnectionBase::receiveMessage(out_message, mClientSocket, recvBuffer, isVerifyChecksum());
+}
+
+inline int ClientConnection::sendMessages(const RemoteMessage * messages, uint32_t count, uint32_t * out_sent /*= nullptr*/) const
+{
+    return SocketConnectionBase::sendMessages(messages, count, mClientSocket, isCalculateChecksum(), out_sent);
 }
 
 inline int ClientConnection::receiveMessage(RemoteMessage & out_message) const
 {
-    return SocketConnectionBase::receiveMessage(out_message, mClientSocket);
+    return SocketConnectionBase::receiveMessage(out_message, mClientSocket, isVerifyChecksum());
 }
 
 #endif  // AREG_IPC_CLIENTCONNECTION_HPP
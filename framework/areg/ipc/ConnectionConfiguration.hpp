@@ -107,6 +107,27 @@ public:
      **/
     void setConnectionAddress(const String& address);
 
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the remote service.
+     **/
+    uint32_t getServiceWorkers( void ) const;
+
+    /**
+     * \brief   Returns true if the remote service verifies the checksum of received messages.
+     **/
+    bool getServiceChecksum( void ) const;
+
+    /**
+     * \brief   Returns the maximum number of messages of the remote service sent by one system call.
+     **/
+    uint32_t getServiceBatch( void ) const;
+
+    /**
+     * \brief   Returns the timeout in milliseconds to wait for more messages of the remote service
+     *          to send by one system call.
+     **/
+    uint32_t getServiceLinger( void ) const;
+
     /**
      * \brief   Sets the connection address and port number of the remote service and type.
      * \param   address     The connection address.
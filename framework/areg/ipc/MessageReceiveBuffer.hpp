@@ -0,0 +1,186 @@
+#ifndef AREG_IPC_MESSAGERECEIVEBUFFER_HPP
+#define AREG_IPC_MESSAGERECEIVEBUFFER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/MessageReceiveBuffer.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the buffer of connection to receive remote messages.
+ ************************************************************************/
+
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#include <memory>
+
+/************************************************************************
+ * Dependencies
+ ************************************************************************/
+class RemoteMessage;
+class Socket;
+
+//////////////////////////////////////////////////////////////////////////
+// MessageReceiveBuffer class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The receive buffer of a single connection. It receives from the socket
+ *          as much data as available and fits into the buffer, and slices
+ *          the complete messages out of it. So that many small messages are received
+ *          by one system call. The extracted messages refer to the data in the buffer
+ *          without copying, and the block of the buffer is reused only when no
+ *          extracted message refers to it anymore. Otherwise, the not extracted data
+ *          is moved to the new block.
+ *          The object is not thread safe and should be used in one receiving thread.
+ **/
+class AREG_API MessageReceiveBuffer
+{
+//////////////////////////////////////////////////////////////////////////
+// Constants.
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   MessageReceiveBuffer::DEFAULT_CAPACITY
+     *          The default size in bytes of the block to receive data.
+     **/
+    static constexpr unsigned int   DEFAULT_CAPACITY    { 64 * 1024 };
+
+    /**
+     * \brief   MessageReceiveBuffer::MAX_MESSAGE_LENGTH
+     *          The maximum length in bytes of the data of the message, the same as byte buffer has.
+     **/
+    static constexpr unsigned int   MAX_MESSAGE_LENGTH  { 0x04000000u };
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the buffer. The block is allocated on first receive.
+     * \param   capacity    The size in bytes of the block to receive data.
+     *                      The messages bigger than the capacity are received
+     *                      in the block of message size.
+     **/
+    explicit MessageReceiveBuffer( unsigned int capacity = MessageReceiveBuffer::DEFAULT_CAPACITY );
+
+    /**
+     * \brief   Destructor.
+     **/
+    ~MessageReceiveBuffer( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Attributes and operations.
+//////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Returns the size in bytes of received data, which is not extracted yet.
+     **/
+    inline unsigned int getPendingSize( void ) const;
+
+    /**
+     * \brief   Returns true if the buffer contains at least one complete message to extract.
+     **/
+    bool hasMessage( void ) const;
+
+    /**
+     * \brief   Receives the data available in the socket by single call.
+     *          The call is blocking until any data is available.
+     * \param   socket  The valid socket to receive data.
+     * \return  Returns the number of received bytes. Returns zero if the remote
+     *          target closed connection and negative number if failed to receive.
+     **/
+    int receiveData( const Socket & socket );
+
+    /**
+     * \brief   Extracts the next complete message from the buffer.
+     * \param   out_message On output contains the extracted message, if succeeded.
+     * \return  Returns the length in bytes of the extracted message.
+     *          Returns zero if the buffer does not contain complete message.
+     *          Returns negative number if the received data is not a valid message.
+     **/
+    int extractMessage( RemoteMessage & OUT out_message );
+
+    /**
+     * \brief   Drops the received data, which is not extracted.
+     *          Should be called when the connection is closed or restarted.
+     **/
+    void clear( void );
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns the length in bytes of the next message in the buffer.
+     *          Returns zero if the header of the message is not received yet,
+     *          and negative number if the header is not valid.
+     **/
+    int _nextMessageLength( void ) const;
+
+    /**
+     * \brief   Makes sure that the block has free space to receive data and
+     *          has space for the complete message of specified length.
+     * \param   required    The length in bytes of the message to receive.
+     **/
+    void _prepareSpace( unsigned int required );
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables.
+//////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+    /**
+     * \brief   The block of memory to receive data. It is shared with the extracted messages.
+     **/
+    std::shared_ptr<unsigned char>  mBlock;
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    /**
+     * \brief   The default size in bytes of the block.
+     **/
+    const unsigned int  mCapacity;
+
+    /**
+     * \brief   The size in bytes of current block.
+     **/
+    unsigned int        mBlockSize;
+
+    /**
+     * \brief   The position in the block of the first not extracted byte.
+     **/
+    unsigned int        mReadPos;
+
+    /**
+     * \brief   The position in the block to write next received data.
+     **/
+    unsigned int        mWritePos;
+
+//////////////////////////////////////////////////////////////////////////
+// Forbidden calls
+//////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( MessageReceiveBuffer );
+};
+
+//////////////////////////////////////////////////////////////////////////
+// MessageReceiveBuffer class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline unsigned int MessageReceiveBuffer::getPendingSize( void ) const
+{
+    return (mWritePos - mReadPos);
+}
+
+#endif  // AREG_IPC_MESSAGERECEIVEBUFFER_HPP
@@ -243,6 +243,17 @@ namespace NERemoteService
      **/
     AREG_API RemoteMessage createServiceClientUnregisteredNotification( const ProxyAddress & proxy, NEService::eDisconnectReason reason, const ITEM_ID & source, const ITEM_ID & target);
 
+    /**
+     * \brief   NERemoteService::readAddressHandle
+     *          Reads the handle of the stub or proxy address in the registration request or
+     *          notification message. The handle follows the address and the reason.
+     * \param   msgRegister The registration message to read. The read position of the message
+     *                      should be set after the reason.
+     * \return  Returns the handle of the address or NEService::INVALID_HANDLE if the message
+     *          does not contain the handle, i.e. it is created by the version not supporting handles.
+     **/
+    AREG_API uint32_t readAddressHandle( const RemoteMessage & msgRegister );
+
     /**
      * \brief   NERemoteService::isMessageHelloServer
      *          Checks whether specified message is a connect request.
@@ -21,6 +21,7 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/TEEvent.hpp"
 #include "areg/base/RemoteMessage.hpp"
+#include "areg/component/NEService.hpp"
 
 #include <utility>
 
@@ -64,6 +65,15 @@ public:
      **/
     inline explicit SendMessageEventData( const RemoteMessage & remoteMessage );
 
+    /**
+     * \brief   Sets the remote message buffer with the instruction to forward message
+     *          to the specified target. It is used to send the same message buffer
+     *          to several targets, for example, when forwarding multicast message.
+     * \param   remoteMessage   The remote message object to initialize.
+     * \param   target          The cookie of the target to send the message.
+     **/
+    inline SendMessageEventData( const RemoteMessage & remoteMessage, const ITEM_ID & target );
+
     /**
      * \brief   Copies remote message data from given source.
      * \param   source  The source, which contains remote message.
@@ -102,6 +112,12 @@ public:
      **/
     inline const RemoteMessage & getRemoteMessage( void ) const;
 
+    /**
+     * \brief   Returns the cookie of the target to send the message.
+     *          By default, it is the target of the remote message.
+     **/
+    inline const ITEM_ID & getTarget( void ) const;
+
     /**
      * \brief   Returns the command instruction to handle messages.
      **/
@@ -126,6 +142,11 @@ private:
      **/
     RemoteMessage   mRemoteMessage;
 
+    /**
+     * \brief   The cookie of the target to send the message.
+     **/
+    ITEM_ID         mTarget;
+
     /**
      * \brief   The action to perform on the message.
      **/
@@ -144,24 +165,35 @@ DECLARE_EVENT(SendMessageEventData, SendMessageEvent, IESendMessageEventConsumer
 
 inline SendMessageEventData::SendMessageEventData(const RemoteMessage& remoteMessage)
     : mRemoteMessage    (remoteMessage)
+    , mTarget           ( remoteMessage.getTarget() )
+    , mCmdSendMessage   ( SendMessageEventData::eSendMessage::MessageForward )
+{
+}
+
+inline SendMessageEventData::SendMessageEventData(const RemoteMessage& remoteMessage, const ITEM_ID & target)
+    : mRemoteMessage    (remoteMessage)
+    , mTarget           ( target )
     , mCmdSendMessage   ( SendMessageEventData::eSendMessage::MessageForward )
 {
 }
 
 inline SendMessageEventData::SendMessageEventData(void)
     : mRemoteMessage    ( )
+    , mTarget           ( NEService::TARGET_UNKNOWN )
     , mCmdSendMessage   ( SendMessageEventData::eSendMessage::ExitThread )
 {
 }
 
 inline SendMessageEventData::SendMessageEventData( const SendMessageEventData & source )
     : mRemoteMessage    ( source.mRemoteMessage )
+    , mTarget           ( source.mTarget )
     , mCmdSendMessage   ( source.mCmdSendMessage )
 {
 }
 
 inline SendMessageEventData::SendMessageEventData(SendMessageEventData&& source) noexcept
     : mRemoteMessage    ( std::move(source.mRemoteMessage) )
+    , mTarget           ( source.mTarget )
     , mCmdSendMessage   ( source.mCmdSendMessage )
 {
 }
@@ -169,6 +201,7 @@ inline SendMessageEventData::SendMessageEventData(SendMessageEventData&& source)
 inline SendMessageEventData& SendMessageEventData::operator = (const SendMessageEventData& source)
 {
     mRemoteMessage  = source.mRemoteMessage;
+    mTarget         = source.mTarget;
     mCmdSendMessage = source.mCmdSendMessage;
     return (*this);
 }
@@ -176,6 +209,7 @@ inline SendMessageEventData& SendMessageEventData::operator = (const SendMessage
 inline SendMessageEventData& SendMessageEventData::operator = (SendMessageEventData&& source) noexcept
 {
     mRemoteMessage  = std::move(source.mRemoteMessage);
+    mTarget         = source.mTarget;
     mCmdSendMessage = source.mCmdSendMessage;
     return (*this);
 }
@@ -185,6 +219,11 @@ inline const RemoteMessage & SendMessageEventData::getRemoteMessage( void ) cons
     return mRemoteMessage;
 }
 
+inline const ITEM_ID & SendMessageEventData::getTarget( void ) const
+{
+    return mTarget;
+}
+
 inline SendMessageEventData::eSendMessage SendMessageEventData::getCommand( void ) const
 {
     return mCmdSendMessage;
@@ -24,8 +24,12 @@
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/SocketServer.hpp"
 #include "areg/base/SocketAccepted.hpp"
+#include "areg/base/SocketPoller.hpp"
 #include "areg/component/NEService.hpp"
 
+#include <memory>
+#include <vector>
+
 //////////////////////////////////////////////////////////////////////////
 // ServerConnectionBase class declaration.
 //////////////////////////////////////////////////////////////////////////
@@ -65,14 +69,47 @@ protected:
     using MapSocketToCookie		= TEMap<SOCKETHANDLE, ITEM_ID>;
 
     /**
-     * \brief   The list of accepted sockets.
+     * \brief   The list of new accepted sockets and their addresses, which are not reported yet.
+     **/
+    using ListAcceptedSockets   = TELinkedList<std::pair<SOCKETHANDLE, NESocket::SocketAddress>>;
+
+    /**
+     * \brief   The container of sockets, which have data to read, where the values
+     *          are flags indicating that the connection is closed by remote side.
+     **/
+    using MapSocketEvents       = TEHashMap<SOCKETHANDLE, bool>;
+
+    /**
+     * \brief   The list of sockets, which have data to read, in the order to process.
+     **/
+    using ListSocketEvents      = TELinkedList<SOCKETHANDLE>;
+
+    /**
+     * \brief   ServerConnectionBase::sConnectionShard
+     *          The part of accepted connections, which events are waited and processed
+     *          by one thread. Each accepted connection belongs to one shard.
+     **/
+    struct sConnectionShard
+    {
+        //!< The poller to wait for events of the sockets of the shard.
+        SocketPoller        csPoller;
+        //!< The sockets with data to read, which are not returned yet by waitForConnectionEvent().
+        MapSocketEvents     csSocketEvents;
+        //!< The order of sockets to return by waitForConnectionEvent().
+        ListSocketEvents    csEventOrder;
+    };
+
+    /**
+     * \brief   The list of connection shards.
      **/
-    using ListSockets			= TEArrayList<SOCKETHANDLE>;
+    using ListConnectionShards  = std::vector<std::unique_ptr<sConnectionShard>>;
 
+public:
     /**
-     * \brief   The size of master list to listen sockets for incoming messages.
+     * \brief   ServerConnectionBase::MAX_CONNECTION_SHARDS
+     *          The maximum number of shards of accepted connections.
      **/
-    static constexpr int    MASTER_LIST_SIZE    { 64 };
+    static constexpr uint32_t   MAX_CONNECTION_SHARDS   { 64 };
 
 //////////////////////////////////////////////////////////////////////////
 // Constructors / Destructor
@@ -195,6 +232,29 @@ public:
      **/
     inline SocketAccepted getClientByHandle( SOCKETHANDLE clientSocket ) const;
 
+    /**
+     * \brief   Returns the number of shards of accepted connections.
+     **/
+    inline uint32_t getShardCount( void ) const;
+
+    /**
+     * \brief   Sets the number of shards of accepted connections. Each shard has own
+     *          poller and the events of its connections should be waited by one thread.
+     *          The connections are distributed between shards by cookie. The first shard
+     *          waits as well for new connections. Can be set only if the server socket is
+     *          not created yet.
+     * \param   count   The number of shards, from 1 to MAX_CONNECTION_SHARDS.
+     * \return  Returns true if succeeded to set the number of shards.
+     **/
+    bool setShardCount( uint32_t count );
+
+    /**
+     * \brief   Returns the index of shard of the accepted connection.
+     *          Returns the number of shards if the connection is not accepted.
+     * \param   hSocket     The socket handle of accepted connection.
+     **/
+    uint32_t getConnectionShard( SOCKETHANDLE hSocket ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Operations
 //////////////////////////////////////////////////////////////////////////
@@ -236,21 +296,36 @@ public:
     /**
      * \brief   Call to wait for connection event. Function is blocking call until connection
      *          event is not triggered. Once connection event happens, the function returns
-     *          valid socket handle of connected event. On output out_addrNewAccepted parameter
-     *          changes only if new client connection is accepted. In all other cases, when
-     *          client send data or closes socket, this parameter will not be changed, and
-     *          the method does not distinguish whether client socket is closed or send data.
-     *          The connection event is fired when new client is connected, when client
-     *          is sending data or client closes connection.
+     *          valid socket handle of connected event. The connection event is fired when
+     *          new client is connected, when client is sending data or client closes connection.
+     *          The new connections are accepted without blocking, and the events of connections
+     *          are returned in the order they are received, each socket only once until it is
+     *          returned. The event of the socket is fired only when new data arrives. So that the
+     *          caller should read all available data of the socket, or call continueConnectionEvent()
+     *          to be returned again after the events of other connections.
      * \param   out_addrNewAccepted On output, if new connection is accepted, this parameter
      *                              contain address of new accepted socket. In all other cases,
      *                              when client sends data or close socket, this parameter
      *                              remains unchanged.
+     * \param   out_isClosed        On output, indicates whether the remote side closed the connection
+     *                              of accepted socket. The data, which is still in the socket, can be read.
+     * \param   shard               The index of shard of connections to wait for events. The new
+     *                              connections are accepted and returned only by the first shard.
      * \return  If function succeeds, the function returns valid socket handle. For new connections,
      *          out_addrNewAccepted parameter contains address of accepted socket.
-     *          If function fails, returns invalid socket handle.
+     *          Returns NESocket::FailedSocketHandle if failed to wait for events, and
+     *          invalid socket handle if waiting was interrupted.
      **/
-    SOCKETHANDLE waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted);
+    SOCKETHANDLE waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted, bool & out_isClosed, uint32_t shard = 0);
+
+    /**
+     * \brief   Queues the accepted connection to be returned again by waitForConnectionEvent()
+     *          after the events of other connections. Called when the connection still has
+     *          data to read, but the caller stopped reading to let other connections to be processed.
+     * \param   hSocket     The accepted socket, which still has data to read.
+     * \param   isClosed    Flag, indicating whether the connection was closed by remote side.
+     **/
+    void continueConnectionEvent(SOCKETHANDLE hSocket, bool isClosed);
 
     /**
      * \brief   Call to accept connection. Nothing will happen if connection was already accepted.
@@ -296,6 +371,12 @@ public:
      **/
     inline void disableReceive( void );
 
+protected:
+    /**
+     * \brief   Removes new accepted sockets and queued events of connections, which are not returned yet.
+     **/
+    void releaseConnectionEvents( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -325,9 +406,14 @@ protected:
      **/
     MapSocketToCookie   mSocketToCookie;
     /**
-     * \brief   The list of accepted sockets.
+     * \brief   The new accepted sockets, which are not returned yet by waitForConnectionEvent().
      **/
-    ListSockets         mMasterList;
+    ListAcceptedSockets mAcceptedSockets;
+
+    /**
+     * \brief   The shards of accepted connections. The poller of first shard waits as well for new connections.
+     **/
+    ListConnectionShards    mShards;
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
 #endif  // _MSC_VER
@@ -337,6 +423,32 @@ protected:
      **/
     mutable ResourceLock    mLock;
 //////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Queues the socket event in the shard if the socket is not queued yet.
+     *          Otherwise, updates the flag of closed connection.
+     **/
+    inline void _queueSocketEvent( sConnectionShard & shard, SOCKETHANDLE hSocket, bool isClosed );
+
+    /**
+     * \brief   Extracts the next accepted socket or socket with event of the shard.
+     *          Returns false if there is no socket to return.
+     **/
+    bool _nextSocketEvent( uint32_t shard, SOCKETHANDLE & out_socket, NESocket::SocketAddress & out_addrNewAccepted, bool & out_isClosed );
+
+    /**
+     * \brief   Returns the index of shard of the connection with specified cookie.
+     **/
+    inline uint32_t _getCookieShard( const ITEM_ID & cookie ) const;
+
+    /**
+     * \brief   Creates the pollers of all shards. Returns true if succeeded.
+     **/
+    bool _createPollers( void );
+
+//////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
 private:
@@ -410,6 +522,12 @@ inline SocketAccepted ServerConnectionBase::getClientByHandle(SOCKETHANDLE clien
     return (mAcceptedConnections.isValidPosition(pos) ? mAcceptedConnections.getAt(clientSocket) : SocketAccepted());
 }
 
+inline uint32_t ServerConnectionBase::getShardCount( void ) const
+{
+    Lock lock( mLock );
+    return static_cast<uint32_t>(mShards.size( ));
+}
+
 inline bool ServerConnectionBase::disableSend( const SocketAccepted & clientConnection )
 {
     return clientConnection.disableSend();
@@ -436,4 +554,23 @@ inline void ServerConnectionBase::disableReceive( void )
     }
 }
 
+inline void ServerConnectionBase::_queueSocketEvent( sConnectionShard & shard, SOCKETHANDLE hSocket, bool isClosed )
+{
+    MapSocketEvents::MAPPOS pos = shard.csSocketEvents.find( hSocket );
+    if ( shard.csSocketEvents.isValidPosition( pos ) )
+    {
+        shard.csSocketEvents.valueAtPosition( pos ) |= isClosed;
+    }
+    else
+    {
+        shard.csSocketEvents.setAt( hSocket, isClosed );
+        shard.csEventOrder.pushLast( hSocket );
+    }
+}
+
+inline uint32_t ServerConnectionBase::_getCookieShard( const ITEM_ID & cookie ) const
+{
+    return static_cast<uint32_t>(cookie % static_cast<ITEM_ID>(mShards.size( )));
+}
+
 #endif  // AREG_IPC_SERVERCONNECTIONBASE_HPP
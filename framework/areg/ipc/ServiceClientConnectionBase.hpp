@@ -30,6 +30,8 @@
 #include "areg/base/SynchObjects.hpp"
 #include "areg/base/String.hpp"
 
+#include <atomic>
+
 /************************************************************************
  * Dependencies
  ************************************************************************/
@@ -332,6 +334,12 @@ protected:
      **/
     inline bool sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
 
+    /**
+     * \brief   Returns true if the connected remote service forwards the multicast messages.
+     *          The remote service notifies it when the connection is established.
+     **/
+    inline bool isServiceMulticast( void ) const;
+
     /**
      * \brief   Called to start client socket connection. Returns true if connected.
      **/
@@ -451,6 +459,10 @@ private:
      * \brief   The Client Service event consumer
      **/
     ReconnectTimerConsumer                  mTimerConsumer;
+    /**
+     * \brief   The flag, indicating whether the connected remote service forwards the multicast messages.
+     **/
+    std::atomic_bool                        mServiceMulticast;
 
 #if defined(_MSC_VER) && (_MSC_VER > 1200)
     #pragma warning(default: 4251)
@@ -551,6 +563,11 @@ inline bool ServiceClientConnectionBase::isConnectionStarted(void) const
     return (mClientConnection.isValid() && (cookie != NEService::COOKIE_LOCAL) && (cookie != NEService::COOKIE_UNKNOWN));
 }
 
+inline bool ServiceClientConnectionBase::isServiceMulticast( void ) const
+{
+    return mServiceMulticast.load( std::memory_order_relaxed );
+}
+
 inline void ServiceClientConnectionBase::setConnectionState(const ServiceClientConnectionBase::eConnectionState newState)
 {
     mConnectionState = newState;
@@ -24,6 +24,7 @@
 /************************************************************************
  * Dependencies
  ************************************************************************/
+class MessageReceiveBuffer;
 class RemoteMessage;
 class Socket;
 
@@ -67,11 +68,33 @@ protected:
      * \param   in_message      The instance of buffer to send. The checksum number of Remote Buffer object
      *                          will be checked before sending. If checksum is invalid, the data will not be sent.
      * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \param   checksum        If false, the checksum of the message is not calculated, because the remote host
+     *                          does not verify the checksum of received messages.
      * \return  Returns length in bytes of data in Remote Buffer sent to remote host. 
      *          Returns negative number if socket is not valid of failed to send.
      *          Returns zero, if checksum in Remote Buffer was not validated or Remote Buffer object is empty.
      **/
-    int sendMessage( const RemoteMessage & in_message, const Socket & clientSocket ) const;
+    int sendMessage( const RemoteMessage & in_message, const Socket & clientSocket, bool checksum = true ) const;
+
+    /**
+     * \brief   If socket is valid, sends the list of messages using existing socket connection.
+     *          The headers and the data of messages are passed to the system by gathering calls,
+     *          so that many messages are sent by one system call. The invalid messages are skipped.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   messages        The list of messages to send.
+     * \param   count           The number of messages in the list.
+     * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \param   checksum        If false, the checksum of the messages is not calculated, because the remote host
+     *                          does not verify the checksum of received messages.
+     * \param   out_sent        If not nullptr, on output contains the number of messages from the beginning
+     *                          of the list, which are completely sent. If sending fails, the message at this
+     *                          index is the first, which is not completely sent.
+     * \return  Returns total length in bytes of sent messages.
+     *          Returns negative number if socket is not valid of failed to send.
+     *          Returns zero, if there is no valid message to send.
+     **/
+    int sendMessages( const RemoteMessage * messages, uint32_t count, const Socket & clientSocket, bool checksum = true, uint32_t * out_sent = nullptr ) const;
 
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
@@ -85,11 +108,31 @@ protected:
      * \param   out_message     The instance of Remote Buffer to receive data. The checksum number of Remote Buffer object
      *                          will be checked after receiving data. If checksum is invalid, the data will invalidated and dropped.
      * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \param   checksum        If false, the checksum of the received message is not verified.
      * \return  Returns length in bytes of data in Remote Buffer received from remote host.
      *          Returns negative number if socket is not valid of failed to send.
      *          Returns zero, if checksum in Remote Buffer was not validated or data in Remote Buffer object is empty.
      **/
-    int receiveMessage( RemoteMessage & out_message, const Socket & clientSocket ) const;
+    int receiveMessage( RemoteMessage & out_message, const Socket & clientSocket, bool checksum = true ) const;
+
+    /**
+     * \brief   Extracts the next message from the receive buffer of the connection. If the buffer
+     *          does not contain the complete message, receives from the socket the available data
+     *          until the message is complete. The extracted message refers to the received data
+     *          without copying. Returns the length in bytes of the message, or negative number
+     *          if failed to receive data or the remote host closed the connection.
+     *          Returns zero if the checksum is not valid.
+     *          Note:   The call is blocking only if the receive buffer does not contain complete message.
+     * \param   out_message     The instance of Remote Buffer to receive data. If checksum is invalid,
+     *                          the data will invalidated and dropped.
+     * \param   clientSocket    The socket object, which can be either client connection socket or accepted socket on server side
+     * \param   recvBuffer      The receive buffer of the connection.
+     * \param   checksum        If false, the checksum of the received message is not verified.
+     * \return  Returns length in bytes of data in Remote Buffer received from remote host.
+     *          Returns negative number if socket is not valid, the connection is closed or failed to receive.
+     *          Returns zero, if checksum in Remote Buffer was not validated.
+     **/
+    int receiveMessage( RemoteMessage & out_message, const Socket & clientSocket, MessageReceiveBuffer & recvBuffer, bool checksum = true ) const;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
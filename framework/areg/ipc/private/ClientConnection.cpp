@@ -23,6 +23,8 @@ ClientConnection::ClientConnection( void )
     : SocketConnectionBase    ( )
     , mClientSocket ( )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mVerifyChecksum   ( true )
+    , mCalculateChecksum( true )
 {
 }
 
@@ -30,6 +32,8 @@ ClientConnection::ClientConnection(const String & hostName, unsigned short portN
     : SocketConnectionBase    ( )
     , mClientSocket ( hostName, portNr )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mVerifyChecksum   ( true )
+    , mCalculateChecksum( true )
 {
 }
 
@@ -37,6 +41,8 @@ ClientConnection::ClientConnection(const NESocket::SocketAddress & remoteAddress
     : SocketConnectionBase    ( )
     , mClientSocket ( remoteAddress )
     , mCookie       ( NEService::COOKIE_UNKNOWN )
+    , mVerifyChecksum   ( true )
+    , mCalculateChecksum( true )
 {
 }
 
@@ -56,5 +62,7 @@ bool ClientConnection::createSocket(void)
 void ClientConnection::closeSocket(void)
 {
     setCookie(NEService::COOKIE_UNKNOWN);
+    // the next connected remote host may verify the checksum.
+    setCalculateChecksum(true);
     mClientSocket.closeSocket();
 }
@@ -29,6 +29,7 @@ ClientReceiveThread::ClientReceiveThread(IERemoteMessageHandler& remoteService,
     , mConnection       ( connection )
     , mBytesReceive     ( 0 )
     , mSaveDataReceive  ( false )
+    , mReceiveBuffer    ( )
 {
 }
 
@@ -38,6 +39,7 @@ bool ClientReceiveThread::runDispatcher(void)
     LOG_DBG("Starting client service dispatcher thread [ %s ]", getName().getString());
     
     readyForEvents( true );
+    mReceiveBuffer.clear( );
 
     IESynchObject* syncObjects[2] {&mEventExit, &mEventQueue};
     MultiLock multiLock(syncObjects, 2, false);
@@ -50,7 +52,7 @@ bool ClientReceiveThread::runDispatcher(void)
         if ( whichEvent == MultiLock::LOCK_INDEX_TIMEOUT )
         {
             whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
-            int sizeReceive = mConnection.receiveMessage( msgReceived );
+            int sizeReceive = mConnection.receiveMessage( msgReceived, mReceiveBuffer );
             if ( sizeReceive <= 0 )
             {
                 msgReceived.invalidate();
@@ -79,6 +81,7 @@ bool ClientReceiveThread::runDispatcher(void)
 
     readyForEvents(false);
     removeAllEvents( );
+    mReceiveBuffer.clear( );
 
     LOG_DBG("Exiting client service dispatcher thread [ %s ] with result [ %s ]"
                 , getName().getString()
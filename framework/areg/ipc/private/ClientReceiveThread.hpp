@@ -20,6 +20,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
+#include "areg/ipc/MessageReceiveBuffer.hpp"
 
 #include <atomic>
 
@@ -116,6 +117,11 @@ private:
      **/
     bool                        mSaveDataReceive;
 
+    /**
+     * \brief   The buffer to receive messages of the connection.
+     **/
+    MessageReceiveBuffer        mReceiveBuffer;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -14,10 +14,12 @@
  ************************************************************************/
 #include "areg/ipc/private/ClientSendThread.hpp"
 
+#include "areg/appbase/NEApplication.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/ipc/ClientConnection.hpp"
 #include "areg/ipc/IERemoteMessageHandler.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
+#include "areg/base/NEUtilities.hpp"
 
 #include "areg/logging/GELog.h"
 
@@ -31,7 +33,12 @@ ClientSendThread::ClientSendThread(IERemoteMessageHandler& remoteService, Client
     , mConnection       ( connection )
     , mBytesSend        ( 0 )
     , mSaveDataSend     ( false )
+    , mSendBatch        ( )
+    , mBatchSize        ( NEApplication::DEFAULT_SERVICE_BATCH )
+    , mBatchLinger      ( NEApplication::DEFAULT_SERVICE_LINGER )
+    , mBatchStarted     ( 0 )
 {
+    mSendBatch.reserve( mBatchSize );
 }
 
 void ClientSendThread::readyForEvents( bool isReady )
@@ -48,6 +55,7 @@ void ClientSendThread::readyForEvents( bool isReady )
     {
         DispatcherThread::readyForEvents( false );
         SendMessageEvent::removeListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this) );
+        _sendBatch( );
         mConnection.closeSocket( );
         LOG_DBG( "Exiting client service dispatcher thread [ %s ], stopping receiving events", getName( ).getString( ) );
     }
@@ -58,12 +66,17 @@ void ClientSendThread::processEvent( const SendMessageEventData & data )
     if ( data.isForwardMessage() )
     {
         const RemoteMessage & msg = data.getRemoteMessage( );
-        int sizeSend = mConnection.sendMessage( msg );
-        if ( sizeSend > 0 )
+        if ( msg.isValid( ) )
         {
-            if (mSaveDataSend)
+            if ( mSendBatch.empty( ) )
             {
-                mBytesSend += static_cast<uint32_t>(sizeSend);
+                mBatchStarted = NEUtilities::getTickCount( );
+            }
+
+            mSendBatch.push_back( msg );
+            if ( _waitNextMessage( ) == false )
+            {
+                _sendBatch( );
             }
         }
         else
@@ -73,11 +86,58 @@ void ClientSendThread::processEvent( const SendMessageEventData & data )
     }
     else if (data.isExitThreadMessage() )
     {
+        _sendBatch( );
         mConnection.closeSocket( );
         triggerExit( );
     }
 }
 
+bool ClientSendThread::_waitNextMessage( void )
+{
+    bool result{ false };
+    if ( mSendBatch.size( ) < static_cast<size_t>(mBatchSize) )
+    {
+        if ( static_cast<EventQueue &>(mExternaEvents).isEmpty( ) == false )
+        {
+            result = true;
+        }
+        else if ( mBatchLinger != 0 )
+        {
+            TIME64 elapsed = NEUtilities::getTickCount( ) - mBatchStarted;
+            result = (elapsed < mBatchLinger) && mEventQueue.lock( static_cast<unsigned int>(mBatchLinger - elapsed) );
+        }
+    }
+
+    return result;
+}
+
+void ClientSendThread::_sendBatch( void )
+{
+    if ( mSendBatch.empty( ) )
+        return;
+
+    const uint32_t count{ static_cast<uint32_t>(mSendBatch.size( )) };
+    uint32_t sent{ 0 };
+    int sizeSend = mConnection.sendMessages( mSendBatch.data( ), count, &sent );
+    if ( sizeSend > 0 )
+    {
+        if (mSaveDataSend)
+        {
+            mBytesSend += static_cast<uint32_t>(sizeSend);
+        }
+    }
+    else
+    {
+        // the messages at the beginning of the batch are already sent.
+        for ( uint32_t i = sent; i < count; ++ i )
+        {
+            mRemoteService.failedSendMessage( mSendBatch[i], mConnection.getSocket( ) );
+        }
+    }
+
+    mSendBatch.clear( );
+}
+
 bool ClientSendThread::postEvent(Event & eventElem)
 {
     return (RUNTIME_CAST(&eventElem, SendMessageEvent) != nullptr) && EventDispatcher::postEvent(eventElem);
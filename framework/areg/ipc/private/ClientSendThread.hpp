@@ -23,6 +23,7 @@
 #include "areg/ipc/SendMessageEvent.hpp"
 
 #include <atomic>
+#include <vector>
 
 /************************************************************************
  * Dependencies
@@ -35,7 +36,9 @@ class ClientConnection;
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The message sender thread. All messages to be sent to remote routing service
- *          are queued in message sender thread. 
+ *          are queued in message sender thread. The thread collects the queued messages
+ *          in the batch and sends the batch by one system call when the queue is empty,
+ *          the batch is full or the messages in the batch wait longer than the linger time.
  **/
 class ClientSendThread  : public    DispatcherThread
                         , public    IESendMessageEventConsumer
@@ -79,6 +82,16 @@ public:
      **/
     inline bool isCalculateDataEnabled(void) const;
 
+    /**
+     * \brief   Sets the parameters of the batch of messages sent by one system call.
+     *          Should be called before the thread is started.
+     * \param   maxMessages The maximum number of messages in the batch. Must be not zero.
+     * \param   maxLinger   The maximum time in milliseconds to wait for more messages
+     *                      when the queue is empty. If zero, the batch is sent as soon
+     *                      as there are no more queued messages.
+     **/
+    inline void setSendBatch( uint32_t maxMessages, uint32_t maxLinger );
+
 protected:
 /************************************************************************/
 // DispatcherThread overrides
@@ -119,6 +132,22 @@ private:
      **/
     virtual void processEvent( const SendMessageEventData & data ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns true if more messages can be added in the batch before sending.
+     *          If the queue is empty and the linger time is not elapsed, waits for
+     *          the next message until the linger time elapses.
+     **/
+    bool _waitNextMessage( void );
+
+    /**
+     * \brief   Sends the collected batch of messages and empties the batch.
+     **/
+    void _sendBatch( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables.
 //////////////////////////////////////////////////////////////////////////
@@ -142,6 +171,26 @@ private:
      **/
     bool                        mSaveDataSend;
 
+    /**
+     * \brief   The batch of messages to send by one system call.
+     **/
+    std::vector<RemoteMessage>  mSendBatch;
+
+    /**
+     * \brief   The maximum number of messages in the batch.
+     **/
+    uint32_t                    mBatchSize;
+
+    /**
+     * \brief   The maximum time in milliseconds to wait for more messages in the batch.
+     **/
+    uint32_t                    mBatchLinger;
+
+    /**
+     * \brief   The tick count in milliseconds when the first message of the batch was queued.
+     **/
+    TIME64                      mBatchStarted;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -169,4 +218,12 @@ inline bool ClientSendThread::isCalculateDataEnabled(void) const
     return mSaveDataSend;
 }
 
+inline void ClientSendThread::setSendBatch( uint32_t maxMessages, uint32_t maxLinger )
+{
+    ASSERT( maxMessages != 0 );
+    mBatchSize  = maxMessages;
+    mBatchLinger= maxLinger;
+    mSendBatch.reserve( mBatchSize );
+}
+
 #endif  // AREG_IPC_PRIVATE_CLIENTSENDTHREAD_HPP
@@ -75,6 +75,26 @@ void ConnectionConfiguration::setConnectionPort(unsigned short portNr)
     Application::getConfigManager().setRemoteServicePort(mServiceName, mConnectType, portNr);
 }
 
+uint32_t ConnectionConfiguration::getServiceWorkers( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceWorkers(mServiceName);
+}
+
+bool ConnectionConfiguration::getServiceChecksum( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceChecksum(mServiceName);
+}
+
+uint32_t ConnectionConfiguration::getServiceBatch( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceBatch(mServiceName);
+}
+
+uint32_t ConnectionConfiguration::getServiceLinger( void ) const
+{
+    return Application::getConfigManager().getRemoteServiceLinger(mServiceName);
+}
+
 bool ConnectionConfiguration::getConnectionIpAddress( unsigned char & OUT field0
                                                     , unsigned char & OUT field1
                                                     , unsigned char & OUT field2
@@ -0,0 +1,151 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/ipc/private/MessageReceiveBuffer.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, the buffer of connection to receive remote messages.
+ ************************************************************************/
+#include "areg/ipc/MessageReceiveBuffer.hpp"
+
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/Socket.hpp"
+
+#include <string.h>
+
+MessageReceiveBuffer::MessageReceiveBuffer( unsigned int capacity /*= MessageReceiveBuffer::DEFAULT_CAPACITY*/ )
+    : mBlock    ( )
+    , mCapacity ( MACRO_MAX(capacity, static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader))) )
+    , mBlockSize( 0 )
+    , mReadPos  ( 0 )
+    , mWritePos ( 0 )
+{
+}
+
+bool MessageReceiveBuffer::hasMessage( void ) const
+{
+    int length = _nextMessageLength( );
+    return ((length > 0) && (static_cast<unsigned int>(length) <= getPendingSize( )));
+}
+
+int MessageReceiveBuffer::receiveData( const Socket & socket )
+{
+    int length = _nextMessageLength( );
+    if ( length < 0 )
+        return length;
+
+    _prepareSpace( length > 0 ? static_cast<unsigned int>(length) : static_cast<unsigned int>(sizeof(NEMemory::sRemoteMessageHeader)) );
+    int result = socket.receiveAvailableData( mBlock.get( ) + mWritePos, static_cast<int>(mBlockSize - mWritePos) );
+    if ( result > 0 )
+    {
+        mWritePos += static_cast<unsigned int>(result);
+    }
+
+    return result;
+}
+
+int MessageReceiveBuffer::extractMessage( RemoteMessage & OUT out_message )
+{
+    int result = _nextMessageLength( );
+    if ( (result > 0) && (static_cast<unsigned int>(result) <= getPendingSize( )) )
+    {
+        // Refer to the received data, if possible. Otherwise, copy the data.
+        if ( out_message.initMessage( mBlock, mReadPos ) == false )
+        {
+            NEMemory::sRemoteMessageHeader header{ };
+            const unsigned char * src = mBlock.get( ) + mReadPos;
+            ::memcpy( &header, src, sizeof( NEMemory::sRemoteMessageHeader ) );
+            unsigned char * data = out_message.initMessage( header );
+            if ( (data != nullptr) && (header.rbhBufHeader.biUsed != 0) )
+            {
+                ::memcpy( data, src + sizeof( NEMemory::sRemoteMessageHeader ), header.rbhBufHeader.biUsed );
+            }
+        }
+
+        mReadPos += static_cast<unsigned int>(result);
+        if ( (mReadPos == mWritePos) && (mBlock.use_count( ) == 1) )
+        {
+            // Nobody refers to the block, start from the beginning.
+            mReadPos = mWritePos = 0;
+        }
+    }
+    else if ( result > 0 )
+    {
+        result = 0;
+    }
+
+    return result;
+}
+
+void MessageReceiveBuffer::clear( void )
+{
+    if ( mBlock.use_count( ) > 1 )
+    {
+        mBlock.reset( );
+        mBlockSize = 0;
+    }
+
+    mReadPos = mWritePos = 0;
+}
+
+int MessageReceiveBuffer::_nextMessageLength( void ) const
+{
+    constexpr unsigned int headerSize{ sizeof( NEMemory::sRemoteMessageHeader ) };
+
+    int result{ 0 };
+    if ( getPendingSize( ) >= headerSize )
+    {
+        // The header in the block may be not aligned.
+        NEMemory::sRemoteMessageHeader header{ };
+        ::memcpy( &header, mBlock.get( ) + mReadPos, headerSize );
+        const NEMemory::sBuferHeader & info = header.rbhBufHeader;
+        if ( (info.biLength >= info.biUsed) && (info.biLength <= MessageReceiveBuffer::MAX_MESSAGE_LENGTH) )
+        {
+            result = static_cast<int>(headerSize + (info.biUsed != 0 ? info.biLength : 0u));
+        }
+        else
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+void MessageReceiveBuffer::_prepareSpace( unsigned int required )
+{
+    const unsigned int pending{ getPendingSize( ) };
+    if ( mBlock == nullptr )
+    {
+        mBlockSize  = MACRO_MAX( mCapacity, required );
+        mBlock      = std::shared_ptr<unsigned char>( DEBUG_NEW unsigned char[mBlockSize], std::default_delete<unsigned char[]>( ) );
+        mReadPos    = mWritePos = 0;
+    }
+    else if ( (mBlockSize - mReadPos < required) || ((mReadPos != 0) && (mBlockSize - mWritePos < mBlockSize / 4)) )
+    {
+        if ( (mBlock.use_count( ) == 1) && (mBlockSize >= required) )
+        {
+            // Nobody refers to the block, move the pending data to the beginning.
+            ::memmove( mBlock.get( ), mBlock.get( ) + mReadPos, pending );
+        }
+        else
+        {
+            // The extracted messages refer to the block, continue in the new block.
+            unsigned int blockSize = MACRO_MAX( mCapacity, required );
+            std::shared_ptr<unsigned char> block( DEBUG_NEW unsigned char[blockSize], std::default_delete<unsigned char[]>( ) );
+            ::memcpy( block.get( ), mBlock.get( ) + mReadPos, pending );
+            mBlock      = block;
+            mBlockSize  = blockSize;
+        }
+
+        mReadPos    = 0;
+        mWritePos   = pending;
+    }
+}
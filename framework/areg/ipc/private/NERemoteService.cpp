@@ -39,6 +39,7 @@ namespace
             out_msgRegister << reqType;
             out_msgRegister << addrService;
             out_msgRegister << reason;
+            out_msgRegister << addrService.getHandle();
         }
     }
 
@@ -53,6 +54,7 @@ namespace
             out_msgRegister << reqType;
             out_msgRegister << addrService;
             out_msgRegister << reason;
+            out_msgRegister << addrService.getHandle();
         }
     }
 
@@ -67,6 +69,7 @@ namespace
             out_msgNotify << reqType;
             out_msgNotify << addrService;
             out_msgNotify << reason;
+            out_msgNotify << addrService.getHandle();
         }
     }
 
@@ -81,6 +84,7 @@ namespace
             out_msgNotify << reqType;
             out_msgNotify << addrService;
             out_msgNotify << reason;
+            out_msgNotify << addrService.getHandle();
         }
     }
 
@@ -435,6 +439,17 @@ AREG_API_IMPL RemoteMessage NERemoteService::createServiceClientUnregisteredNoti
     return msgResult;
 }
 
+AREG_API_IMPL uint32_t NERemoteService::readAddressHandle( const RemoteMessage & msgRegister )
+{
+    uint32_t handle{ NEService::INVALID_HANDLE };
+    if ( msgRegister.isEndOfBuffer( ) == false )
+    {
+        msgRegister >> handle;
+    }
+
+    return handle;
+}
+
 AREG_API_IMPL RemoteMessage NERemoteService::createConnectRequest(const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource)
 {
     RemoteMessage msgHelloServer;
@@ -83,6 +83,24 @@ bool RouterClient::connectServiceHost(void)
     return result;
 }
 
+void RouterClient::onChannelConnected(const ITEM_ID & cookie)
+{
+    ServiceClientConnectionBase::onChannelConnected(cookie);
+
+    // the handles of addresses of other processes are valid only during the connection.
+    const ITEM_ID owner{ cookie >= NEService::COOKIE_REMOTE_SERVICE ? cookie : NEService::COOKIE_UNKNOWN };
+    StubAddress::setHandleOwner( owner );
+    ProxyAddress::setHandleOwner( owner );
+}
+
+RemoteMessage RouterClient::createServiceConnectMessage(const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource) const
+{
+    RemoteMessage result{ ServiceClientConnectionBase::createServiceConnectMessage(source, target, msgSource) };
+    result.moveToEnd();
+    result << true; // processes multicast messages
+    return result;
+}
+
 void RouterClient::disconnectServiceHost(void)
 {
     if (isRunning())
@@ -297,13 +315,16 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
                         ProxyAddress proxy(msgReceived);
                         NEService::eDisconnectReason reason { NEService::eDisconnectReason::ReasonUndefined };
                         msgReceived >> reason;
+                        proxy.setHandle( NERemoteService::readAddressHandle(msgReceived) );
                         proxy.setSource( mChannel.getSource() );
                         if ( result == NEMemory::eMessageResult::ResultSucceed )
                         {
+                            ProxyAddress::registerRemoteHandle(proxy);
                             mRegisterConsumer.registeredRemoteServiceConsumer(proxy);
                         }
                         else
                         {
+                            ProxyAddress::unregisterRemoteHandle(proxy);
                             mRegisterConsumer.unregisteredRemoteServiceConsumer(proxy, reason, NEService::COOKIE_ANY);
                         }
                     }
@@ -312,13 +333,18 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
                 case NEService::eServiceRequestType::RegisterStub:
                     {
                         StubAddress stub(msgReceived);
+                        NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
+                        msgReceived >> reason;
+                        stub.setHandle( NERemoteService::readAddressHandle(msgReceived) );
                         stub.setSource( mChannel.getSource() );
                         if ( result == NEMemory::eMessageResult::ResultSucceed )
                         {
+                            StubAddress::registerRemoteHandle( stub );
                             mRegisterConsumer.registeredRemoteServiceProvider( stub );
                         }
                         else
                         {
+                            StubAddress::unregisterRemoteHandle( stub );
                             mRegisterConsumer.unregisteredRemoteServiceProvider( stub, NEService::eDisconnectReason::ReasonUndefined, NEService::COOKIE_ANY );
                         }
                     }
@@ -329,7 +355,9 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
                         ProxyAddress proxy(msgReceived);
                         NEService::eDisconnectReason reason { NEService::eDisconnectReason::ReasonUndefined };
                         msgReceived >> reason;
+                        proxy.setHandle( NERemoteService::readAddressHandle(msgReceived) );
                         proxy.setSource( mChannel.getSource() );
+                        ProxyAddress::unregisterRemoteHandle(proxy);
                         mRegisterConsumer.unregisteredRemoteServiceConsumer(proxy, reason, NEService::COOKIE_ANY);
                     }
                     break;
@@ -339,7 +367,9 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
                         StubAddress stub(msgReceived);
                         NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
                         msgReceived >> reason;
+                        stub.setHandle( NERemoteService::readAddressHandle(msgReceived) );
                         stub.setSource( mChannel.getSource() );
+                        StubAddress::unregisterRemoteHandle( stub );
                         mRegisterConsumer.unregisteredRemoteServiceProvider(stub, reason, NEService::COOKIE_ANY);
                     }
                     break;
@@ -370,6 +400,20 @@ void RouterClient::processReceivedMessage( const RemoteMessage & msgReceived, So
         case NEService::eFuncIdRange::ServiceSaveLogConfiguration:      // fall through
         case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
         case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+        case NEService::eFuncIdRange::ServiceLogMessageBatch:           // fall through
+        case NEService::eFuncIdRange::ServiceLogObserverFilter:         // fall through
+            break;
+
+        case NEService::eFuncIdRange::ServiceMulticastMessage:
+            {
+                TEArrayList<StreamableEvent *> events;
+                RemoteEventFactory::createEventsFromMulticastStream(msgReceived, mChannel, events);
+                LOG_DBG("Delivering multicast message to [ %u ] targets", events.getSize());
+                for ( uint32_t i = 0; i < events.getSize( ); ++ i )
+                {
+                    events[i]->deliverEvent();
+                }
+            }
             break;
 
         case NEService::eFuncIdRange::AttributeLastId:          // fall through
@@ -471,7 +515,27 @@ void RouterClient::processRemoteResponseEvent(RemoteResponseEvent & responseEven
 {
     LOG_SCOPE(areg_ipc_private_RouterClient_processRemoteResponseEvent);
 
-    if ( responseEvent.isRemote() )
+    if ( responseEvent.isMulticast() && (isServiceMulticast() == false) )
+    {
+        // The router does not forward multicast messages, send one message per target.
+        const TEArrayList<ProxyAddress> & targets = responseEvent.getMulticastTargets();
+        LOG_DBG("The router does not forward multicast messages, sending response [ %u ] to [ %u ] targets", responseEvent.getResponseId(), targets.getSize() + 1);
+        for ( uint32_t i = 0; i <= targets.getSize(); ++ i )
+        {
+            ServiceResponseEvent * eventResp = responseEvent.cloneForTarget( i == 0 ? responseEvent.getTargetProxy() : targets[i - 1] );
+            RemoteResponseEvent * eventRemote = RUNTIME_CAST( eventResp, RemoteResponseEvent );
+            if ( eventRemote != nullptr )
+            {
+                processRemoteResponseEvent( *eventRemote );
+            }
+
+            if ( eventResp != nullptr )
+            {
+                eventResp->destroy();
+            }
+        }
+    }
+    else if ( responseEvent.isRemote() )
     {
         RemoteMessage data;
         if ( RemoteEventFactory::createStreamFromEvent( data, responseEvent, mChannel) )
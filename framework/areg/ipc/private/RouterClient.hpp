@@ -87,6 +87,22 @@ protected:
      **/
     virtual void onServiceExit(void) override;
 
+    /**
+     * \brief   Triggered when the connection with the router is established or lost.
+     *          Sets the cookie of the process, which owns the handles of local addresses.
+     * \param   cookie  The cookie of the process assigned by the router, or invalid if disconnected.
+     **/
+    virtual void onChannelConnected(const ITEM_ID & cookie) override;
+
+    /**
+     * \brief   Creates the message to connect to the router. The message notifies
+     *          the router that the client processes the multicast messages.
+     * \param   source      The ID of the source that sends the message.
+     * \param   target      The ID of the target to send the message.
+     * \param   msgSource   The type of the message source.
+     **/
+    virtual RemoteMessage createServiceConnectMessage( const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource ) const override;
+
 /************************************************************************/
 // IERemoteMessageHandler interface overrides
 /************************************************************************/
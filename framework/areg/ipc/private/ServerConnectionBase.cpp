@@ -22,9 +22,11 @@ ServerConnectionBase::ServerConnectionBase( void )
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
-    , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
+    , mAcceptedSockets      ( )
+    , mShards               ( )
     , mLock                 ( )
 {
+    mShards.emplace_back( DEBUG_NEW sConnectionShard( ) );
 }
 
 ServerConnectionBase::ServerConnectionBase(const String & hostName, unsigned short portNr)
@@ -33,9 +35,11 @@ ServerConnectionBase::ServerConnectionBase(const String & hostName, unsigned sho
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
-    , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
+    , mAcceptedSockets      ( )
+    , mShards               ( )
     , mLock                 ( )
 {
+    mShards.emplace_back( DEBUG_NEW sConnectionShard( ) );
 }
 
 ServerConnectionBase::ServerConnectionBase(const NESocket::SocketAddress & serverAddress)
@@ -44,43 +48,128 @@ ServerConnectionBase::ServerConnectionBase(const NESocket::SocketAddress & serve
     , mAcceptedConnections  ( )
     , mCookieToSocket       ( )
     , mSocketToCookie       ( )
-    , mMasterList           ( ServerConnectionBase::MASTER_LIST_SIZE )
+    , mAcceptedSockets      ( )
+    , mShards               ( )
     , mLock                 ( )
 {
+    mShards.emplace_back( DEBUG_NEW sConnectionShard( ) );
 }
 
 bool ServerConnectionBase::createSocket(const String & hostName, unsigned short portNr)
 {
     Lock lock(mLock);
-    return mServerSocket.createSocket(hostName, portNr);
+    return mServerSocket.createSocket(hostName, portNr) && _createPollers();
 }
 
 bool ServerConnectionBase::createSocket(void)
 {
     Lock lock(mLock);
-    return mServerSocket.createSocket();
+    return mServerSocket.createSocket() && _createPollers();
 }
 
 void ServerConnectionBase::closeSocket(void)
 {
     Lock lock(mLock);
-    mMasterList.clear();
     mCookieToSocket.clear();
     mSocketToCookie.clear();
     mAcceptedConnections.clear();
+    releaseConnectionEvents();
     mCookieGenerator = NEService::COOKIE_REMOTE_SERVICE;
 
     mServerSocket.closeSocket();
+    // The closed socket does not wake up epoll.
+    for ( auto & shard : mShards )
+    {
+        shard->csPoller.wakeUp();
+    }
 }
 
 bool ServerConnectionBase::serverListen(int maxQueueSize /*= NESocket::MAXIMUM_LISTEN_QUEUE_SIZE */)
 {
-    return mServerSocket.listenConnection(maxQueueSize);
+    return mServerSocket.listenConnection(maxQueueSize) && mShards.front()->csPoller.addSocket(getSocketHandle());
+}
+
+bool ServerConnectionBase::setShardCount( uint32_t count )
+{
+    Lock lock(mLock);
+    if ( mServerSocket.isValid() || (count == 0) || (count > MAX_CONNECTION_SHARDS) )
+        return false;
+
+    mShards.clear();
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        mShards.emplace_back( DEBUG_NEW sConnectionShard( ) );
+    }
+
+    return true;
+}
+
+uint32_t ServerConnectionBase::getConnectionShard( SOCKETHANDLE hSocket ) const
+{
+    Lock lock(mLock);
+    MapSocketToCookie::MAPPOS pos = mSocketToCookie.find( hSocket );
+    return (mSocketToCookie.isValidPosition(pos) ? _getCookieShard(mSocketToCookie.valueAtPosition(pos)) : static_cast<uint32_t>(mShards.size()));
 }
 
-SOCKETHANDLE ServerConnectionBase::waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted)
+SOCKETHANDLE ServerConnectionBase::waitForConnectionEvent(NESocket::SocketAddress & out_addrNewAccepted, bool & out_isClosed, uint32_t shard /*= 0*/)
 {
-    return mServerSocket.waitConnectionEvent(out_addrNewAccepted, static_cast<const SOCKETHANDLE *>(mMasterList), static_cast<int32_t>(mMasterList.getSize()));
+    SOCKETHANDLE result{ NESocket::InvalidSocketHandle };
+    out_isClosed = false;
+    if ( shard >= getShardCount() )
+    {
+        return NESocket::FailedSocketHandle;
+    }
+    else if ( _nextSocketEvent(shard, result, out_addrNewAccepted, out_isClosed) )
+    {
+        return result;
+    }
+
+    // The shards are not changed while the socket is valid.
+    sConnectionShard & connections = *mShards[shard];
+    SocketPoller::sSocketEvent events[SocketPoller::MAX_EVENTS];
+    int count = connections.csPoller.waitEvents(events, SocketPoller::MAX_EVENTS);
+    if ( count < 0 )
+    {
+        return NESocket::FailedSocketHandle;
+    }
+
+    do
+    {
+        Lock lock(mLock);
+        const SOCKETHANDLE hServer{ mServerSocket.getHandle() };
+        for ( int i = 0; i < count; ++ i )
+        {
+            const SocketPoller::sSocketEvent & entry = events[i];
+            if ( entry.seSocket == hServer )
+            {
+                // Accept all pending connections, the event is fired only for new connections.
+                NESocket::SocketAddress addrAccepted;
+                SOCKETHANDLE hSocket{ NESocket::serverAcceptPending(hServer, &addrAccepted) };
+                while ( hSocket != NESocket::InvalidSocketHandle )
+                {
+                    mAcceptedSockets.pushLast(std::make_pair(hSocket, addrAccepted));
+                    hSocket = NESocket::serverAcceptPending(hServer, &addrAccepted);
+                }
+            }
+            else if ( mAcceptedConnections.contains(entry.seSocket) )
+            {
+                _queueSocketEvent(connections, entry.seSocket, entry.seClosed);
+            }
+        }
+    } while ( false );
+
+    _nextSocketEvent(shard, result, out_addrNewAccepted, out_isClosed);
+    return result;
+}
+
+void ServerConnectionBase::continueConnectionEvent(SOCKETHANDLE hSocket, bool isClosed)
+{
+    Lock lock(mLock);
+    MapSocketToCookie::MAPPOS pos = mSocketToCookie.find( hSocket );
+    if ( mSocketToCookie.isValidPosition(pos) )
+    {
+        _queueSocketEvent(*mShards[_getCookieShard(mSocketToCookie.valueAtPosition(pos))], hSocket, isClosed);
+    }
 }
 
 bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
@@ -93,7 +182,7 @@ bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
         const SOCKETHANDLE hSocket = clientConnection.getHandle();
         ASSERT(hSocket != NESocket::InvalidSocketHandle);
 
-        if ( mMasterList.find(hSocket) == -1)
+        if ( mAcceptedConnections.contains(hSocket) == false )
         {
             ASSERT(mAcceptedConnections.contains( hSocket ) == false);
             ASSERT(mSocketToCookie.contains(hSocket) == false);
@@ -104,8 +193,8 @@ bool ServerConnectionBase::acceptConnection(SocketAccepted & clientConnection)
             mAcceptedConnections.setAt(hSocket, clientConnection);
             mCookieToSocket.setAt(cookie, hSocket);
             mSocketToCookie.setAt(hSocket, cookie);
-            mMasterList.add( hSocket );
-            result = true;
+            // The data received before registering is reported as well.
+            result = mShards[_getCookieShard(cookie)]->csPoller.addSocket( hSocket );
         }
         else
         {
@@ -129,7 +218,10 @@ void ServerConnectionBase::closeConnection(SocketAccepted & clientConnection)
     mSocketToCookie.removeAt(hSocket);
     mCookieToSocket.removeAt(cookie);
     mAcceptedConnections.removeAt(hSocket);
-    mMasterList.removeElem(hSocket, 0);
+    if ( cookie != NEService::COOKIE_UNKNOWN )
+    {
+        mShards[_getCookieShard(cookie)]->csPoller.removeSocket(hSocket);
+    }
 
     clientConnection.closeSocket();
 }
@@ -146,7 +238,7 @@ void ServerConnectionBase::closeConnection( const ITEM_ID & cookie )
 
         mCookieToSocket.removePosition( posCookie );        
         mSocketToCookie.removeAt( hSocket );
-        mMasterList.removeElem( hSocket, 0 );
+        mShards[_getCookieShard(cookie)]->csPoller.removeSocket( hSocket );
         if (mAcceptedConnections.isValidPosition(posClient))
         {
             SocketAccepted client(mAcceptedConnections.valueAtPosition(posClient));
@@ -155,3 +247,56 @@ void ServerConnectionBase::closeConnection( const ITEM_ID & cookie )
         }
     }
 }
+
+void ServerConnectionBase::releaseConnectionEvents(void)
+{
+    Lock lock(mLock);
+    mAcceptedSockets.clear();
+    for ( auto & shard : mShards )
+    {
+        shard->csSocketEvents.clear();
+        shard->csEventOrder.clear();
+    }
+}
+
+bool ServerConnectionBase::_createPollers(void)
+{
+    bool result{ true };
+    for ( auto & shard : mShards )
+    {
+        result = result && shard->csPoller.create();
+    }
+
+    return result;
+}
+
+bool ServerConnectionBase::_nextSocketEvent(uint32_t shard, SOCKETHANDLE & out_socket, NESocket::SocketAddress & out_addrNewAccepted, bool & out_isClosed)
+{
+    Lock lock(mLock);
+
+    if ( (shard == 0) && (mAcceptedSockets.isEmpty() == false) )
+    {
+        std::pair<SOCKETHANDLE, NESocket::SocketAddress> accepted{ mAcceptedSockets.popFirst() };
+        out_socket          = accepted.first;
+        out_addrNewAccepted = accepted.second;
+        out_isClosed        = false;
+        return true;
+    }
+
+    sConnectionShard & connections = *mShards[shard];
+    while ( connections.csEventOrder.isEmpty() == false )
+    {
+        SOCKETHANDLE hSocket{ connections.csEventOrder.popFirst() };
+        bool isClosed{ false };
+        connections.csSocketEvents.removeAt(hSocket, isClosed);
+        // Skip the sockets closed after the event was received.
+        if ( mAcceptedConnections.contains(hSocket) )
+        {
+            out_socket  = hSocket;
+            out_isClosed= isClosed;
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -65,6 +65,7 @@ ServiceClientConnectionBase::ServiceClientConnectionBase( const ITEM_ID & target
     , mThreadReceive        (messageHandler, mClientConnection, prefixName)
     , mThreadSend           (messageHandler, mClientConnection, prefixName)
     , mTimerConsumer        ( static_cast<IEServiceEventConsumerBase &>(self()) )
+    , mServiceMulticast     ( false )
 {
     ASSERT((target > NEService::TARGET_LOCAL) && (target < NEService::COOKIE_REMOTE_SERVICE));
 }
@@ -94,6 +95,27 @@ void ServiceClientConnectionBase::serviceConnectionEvent(const RemoteMessage& ms
                 Lock lock(mLock);
                 ASSERT(cookie == msgReceived.getTarget());
                 mClientConnection.setCookie(cookie);
+
+                // The service verifies the checksum of received messages, unless it explicitly notifies otherwise.
+                // The service forwards the multicast messages only if it explicitly notifies it.
+                bool verifyChecksum{ true };
+                bool multicast{ false };
+                if (msgReceived.isEndOfBuffer() == false)
+                {
+                    NEService::eMessageSource msgSource{ NEService::eMessageSource::MessageSourceUndefined };
+                    msgReceived >> msgSource;
+                    if (msgReceived.isEndOfBuffer() == false)
+                    {
+                        msgReceived >> verifyChecksum;
+                        if (msgReceived.isEndOfBuffer() == false)
+                        {
+                            msgReceived >> multicast;
+                        }
+                    }
+                }
+
+                mClientConnection.setCalculateChecksum(verifyChecksum);
+                mServiceMulticast.store(multicast, std::memory_order_relaxed);
                 onChannelConnected(cookie);
                 sendCommand(ServiceEventData::eServiceEventCommands::CMD_ServiceStarted);
             }
@@ -144,6 +166,8 @@ bool ServiceClientConnectionBase::setupServiceConnectionData(NERemoteService::eR
                 String address{ config.getConnectionAddress() };
                 unsigned short port{ config.getConnectionPort() };
                 result = mClientConnection.setAddress(address, port);
+                mClientConnection.setVerifyChecksum(config.getServiceChecksum());
+                mThreadSend.setSendBatch(MACRO_MAX(config.getServiceBatch(), 1u), config.getServiceLinger());
             }
         }
     }
@@ -204,7 +228,10 @@ bool ServiceClientConnectionBase::isServiceHostSetup( void ) const
 
 RemoteMessage ServiceClientConnectionBase::createServiceConnectMessage(const ITEM_ID & source, const ITEM_ID & target, NEService::eMessageSource msgSource) const
 {
-    return NERemoteService::createConnectRequest(source, target, msgSource);
+    RemoteMessage result{ NERemoteService::createConnectRequest(source, target, msgSource) };
+    result.moveToEnd();
+    result << mClientConnection.isVerifyChecksum();
+    return result;
 }
 
 RemoteMessage ServiceClientConnectionBase::createServiceDisconnectMessage(const ITEM_ID & source, const ITEM_ID & target) const
@@ -411,6 +438,7 @@ void ServiceClientConnectionBase::cancelConnection(void)
 
     mClientConnection.closeSocket();
     mClientConnection.setCookie( NEService::COOKIE_UNKNOWN );
+    mServiceMulticast.store( false, std::memory_order_relaxed );
 
     mThreadReceive.shutdownThread( NECommon::DO_NOT_WAIT );
     mThreadSend.shutdownThread( NECommon::DO_NOT_WAIT );
@@ -14,18 +14,19 @@
  ************************************************************************/
 
 #include "areg/ipc/SocketConnectionBase.hpp"
+#include "areg/ipc/MessageReceiveBuffer.hpp"
 #include "areg/base/Socket.hpp"
 #include "areg/base/RemoteMessage.hpp"
 #include "areg/base/NEMemory.hpp"
 
 #include "areg/logging/GELog.h"
 
-int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const Socket & clientSocket) const
+int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const Socket & clientSocket, bool checksum /*= true*/) const
 {
     int result{ -1 };
     if ( in_message.isValid() && clientSocket.isValid() )
     {
-        in_message.bufferCompletionFix();
+        in_message.bufferCompletionFix(checksum);
         const NEMemory::sRemoteMessageHeader & buffer = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>( *in_message.getByteBuffer() );
         result = clientSocket.sendData( reinterpret_cast<const unsigned char *>(&buffer), sizeof(NEMemory::sRemoteMessageHeader) );
         if ((result == sizeof(NEMemory::sRemoteMessageHeader)) && (buffer.rbhBufHeader.biUsed != 0))
@@ -39,7 +40,70 @@ int SocketConnectionBase::sendMessage(const RemoteMessage & in_message, const So
     return result;
 }
 
-int SocketConnectionBase::receiveMessage(RemoteMessage & out_message, const Socket & clientSocket) const
+int SocketConnectionBase::sendMessages( const RemoteMessage * messages, uint32_t count, const Socket & clientSocket, bool checksum /*= true*/, uint32_t * out_sent /*= nullptr*/ ) const
+{
+    constexpr uint32_t maxMessages{ NESocket::MAX_SEND_BUFFERS / 2 };
+
+    int result{ -1 };
+    uint32_t sent{ 0 };
+    if ( (messages != nullptr) && clientSocket.isValid() )
+    {
+        NESocket::sSendBuffer buffers[NESocket::MAX_SEND_BUFFERS];
+        uint32_t ends[maxMessages]; // the number of buffers to send to complete the message.
+        result = 0;
+
+        for ( uint32_t first = 0; (first < count) && (result >= 0); first += maxMessages )
+        {
+            uint32_t last = MACRO_MIN( first + maxMessages, count );
+            uint32_t used{ 0 };
+            for ( uint32_t i = first; i < last; ++ i )
+            {
+                const RemoteMessage & msg = messages[i];
+                if ( msg.isValid() )
+                {
+                    msg.bufferCompletionFix(checksum);
+                    const NEMemory::sRemoteMessageHeader & header = reinterpret_cast<const NEMemory::sRemoteMessageHeader &>( *msg.getByteBuffer() );
+                    buffers[used].sbData    = reinterpret_cast<const unsigned char *>(&header);
+                    buffers[used].sbLength  = sizeof(NEMemory::sRemoteMessageHeader);
+                    ++ used;
+
+                    if ( header.rbhBufHeader.biUsed != 0 )
+                    {
+                        ASSERT(header.rbhBufHeader.biLength >= header.rbhBufHeader.biUsed);
+                        // send the aligned length.
+                        buffers[used].sbData    = msg.getBuffer();
+                        buffers[used].sbLength  = header.rbhBufHeader.biLength;
+                        ++ used;
+                    }
+                }
+
+                ends[i - first] = used;
+            }
+
+            uint32_t buffersSent{ 0 };
+            if ( used != 0 )
+            {
+                int bytes = clientSocket.sendDataVector( buffers, used, &buffersSent );
+                result = bytes >= 0 ? result + bytes : bytes;
+            }
+
+            // the skipped invalid messages are counted as sent.
+            for ( uint32_t i = first; (i < last) && (ends[i - first] <= buffersSent); ++ i )
+            {
+                ++ sent;
+            }
+        }
+    }
+
+    if ( out_sent != nullptr )
+    {
+        *out_sent = sent;
+    }
+
+    return result;
+}
+
+int SocketConnectionBase::receiveMessage(RemoteMessage & out_message, const Socket & clientSocket, bool checksum /*= true*/) const
 {
     int result{ -1 };
     if ( clientSocket.isValid() && clientSocket.isAlive() )
@@ -61,7 +125,7 @@ int SocketConnectionBase::receiveMessage(RemoteMessage & out_message, const Sock
             }
 
             out_message.moveToBegin();
-            if ( out_message.isChecksumValid() == false )
+            if ( checksum && (out_message.isChecksumValid() == false) )
             {
                 result = 0;
                 out_message.invalidate();
@@ -75,3 +139,30 @@ int SocketConnectionBase::receiveMessage(RemoteMessage & out_message, const Sock
 
     return result;
 }
+
+int SocketConnectionBase::receiveMessage( RemoteMessage & out_message, const Socket & clientSocket, MessageReceiveBuffer & recvBuffer, bool checksum /*= true*/ ) const
+{
+    int result{ -1 };
+    if ( clientSocket.isValid() )
+    {
+        out_message.invalidate();
+        result = recvBuffer.extractMessage( out_message );
+        while ( result == 0 )
+        {
+            int received = recvBuffer.receiveData( clientSocket );
+            result = received > 0 ? recvBuffer.extractMessage( out_message ) : (received < 0 ? received : -1);
+        }
+
+        if ( result > 0 )
+        {
+            out_message.moveToBegin();
+            if ( checksum && (out_message.isChecksumValid() == false) )
+            {
+                result = 0;
+                out_message.invalidate();
+            }
+        }
+    }
+
+    return result;
+}
@@ -65,6 +65,25 @@
  *              }
  **/
 
+/**
+ * \brief   The levels of AREG_LOGS_PRIO, the lowest priority of the log messages
+ *          compiled in the code. The log messages with the lower priority are
+ *          removed at compile time, the arguments of them are not evaluated and
+ *          they cannot be enabled during runtime. By default, all log messages
+ *          are compiled. To remove, for example, debug messages from the sources,
+ *          define AREG_LOGS_PRIO=AREG_LOGS_PRIO_INFO in preprocessor definitions.
+ *          The scopes are not affected, they can be still enabled during runtime.
+ **/
+#define AREG_LOGS_PRIO_DEBUG    1   //!< Compile debug and higher priority messages.
+#define AREG_LOGS_PRIO_INFO     2   //!< Compile info and higher priority messages.
+#define AREG_LOGS_PRIO_WARNING  3   //!< Compile warning and higher priority messages.
+#define AREG_LOGS_PRIO_ERROR    4   //!< Compile error and fatal error messages.
+#define AREG_LOGS_PRIO_FATAL    5   //!< Compile only fatal error messages.
+
+#ifndef AREG_LOGS_PRIO
+    #define AREG_LOGS_PRIO      AREG_LOGS_PRIO_DEBUG
+#endif  // AREG_LOGS_PRIO
+
 #if AREG_LOGS
 
 //////////////////////////////////////////////////////////////////////////
@@ -150,26 +169,52 @@
      **/
     #define LOG_SCOPE(scope)                            ScopeMessage      _messager( _##scope )
 
+    /**
+     * \brief   Returns true if the first argument of the logging macro is written as a string literal
+     *          in the source code. Only the address of such format is saved in the log record.
+     **/
+    #define AREG_LOG_IS_LITERAL(...)                    ((#__VA_ARGS__)[0] == '"')
+
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_DEBUG
     /**
      * \brief   Use this macro to log Debug priority messages in logging target (file or remote host)
      **/
-    #define LOG_DBG(...)                                if (_messager.isDbgEnabled())   _messager.logMessage( NELogging::PrioDebug    , __VA_ARGS__ )
+    #define LOG_DBG(...)                                if (_messager.isDbgEnabled())   _messager.logFormat( NELogging::PrioDebug    , AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ )
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_DEBUG
+    #define LOG_DBG(...)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_DEBUG
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_INFO
     /**
      * \brief   Use this macro to log Information priority messages in logging target (file or remote host)
      **/
-    #define LOG_INFO(...)                             if (_messager.isInfoEnabled())  _messager.logMessage( NELogging::PrioInfo     , __VA_ARGS__ )
+    #define LOG_INFO(...)                             if (_messager.isInfoEnabled())  _messager.logFormat( NELogging::PrioInfo     , AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ )
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_INFO
+    #define LOG_INFO(...)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_INFO
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_WARNING
     /**
      * \brief   Use this macro to log Warning priority messages in logging target (file or remote host)
      **/
-    #define LOG_WARN(...)                             if (_messager.isWarnEnabled())  _messager.logMessage( NELogging::PrioWarning  , __VA_ARGS__ )
+    #define LOG_WARN(...)                             if (_messager.isWarnEnabled())  _messager.logFormat( NELogging::PrioWarning  , AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ )
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_WARNING
+    #define LOG_WARN(...)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_WARNING
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_ERROR
     /**
      * \brief   Use this macro to log Error priority messages in logging target (file or remote host)
      **/
-    #define LOG_ERR(...)                              if (_messager.isErrEnabled())   _messager.logMessage( NELogging::PrioError    , __VA_ARGS__ )
+    #define LOG_ERR(...)                              if (_messager.isErrEnabled())   _messager.logFormat( NELogging::PrioError    , AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ )
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_ERROR
+    #define LOG_ERR(...)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_ERROR
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_FATAL
     /**
      * \brief   Use this macro to log Fatal Error priority messages in logging target (file or remote host)
      **/
-    #define LOG_FATAL(...)                            if (_messager.isFatalEnabled()) _messager.logMessage( NELogging::PrioFatal    , __VA_ARGS__ )
+    #define LOG_FATAL(...)                            if (_messager.isFatalEnabled()) _messager.logFormat( NELogging::PrioFatal    , AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ )
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_FATAL
+    #define LOG_FATAL(...)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_FATAL
 
     /**
      * \brief   Use this macro to define global scope and global message object.
@@ -190,36 +235,56 @@
                                                             return _messager;                           \
                                                         }
 
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_DEBUG
     /**
      * \brief   Use this macro to log Debug priority messages in logging target (file or remote host).
      *          This macro will use global scope for logging. There can be only one global scope
      *          per source file defined.
      **/
-    #define GLOBAL_DBG(...)                             _getGlobalScope().logDebug( __VA_ARGS__ )
+    #define GLOBAL_DBG(...)                             (_getGlobalScope().isDbgEnabled() ? _getGlobalScope().logFormat( NELogging::PrioDebug, AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ ) : (void)0)
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_DEBUG
+    #define GLOBAL_DBG(...)                             ((void)0)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_DEBUG
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_INFO
     /**
      * \brief   Use this macro to log Information priority messages in logging target (file or remote host)
      *          This macro will use global scope for logging. There can be only one global scope
      *          per source file defined.
      **/
-    #define GLOBAL_INFO(...)                            _getGlobalScope().logInfo( __VA_ARGS__ )
+    #define GLOBAL_INFO(...)                            (_getGlobalScope().isInfoEnabled() ? _getGlobalScope().logFormat( NELogging::PrioInfo, AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ ) : (void)0)
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_INFO
+    #define GLOBAL_INFO(...)                            ((void)0)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_INFO
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_WARNING
     /**
      * \brief   Use this macro to log Warning priority messages in logging target (file or remote host)
      *          This macro will use global scope for logging. There can be only one global scope
      *          per source file defined.
      **/
-    #define GLOBAL_WARN(...)                            _getGlobalScope().logWarning( __VA_ARGS__ )
+    #define GLOBAL_WARN(...)                            (_getGlobalScope().isWarnEnabled() ? _getGlobalScope().logFormat( NELogging::PrioWarning, AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ ) : (void)0)
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_WARNING
+    #define GLOBAL_WARN(...)                            ((void)0)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_WARNING
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_ERROR
     /**
      * \brief   Use this macro to log Error priority messages in logging target (file or remote host)
      *          This macro will use global scope for logging. There can be only one global scope
      *          per source file defined.
      **/
-    #define GLOBAL_ERR(...)                             _getGlobalScope().logError( __VA_ARGS__ )
+    #define GLOBAL_ERR(...)                             (_getGlobalScope().isErrEnabled() ? _getGlobalScope().logFormat( NELogging::PrioError, AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ ) : (void)0)
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_ERROR
+    #define GLOBAL_ERR(...)                             ((void)0)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_ERROR
+#if AREG_LOGS_PRIO <= AREG_LOGS_PRIO_FATAL
     /**
      * \brief   Use this macro to log Fatal Error priority messages in logging target (file or remote host)
      *          This macro will use global scope for logging. There can be only one global scope
      *          per source file defined.
      **/
-    #define GLOBAL_FATAL(...)                           _getGlobalScope().logFatal( __VA_ARGS__ )
+    #define GLOBAL_FATAL(...)                           (_getGlobalScope().isFatalEnabled() ? _getGlobalScope().logFormat( NELogging::PrioFatal, AREG_LOG_IS_LITERAL(__VA_ARGS__), __VA_ARGS__ ) : (void)0)
+#else   // AREG_LOGS_PRIO > AREG_LOGS_PRIO_FATAL
+    #define GLOBAL_FATAL(...)                           ((void)0)
+#endif  // AREG_LOGS_PRIO <= AREG_LOGS_PRIO_FATAL
 
 #else   // !AREG_LOGS
 
@@ -0,0 +1,370 @@
+#ifndef AREG_LOGGING_LOGBATCH_HPP
+#define AREG_LOGGING_LOGBATCH_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/LogBatch.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The encoder and decoder of the batch of log messages
+ *              to send to the log collector in one remote message.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/String.hpp"
+#include "areg/logging/NELogging.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The batch of log messages is the remote message with ID
+ * NEService::eFuncIdRange::ServiceLogMessageBatch. The data of the message
+ * starts with the version of the format, followed by the entries. Each entry
+ * starts with the type byte, and the numbers are encoded as variable-length
+ * integers with 7 bits per byte:
+ *
+ *  - The module entry:     the ID of the module, the length and the name of the module.
+ *  - The thread entry:     the index of the thread, the ID of the thread, the length and the name of the thread.
+ *  - The message entry:    the type, the priority, the index of the thread, the difference of the
+ *                          timestamp with the previous message of the batch, the duration, the scope ID,
+ *                          the session ID, the source, the target, the length and the text of the message.
+ *
+ * The names of the module and threads are sent once per connection, the
+ * messages refer to the threads by index. The cookie of the log source is
+ * the source of the remote message.
+ **/
+
+//////////////////////////////////////////////////////////////////////////////
+// LogBatchEncoder class declaration
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The encoder of the batch of log messages. The encoder appends the
+ *          log messages in the buffer and interns the names of the module and
+ *          threads, so that each name is written only once per connection.
+ *          The object is not thread safe.
+ **/
+class AREG_API LogBatchEncoder
+{
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The version of the format of the batch of log messages.
+     **/
+    static constexpr unsigned char  BATCH_VERSION       { 1 };
+
+    /**
+     * \brief   The maximum number of interned names of threads. If the number
+     *          of threads exceeds, the interned names are reset.
+     **/
+    static constexpr uint32_t       MAX_THREAD_NAMES    { 1'024 };
+
+private:
+    /**
+     * \brief   The maximum size in bytes of the encoded entry.
+     **/
+    static constexpr uint32_t       MAX_ENTRY_SIZE      { 512 };
+
+    /**
+     * \brief   LogBatchEncoder::sThreadName
+     *          The interned name of the thread.
+     **/
+    struct sThreadName
+    {
+        id_type     threadId;   //!< The ID of the thread.
+        String      threadName; //!< The name of the thread.
+        bool        isExpired;  //!< The flag, indicating that the name should be checked again.
+    };
+
+//////////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////////
+public:
+    LogBatchEncoder( void );
+
+    ~LogBatchEncoder( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Appends the log message in the batch. If the names of the module or
+     *          thread of the message are not interned yet, appends the names before
+     *          the message.
+     * \param   logMessage  The log message to append.
+     **/
+    void addMessage( const NELogging::sLogMessage & logMessage );
+
+    /**
+     * \brief   Appends the names of the module and all interned threads in the batch.
+     *          Called when the receivers of the batches may not know the interned names,
+     *          for example, when the connection is established again or new observer is connected.
+     **/
+    void defineNames( void );
+
+    /**
+     * \brief   Removes the interned names, so that the names are written again.
+     **/
+    void resetNames( void );
+
+    /**
+     * \brief   Creates the remote message of the batch and starts new batch.
+     *          Returns invalid message if the batch is empty.
+     * \param   source  The cookie of the log source to set in the message.
+     **/
+    RemoteMessage createBatch( const ITEM_ID & source );
+
+    /**
+     * \brief   Removes the messages of the batch and keeps the interned names.
+     **/
+    void clearBatch( void );
+
+    /**
+     * \brief   Returns true if the batch has no data.
+     **/
+    inline bool isEmpty( void ) const;
+
+    /**
+     * \brief   Returns the size in bytes of the encoded data of the batch.
+     **/
+    inline uint32_t getSize( void ) const;
+
+    /**
+     * \brief   Returns the number of log messages in the batch.
+     **/
+    inline uint32_t getCount( void ) const;
+
+//////////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Reserves the space to write the entry, and writes the version if the batch is empty.
+     **/
+    void _beginEntry( void );
+
+    /**
+     * \brief   Writes the entry of the name of the module.
+     **/
+    void _writeModule( void );
+
+    /**
+     * \brief   Writes the entry of the name of the thread of the specified index.
+     **/
+    void _writeThread( uint32_t index );
+
+    /**
+     * \brief   Returns the index of the interned thread. Interns the thread if it is not interned yet.
+     **/
+    uint32_t _getThreadIndex( id_type threadId );
+
+//////////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The buffer of the encoded data of the batch.
+    std::vector<unsigned char>              mBuffer;
+    //!< The interned names of threads.
+    std::vector<sThreadName>                mThreads;
+    //!< The indexes of the interned threads.
+    std::unordered_map<id_type, uint32_t>   mThreadIndex;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    //!< The size in bytes of the encoded data.
+    uint32_t    mSize;
+    //!< The number of log messages in the batch.
+    uint32_t    mCount;
+    //!< The timestamp of the last log message in the batch.
+    TIME64      mTimestamp;
+    //!< The number of unregistered threads when the names of threads were checked.
+    uint32_t    mThreadsUnregistered;
+    //!< The flag, indicating whether the name of the module is interned.
+    bool        mModuleDefined;
+    //!< The ID of the interned module.
+    ITEM_ID     mModuleId;
+    //!< The name of the interned module.
+    String      mModuleName;
+
+//////////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LogBatchEncoder );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// LogBatchDecoder class declaration
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The decoder of the batches of log messages. The decoder keeps the
+ *          names of modules and threads of each log source, defined in the
+ *          batches, and restores the log messages with the names.
+ *          The object is not thread safe.
+ **/
+class AREG_API LogBatchDecoder
+{
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   LogBatchDecoder::sThreadName
+     *          The name of the thread of the log source.
+     **/
+    struct sThreadName
+    {
+        id_type     threadId;   //!< The ID of the thread.
+        String      threadName; //!< The name of the thread.
+    };
+
+    /**
+     * \brief   LogBatchDecoder::sSourceNames
+     *          The names of the module and threads of the log source.
+     **/
+    struct sSourceNames
+    {
+        ITEM_ID                     moduleId;   //!< The ID of the module.
+        String                      moduleName; //!< The name of the module.
+        std::vector<sThreadName>    threads;    //!< The names of threads, accessed by index.
+    };
+
+//////////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////////
+public:
+    LogBatchDecoder( void );
+
+    ~LogBatchDecoder( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Starts decoding the batch of log messages.
+     * \param   msgBatch    The remote message with the batch of log messages.
+     * \return  Returns false if the message is not a batch of log messages,
+     *          or the format of the batch is not supported.
+     **/
+    bool startBatch( const RemoteMessage & msgBatch );
+
+    /**
+     * \brief   Decodes the next log message of the batch. The names of the module
+     *          and threads defined in the batch are saved for the log source.
+     *          If the name of the thread is not known, the thread ID and name are empty.
+     * \param   logMessage  On output, contains the decoded log message.
+     * \return  Returns true if decoded the message. Returns false if there are no
+     *          more messages, or the data of the batch is corrupted.
+     **/
+    bool nextMessage( NELogging::sLogMessage & logMessage );
+
+    /**
+     * \brief   Creates the remote message of a single log message with the source
+     *          and target of the current batch.
+     * \param   logMessage  The decoded log message.
+     **/
+    RemoteMessage createLogMessage( const NELogging::sLogMessage & logMessage ) const;
+
+    /**
+     * \brief   Removes the names of the module and threads of the log source.
+     *          Called when the log source is disconnected.
+     * \param   source  The cookie of the log source.
+     **/
+    void removeSource( const ITEM_ID & source );
+
+    /**
+     * \brief   Removes the names of all log sources.
+     **/
+    void clear( void );
+
+//////////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Reads the variable-length integer. Returns false if the data is corrupted.
+     **/
+    bool _readNumber( uint64_t & value );
+
+    /**
+     * \brief   Reads the length and the text. Returns false if the data is corrupted.
+     **/
+    bool _readText( const char * & text, uint32_t & length );
+
+    /**
+     * \brief   Stops decoding the batch.
+     **/
+    inline bool _stopBatch( void );
+
+//////////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The names of the modules and threads of log sources.
+    std::unordered_map<ITEM_ID, sSourceNames>   mSources;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    //!< The batch of log messages to decode.
+    RemoteMessage   mBatch;
+    //!< The names of the source of the batch.
+    sSourceNames *  mNames;
+    //!< The position of the next entry to decode.
+    uint32_t        mPosition;
+    //!< The timestamp of the last decoded log message.
+    TIME64          mTimestamp;
+
+//////////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LogBatchDecoder );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// LogBatchEncoder class inline methods
+//////////////////////////////////////////////////////////////////////////////
+
+inline bool LogBatchEncoder::isEmpty( void ) const
+{
+    return (mSize == 0u);
+}
+
+inline uint32_t LogBatchEncoder::getSize( void ) const
+{
+    return mSize;
+}
+
+inline uint32_t LogBatchEncoder::getCount( void ) const
+{
+    return mCount;
+}
+
+#endif  // AREG_LOGGING_LOGBATCH_HPP
@@ -216,6 +216,98 @@ public:
     void setDatabaseUser(const NESocket::UserData& dbUser, bool isTemporary = false);
     void setDatabaseUser(const String& dbUserName, const String& dbUserPassword, bool isTemporary = false);
 
+    /**
+     * \brief   Gets and sets the maximum number of log rows inserted in one database transaction.
+     *          The value 1 means that each log is inserted in the database immediately.
+     **/
+    uint32_t getDatabaseBatch(void) const;
+    void setDatabaseBatch(uint32_t batchRows, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the timeout in milliseconds to commit pending log rows in the database.
+     **/
+    uint32_t getDatabaseFlush(void) const;
+    void setDatabaseFlush(uint32_t flushTimeout, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the journal mode of the log database, for example `wal` or `delete`.
+     **/
+    String getDatabaseJournal(void) const;
+    void setDatabaseJournal(const String& journalMode, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the synchronous mode of the log database, for example `normal` or `full`.
+     **/
+    String getDatabaseSync(void) const;
+    void setDatabaseSync(const String& syncMode, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the flag to enable the full-text search index of the log database.
+     **/
+    bool getDatabaseSearch(void) const;
+    void setDatabaseSearch(bool isEnabled, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the size in bytes of the ring buffer of log records created for each logging thread.
+     *          If the size is not set, the default size NELogging::LOG_RING_SIZE is used.
+     **/
+    uint32_t getRingSize(void) const;
+    void setRingSize(uint32_t ringSize, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the policy of the logging thread when its ring buffer of log records is full.
+     **/
+    NELogging::eLogOverflow getRingOverflow(void) const;
+    void setRingOverflow(NELogging::eLogOverflow overflow, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the size in bytes of the buffer to write logs in the file.
+     *          If the size is not set, the default size NELogging::LOG_FILE_BUFFER_SIZE is used.
+     **/
+    uint32_t getFileBuffer(void) const;
+    void setFileBuffer(uint32_t bufferSize, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the timeout in milliseconds to write buffered logs in the file.
+     *          If the timeout is not set, the default timeout NELogging::LOG_FILE_FLUSH_TIMEOUT is used.
+     **/
+    uint32_t getFileFlush(void) const;
+    void setFileFlush(uint32_t flushTimeout, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the size in bytes of the log file to rotate. The value 0 disables the rotation by size.
+     **/
+    uint64_t getFileMaxSize(void) const;
+    void setFileMaxSize(uint64_t maxSize, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the period in seconds to rotate the log file. The value 0 disables the rotation by time.
+     **/
+    uint32_t getFilePeriod(void) const;
+    void setFilePeriod(uint32_t period, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the flag to compress rotated log files in gzip format.
+     **/
+    bool getFileCompress(void) const;
+    void setFileCompress(bool compress, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the size in bytes of the batch of log messages sent to the log collector.
+     *          The value 0 disables the batching and every message is sent separately.
+     *          If the size is not set, the default size NELogging::LOG_REMOTE_BATCH_SIZE is used.
+     **/
+    uint32_t getRemoteBatch(void) const;
+    void setRemoteBatch(uint32_t batchSize, bool isTemporary = false);
+
+    /**
+     * \brief   Gets and sets the timeout in milliseconds to send the incomplete batch of log messages.
+     *          The value 0 sends the batch when the logging thread has no more messages to log.
+     *          If the timeout is not set, the default timeout NELogging::LOG_REMOTE_LINGER is used.
+     **/
+    uint32_t getRemoteLinger(void) const;
+    void setRemoteLinger(uint32_t linger, bool isTemporary = false);
+
     /**
      * \brief   Saves the configuration in the current config file.
      **/
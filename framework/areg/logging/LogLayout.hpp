@@ -0,0 +1,251 @@
+#ifndef AREG_LOGGING_LOGLAYOUT_HPP
+#define AREG_LOGGING_LOGLAYOUT_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/LogLayout.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The compiled layout to format log messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/String.hpp"
+#include "areg/logging/NELogging.hpp"
+
+#include <vector>
+
+#if AREG_LOGS
+
+//////////////////////////////////////////////////////////////////////////////
+// LogLayout class declaration
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The layout of log messages, compiled from the layout format string
+ *          like '%d: [ %t  %p >>> ] %m%n' into the flat list of operations.
+ *          The layout renders the log message directly in the buffer of the
+ *          caller, without creating temporary strings.
+ *
+ *          To avoid the conversion of the timestamp on each message, the layout
+ *          keeps the formatted date and time of the last rendered second and
+ *          renders only the milliseconds. The names of local threads are cached
+ *          by thread ID, and the name and the ID of the local module are
+ *          formatted once when the layout is compiled.
+ *
+ *          The object is not thread safe, since the rendering updates caches.
+ **/
+class AREG_API LogLayout
+{
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   LogLayout::eOperation
+     *          The operations of the compiled layout.
+     **/
+    enum class eOperation : uint8_t
+    {
+          OpText        = 0 //!< Outputs the text of the layout format.
+        , OpCookieId        //!< Outputs the cookie ID of the source of the message.
+        , OpTickCount       //!< Outputs the tick count since the process start.
+        , OpDayTime         //!< Outputs the date and time of the message.
+        , OpModuleId        //!< Outputs the ID of the module.
+        , OpMessage         //!< Outputs the text of the message.
+        , OpEndOfLine       //!< Outputs the end of line character.
+        , OpPriority        //!< Outputs the priority of the message.
+        , OpScopeId         //!< Outputs the ID of the scope.
+        , OpThreadId        //!< Outputs the ID of the thread.
+        , OpModuleName      //!< Outputs the name of the module.
+        , OpThreadName      //!< Outputs the name of the thread.
+        , OpScopeName       //!< Outputs the name of the scope.
+    };
+
+    /**
+     * \brief   LogLayout::sOperation
+     *          The operation of the compiled layout. The text operations
+     *          refer to the text of the layout format, saved in the layout.
+     **/
+    struct sOperation
+    {
+        eOperation  opCode;     //!< The operation code.
+        uint32_t    textPos;    //!< The position of the text, valid only for text operation.
+        uint32_t    textLen;    //!< The length of the text, valid only for text operation.
+    };
+
+    /**
+     * \brief   The maximum length of the thread and module names reserved in the rendered message.
+     *          The names are truncated if they do not fit in the buffer.
+     **/
+    static constexpr uint32_t   MAX_NAME_LENGTH     { 256 };
+
+private:
+    /**
+     * \brief   The number of cached names of threads.
+     **/
+    static constexpr uint32_t   THREAD_CACHE_SIZE   { 64 };
+
+    /**
+     * \brief   LogLayout::sThreadName
+     *          The cached name of the thread.
+     **/
+    struct sThreadName
+    {
+        id_type     threadId;   //!< The ID of the thread.
+        String      threadName; //!< The name of the thread.
+    };
+
+//////////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////////
+public:
+    LogLayout( void );
+
+    ~LogLayout( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Compiles the layout format string into the list of operations.
+     *          The message '%m' and the scope name '%z' are exclusive, only
+     *          the first of them is compiled. The '%%' is compiled as '%',
+     *          and the unknown specifiers are compiled as text.
+     * \param   layoutFormat    The layout format string to compile.
+     * \return  Returns true if the compiled layout contains at least one operation.
+     **/
+    bool compile( const char * layoutFormat );
+
+    /**
+     * \brief   Removes the compiled operations and clears the caches.
+     **/
+    void clear( void );
+
+    /**
+     * \brief   Renders the log message in the buffer. The message with the priority
+     *          NELogging::PrioIgnoreLayout is copied without layout. If the buffer
+     *          is not big enough, the rendered message is truncated.
+     *          The rendered message is not null-terminated.
+     * \param   logMsg  The log message to render.
+     * \param   buffer  The buffer to render the message.
+     * \param   size    The size in bytes of the buffer.
+     * \return  Returns the number of rendered characters.
+     **/
+    uint32_t renderMessage( const NELogging::sLogMessage & logMsg, char * buffer, uint32_t size );
+
+    /**
+     * \brief   Returns true if the layout contains at least one operation.
+     **/
+    inline bool isValid( void ) const;
+
+    /**
+     * \brief   Returns the size in bytes of the buffer to render any message
+     *          with this layout, assuming that the names of thread and module
+     *          are not longer than LogLayout::MAX_NAME_LENGTH.
+     **/
+    inline uint32_t getMaxLength( void ) const;
+
+    /**
+     * \brief   Returns the list of compiled operations.
+     **/
+    inline const std::vector<sOperation> & getOperations( void ) const;
+
+//////////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Adds the text operation, if the text is not empty.
+     **/
+    void _addText( const char * text, uint32_t length );
+
+    /**
+     * \brief   Adds the operation, which outputs the data of the log message.
+     **/
+    void _addOperation( eOperation opCode, uint32_t maxLength );
+
+    /**
+     * \brief   Renders the date and time of the timestamp, using the cached date and time of the second.
+     **/
+    uint32_t _renderDayTime( TIME64 timestamp, char * buffer, uint32_t size );
+
+    /**
+     * \brief   Returns the cached name of the local thread.
+     **/
+    const String & _getThreadName( id_type threadId );
+
+//////////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////////
+private:
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(disable: 4251)
+#endif  // _MSC_VER
+
+    //!< The list of compiled operations.
+    std::vector<sOperation> mOperations;
+    //!< The cached names of the local threads.
+    std::vector<sThreadName> mThreadNames;
+
+#if defined(_MSC_VER) && (_MSC_VER > 1200)
+    #pragma warning(default: 4251)
+#endif  // _MSC_VER
+
+    //!< The number of unregistered threads when the names of threads were cached.
+    uint32_t    mThreadsUnregistered;
+    //!< The text of the layout format, referred by text operations.
+    String      mText;
+    //!< The maximum length of the rendered message.
+    uint32_t    mMaxLength;
+    //!< The name of the local module.
+    String      mModuleName;
+    //!< The ID of the local module.
+    ITEM_ID     mModuleId;
+    //!< The formatted ID of the local module.
+    String      mModuleIdText;
+    //!< The second of the cached date and time.
+    uint64_t    mTimeSecond;
+    //!< The length of the cached date and time.
+    uint32_t    mTimeLength;
+    //!< The cached date and time of the second, followed by the milliseconds.
+    char        mTimeText[32];
+
+//////////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LogLayout );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// LogLayout class inline methods
+//////////////////////////////////////////////////////////////////////////////
+
+inline bool LogLayout::isValid( void ) const
+{
+    return (mOperations.empty( ) == false);
+}
+
+inline uint32_t LogLayout::getMaxLength( void ) const
+{
+    return mMaxLength;
+}
+
+inline const std::vector<LogLayout::sOperation> & LogLayout::getOperations( void ) const
+{
+    return mOperations;
+}
+
+#endif  // AREG_LOGS
+
+#endif  // AREG_LOGGING_LOGLAYOUT_HPP
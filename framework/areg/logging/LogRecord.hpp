@@ -0,0 +1,306 @@
+#ifndef AREG_LOGGING_LOGRECORD_HPP
+#define AREG_LOGGING_LOGRECORD_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/LogRecord.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Binary log record with deferred formatting.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/logging/NELogging.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/String.hpp"
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if AREG_LOGS
+
+//////////////////////////////////////////////////////////////////////////////
+// LogRecord class declaration
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The binary log record, which keeps the address of the static format
+ *          string and the raw bytes of the arguments instead of the formatted text.
+ *          The record is created on the thread that logs the message, and the
+ *          text is formatted later in the logging thread before it is passed
+ *          to the logging targets. This keeps the formatting of the message
+ *          out of the application threads.
+ *
+ *          The format string must be a string literal or other static string,
+ *          since it is accessed in the logging thread. The arguments are copied
+ *          in the record, including the text of the string arguments.
+ *          The format follows the rules of 'printf'.
+ **/
+class AREG_API LogRecord
+{
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   LogRecord::eArgType
+     *          The types of arguments saved in the record.
+     **/
+    enum class eArgType : uint8_t
+    {
+          ArgInvalid    = 0 //!< Invalid argument
+        , ArgSigned         //!< Signed integer, saved as 64-bit value.
+        , ArgUnsigned       //!< Unsigned integer, saved as 64-bit value.
+        , ArgDouble         //!< Floating point value, saved as double.
+        , ArgPointer        //!< Pointer, saved as 64-bit value.
+        , ArgString         //!< String, saved as 16-bit length and the text without null-character.
+    };
+
+    /**
+     * \brief   LogRecord::sRecordHeader
+     *          The header of log record, followed by the arguments.
+     **/
+    struct sRecordHeader
+    {
+        const char *            recFormat;      //!< The static format string, which is the ID of the format of the record. If nullptr, the format is the first string argument.
+        ITEM_ID                 recCookie;      //!< The cookie of the logging source.
+        ITEM_ID                 recThreadId;    //!< The ID of the thread that created the record.
+        TIME64                  recTimestamp;   //!< The timestamp when the record is created.
+        unsigned int            recDuration;    //!< The duration in microseconds after scope message is instantiated.
+        unsigned int            recScopeId;     //!< The ID of log scope that created the record.
+        unsigned int            recSessionId;   //!< The session ID of the scope message.
+        NELogging::eLogPriority recPrio;        //!< The priority of the log message.
+        NELogging::eLogMessageType recMsgType;  //!< The type of the log message.
+    };
+
+    /**
+     * \brief   The maximum size in bytes of the log record.
+     **/
+    static constexpr uint32_t   RECORD_SIZE     { 512 };
+
+//////////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Initializes the header of log record.
+     * \param   scopeId     The ID of the log scope.
+     * \param   sessionId   The ID of the session of the scope message.
+     * \param   scopeStamp  The timestamp of the scope message to calculate duration.
+     *                      The duration is 0 if the scopeStamp is 0.
+     * \param   msgPrio     The priority of the log message.
+     * \param   format      The static format string of the log message.
+     * \param   msgType     The type of the log message, either text or enter and exit scope.
+     **/
+    LogRecord( unsigned int scopeId
+             , unsigned int sessionId
+             , TIME64 scopeStamp
+             , NELogging::eLogPriority msgPrio
+             , const char * format
+             , NELogging::eLogMessageType msgType = NELogging::eLogMessageType::LogMessageText );
+
+    /**
+     * \brief   Initializes the header of log record and copies the text of the format
+     *          in the record. Use it if the format string is not static and may not
+     *          exist when the record is formatted in the logging thread.
+     * \param   scopeId     The ID of the log scope.
+     * \param   sessionId   The ID of the session of the scope message.
+     * \param   scopeStamp  The timestamp of the scope message to calculate duration.
+     *                      The duration is 0 if the scopeStamp is 0.
+     * \param   msgPrio     The priority of the log message.
+     * \param   format      The format of the log message to copy in the record.
+     **/
+    LogRecord( unsigned int scopeId
+             , unsigned int sessionId
+             , TIME64 scopeStamp
+             , NELogging::eLogPriority msgPrio
+             , const std::string_view & format );
+
+    ~LogRecord( void ) = default;
+
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Saves the arguments of the log message in the record.
+     **/
+    template<typename ... Args>
+    inline LogRecord & addArguments( const Args & ... args );
+
+    /**
+     * \brief   Saves one argument of the log message in the record.
+     *          Integers, enumerations, floating point values, pointers
+     *          and strings are supported.
+     **/
+    template<typename Type>
+    inline void addArgument( const Type & arg );
+
+    /**
+     * \brief   Sends the log record to the logging thread. The record is written
+     *          in the ring buffer of log records of the calling thread.
+     **/
+    void sendRecord( void ) const;
+
+    /**
+     * \brief   Returns the data of the record.
+     **/
+    inline const unsigned char * getData( void ) const;
+
+    /**
+     * \brief   Returns the size in bytes of the record.
+     **/
+    inline uint32_t getSize( void ) const;
+
+    /**
+     * \brief   Formats the text of the log record and sets the data of log message.
+     * \param   record      The data of the log record.
+     * \param   size        The size in bytes of the log record.
+     * \param   logMessage  On output, contains the log message with formatted text.
+     * \return  Returns the length of the formatted text.
+     **/
+    static uint32_t formatRecord( const unsigned char * record, uint32_t size, NELogging::sLogMessage & OUT logMessage );
+
+//////////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Saves the argument of the fixed size.
+     **/
+    inline void _writeValue( LogRecord::eArgType argType, uint64_t value );
+
+    /**
+     * \brief   Saves the string argument. The string is truncated if
+     *          it does not fit the record.
+     **/
+    void _writeString( const char * text, uint32_t length );
+
+    /**
+     * \brief   Returns instance of the object.
+     **/
+    inline LogRecord & self( void );
+
+//////////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////////
+private:
+    uint32_t        mSize;                  //!< The used size of the record.
+    unsigned char   mRecord[RECORD_SIZE];   //!< The data of the record.
+
+//////////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    LogRecord( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( LogRecord );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// LogRecord class inline methods
+//////////////////////////////////////////////////////////////////////////////
+
+template<typename ... Args>
+inline LogRecord & LogRecord::addArguments( const Args & ... args )
+{
+    ( addArgument( args ), ... );
+    return self();
+}
+
+template<typename Type>
+inline void LogRecord::addArgument( const Type & arg )
+{
+    using ArgType = std::decay_t<Type>;
+
+    if constexpr ( std::is_same_v<ArgType, char *> || std::is_same_v<ArgType, const char *> )
+    {
+        const char * text{ arg };
+        if ( text != nullptr )
+        {
+            _writeString( text, static_cast<uint32_t>(NEString::getStringLength<char>(text)) );
+        }
+        else
+        {
+            _writeValue( eArgType::ArgPointer, 0u );
+        }
+    }
+    else if constexpr ( std::is_same_v<ArgType, String> )
+    {
+        _writeString( arg.getString(), static_cast<uint32_t>(arg.getLength()) );
+    }
+    else if constexpr ( std::is_same_v<ArgType, std::string> || std::is_same_v<ArgType, std::string_view> )
+    {
+        _writeString( arg.data(), static_cast<uint32_t>(arg.size()) );
+    }
+    else if constexpr ( std::is_enum_v<ArgType> )
+    {
+        using Underlying = std::underlying_type_t<ArgType>;
+        _writeValue( std::is_signed_v<Underlying> ? eArgType::ArgSigned : eArgType::ArgUnsigned
+                   , std::is_signed_v<Underlying> ? static_cast<uint64_t>(static_cast<int64_t>(arg)) : static_cast<uint64_t>(arg) );
+    }
+    else if constexpr ( std::is_integral_v<ArgType> && std::is_signed_v<ArgType> )
+    {
+        _writeValue( eArgType::ArgSigned, static_cast<uint64_t>(static_cast<int64_t>(arg)) );
+    }
+    else if constexpr ( std::is_integral_v<ArgType> )
+    {
+        _writeValue( eArgType::ArgUnsigned, static_cast<uint64_t>(arg) );
+    }
+    else if constexpr ( std::is_floating_point_v<ArgType> )
+    {
+        const double value{ static_cast<double>(arg) };
+        uint64_t bits{ 0 };
+        NEMemory::memCopy( reinterpret_cast<unsigned char *>(&bits), sizeof(uint64_t), reinterpret_cast<const unsigned char *>(&value), sizeof(double) );
+        _writeValue( eArgType::ArgDouble, bits );
+    }
+    else if constexpr ( std::is_null_pointer_v<ArgType> )
+    {
+        _writeValue( eArgType::ArgPointer, 0u );
+    }
+    else if constexpr ( std::is_pointer_v<ArgType> )
+    {
+        _writeValue( eArgType::ArgPointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg)) );
+    }
+    else
+    {
+        static_assert( std::is_pointer_v<ArgType>, "The type of the log argument is not supported." );
+    }
+}
+
+inline void LogRecord::_writeValue( LogRecord::eArgType argType, uint64_t value )
+{
+    if ( (mSize + sizeof(uint8_t) + sizeof(uint64_t)) <= RECORD_SIZE )
+    {
+        mRecord[mSize ++] = static_cast<unsigned char>(argType);
+        NEMemory::memCopy( mRecord + mSize, sizeof(uint64_t), reinterpret_cast<const unsigned char *>(&value), sizeof(uint64_t) );
+        mSize += sizeof(uint64_t);
+    }
+}
+
+inline const unsigned char * LogRecord::getData( void ) const
+{
+    return mRecord;
+}
+
+inline uint32_t LogRecord::getSize( void ) const
+{
+    return mSize;
+}
+
+inline LogRecord & LogRecord::self( void )
+{
+    return (*this);
+}
+
+#endif  // AREG_LOGS
+
+#endif  // AREG_LOGGING_LOGRECORD_HPP
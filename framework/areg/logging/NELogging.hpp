@@ -88,6 +88,31 @@ namespace NELogging
     //!< The list of scope update structure.
     using ScopeNames    = TEArrayList<sScopeInfo>;
 
+    /**
+     * \brief   NELogging::sObserverFilter
+     *          The filter of log messages, which the log collector forwards to the log observer.
+     *          The log message is forwarded if it matches all criteria of the filter.
+     *          The empty criteria match any log message.
+     **/
+    struct sObserverFilter
+    {
+        /**
+         * \brief   Default constructor. Creates filter, which matches any log message.
+         **/
+        inline sObserverFilter(void);
+
+        /**
+         * \brief   Returns true if the filter matches any log message.
+         **/
+        inline bool isEmpty(void) const;
+
+        TEArrayList<ITEM_ID>    ofInstances;    //!< The cookies of log sources. If empty, matches messages of any log source.
+        TEArrayList<uint32_t>   ofScopes;       //!< The IDs of scopes. If empty and no prefix is set, matches messages of any scope.
+        String                  ofScopePrefix;  //!< The prefix of the names of scopes, like 'areg_base_'. Ignored if empty.
+        uint32_t                ofPriorities;   //!< The bitwise combination of priorities. If 0 (PrioInvalid), matches messages of any priority.
+        String                  ofText;         //!< The text, which the message should contain. Ignored if empty.
+    };
+
     /**
      * \brief   NELogging::eLogingTypes
      *          The logging types in AREG framework
@@ -283,6 +308,66 @@ namespace NELogging
         , LogDataRemote         = 1 //!< The message data is prepared for remote logging.
     };
 
+    /**
+     * \brief   NELogging::eLogOverflow
+     *          The policy of the logging thread when its ring buffer of log records is full.
+     **/
+    enum class eLogOverflow : unsigned char
+    {
+          OverflowBlock         = 0 //!< The logging thread waits until the logger frees the space in the ring buffer.
+        , OverflowDropNewest    = 1 //!< The new log record is dropped.
+        , OverflowDropOldest    = 2 //!< The oldest log records are dropped to free the space in the ring buffer.
+    };
+
+    /**
+     * \brief   The string values of the overflow policies of the ring buffer of log records.
+     **/
+    constexpr std::string_view  OVERFLOW_BLOCK_STR          { "block" };
+    constexpr std::string_view  OVERFLOW_DROP_NEWEST_STR    { "drop-newest" };
+    constexpr std::string_view  OVERFLOW_DROP_OLDEST_STR    { "drop-oldest" };
+
+    /**
+     * \brief   NELogging::LOG_RING_SIZE
+     *          The default size in bytes of the ring buffer of log records of each thread.
+     **/
+    constexpr uint32_t  LOG_RING_SIZE   { 65'536 };
+
+    /**
+     * \brief   NELogging::LOG_FILE_BUFFER_SIZE
+     *          The default size in bytes of the buffer to write logs in the file.
+     **/
+    constexpr uint32_t  LOG_FILE_BUFFER_SIZE    { 65'536 };
+
+    /**
+     * \brief   NELogging::LOG_FILE_FLUSH_TIMEOUT
+     *          The default timeout in milliseconds to write buffered logs in the file.
+     **/
+    constexpr uint32_t  LOG_FILE_FLUSH_TIMEOUT  { 500 };
+
+    /**
+     * \brief   NELogging::LOG_REMOTE_BATCH_SIZE
+     *          The default size in bytes of the batch of log messages to send to the log collector.
+     **/
+    constexpr uint32_t  LOG_REMOTE_BATCH_SIZE   { 16'384 };
+
+    /**
+     * \brief   NELogging::LOG_REMOTE_LINGER
+     *          The default timeout in milliseconds to send the incomplete batch of log messages.
+     **/
+    constexpr uint32_t  LOG_REMOTE_LINGER       { 50 };
+
+    /**
+     * \brief   Returns string value of NELogging::eLogOverflow.
+     **/
+    inline const char * overflowToString( NELogging::eLogOverflow overflow );
+
+    /**
+     * \brief   From given string value returns the overflow policy of the ring buffer of log records.
+     *          The string values should be `block`, `drop-newest` or `drop-oldest`.
+     *          If the string value is not valid, returns NELogging::eLogOverflow::OverflowBlock.
+     **/
+    inline NELogging::eLogOverflow stringToOverflow( const String & overflow );
+
     /**
      * \brief   NELogging::sLogMessage
      *          The structure of logging message object to output on target (log collector or observer).
@@ -580,6 +665,15 @@ namespace NELogging
      **/
     AREG_API RemoteMessage messageConfigurationSaved(void);
 
+    /**
+     * \brief   Creates a message to set the filter of log messages, which the log collector forwards to the log observer.
+     *          The filter replaces the previous filter of the observer. The empty filter forwards all log messages.
+     * \param   source      The ID of the log observer that generated the message.
+     * \param   filter      The filter of log messages to set.
+     * \return  Returns generated message ready to send to the log collector.
+     **/
+    AREG_API RemoteMessage messageObserverFilter(const ITEM_ID & source, const NELogging::sObserverFilter & filter);
+
     /**
      * \brief   Call to set external logging database engine.
      **/
@@ -646,6 +740,28 @@ inline IEOutStream& operator << (IEOutStream& stream, const NELogging::sScopeInf
     return stream;
 }
 
+/**
+ * \brief   De-serializes the filter of log messages of the observer from the stream.
+ * \param   stream  The source of data that contains the filter of log messages.
+ * \param   input   On output this contains the filter of log messages.
+ **/
+inline const IEInStream& operator >> (const IEInStream& stream, NELogging::sObserverFilter & input)
+{
+    stream >> input.ofInstances >> input.ofScopes >> input.ofScopePrefix >> input.ofPriorities >> input.ofText;
+    return stream;
+}
+
+/**
+ * \brief   Serializes the filter of log messages of the observer to the stream.
+ * \param   stream  The streaming object to save the filter of log messages.
+ * \param   output  The source of the filter of log messages to serialize.
+ **/
+inline IEOutStream& operator << (IEOutStream& stream, const NELogging::sObserverFilter & output)
+{
+    stream << output.ofInstances << output.ofScopes << output.ofScopePrefix << output.ofPriorities << output.ofText;
+    return stream;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // NELogging namespace inline methods
 //////////////////////////////////////////////////////////////////////////////
@@ -702,6 +818,24 @@ inline NELogging::sScopeInfo::sScopeInfo(const char* name, uint32_t id, uint32_t
 {
 }
 
+inline NELogging::sObserverFilter::sObserverFilter(void)
+    : ofInstances   ( )
+    , ofScopes      ( )
+    , ofScopePrefix ( )
+    , ofPriorities  ( static_cast<uint32_t>(NELogging::eLogPriority::PrioInvalid) )
+    , ofText        ( )
+{
+}
+
+inline bool NELogging::sObserverFilter::isEmpty(void) const
+{
+    return ( ofInstances.isEmpty()  &&
+             ofScopes.isEmpty()     &&
+             ofScopePrefix.isEmpty()&&
+             (ofPriorities == static_cast<uint32_t>(NELogging::eLogPriority::PrioInvalid)) &&
+             ofText.isEmpty() );
+}
+
 inline bool NELogging::isValidLogPriority( NELogging::eLogPriority prio )
 {
     return (static_cast<unsigned int>(prio) & static_cast<unsigned int>(NELogging::eLogPriority::PrioValid)) != 0;
@@ -778,4 +912,28 @@ inline NELogging::eLogPriority NELogging::stringToLogPrio(const String& prio)
         return NELogging::eLogPriority::PrioIgnoreLayout;
 }
 
+inline const char * NELogging::overflowToString( NELogging::eLogOverflow overflow )
+{
+    switch ( overflow )
+    {
+    case NELogging::eLogOverflow::OverflowDropNewest:
+        return NELogging::OVERFLOW_DROP_NEWEST_STR.data();
+    case NELogging::eLogOverflow::OverflowDropOldest:
+        return NELogging::OVERFLOW_DROP_OLDEST_STR.data();
+    case NELogging::eLogOverflow::OverflowBlock:    // fall through
+    default:
+        return NELogging::OVERFLOW_BLOCK_STR.data();
+    }
+}
+
+inline NELogging::eLogOverflow NELogging::stringToOverflow( const String & overflow )
+{
+    if ( overflow == NELogging::OVERFLOW_DROP_NEWEST_STR )
+        return NELogging::eLogOverflow::OverflowDropNewest;
+    else if ( overflow == NELogging::OVERFLOW_DROP_OLDEST_STR )
+        return NELogging::eLogOverflow::OverflowDropOldest;
+    else
+        return NELogging::eLogOverflow::OverflowBlock;
+}
+
 #endif  // AREG_LOGGING_NELOGGING_HPP
@@ -19,6 +19,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/logging/NELogging.hpp"
+#include "areg/logging/LogRecord.hpp"
 #include <stdarg.h>
 
 /************************************************************************
@@ -121,6 +122,56 @@ public:
      **/
     void logMessage( NELogging::eLogPriority logPrio, const char * format, ...);
 
+    /**
+     * \brief   Logs a message with the specified priority, bypassing the priority check.
+     *          The address of the format string literal and the arguments are saved in
+     *          the binary log record, and the message is formatted later in the logging thread.
+     *          The format must be a string literal, which exists until the application exits.
+     * \param   logPrio The priority of the message.
+     * \param   format  The string literal with the format of the message.
+     * \param   args    The arguments of the message to format.
+     **/
+    template<uint32_t Size, typename ... Args>
+    inline void logLiteral( NELogging::eLogPriority logPrio, const char (&format)[Size], const Args & ... args ) const;
+
+    /**
+     * \brief   Logs a message with the specified priority, bypassing the priority check.
+     *          The format may be a character array on the stack or other buffer, which
+     *          does not exist when the logging thread formats the message. Therefore, the
+     *          text of the format is copied in the binary log record with the arguments.
+     * \param   logPrio The priority of the message.
+     * \param   format  The character array with the format of the message.
+     * \param   args    The arguments of the message to format.
+     **/
+    template<uint32_t Size, typename ... Args>
+    inline void logRecord( NELogging::eLogPriority logPrio, const char (&format)[Size], const Args & ... args ) const;
+
+    /**
+     * \brief   Formats and logs a message with the specified priority, bypassing the priority check.
+     *          This is called if the format is not a string literal. The message is formatted
+     *          immediately, since the format string may not exist when the message is logged.
+     * \param   logPrio The priority of the message.
+     * \param   format  The format string of the message.
+     * \param   args    The arguments of the message to format.
+     **/
+    template<typename Format, typename ... Args>
+    inline void logRecord( NELogging::eLogPriority logPrio, const Format & format, const Args & ... args ) const;
+
+    /**
+     * \brief   Logs a message with the specified priority, bypassing the priority check.
+     *          The logging macros call this method. If the format is a character array and
+     *          the flag 'isLiteral' is set, only the address of the format is saved in the record.
+     *          Any other character array is copied in the record, and any other format
+     *          is formatted immediately.
+     * \param   logPrio     The priority of the message.
+     * \param   isLiteral   Flag, indicating whether the format is written as a string literal
+     *                      in the source code.
+     * \param   format      The format of the message.
+     * \param   args        The arguments of the message to format.
+     **/
+    template<typename Format, typename ... Args>
+    inline void logFormat( NELogging::eLogPriority logPrio, bool isLiteral, const Format & format, const Args & ... args ) const;
+
     /**
      * \brief   Checks if Scope Priority logging is enabled for the Log Scope.
      **/
@@ -179,6 +230,17 @@ private:
      **/
     static void _sendLog( unsigned int scopeId, unsigned int sessionId, TIME64 scopeStamp, NELogging::eLogPriority msgPrio, const char * format, va_list args );
 
+    /**
+     * \brief   Creates a logging message object with formatted text and sends it to the logging targets.
+     * \param   scopeId     The ID of the Log Scope.
+     * \param   sessionId   The ID of the session, used to differentiate messages of the same scope.
+     * \param   scopeStamp  The timestamp of the scope message to set duration.
+     * \param   msgPrio     The priority of the message to log.
+     * \param   text        The formatted text to output.
+     * \param   length      The length of the formatted text.
+     **/
+    static void _sendText( unsigned int scopeId, unsigned int sessionId, TIME64 scopeStamp, NELogging::eLogPriority msgPrio, const char * text, int length );
+
 //////////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////////
@@ -245,6 +307,51 @@ inline bool ScopeMessage::isPrioEnabled(NELogging::eLogPriority msgPrio) const
     return (msgPrio == NELogging::PrioScope ? mScopePrio &  static_cast<unsigned int>(NELogging::PrioScope) : mScopePrio >= static_cast<unsigned int>(msgPrio)) ;
 }
 
+template<uint32_t Size, typename ... Args>
+inline void ScopeMessage::logLiteral(NELogging::eLogPriority logPrio, const char (&format)[Size], const Args & ... args) const
+{
+    LogRecord record(mScopeId, mSessionId, mTimestamp, logPrio, format);
+    record.addArguments(args ...);
+    record.sendRecord();
+}
+
+template<uint32_t Size, typename ... Args>
+inline void ScopeMessage::logRecord(NELogging::eLogPriority logPrio, const char (&format)[Size], const Args & ... args) const
+{
+    const std::string_view text(format, Size);
+    LogRecord record(mScopeId, mSessionId, mTimestamp, logPrio, text.substr(0, text.find(String::EmptyChar)));
+    record.addArguments(args ...);
+    record.sendRecord();
+}
+
+template<typename Format, typename ... Args>
+inline void ScopeMessage::logRecord(NELogging::eLogPriority logPrio, const Format & format, const Args & ... args) const
+{
+    char text[NELogging::LOG_MESSAGE_IZE];
+    int len = String::formatString(text, static_cast<int>(NELogging::LOG_MESSAGE_IZE), format, args ...);
+    ScopeMessage::_sendText(mScopeId, mSessionId, mTimestamp, logPrio, text, len);
+}
+
+template<typename Format, typename ... Args>
+inline void ScopeMessage::logFormat(NELogging::eLogPriority logPrio, bool isLiteral, const Format & format, const Args & ... args) const
+{
+    if constexpr (std::is_array_v<Format>)
+    {
+        if (isLiteral)
+        {
+            logLiteral(logPrio, format, args ...);
+        }
+        else
+        {
+            logRecord(logPrio, format, args ...);
+        }
+    }
+    else
+    {
+        logRecord(logPrio, format, args ...);
+    }
+}
+
 #endif  // AREG_LOGS
 
 #endif  // AREG_LOGGING_SCOPEMESSAGE_HPP
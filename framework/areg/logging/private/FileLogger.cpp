@@ -33,19 +33,10 @@ bool FileLogger::openLogger( void )
         String fileName(mLogConfiguration.getLogFile() );
         if ( fileName.isEmpty() == false )
         {
-            bool newFile      = static_cast<bool>(mLogConfiguration.getAppendData()) == false;
-            unsigned int mode = File::FO_MODE_WRITE | File::FO_MODE_READ | File::FO_MODE_SHARE_READ | File::FO_MODE_SHARE_WRITE | File::FO_MODE_TEXT;
+            mLogFile.setBuffering(mLogConfiguration.getFileBuffer(), mLogConfiguration.getFileFlush());
+            mLogFile.setRotation(mLogConfiguration.getFileMaxSize(), mLogConfiguration.getFilePeriod(), mLogConfiguration.getFileCompress());
 
-            if (File::existFile(fileName))
-            {
-                mode |= newFile ? File::FO_MODE_TRUNCATE : File::FO_MODE_EXIST;
-            }
-            else
-            {
-                mode |= FileBase::FO_MODE_CREATE;
-            }
-
-            if ( mLogFile.open( fileName, mode) && createLayouts() )
+            if ( mLogFile.openFile( fileName, mLogConfiguration.getAppendData()) && createLayouts() )
             {
                     
                 Process & curProcess = Process::getInstance();
@@ -82,13 +73,14 @@ void FileLogger::closeLogger(void)
     }
 
     releaseLayouts();
-    mLogFile.close();
+    mLogFile.closeFile();
 }
 
 void FileLogger::logMessage( const NELogging::sLogMessage & logMessage )
 {
     if (mLogFile.isOpened())
     {
+        mLogFile.beginLine();
         switch (logMessage.logMsgType)
         {
         case NELogging::eLogMessageType::LogMessageText:
@@ -108,6 +100,14 @@ void FileLogger::logMessage( const NELogging::sLogMessage & logMessage )
             ASSERT(false);  // unexpected message to log
             break;
         }
+
+        // The errors are written immediately, the fatal errors are as well flushed on disk.
+        const bool isFatal{ logMessage.logMessagePrio == NELogging::eLogPriority::PrioFatal };
+        mLogFile.endLine(isFatal || (logMessage.logMessagePrio == NELogging::eLogPriority::PrioError));
+        if (isFatal)
+        {
+            mLogFile.flush();
+        }
     }
 }
 
@@ -20,8 +20,7 @@
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
 #include "areg/logging/private/LoggerBase.hpp"
-
-#include "areg/base/File.hpp"
+#include "areg/logging/private/LogFileWriter.hpp"
 
 #if AREG_LOGS
 
@@ -32,6 +31,8 @@
  * \brief   Message logger to output messages in to the file.
  *          At the moment the output logger supports only ASCII messages
  *          and any Unicode character might output wrong.
+ *          The messages are buffered and written in the file by the
+ *          writer thread, which as well rotates the log file.
  **/
 class FileLogger    : public    LoggerBase
 {
@@ -89,7 +90,10 @@ public:
 
 public:
     /**
-     * \brief   Call to flush logs, if they are queued. Some loggers might ignore this.
+     * \brief   Call to write buffered logs in the file and flush the file on disk.
+     *          The buffered logs are written by the writer thread when the buffer
+     *          is full or the flush timeout expires, so that normally there is no
+     *          need to call this method.
      **/
     void flushLogs(void);
 
@@ -98,9 +102,9 @@ public:
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   The log file object
+     * \brief   The buffered writer of the log file
      **/
-    File              mLogFile;
+    LogFileWriter     mLogFile;
 
 //////////////////////////////////////////////////////////////////////////
 // Hidden / Forbidden calls.
@@ -18,23 +18,25 @@
  * Include files.
  ************************************************************************/
 #include "areg/base/GEGlobal.h"
-#include "areg/base/TEArrayList.hpp"
+#include "areg/logging/LogLayout.hpp"
 #include "areg/logging/NELogging.hpp"
 
+#include <vector>
+
 #if AREG_LOGS
 
 /************************************************************************
  * Dependencies
  ************************************************************************/
-class IELayout;
 class IEOutStream;
 
 //////////////////////////////////////////////////////////////////////////
 // ClientService class declaration
 //////////////////////////////////////////////////////////////////////////
 /**
- * \brief   The Layout Manager keeps list of layout objects to format output message
+ * \brief   The Layout Manager keeps the compiled layout to format output message.
  *          The Layouts are created based on data in tracing configuration file.
+ *          The message is rendered in the buffer and written in the stream at once.
  *          Currently, there are 3 types of layout manager used:
  *              - Message layout, format to display output message
  *              - Enter scope layout, format to display enter scope message
@@ -42,12 +44,6 @@ class IEOutStream;
  **/
 class LayoutManager
 {
-//////////////////////////////////////////////////////////////////////////
-// Local types and constants.
-//////////////////////////////////////////////////////////////////////////
-private:
-    using ListLayouts   = TEArrayList<IELayout *>;
-
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -66,21 +62,21 @@ public:
 //////////////////////////////////////////////////////////////////////////
 public:
     /**
-     * \brief   Creates list of layout objects outside of passed formatting string.
-     * \param   layoutFormat    The formatting string to parse and crate layout objects.
-     * \return  Returns true if after parsing the layout manager contains at least one layout object.
+     * \brief   Compiles the layout out of passed formatting string.
+     * \param   layoutFormat    The formatting string to parse and compile the layout.
+     * \return  Returns true if after parsing the layout contains at least one operation.
      **/
     bool createLayouts( const char * layoutFormat );
     bool createLayouts( const String & layoutFormat );
 
     /**
-     * \brief   Release and delete list of layout objects.
+     * \brief   Clears the compiled layout.
      **/
     void deleteLayouts( void );
 
     /**
-     * \brief   Logs the message in the streaming object by using layout objects.
-     *          It will go through all layouts to generate message and write in stream.
+     * \brief   Logs the message in the streaming object by using compiled layout.
+     *          It renders the message in the buffer and writes in stream.
      * \param   logMsg  The logging message to stream.
      * \param   stream  The streaming object to write output message.
      **/
@@ -88,26 +84,23 @@ public:
 
     /**
      * \brief   Returns true if layout manager is valid.
-     *          The layout manager is valid if it has at least one layout object.
+     *          The layout manager is valid if it has at least one layout operation.
      **/
     inline bool isValid( void ) const;
 
-private:
-
-    /**
-     * \brief   Instantiates and creates layout objects out of layout format string.
-     * \param   layoutFormat    The layout string to parse and create objects.
-     **/
-    inline void _createLayouts(char* layoutFormat);
-
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
 private:
     /**
-     * \brief   The list of layouts
+     * \brief   The compiled layout. It caches the formatted time and names when renders messages.
+     **/
+    mutable LogLayout           mLayout;
+
+    /**
+     * \brief   The buffer to render messages.
      **/
-    ListLayouts     mLayoutList;
+    mutable std::vector<char>   mBuffer;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -121,7 +114,7 @@ private:
 //////////////////////////////////////////////////////////////////////////
 inline bool LayoutManager::isValid( void ) const
 {
-    return (mLayoutList.isEmpty() == false);
+    return mLayout.isValid();
 }
 
 #endif  // AREG_LOGS
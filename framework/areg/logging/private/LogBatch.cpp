@@ -0,0 +1,467 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogBatch.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The encoder and decoder of the batch of log messages
+ *              to send to the log collector in one remote message.
+ ************************************************************************/
+#include "areg/logging/LogBatch.hpp"
+
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/component/NEService.hpp"
+
+namespace
+{
+    /**
+     * \brief   The types of the entries of the batch of log messages.
+     **/
+    enum class _eEntry : unsigned char
+    {
+          EntryModule   = 1 //!< The name of the module.
+        , EntryThread   = 2 //!< The name of the thread.
+        , EntryMessage  = 3 //!< The log message.
+    };
+
+    /**
+     * \brief   Returns predefined structure of the remote message with the batch of log messages.
+     *          The source of the log should be set before sending the message.
+     **/
+    const NEMemory::sRemoteMessage & _getLogBatchMessage( void )
+    {
+        static constexpr NEMemory::sRemoteMessage _messageLogBatch
+        {
+            {
+                {   /*rbhBufHeader*/
+                      sizeof(NEMemory::sRemoteMessage)          // biBufSize
+                    , sizeof(unsigned char)                     // biLength
+                    , sizeof(NEMemory::sRemoteMessageHeader)    // biOffset
+                    , NEMemory::eBufferType::BufferRemote       // biBufType
+                    , 0                                         // biUsed
+                }
+                , NEService::COOKIE_LOGGER                      // rbhTarget
+                , NEMemory::INVALID_VALUE                       // rbhChecksum
+                , NEMemory::INVALID_VALUE                       // rbhSource
+                , static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessageBatch)  // rbhMessageId
+                , NEMemory::MESSAGE_SUCCESS                     // rbhResult
+                , NEService::SEQUENCE_NUMBER_NOTIFY             // rbhSequenceNr
+            }
+            , { static_cast<char>(0) }
+        };
+
+        return _messageLogBatch;
+    }
+
+    //!< Writes the variable-length integer, 7 bits per byte, and returns the number of written bytes.
+    inline uint32_t _writeNumber( unsigned char * dst, uint64_t value )
+    {
+        uint32_t len{ 0 };
+        while ( value >= 0x80u )
+        {
+            dst[ len ++ ] = static_cast<unsigned char>(value | 0x80u);
+            value >>= 7;
+        }
+
+        dst[ len ++ ] = static_cast<unsigned char>(value);
+        return len;
+    }
+
+    //!< Writes the length and the text, and returns the number of written bytes.
+    inline uint32_t _writeText( unsigned char * dst, const char * text, uint32_t length )
+    {
+        uint32_t len{ _writeNumber( dst, length ) };
+        NEMemory::memCopy( dst + len, length, text, length );
+        return (len + length);
+    }
+
+    //!< Encodes the signed difference of timestamps, so that small negative values are encoded in few bytes.
+    inline uint64_t _encodeDelta( TIME64 value, TIME64 previous )
+    {
+        const int64_t delta{ static_cast<int64_t>(value - previous) };
+        return ((static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+    }
+
+    //!< Decodes the signed difference of timestamps.
+    inline TIME64 _decodeDelta( uint64_t value, TIME64 previous )
+    {
+        const uint64_t delta{ (value >> 1) ^ (~(value & 1u) + 1u) };
+        return (previous + delta);
+    }
+
+    //!< Returns the length of the name, truncated to fit in the log message.
+    inline uint32_t _nameLength( const String & name )
+    {
+        return MACRO_MIN( static_cast<uint32_t>(name.getLength( )), NELogging::LOG_NAMES_SIZE - 1 );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LogBatchEncoder class implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogBatchEncoder::LogBatchEncoder( void )
+    : mBuffer               ( )
+    , mThreads              ( )
+    , mThreadIndex          ( )
+    , mSize                 ( 0u )
+    , mCount                ( 0u )
+    , mTimestamp            ( 0u )
+    , mThreadsUnregistered  ( Thread::getUnregisteredCount( ) )
+    , mModuleDefined        ( false )
+    , mModuleId             ( 0u )
+    , mModuleName           ( )
+{
+}
+
+void LogBatchEncoder::addMessage( const NELogging::sLogMessage & logMessage )
+{
+    if ( (mModuleDefined == false) || (mModuleId != logMessage.logModuleId) )
+    {
+        mModuleDefined  = true;
+        mModuleId       = logMessage.logModuleId;
+        mModuleName     = Process::getInstance( ).getAppName( );
+        _writeModule( );
+    }
+
+    const uint32_t index{ _getThreadIndex( static_cast<id_type>(logMessage.logThreadId) ) };
+    const uint32_t msgLen{ MACRO_MIN( logMessage.logMessageLen, NELogging::LOG_MESSAGE_IZE - 1 ) };
+
+    _beginEntry( );
+    unsigned char * dst{ mBuffer.data( ) + mSize };
+    uint32_t len{ 0 };
+    dst[ len ++ ] = static_cast<unsigned char>(_eEntry::EntryMessage);
+    dst[ len ++ ] = static_cast<unsigned char>(logMessage.logMsgType);
+    len += _writeNumber( dst + len, static_cast<uint64_t>(logMessage.logMessagePrio) );
+    len += _writeNumber( dst + len, index );
+    len += _writeNumber( dst + len, _encodeDelta( logMessage.logTimestamp, mTimestamp ) );
+    len += _writeNumber( dst + len, logMessage.logDuration );
+    len += _writeNumber( dst + len, logMessage.logScopeId );
+    len += _writeNumber( dst + len, logMessage.logSessionId );
+    len += _writeNumber( dst + len, logMessage.logSource );
+    len += _writeNumber( dst + len, logMessage.logTarget );
+    len += _writeText( dst + len, logMessage.logMessage, msgLen );
+
+    mSize      += len;
+    mTimestamp  = logMessage.logTimestamp;
+    ++ mCount;
+}
+
+void LogBatchEncoder::defineNames( void )
+{
+    if ( mModuleDefined )
+    {
+        _writeModule( );
+    }
+
+    for ( uint32_t i = 0; i < static_cast<uint32_t>(mThreads.size( )); ++ i )
+    {
+        _writeThread( i );
+    }
+}
+
+void LogBatchEncoder::resetNames( void )
+{
+    mThreads.clear( );
+    mThreadIndex.clear( );
+    mThreadsUnregistered= Thread::getUnregisteredCount( );
+    mModuleDefined      = false;
+    mModuleId           = 0u;
+    mModuleName.clear( );
+}
+
+RemoteMessage LogBatchEncoder::createBatch( const ITEM_ID & source )
+{
+    RemoteMessage msgBatch;
+    if ( mSize != 0u )
+    {
+        unsigned char * dst{ msgBatch.initMessage( _getLogBatchMessage( ).rbHeader, mSize ) };
+        if ( dst != nullptr )
+        {
+            NEMemory::memCopy( dst, mSize, mBuffer.data( ), mSize );
+            msgBatch.setSizeUsed( mSize );
+            msgBatch.moveToEnd( );
+            msgBatch.setSource( source );
+        }
+
+        clearBatch( );
+    }
+
+    return msgBatch;
+}
+
+void LogBatchEncoder::clearBatch( void )
+{
+    mSize       = 0u;
+    mCount      = 0u;
+    mTimestamp  = 0u;
+}
+
+void LogBatchEncoder::_beginEntry( void )
+{
+    if ( mBuffer.size( ) < static_cast<size_t>(mSize) + MAX_ENTRY_SIZE )
+    {
+        mBuffer.resize( MACRO_MAX( mBuffer.size( ) * 2, static_cast<size_t>(mSize) + MAX_ENTRY_SIZE ) );
+    }
+
+    if ( mSize == 0u )
+    {
+        mBuffer[ mSize ++ ] = LogBatchEncoder::BATCH_VERSION;
+    }
+}
+
+void LogBatchEncoder::_writeModule( void )
+{
+    _beginEntry( );
+    unsigned char * dst{ mBuffer.data( ) + mSize };
+    uint32_t len{ 0 };
+    dst[ len ++ ] = static_cast<unsigned char>(_eEntry::EntryModule);
+    len += _writeNumber( dst + len, mModuleId );
+    len += _writeText( dst + len, mModuleName.getString( ), _nameLength( mModuleName ) );
+    mSize += len;
+}
+
+void LogBatchEncoder::_writeThread( uint32_t index )
+{
+    const sThreadName & entry{ mThreads[ index ] };
+    _beginEntry( );
+    unsigned char * dst{ mBuffer.data( ) + mSize };
+    uint32_t len{ 0 };
+    dst[ len ++ ] = static_cast<unsigned char>(_eEntry::EntryThread);
+    len += _writeNumber( dst + len, index );
+    len += _writeNumber( dst + len, static_cast<uint64_t>(entry.threadId) );
+    len += _writeText( dst + len, entry.threadName.getString( ), _nameLength( entry.threadName ) );
+    mSize += len;
+}
+
+uint32_t LogBatchEncoder::_getThreadIndex( id_type threadId )
+{
+    // The IDs of threads are reused, check the names again if any thread is unregistered.
+    const uint32_t unregistered{ Thread::getUnregisteredCount( ) };
+    if ( unregistered != mThreadsUnregistered )
+    {
+        mThreadsUnregistered = unregistered;
+        for ( sThreadName & entry : mThreads )
+        {
+            entry.isExpired = true;
+        }
+    }
+
+    auto pos = mThreadIndex.find( threadId );
+    if ( pos != mThreadIndex.end( ) )
+    {
+        sThreadName & entry{ mThreads[ pos->second ] };
+        if ( entry.isExpired )
+        {
+            entry.isExpired = false;
+            const String & threadName{ Thread::getThreadName( threadId ) };
+            if ( threadName != entry.threadName )
+            {
+                entry.threadName = threadName;
+                _writeThread( pos->second );
+            }
+        }
+
+        return pos->second;
+    }
+
+    if ( mThreads.size( ) >= LogBatchEncoder::MAX_THREAD_NAMES )
+    {
+        mThreads.clear( );
+        mThreadIndex.clear( );
+    }
+
+    const uint32_t index{ static_cast<uint32_t>(mThreads.size( )) };
+    mThreads.push_back( sThreadName{ threadId, Thread::getThreadName( threadId ), false } );
+    mThreadIndex[ threadId ] = index;
+    _writeThread( index );
+    return index;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LogBatchDecoder class implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogBatchDecoder::LogBatchDecoder( void )
+    : mSources  ( )
+    , mBatch    ( )
+    , mNames    ( nullptr )
+    , mPosition ( 0u )
+    , mTimestamp( 0u )
+{
+}
+
+bool LogBatchDecoder::startBatch( const RemoteMessage & msgBatch )
+{
+    mBatch      = msgBatch;
+    mNames      = nullptr;
+    mPosition   = 0u;
+    mTimestamp  = 0u;
+
+    if ( (msgBatch.getMessageId( ) != static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessageBatch)) ||
+         (msgBatch.getSizeUsed( ) == 0u) ||
+         (msgBatch.getBuffer( )[ 0 ] != LogBatchEncoder::BATCH_VERSION) )
+    {
+        return _stopBatch( );
+    }
+
+    mNames      = &mSources[ msgBatch.getSource( ) ];
+    mPosition   = 1u;
+    return true;
+}
+
+bool LogBatchDecoder::nextMessage( NELogging::sLogMessage & logMessage )
+{
+    const unsigned char * data{ mBatch.getBuffer( ) };
+    const uint32_t size{ mNames != nullptr ? mBatch.getSizeUsed( ) : 0u };
+    uint64_t value{ 0 };
+    const char * text{ nullptr };
+    uint32_t length{ 0 };
+
+    while ( mPosition < size )
+    {
+        const _eEntry entry{ static_cast<_eEntry>(data[ mPosition ++ ]) };
+        if ( entry == _eEntry::EntryModule )
+        {
+            if ( (_readNumber( value ) == false) || (_readText( text, length ) == false) )
+                return _stopBatch( );
+
+            mNames->moduleId    = static_cast<ITEM_ID>(value);
+            mNames->moduleName.assign( text, static_cast<NEString::CharCount>(length) );
+        }
+        else if ( entry == _eEntry::EntryThread )
+        {
+            uint64_t threadId{ 0 };
+            if ( (_readNumber( value ) == false) || (value >= LogBatchEncoder::MAX_THREAD_NAMES) ||
+                 (_readNumber( threadId ) == false) || (_readText( text, length ) == false) )
+            {
+                return _stopBatch( );
+            }
+
+            const uint32_t index{ static_cast<uint32_t>(value) };
+            if ( index >= static_cast<uint32_t>(mNames->threads.size( )) )
+            {
+                mNames->threads.resize( static_cast<size_t>(index) + 1u, sThreadName{ 0u, String( ) } );
+            }
+
+            mNames->threads[ index ].threadId = static_cast<id_type>(threadId);
+            mNames->threads[ index ].threadName.assign( text, static_cast<NEString::CharCount>(length) );
+        }
+        else if ( (entry == _eEntry::EntryMessage) && (mPosition < size) )
+        {
+            logMessage.logMsgType = static_cast<NELogging::eLogMessageType>(data[ mPosition ++ ]);
+
+            uint64_t prio{ 0 }, index{ 0 }, delta{ 0 }, duration{ 0 }, scopeId{ 0 }, sessionId{ 0 }, source{ 0 }, target{ 0 };
+            if ( (_readNumber( prio ) == false)     || (_readNumber( index ) == false)      ||
+                 (_readNumber( delta ) == false)    || (_readNumber( duration ) == false)   ||
+                 (_readNumber( scopeId ) == false)  || (_readNumber( sessionId ) == false)  ||
+                 (_readNumber( source ) == false)   || (_readNumber( target ) == false)     ||
+                 (_readText( text, length ) == false) || (length >= NELogging::LOG_MESSAGE_IZE) )
+            {
+                return _stopBatch( );
+            }
+
+            mTimestamp = _decodeDelta( delta, mTimestamp );
+
+            logMessage.logDataType      = NELogging::eLogDataType::LogDataRemote;
+            logMessage.logMessagePrio   = static_cast<NELogging::eLogPriority>(prio);
+            logMessage.logSource        = static_cast<ITEM_ID>(source);
+            logMessage.logTarget        = static_cast<ITEM_ID>(target);
+            logMessage.logCookie        = mBatch.getSource( );
+            logMessage.logModuleId      = mNames->moduleId;
+            logMessage.logTimestamp     = mTimestamp;
+            logMessage.logReceived      = 0u;
+            logMessage.logDuration      = static_cast<unsigned int>(duration);
+            logMessage.logScopeId       = static_cast<unsigned int>(scopeId);
+            logMessage.logSessionId     = static_cast<unsigned int>(sessionId);
+            logMessage.logMessageLen    = length;
+            NEMemory::memCopy( logMessage.logMessage, NELogging::LOG_MESSAGE_IZE, text, length );
+            logMessage.logMessage[ length ] = String::EmptyChar;
+
+            const sThreadName * thread{ index < mNames->threads.size( ) ? &mNames->threads[ static_cast<size_t>(index) ] : nullptr };
+            logMessage.logThreadId      = thread != nullptr ? static_cast<ITEM_ID>(thread->threadId) : 0u;
+            logMessage.logThreadLen     = thread != nullptr ? NEMemory::memCopy( logMessage.logThread, NELogging::LOG_NAMES_SIZE - 1, thread->threadName.getString( ), _nameLength( thread->threadName ) ) : 0u;
+            logMessage.logThread[ logMessage.logThreadLen ] = String::EmptyChar;
+            logMessage.logModuleLen     = NEMemory::memCopy( logMessage.logModule, NELogging::LOG_NAMES_SIZE - 1, mNames->moduleName.getString( ), _nameLength( mNames->moduleName ) );
+            logMessage.logModule[ logMessage.logModuleLen ] = String::EmptyChar;
+            return true;
+        }
+        else
+        {
+            return _stopBatch( );
+        }
+    }
+
+    return false;
+}
+
+RemoteMessage LogBatchDecoder::createLogMessage( const NELogging::sLogMessage & logMessage ) const
+{
+    RemoteMessage msgLog;
+    NEMemory::sRemoteMessageHeader header{ mBatch.isValid( ) ? mBatch.getRemoteMessage( )->rbHeader : _getLogBatchMessage( ).rbHeader };
+    header.rbhBufHeader.biUsed  = 0u;
+    header.rbhMessageId         = static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage);
+    if ( msgLog.initMessage( header, sizeof( NELogging::sLogMessage ) ) != nullptr )
+    {
+        msgLog << logMessage;
+        msgLog.setSizeUsed( sizeof( NELogging::sLogMessage ) );
+        msgLog.moveToEnd( );
+    }
+
+    return msgLog;
+}
+
+void LogBatchDecoder::removeSource( const ITEM_ID & source )
+{
+    mSources.erase( source );
+    _stopBatch( );
+}
+
+void LogBatchDecoder::clear( void )
+{
+    mSources.clear( );
+    _stopBatch( );
+}
+
+bool LogBatchDecoder::_readNumber( uint64_t & value )
+{
+    const unsigned char * data{ mBatch.getBuffer( ) };
+    const uint32_t size{ mBatch.getSizeUsed( ) };
+    value = 0u;
+    for ( uint32_t shift = 0; (mPosition < size) && (shift < 64); shift += 7 )
+    {
+        const unsigned char byte{ data[ mPosition ++ ] };
+        value |= static_cast<uint64_t>(byte & 0x7Fu) << shift;
+        if ( (byte & 0x80u) == 0 )
+            return true;
+    }
+
+    return false;
+}
+
+bool LogBatchDecoder::_readText( const char * & text, uint32_t & length )
+{
+    uint64_t value{ 0 };
+    if ( (_readNumber( value ) == false) || (value > static_cast<uint64_t>(mBatch.getSizeUsed( ) - mPosition)) )
+        return false;
+
+    text    = reinterpret_cast<const char *>(mBatch.getBuffer( ) + mPosition);
+    length  = static_cast<uint32_t>(value);
+    mPosition += length;
+    return true;
+}
+
+inline bool LogBatchDecoder::_stopBatch( void )
+{
+    mNames      = nullptr;
+    mPosition   = 0u;
+    return false;
+}
@@ -292,6 +292,151 @@ void LogConfiguration::setDatabaseUser(const String& dbUserName, const String& d
     Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabasePassword().position, dbUserPassword, isTemporary);
 }
 
+uint32_t LogConfiguration::getDatabaseBatch(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabaseBatch().position).toUInt32();
+}
+
+void LogConfiguration::setDatabaseBatch(uint32_t batchRows, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabaseBatch().position, String::makeString(batchRows), isTemporary);
+}
+
+uint32_t LogConfiguration::getDatabaseFlush(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabaseFlush().position).toUInt32();
+}
+
+void LogConfiguration::setDatabaseFlush(uint32_t flushTimeout, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabaseFlush().position, String::makeString(flushTimeout), isTemporary);
+}
+
+String LogConfiguration::getDatabaseJournal(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabaseJournal().position);
+}
+
+void LogConfiguration::setDatabaseJournal(const String& journalMode, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabaseJournal().position, journalMode, isTemporary);
+}
+
+String LogConfiguration::getDatabaseSync(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabaseSync().position);
+}
+
+void LogConfiguration::setDatabaseSync(const String& syncMode, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabaseSync().position, syncMode, isTemporary);
+}
+
+bool LogConfiguration::getDatabaseSearch(void) const
+{
+    return Application::getConfigManager().getLogDatabaseProperty(NEPersistence::getLogDatabaseSearch().position).toBool();
+}
+
+void LogConfiguration::setDatabaseSearch(bool isEnabled, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogDatabaseProperty(NEPersistence::getLogDatabaseSearch().position, String::makeString(isEnabled), isTemporary);
+}
+
+uint32_t LogConfiguration::getRingSize(void) const
+{
+    uint32_t result{ Application::getConfigManager().getLogRingProperty(NEPersistence::getLogRingSize().position).toUInt32() };
+    return (result != 0 ? result : NELogging::LOG_RING_SIZE);
+}
+
+void LogConfiguration::setRingSize(uint32_t ringSize, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogRingProperty(NEPersistence::getLogRingSize().position, String::makeString(ringSize), isTemporary);
+}
+
+NELogging::eLogOverflow LogConfiguration::getRingOverflow(void) const
+{
+    return NELogging::stringToOverflow(Application::getConfigManager().getLogRingProperty(NEPersistence::getLogRingOverflow().position));
+}
+
+void LogConfiguration::setRingOverflow(NELogging::eLogOverflow overflow, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogRingProperty(NEPersistence::getLogRingOverflow().position, NELogging::overflowToString(overflow), isTemporary);
+}
+
+uint32_t LogConfiguration::getFileBuffer(void) const
+{
+    uint32_t result{ Application::getConfigManager().getLogFileProperty(NEPersistence::getLogFileBuffer().position).toUInt32() };
+    return (result != 0 ? result : NELogging::LOG_FILE_BUFFER_SIZE);
+}
+
+void LogConfiguration::setFileBuffer(uint32_t bufferSize, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileProperty(NEPersistence::getLogFileBuffer().position, String::makeString(bufferSize), isTemporary);
+}
+
+uint32_t LogConfiguration::getFileFlush(void) const
+{
+    uint32_t result{ Application::getConfigManager().getLogFileProperty(NEPersistence::getLogFileFlush().position).toUInt32() };
+    return (result != 0 ? result : NELogging::LOG_FILE_FLUSH_TIMEOUT);
+}
+
+void LogConfiguration::setFileFlush(uint32_t flushTimeout, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileProperty(NEPersistence::getLogFileFlush().position, String::makeString(flushTimeout), isTemporary);
+}
+
+uint64_t LogConfiguration::getFileMaxSize(void) const
+{
+    return Application::getConfigManager().getLogFileProperty(NEPersistence::getLogFileMaxSize().position).toUInt64();
+}
+
+void LogConfiguration::setFileMaxSize(uint64_t maxSize, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileProperty(NEPersistence::getLogFileMaxSize().position, String::makeString(maxSize), isTemporary);
+}
+
+uint32_t LogConfiguration::getFilePeriod(void) const
+{
+    return Application::getConfigManager().getLogFileProperty(NEPersistence::getLogFilePeriod().position).toUInt32();
+}
+
+void LogConfiguration::setFilePeriod(uint32_t period, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileProperty(NEPersistence::getLogFilePeriod().position, String::makeString(period), isTemporary);
+}
+
+bool LogConfiguration::getFileCompress(void) const
+{
+    return Application::getConfigManager().getLogFileProperty(NEPersistence::getLogFileCompress().position).toBool();
+}
+
+void LogConfiguration::setFileCompress(bool compress, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogFileProperty(NEPersistence::getLogFileCompress().position, String::makeString(compress), isTemporary);
+}
+
+uint32_t LogConfiguration::getRemoteBatch(void) const
+{
+    const String value{ Application::getConfigManager().getLogRemoteProperty(NEPersistence::getLogRemoteBatch().position) };
+    return (value.isEmpty() ? NELogging::LOG_REMOTE_BATCH_SIZE : value.toUInt32());
+}
+
+void LogConfiguration::setRemoteBatch(uint32_t batchSize, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogRemoteProperty(NEPersistence::getLogRemoteBatch().position, String::makeString(batchSize), isTemporary);
+}
+
+uint32_t LogConfiguration::getRemoteLinger(void) const
+{
+    const String value{ Application::getConfigManager().getLogRemoteProperty(NEPersistence::getLogRemoteLinger().position) };
+    return (value.isEmpty() ? NELogging::LOG_REMOTE_LINGER : value.toUInt32());
+}
+
+void LogConfiguration::setRemoteLinger(uint32_t linger, bool isTemporary /*= false*/)
+{
+    Application::getConfigManager().setLogRemoteProperty(NEPersistence::getLogRemoteLinger().position, String::makeString(linger), isTemporary);
+}
+
 void LogConfiguration::saveConfiguration(void)
 {
     Application::getConfigManager().saveConfig();
@@ -21,6 +21,7 @@
 #include "areg/base/FileBuffer.hpp"
 #include "areg/base/IEIOStream.hpp"
 #include "areg/logging/LogScope.hpp"
+#include "areg/logging/private/LogMessage.hpp"
 #include "areg/logging/private/LogManager.hpp"
 #include "areg/logging/private/ScopeNodes.hpp"
 
@@ -61,6 +62,10 @@ void LogEventProcessor::processLogEvent( LoggingEventData::eLoggingAction cmdLog
         _loggingLogMessage( stream );
         break;
 
+    case LoggingEventData::eLoggingAction::LoggingDrainRecords:
+        _loggingDrainRecords( );
+        break;
+
     case LoggingEventData::eLoggingAction::LoggingUpdateScopes:   // fall through
     case LoggingEventData::eLoggingAction::LoggingQueryScopes:    // fall through
     case LoggingEventData::eLoggingAction::LoggingUndefined:      // fall through
@@ -96,6 +101,11 @@ inline void LogEventProcessor::_loggingLogMessage( const SharedBuffer & data )
     mLogManager.writeLogMessage( *logMessage );
 }
 
+inline void LogEventProcessor::_loggingDrainRecords( void )
+{
+    mLogManager.drainRecords( false );
+}
+
 inline void LogEventProcessor::_changeScopePriority( const SharedBuffer & stream, unsigned int scopeCount )
 {
     String scopeName{ };
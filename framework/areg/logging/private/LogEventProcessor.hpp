@@ -96,6 +96,12 @@ private:
      **/
     void _loggingLogMessage( const SharedBuffer & data );
 
+    /**
+     * \brief   Reads the binary log records from the ring buffers of threads,
+     *          formats and logs the messages in the order of timestamps.
+     **/
+    void _loggingDrainRecords( void );
+
     /**
      * \brief   Changes the priority of the scopes. The streaming object contains the list of scopes
      *          with priority to change. Each scope entry can be either a single scope
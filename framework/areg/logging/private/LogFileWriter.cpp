@@ -0,0 +1,583 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogFileWriter.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The buffered asynchronous writer of the log file.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/logging/private/LogFileWriter.hpp"
+
+#include "areg/base/DateTime.hpp"
+#include "areg/base/IEByteBuffer.hpp"
+#include "areg/base/NEMath.hpp"
+#include "areg/base/NEUtilities.hpp"
+#include "areg/base/WideString.hpp"
+#include "areg/logging/NELogging.hpp"
+
+#include <string_view>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The name prefix of the writer thread of the log file.
+    constexpr std::string_view  _writerThreadName   { "_LogFileWriter_" };
+
+    //!< The size in bytes of the block of the rotated file compressed in one step.
+    constexpr uint32_t  _compressBlock  { 128 * 1'024 };
+
+    //!< The number of bits of the hash of 3 bytes to search the matches.
+    constexpr uint32_t  _hashBits       { 15 };
+
+    //!< The maximum distance of the match in the compressed data.
+    constexpr uint32_t  _maxDistance    { 32'768 };
+
+    //!< The minimum and maximum length of the match in the compressed data.
+    constexpr uint32_t  _minMatch       { 3 };
+    constexpr uint32_t  _maxMatch       { 258 };
+
+    //!< The maximum number of matches to compare when searching the longest match.
+    constexpr uint32_t  _maxChain       { 32 };
+
+    //!< The end of block symbol.
+    constexpr uint32_t  _endOfBlock     { 256 };
+
+    //!< The header of gzip file: magic, deflate method, no flags, no time, no extra flags, unknown OS.
+    constexpr unsigned char _gzipHeader[] { 0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF };
+
+    //!< The base values and the number of extra bits of length codes 257 - 285.
+    constexpr uint16_t  _lengthBase[]   { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    constexpr uint8_t   _lengthExtra[]  { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+    //!< The base values and the number of extra bits of distance codes 0 - 29.
+    constexpr uint16_t  _distBase[]     { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    constexpr uint8_t   _distExtra[]    { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    //!< The stream of bits of the compressed data.
+    struct sBitStream
+    {
+        unsigned char * bsData;
+        uint32_t        bsSize;
+        uint64_t        bsBits;
+        uint32_t        bsCount;
+    };
+
+    //!< Writes the bits in the stream starting from the least significant bit.
+    inline void _putBits( sBitStream & stream, uint32_t value, uint32_t count )
+    {
+        stream.bsBits  |= static_cast<uint64_t>(value) << stream.bsCount;
+        stream.bsCount += count;
+        while ( stream.bsCount >= 8 )
+        {
+            stream.bsData[stream.bsSize ++] = static_cast<unsigned char>(stream.bsBits & 0xFFu);
+            stream.bsBits  >>= 8;
+            stream.bsCount  -= 8;
+        }
+    }
+
+    //!< Writes the Huffman code in the stream starting from the most significant bit.
+    inline void _putCode( sBitStream & stream, uint32_t code, uint32_t count )
+    {
+        uint32_t reversed{ 0 };
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            reversed = (reversed << 1) | ((code >> i) & 1u);
+        }
+
+        _putBits( stream, reversed, count );
+    }
+
+    //!< Writes the symbol of literal or length with fixed Huffman code.
+    inline void _putSymbol( sBitStream & stream, uint32_t symbol )
+    {
+        if ( symbol < 144 )
+            _putCode( stream, 0x30u + symbol, 8 );
+        else if ( symbol < 256 )
+            _putCode( stream, 0x190u + symbol - 144, 9 );
+        else if ( symbol < 280 )
+            _putCode( stream, symbol - 256, 7 );
+        else
+            _putCode( stream, 0xC0u + symbol - 280, 8 );
+    }
+
+    //!< Writes the length and the distance of the match.
+    inline void _putMatch( sBitStream & stream, uint32_t length, uint32_t distance )
+    {
+        uint32_t code{ MACRO_ARRAYLEN( _lengthBase ) - 1 };
+        while ( _lengthBase[code] > length )
+            -- code;
+
+        _putSymbol( stream, 257 + code );
+        _putBits( stream, length - _lengthBase[code], _lengthExtra[code] );
+
+        code = MACRO_ARRAYLEN( _distBase ) - 1;
+        while ( _distBase[code] > distance )
+            -- code;
+
+        _putCode( stream, code, 5 );
+        _putBits( stream, distance - _distBase[code], _distExtra[code] );
+    }
+
+    //!< Writes the empty stored block, which aligns the stream to the byte boundary.
+    inline void _putStoredBlock( sBitStream & stream, bool isFinal )
+    {
+        _putBits( stream, isFinal ? 1u : 0u, 3 );
+        if ( stream.bsCount != 0 )
+        {
+            _putBits( stream, 0u, 8 - stream.bsCount );
+        }
+
+        _putBits( stream, 0x0000u, 16 );
+        _putBits( stream, 0xFFFFu, 16 );
+    }
+
+    //!< Returns the hash of 3 bytes.
+    inline uint32_t _hashOf( const unsigned char * data )
+    {
+        return ((static_cast<uint32_t>(data[0]) << 10) ^ (static_cast<uint32_t>(data[1]) << 5) ^ data[2]) & ((1u << _hashBits) - 1u);
+    }
+
+    //!< Returns the maximum size of the compressed block of the specified size.
+    inline uint32_t _deflateBound( uint32_t size )
+    {
+        return size + size / 8 + 64;
+    }
+
+    //!< Compresses the data in one deflate block with fixed Huffman codes, followed
+    //!< by empty stored block to align the output. Returns the size of compressed data.
+    uint32_t _deflateBlock( const unsigned char * data, uint32_t size, unsigned char * out )
+    {
+        std::vector<int32_t> head( static_cast<size_t>(1u << _hashBits), -1 );
+        std::vector<int32_t> prev( size, -1 );
+        sBitStream stream{ out, 0u, 0u, 0u };
+
+        _putBits( stream, 0u, 1 );  // not the final block
+        _putBits( stream, 1u, 2 );  // fixed Huffman codes
+
+        uint32_t pos{ 0 };
+        while ( pos < size )
+        {
+            uint32_t bestLength{ 0 };
+            uint32_t bestDistance{ 0 };
+            const uint32_t maxLength{ MACRO_MIN( _maxMatch, size - pos ) };
+            if ( maxLength >= _minMatch )
+            {
+                const uint32_t hash{ _hashOf( data + pos ) };
+                int32_t candidate{ head[hash] };
+                for ( uint32_t chain = 0; (candidate >= 0) && (chain < _maxChain) && ((pos - candidate) <= _maxDistance); ++ chain )
+                {
+                    const unsigned char * match{ data + candidate };
+                    if ( match[bestLength] == data[pos + bestLength] )
+                    {
+                        uint32_t length{ 0 };
+                        while ( (length < maxLength) && (match[length] == data[pos + length]) )
+                            ++ length;
+
+                        if ( length > bestLength )
+                        {
+                            bestLength = length;
+                            bestDistance = pos - static_cast<uint32_t>(candidate);
+                            if ( length == maxLength )
+                                break;
+                        }
+                    }
+
+                    candidate = prev[candidate];
+                }
+
+                prev[pos] = head[hash];
+                head[hash] = static_cast<int32_t>(pos);
+            }
+
+            if ( bestLength >= _minMatch )
+            {
+                _putMatch( stream, bestLength, bestDistance );
+                for ( uint32_t i = 1; i < bestLength; ++ i )
+                {
+                    const uint32_t next{ pos + i };
+                    if ( (next + _minMatch) <= size )
+                    {
+                        const uint32_t hash{ _hashOf( data + next ) };
+                        prev[next] = head[hash];
+                        head[hash] = static_cast<int32_t>(next);
+                    }
+                }
+
+                pos += bestLength;
+            }
+            else
+            {
+                _putSymbol( stream, data[pos] );
+                ++ pos;
+            }
+        }
+
+        _putSymbol( stream, _endOfBlock );
+        _putStoredBlock( stream, false );
+        return stream.bsSize;
+    }
+
+    //!< Writes 32-bit value in little-endian byte order.
+    inline void _putUInt32( unsigned char * out, uint32_t value )
+    {
+        out[0] = static_cast<unsigned char>(value & 0xFFu);
+        out[1] = static_cast<unsigned char>((value >> 8) & 0xFFu);
+        out[2] = static_cast<unsigned char>((value >> 16) & 0xFFu);
+        out[3] = static_cast<unsigned char>((value >> 24) & 0xFFu);
+    }
+
+    //!< Returns the unique name of the writer thread of the log file.
+    inline String _makeWriterThreadName( void )
+    {
+        static std::atomic_uint _count{ 0 };
+
+        String result( _writerThreadName );
+        result += String::makeString( static_cast<uint32_t>(++ _count) );
+        return result;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LogFileWriter class implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogFileWriter::LogFileWriter( void )
+    : IEOutStream       ( )
+    , IEThreadConsumer  ( )
+    , mFileMask         ( )
+    , mFile             ( )
+    , mIsOpened         ( false )
+    , mBufferSize       ( NELogging::LOG_FILE_BUFFER_SIZE )
+    , mFlushTimeout     ( NELogging::LOG_FILE_FLUSH_TIMEOUT )
+    , mMaxSize          ( 0u )
+    , mPeriod           ( 0u )
+    , mCompress         ( false )
+    , mFileSize         ( 0u )
+    , mRotateTime       ( 0u )
+    , mActive           ( )
+    , mWriting          ( )
+    , mCommitted        ( 0u )
+    , mWritten          ( 0u )
+    , mBufferLock       ( )
+    , mWriteEvent       ( true, true )
+    , mWrittenEvent     ( true, true )
+    , mWriterExit       ( false )
+    , mSyncFile         ( false )
+    , mCompressList     ( )
+    , mCompressSource   ( )
+    , mCompressTarget   ( )
+    , mCompressCrc      ( 0u )
+    , mCompressSize     ( 0u )
+    , mWriterThread     ( static_cast<IEThreadConsumer &>(self( )), _makeWriterThreadName( ) )
+{
+}
+
+LogFileWriter::~LogFileWriter( void )
+{
+    closeFile( );
+}
+
+bool LogFileWriter::openFile( const String & fileName, bool append )
+{
+    if ( isOpened( ) || fileName.isEmpty( ) )
+        return isOpened( );
+
+    mFileMask = fileName;
+    mActive.reserve( static_cast<size_t>(mBufferSize) * 2 );
+    mWriting.reserve( static_cast<size_t>(mBufferSize) * 2 );
+    mActive.clear( );
+    mWriting.clear( );
+    mCommitted = 0u;
+    mWritten.store( 0u );
+
+    if ( _openFile( append ) )
+    {
+        mIsOpened.store( true, std::memory_order_release );
+        mWriterExit.store( false );
+        mWriteEvent.resetEvent( );
+        mWrittenEvent.resetEvent( );
+        mWriterThread.createThread( NECommon::WAIT_INFINITE );
+    }
+
+    return isOpened( );
+}
+
+void LogFileWriter::closeFile( void )
+{
+    if ( mWriterThread.isRunning( ) )
+    {
+        mWriterExit.store( true );
+        mWriteEvent.setEvent( );
+        mWriterThread.shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    if ( isOpened( ) )
+    {
+        mSyncFile.store( true );
+        _writeBuffer( );
+        while ( _compressNext( ) )
+            ;
+
+        mFile.close( );
+        mIsOpened.store( false, std::memory_order_release );
+    }
+}
+
+void LogFileWriter::beginLine( void )
+{
+    mBufferLock.lock( );
+    while ( (mActive.size( ) >= static_cast<size_t>(mBufferSize) * 2) && mWriterThread.isRunning( ) )
+    {
+        // The writer thread is behind, wait until it takes the buffer.
+        mBufferLock.unlock( );
+        mWriteEvent.setEvent( );
+        mWrittenEvent.lock( mFlushTimeout );
+        mBufferLock.lock( );
+    }
+}
+
+void LogFileWriter::endLine( bool writeNow )
+{
+    const bool isFull{ mActive.size( ) >= static_cast<size_t>(mBufferSize) };
+    mBufferLock.unlock( );
+
+    if ( writeNow || isFull )
+    {
+        mWriteEvent.setEvent( );
+    }
+}
+
+unsigned int LogFileWriter::write( const unsigned char * buffer, unsigned int size )
+{
+    if ( (buffer == nullptr) || (size == 0) )
+        return 0u;
+
+    mActive.insert( mActive.end( ), buffer, buffer + size );
+    mCommitted += size;
+    return size;
+}
+
+unsigned int LogFileWriter::write( const IEByteBuffer & buffer )
+{
+    return write( buffer.getBuffer( ), buffer.getSizeUsed( ) );
+}
+
+unsigned int LogFileWriter::write( const String & ascii )
+{
+    return write( reinterpret_cast<const unsigned char *>(ascii.getString( )), static_cast<unsigned int>(ascii.getLength( )) );
+}
+
+unsigned int LogFileWriter::write( const WideString & wide )
+{
+    return write( reinterpret_cast<const unsigned char *>(wide.getString( )), static_cast<unsigned int>(wide.getLength( ) * sizeof( wchar_t )) );
+}
+
+void LogFileWriter::flush( void )
+{
+    if ( isOpened( ) == false )
+        return;
+
+    mBufferLock.lock( );
+    const uint64_t committed{ mCommitted };
+    mBufferLock.unlock( );
+
+    mSyncFile.store( true );
+    if ( mWriterThread.isRunning( ) )
+    {
+        while ( (mWritten.load( ) < committed) && mWriterThread.isRunning( ) )
+        {
+            mWriteEvent.setEvent( );
+            mWrittenEvent.lock( mFlushTimeout );
+        }
+    }
+    else
+    {
+        _writeBuffer( );
+    }
+}
+
+unsigned int LogFileWriter::getSizeWritable( void ) const
+{
+    const size_t used{ mActive.size( ) };
+    return (used < mBufferSize ? static_cast<unsigned int>(mBufferSize - used) : 0u);
+}
+
+void LogFileWriter::onThreadRuns( void )
+{
+    bool hasMore{ false };
+
+    while ( mWriterExit.load( ) == false )
+    {
+        // do not wait if there are rotated files to compress.
+        mWriteEvent.lock( hasMore ? NECommon::DO_NOT_WAIT : mFlushTimeout );
+        if ( _writeBuffer( ) == 0u )
+        {
+            hasMore = _compressNext( );
+        }
+        else
+        {
+            hasMore = hasMore || (mCompressList.isEmpty( ) == false);
+        }
+    }
+}
+
+uint32_t LogFileWriter::_writeBuffer( void )
+{
+    mBufferLock.lock( );
+    mActive.swap( mWriting );
+    const uint64_t committed{ mCommitted };
+    mBufferLock.unlock( );
+
+    const uint32_t size{ static_cast<uint32_t>(mWriting.size( )) };
+    if ( size != 0u )
+    {
+        mFile.write( mWriting.data( ), size );
+        mFileSize += size;
+        mWriting.clear( );
+    }
+
+    if ( mSyncFile.exchange( false ) )
+    {
+        mFile.flush( );
+    }
+
+    mWritten.store( committed );
+    mWrittenEvent.setEvent( );
+
+    if ( mFileSize != 0u )
+    {
+        const bool rotateSize{ (mMaxSize != 0u) && (mFileSize >= mMaxSize) };
+        const bool rotateTime{ (mPeriod != 0u) && (DateTime::getSystemTickCount( ) >= mRotateTime) };
+        if ( rotateSize || rotateTime )
+        {
+            _rotateFile( );
+        }
+    }
+
+    return size;
+}
+
+bool LogFileWriter::_openFile( bool append )
+{
+    unsigned int mode = File::FO_MODE_WRITE | File::FO_MODE_READ | File::FO_MODE_SHARE_READ | File::FO_MODE_SHARE_WRITE | File::FO_MODE_TEXT;
+    const String fileName( File::normalizePath( mFileMask ) );
+    if ( File::existFile( fileName ) )
+    {
+        mode |= append ? File::FO_MODE_EXIST : File::FO_MODE_TRUNCATE;
+    }
+    else
+    {
+        mode |= File::FO_MODE_CREATE;
+    }
+
+    mFileSize = 0u;
+    mRotateTime = DateTime::getSystemTickCount( ) + mPeriod;
+    if ( mFile.open( fileName, mode ) == false )
+        return false;
+
+    if ( append )
+    {
+        mFile.moveToEnd( );
+        mFileSize = mFile.getLength( );
+    }
+
+    return true;
+}
+
+void LogFileWriter::_rotateFile( void )
+{
+    const String oldName( mFile.getName( ) );
+    mFile.close( );
+
+    String rotated( oldName );
+    bool append{ false };
+    if ( File::normalizePath( mFileMask ) == oldName )
+    {
+        // The new log file has the same name, rename the rotated file adding the timestamp.
+        char timestamp[128]{ 0 };
+        NEUtilities::sSystemTime st;
+        DateTime::getNow( st, true );
+        String::formatString( timestamp, 128, File::TIMESTAMP_FORMAT.data( ), st.stYear, st.stMonth, st.stDay, st.stHour, st.stMinute, st.stSecond, st.stMillisecs );
+
+        const String prefix( File::makeFileFullPath( File::getFileDirectory( oldName ).getString( ), File::getFileName( oldName ).getString( ) ) + "_" + timestamp );
+        const String extension( File::getFileExtension( oldName ) );
+        rotated = prefix + extension;
+        for ( uint32_t i = 1; File::existFile( rotated ); ++ i )
+        {
+            rotated = prefix + "_" + String::makeString( i ) + extension;
+        }
+
+        // If failed to rename, continue to write in the same file.
+        append = (File::moveFile( oldName, rotated ) == false);
+    }
+
+    _openFile( append );
+    if ( mCompress && (append == false) )
+    {
+        mCompressList.add( rotated );
+    }
+}
+
+bool LogFileWriter::_compressNext( void )
+{
+    if ( mCompressSource.isOpened( ) == false )
+    {
+        if ( mCompressList.isEmpty( ) )
+            return false;
+
+        const String source( mCompressList[0] );
+        mCompressList.removeAt( 0 );
+        if ( mCompressSource.open( source, File::FO_MODE_READ | File::FO_MODE_BINARY | File::FO_MODE_EXIST ) == false )
+            return (mCompressList.isEmpty( ) == false);
+
+        if ( mCompressTarget.open( source + COMPRESS_EXTENSION, File::FO_MODE_WRITE | File::FO_MODE_BINARY | File::FO_MODE_CREATE ) == false )
+        {
+            mCompressSource.close( );
+            return (mCompressList.isEmpty( ) == false);
+        }
+
+        mCompressTarget.write( _gzipHeader, static_cast<unsigned int>(MACRO_ARRAYLEN( _gzipHeader )) );
+        mCompressCrc = NEMath::crc32Init( );
+        mCompressSize = 0u;
+    }
+
+    std::vector<unsigned char> data( _compressBlock );
+    std::vector<unsigned char> out( _deflateBound( _compressBlock ) );
+    const uint32_t size{ mCompressSource.read( data.data( ), _compressBlock ) };
+    if ( size != 0u )
+    {
+        mCompressCrc = NEMath::crc32Start( mCompressCrc, data.data( ), static_cast<int>(size) );
+        mCompressSize += size;
+        mCompressTarget.write( out.data( ), _deflateBlock( data.data( ), size, out.data( ) ) );
+    }
+
+    if ( size < _compressBlock )
+    {
+        // The end of the file, write the final block and the trailer of gzip file.
+        sBitStream stream{ out.data( ), 0u, 0u, 0u };
+        _putStoredBlock( stream, true );
+        _putUInt32( out.data( ) + stream.bsSize, NEMath::crc32Finish( mCompressCrc ) );
+        _putUInt32( out.data( ) + stream.bsSize + 4, mCompressSize );
+        mCompressTarget.write( out.data( ), stream.bsSize + 8 );
+
+        const String source( mCompressSource.getName( ) );
+        mCompressTarget.close( );
+        mCompressSource.close( );
+        File::deleteFile( source );
+        return (mCompressList.isEmpty( ) == false);
+    }
+
+    return true;
+}
+
+#endif  // AREG_LOGS
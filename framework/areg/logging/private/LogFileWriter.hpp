@@ -0,0 +1,304 @@
+#ifndef AREG_LOGGING_PRIVATE_LOGFILEWRITER_HPP
+#define AREG_LOGGING_PRIVATE_LOGFILEWRITER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogFileWriter.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The buffered asynchronous writer of the log file.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/base/IEIOStream.hpp"
+#include "areg/base/IEThreadConsumer.hpp"
+
+#include "areg/base/File.hpp"
+#include "areg/base/String.hpp"
+#include "areg/base/SynchObjects.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/base/Thread.hpp"
+
+#include <atomic>
+#include <vector>
+
+#if AREG_LOGS
+
+//////////////////////////////////////////////////////////////////////////////
+// LogFileWriter class declaration
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The buffered asynchronous writer of the log file. The logging thread
+ *          writes the log lines in the contiguous buffer in memory, and the
+ *          writer thread writes the buffered data in the file with one system
+ *          call when the size of the buffered data reaches the threshold, when
+ *          the flush timeout expires, or when the message with error or fatal
+ *          priority is logged.
+ *
+ *          The log file is rotated when it reaches the maximum size, or when
+ *          the rotation period expires. The writer thread compresses rotated
+ *          files in gzip format block by block, when there is no data to write.
+ **/
+class LogFileWriter : public    IEOutStream
+                    , private   IEThreadConsumer
+{
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The minimum size in bytes of the buffer to write logs in the file.
+     **/
+    static constexpr uint32_t   MIN_BUFFER_SIZE     { 4'096 };
+
+    /**
+     * \brief   The extension of compressed log files.
+     **/
+    static constexpr std::string_view   COMPRESS_EXTENSION  { ".gz" };
+
+private:
+    //!< The list of rotated log files to compress.
+    using FileList  = TEArrayList<String>;
+
+//////////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////////
+public:
+    LogFileWriter( void );
+
+    virtual ~LogFileWriter( void );
+
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Sets the size of the buffer and the timeout to write buffered logs.
+     *          Should be called before opening the file.
+     * \param   bufferSize      The size in bytes of the buffered logs to write in the file.
+     * \param   flushTimeout    The timeout in milliseconds to write buffered logs in the file.
+     **/
+    inline void setBuffering( uint32_t bufferSize, uint32_t flushTimeout );
+
+    /**
+     * \brief   Sets the rotation of the log file. Should be called before opening the file.
+     * \param   maxSize     The size in bytes of the log file to rotate. The value 0 disables the rotation by size.
+     * \param   period      The period in seconds to rotate the log file. The value 0 disables the rotation by time.
+     * \param   compress    If true, rotated log files are compressed in gzip format.
+     **/
+    inline void setRotation( uint64_t maxSize, uint32_t period, bool compress );
+
+    /**
+     * \brief   Opens the log file and starts the writer thread.
+     * \param   fileName    The path of the log file, which may contain masks.
+     *                      When the log file is rotated, the masks are applied again.
+     * \param   append      If true, the logs are appended at the end of existing file.
+     * \return  Returns true if the log file is opened.
+     **/
+    bool openFile( const String & fileName, bool append );
+
+    /**
+     * \brief   Stops the writer thread, writes the buffered logs,
+     *          compresses rotated files and closes the log file.
+     **/
+    void closeFile( void );
+
+    /**
+     * \brief   Returns true if the log file is opened.
+     **/
+    inline bool isOpened( void ) const;
+
+    /**
+     * \brief   Called by the logging thread before writing the log line.
+     *          If the writer thread cannot write the buffered logs in time,
+     *          waits until there is a free space in the buffer.
+     **/
+    void beginLine( void );
+
+    /**
+     * \brief   Called by the logging thread when the log line is written.
+     *          Notifies the writer thread if the size of buffered logs
+     *          reaches the threshold or if the logs should be written immediately.
+     * \param   writeNow    If true, the writer thread is notified to write
+     *                      the buffered logs immediately.
+     **/
+    void endLine( bool writeNow );
+
+/************************************************************************/
+// IEOutStream interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Writes the data in the buffer.
+     **/
+    virtual unsigned int write( const unsigned char * buffer, unsigned int size ) override;
+
+    /**
+     * \brief   Writes the data of the byte buffer in the buffer.
+     **/
+    virtual unsigned int write( const IEByteBuffer & buffer ) override;
+
+    /**
+     * \brief   Writes the ASCII string in the buffer.
+     **/
+    virtual unsigned int write( const String & ascii ) override;
+
+    /**
+     * \brief   Writes the wide string in the buffer.
+     **/
+    virtual unsigned int write( const WideString & wide ) override;
+
+    /**
+     * \brief   Writes the buffered logs in the file and waits until the data is written on disk.
+     **/
+    virtual void flush( void ) override;
+
+    /**
+     * \brief   Returns the size in bytes of free space in the buffer.
+     **/
+    virtual unsigned int getSizeWritable( void ) const override;
+
+//////////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+
+/************************************************************************/
+// IEThreadConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Runs the writer thread, which writes buffered logs in the file,
+     *          rotates the file and compresses rotated files.
+     **/
+    virtual void onThreadRuns( void ) override;
+
+    /**
+     * \brief   Writes the buffered logs in the file, and rotates the file if needed.
+     * \return  Returns the number of written bytes.
+     **/
+    uint32_t _writeBuffer( void );
+
+    /**
+     * \brief   Opens the log file applying the masks of the file name.
+     **/
+    bool _openFile( bool append );
+
+    /**
+     * \brief   Closes the current log file and opens the new one.
+     *          The rotated file is added to the list of files to compress.
+     **/
+    void _rotateFile( void );
+
+    /**
+     * \brief   Compresses the next block of the rotated log file.
+     * \return  Returns true if there is more data to compress.
+     **/
+    bool _compressNext( void );
+
+    /**
+     * \brief   Returns the instance of the object.
+     **/
+    inline LogFileWriter & self( void );
+
+//////////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////////
+private:
+    //!< The path of the log file with masks.
+    String                      mFileMask;
+    //!< The log file.
+    File                        mFile;
+    //!< The flag, indicating whether the log file is opened.
+    std::atomic_bool            mIsOpened;
+    //!< The size in bytes of buffered logs to write in the file.
+    uint32_t                    mBufferSize;
+    //!< The timeout in milliseconds to write buffered logs in the file.
+    uint32_t                    mFlushTimeout;
+    //!< The size in bytes of the log file to rotate.
+    uint64_t                    mMaxSize;
+    //!< The period in milliseconds to rotate the log file.
+    uint64_t                    mPeriod;
+    //!< The flag, indicating whether rotated log files are compressed.
+    bool                        mCompress;
+    //!< The size in bytes of the current log file.
+    uint64_t                    mFileSize;
+    //!< The time in milliseconds when the log file should be rotated.
+    uint64_t                    mRotateTime;
+    //!< The buffer to write the logs by the logging thread.
+    std::vector<unsigned char>  mActive;
+    //!< The buffer to write in the file by the writer thread.
+    std::vector<unsigned char>  mWriting;
+    //!< The total number of bytes written in the buffer.
+    uint64_t                    mCommitted;
+    //!< The total number of bytes written in the file.
+    std::atomic<uint64_t>       mWritten;
+    //!< The lock to swap the buffers.
+    SpinLock                    mBufferLock;
+    //!< The event signaled to write buffered logs.
+    SynchEvent                  mWriteEvent;
+    //!< The event signaled when the buffered logs are written in the file.
+    SynchEvent                  mWrittenEvent;
+    //!< The flag, indicating whether the writer thread should exit.
+    std::atomic_bool            mWriterExit;
+    //!< The flag, indicating whether the written data should be flushed on disk.
+    std::atomic_bool            mSyncFile;
+    //!< The rotated log files to compress.
+    FileList                    mCompressList;
+    //!< The rotated log file, which is compressed.
+    File                        mCompressSource;
+    //!< The compressed log file.
+    File                        mCompressTarget;
+    //!< The CRC of the data of compressed file.
+    unsigned int                mCompressCrc;
+    //!< The size of the data of compressed file.
+    uint32_t                    mCompressSize;
+    //!< The thread to write the logs in the file.
+    Thread                      mWriterThread;
+
+//////////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    DECLARE_NOCOPY_NOMOVE( LogFileWriter );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// LogFileWriter class inline methods
+//////////////////////////////////////////////////////////////////////////////
+
+inline void LogFileWriter::setBuffering( uint32_t bufferSize, uint32_t flushTimeout )
+{
+    mBufferSize     = MACRO_MAX( bufferSize, MIN_BUFFER_SIZE );
+    mFlushTimeout   = flushTimeout;
+}
+
+inline void LogFileWriter::setRotation( uint64_t maxSize, uint32_t period, bool compress )
+{
+    mMaxSize    = maxSize;
+    mPeriod     = static_cast<uint64_t>(period) * NECommon::TIMEOUT_1_SEC;
+    mCompress   = compress;
+}
+
+inline bool LogFileWriter::isOpened( void ) const
+{
+    return mIsOpened.load( std::memory_order_acquire );
+}
+
+inline LogFileWriter & LogFileWriter::self( void )
+{
+    return (*this);
+}
+
+#endif  // AREG_LOGS
+
+#endif  // AREG_LOGGING_PRIVATE_LOGFILEWRITER_HPP
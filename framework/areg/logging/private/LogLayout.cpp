@@ -0,0 +1,479 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogLayout.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The compiled layout to format log messages.
+ ************************************************************************/
+#include "areg/logging/LogLayout.hpp"
+
+#include "areg/base/DateTime.hpp"
+#include "areg/base/NEUtilities.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/logging/private/NELogOptions.hpp"
+
+#include <cstring>
+#include <ctime>
+#include <string_view>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The format of the date and time of the second, followed by milliseconds.
+    //!< Together with milliseconds, matches the NEUtilities::TIME_FORMAT_ISO8601_OUTPUT format.
+    constexpr char              _TIME_SECOND_FORMAT[]   { "%Y-%m-%d %H:%M:%S," };
+
+    //!< The number of digits of milliseconds.
+    constexpr uint32_t          _MILLI_DIGITS           { 3 };
+
+    //!< The output of the name of unknown module.
+    constexpr std::string_view  _UNKNOWN_MODULE         { "Unknown_Module" };
+
+    //!< The output of the name of unknown thread.
+    constexpr std::string_view  _UNKNOWN_THREAD         { "Unknown_Thread" };
+
+    //!< The maximum length of the formatted integer.
+    constexpr uint32_t          _MAX_NUMBER_LENGTH      { 24 };
+
+    //!< The maximum length of the formatted priority.
+    constexpr uint32_t          _MAX_PRIORITY_LENGTH    { 32 };
+
+    //!< Copies the text in the buffer. Returns the number of copied characters.
+    inline uint32_t _writeText( const char * text, uint32_t length, char * buffer, uint32_t size )
+    {
+        const uint32_t count{ MACRO_MIN( length, size ) };
+        if ( count != 0 )
+        {
+            std::memcpy( buffer, text, count );
+        }
+
+        return count;
+    }
+
+    //!< Writes the decimal digits of the number, padded with zeros to the minimum number of digits.
+    inline uint32_t _writeDecimal( uint64_t number, uint32_t minDigits, char * buffer, uint32_t size )
+    {
+        char digits[ _MAX_NUMBER_LENGTH ];
+        char * end = digits + _MAX_NUMBER_LENGTH;
+        char * pos = end;
+        do
+        {
+            *( -- pos ) = static_cast<char>('0' + (number % 10));
+            number /= 10;
+        } while ( number != 0 );
+
+        while ( static_cast<uint32_t>(end - pos) < minDigits )
+        {
+            *( -- pos ) = '0';
+        }
+
+        return _writeText( pos, static_cast<uint32_t>(end - pos), buffer, size );
+    }
+
+    //!< Writes the upper case hexadecimal digits of the number with the '0x' prefix.
+    inline uint32_t _writeHexadecimal( uint64_t number, char * buffer, uint32_t size )
+    {
+        constexpr char _hexDigits[]{ "0123456789ABCDEF" };
+
+        char digits[ _MAX_NUMBER_LENGTH ];
+        char * end = digits + _MAX_NUMBER_LENGTH;
+        char * pos = end;
+        do
+        {
+            *( -- pos ) = _hexDigits[ number & 0x0F ];
+            number >>= 4;
+        } while ( number != 0 );
+
+        *( -- pos ) = 'x';
+        *( -- pos ) = '0';
+        return _writeText( pos, static_cast<uint32_t>(end - pos), buffer, size );
+    }
+
+    //!< Returns the length of the text of the log message.
+    inline uint32_t _messageLength( const NELogging::sLogMessage & logMsg )
+    {
+        const void * end = std::memchr( logMsg.logMessage, String::EmptyChar, NELogging::LOG_MESSAGE_IZE );
+        return (end != nullptr ? static_cast<uint32_t>(reinterpret_cast<const char *>(end) - logMsg.logMessage) : NELogging::LOG_MESSAGE_IZE);
+    }
+
+    //!< Returns the index in the cache of the names of threads. The thread IDs may be aligned addresses.
+    inline uint32_t _threadSlot( id_type threadId, uint32_t cacheSize )
+    {
+        const uint64_t id{ static_cast<uint64_t>(threadId) };
+        return static_cast<uint32_t>((id ^ (id >> 12) ^ (id >> 24)) % cacheSize);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LogLayout class implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogLayout::LogLayout( void )
+    : mOperations           ( )
+    , mThreadNames          ( THREAD_CACHE_SIZE, sThreadName{ Thread::INVALID_THREAD_ID, String( ) } )
+    , mThreadsUnregistered  ( 0u )
+    , mText                 ( )
+    , mMaxLength            ( 0u )
+    , mModuleName           ( )
+    , mModuleId             ( 0u )
+    , mModuleIdText         ( )
+    , mTimeSecond           ( 0u )
+    , mTimeLength           ( 0u )
+    , mTimeText             { 0 }
+{
+}
+
+bool LogLayout::compile( const char * layoutFormat )
+{
+    clear( );
+    if ( NEString::isEmpty<char>( layoutFormat ) )
+        return false;
+
+    const Process & process{ Process::getInstance( ) };
+    mModuleName = process.getAppName( );
+    mModuleId   = static_cast<ITEM_ID>(process.getId( ));
+#ifdef _BIT64
+    mModuleIdText = String::makeString( static_cast<uint64_t>(mModuleId), NEString::eRadix::RadixHexadecimal );
+#else   // _BIT32
+    mModuleIdText = String::makeString( static_cast<uint32_t>(mModuleId), NEString::eRadix::RadixHexadecimal );
+#endif  // _BIT64
+
+    bool hasExclusive{ false };
+    const char * text = layoutFormat;
+    const char * pos  = layoutFormat;
+    while ( *pos != String::EmptyChar )
+    {
+        if ( *pos != NELogOptions::SYNTAX_SPECIAL_FORMAT )
+        {
+            ++ pos;
+            continue;
+        }
+
+        const char ch{ *(pos + 1) };
+        if ( ch == NELogOptions::SYNTAX_SPECIAL_FORMAT )
+        {
+            // output single '%'
+            _addText( text, static_cast<uint32_t>(pos - text) + 1u );
+            pos += 2;
+            text = pos;
+            continue;
+        }
+
+        eOperation opCode{ eOperation::OpText };
+        uint32_t maxLength{ 0u };
+        switch ( static_cast<NELogOptions::eLayouts>(ch) )
+        {
+        case NELogOptions::eLayouts::LayoutCookieId:
+            opCode = eOperation::OpCookieId;
+            maxLength = _MAX_NUMBER_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LayoutTickCount:
+            opCode = eOperation::OpTickCount;
+            maxLength = _MAX_NUMBER_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LayoutDayTime:
+            opCode = eOperation::OpDayTime;
+            maxLength = static_cast<uint32_t>(sizeof( mTimeText ));
+            break;
+
+        case NELogOptions::eLayouts::LayoutExecutableId:
+            opCode = eOperation::OpModuleId;
+            maxLength = _MAX_NUMBER_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LayoutMessage:
+            opCode = hasExclusive ? eOperation::OpText : eOperation::OpMessage;
+            maxLength = NELogging::LOG_MESSAGE_IZE;
+            hasExclusive = true;
+            break;
+
+        case NELogOptions::eLayouts::LayoutEndOfLine:
+            opCode = eOperation::OpEndOfLine;
+            maxLength = 1u;
+            break;
+
+        case NELogOptions::eLayouts::LayoutPriority:
+            opCode = eOperation::OpPriority;
+            maxLength = _MAX_PRIORITY_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LaytoutScopeId:
+            opCode = eOperation::OpScopeId;
+            maxLength = _MAX_NUMBER_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LayoutThreadId:
+            opCode = eOperation::OpThreadId;
+            maxLength = _MAX_NUMBER_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LayoutExecutableName:
+            opCode = eOperation::OpModuleName;
+            maxLength = MAX_NAME_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LayoutThreadName:
+            opCode = eOperation::OpThreadName;
+            maxLength = MAX_NAME_LENGTH;
+            break;
+
+        case NELogOptions::eLayouts::LaytoutScopeName:
+            opCode = hasExclusive ? eOperation::OpText : eOperation::OpScopeName;
+            maxLength = NELogging::LOG_MESSAGE_IZE;
+            hasExclusive = true;
+            break;
+
+        case NELogOptions::eLayouts::LayoutUndefined:  // fall through
+        case NELogOptions::eLayouts::LayoutAnyText:    // fall through
+        default:
+            // unknown specifier is output as text
+            pos += (ch != String::EmptyChar) ? 2 : 1;
+            continue;
+        }
+
+        _addText( text, static_cast<uint32_t>(pos - text) );
+        if ( opCode != eOperation::OpText )
+        {
+            // the repeated exclusive specifier is skipped
+            _addOperation( opCode, maxLength );
+        }
+
+        pos += 2;
+        text = pos;
+    }
+
+    _addText( text, static_cast<uint32_t>(pos - text) );
+    return isValid( );
+}
+
+void LogLayout::clear( void )
+{
+    mOperations.clear( );
+    mText.clear( );
+    mMaxLength      = 0u;
+    mModuleName.clear( );
+    mModuleId       = 0u;
+    mModuleIdText.clear( );
+    mTimeSecond     = 0u;
+    mTimeLength     = 0u;
+
+    for ( sThreadName & entry : mThreadNames )
+    {
+        entry.threadId = Thread::INVALID_THREAD_ID;
+        entry.threadName.clear( );
+    }
+}
+
+uint32_t LogLayout::renderMessage( const NELogging::sLogMessage & logMsg, char * buffer, uint32_t size )
+{
+    ASSERT( (buffer != nullptr) || (size == 0) );
+
+    if ( logMsg.logMessagePrio == NELogging::eLogPriority::PrioIgnoreLayout )
+    {
+        return _writeText( logMsg.logMessage, _messageLength( logMsg ), buffer, size );
+    }
+
+    char * pos = buffer;
+    uint32_t remain{ size };
+    for ( const sOperation & op : mOperations )
+    {
+        uint32_t count{ 0u };
+        switch ( op.opCode )
+        {
+        case eOperation::OpText:
+            count = _writeText( mText.getString( ) + op.textPos, op.textLen, pos, remain );
+            break;
+
+        case eOperation::OpCookieId:
+            count = _writeDecimal( static_cast<uint64_t>(logMsg.logCookie), 3u, pos, remain );
+            break;
+
+        case eOperation::OpTickCount:
+            count = _writeDecimal( DateTime::getProcessTickCount( ), 1u, pos, remain );
+            break;
+
+        case eOperation::OpDayTime:
+            count = _renderDayTime( logMsg.logTimestamp, pos, remain );
+            break;
+
+        case eOperation::OpModuleId:
+            if ( logMsg.logModuleId == mModuleId )
+            {
+                count = _writeText( mModuleIdText.getString( ), static_cast<uint32_t>(mModuleIdText.getLength( )), pos, remain );
+            }
+            else if ( logMsg.logModuleId != 0 )
+            {
+                count = _writeHexadecimal( static_cast<uint64_t>(logMsg.logModuleId), pos, remain );
+            }
+            break;
+
+        case eOperation::OpMessage:
+            count = _writeText( logMsg.logMessage, _messageLength( logMsg ), pos, remain );
+            break;
+
+        case eOperation::OpEndOfLine:
+            count = _writeText( &NEString::EndOfLine, 1u, pos, remain );
+            break;
+
+        case eOperation::OpPriority:
+            {
+                const String & prio{ NELogging::logPrioToString( logMsg.logMessagePrio ) };
+                count = _writeText( prio.getString( ), static_cast<uint32_t>(prio.getLength( )), pos, remain );
+            }
+            break;
+
+        case eOperation::OpScopeId:
+            if ( logMsg.logScopeId != 0 )
+            {
+                count = _writeDecimal( logMsg.logScopeId, 1u, pos, remain );
+            }
+            break;
+
+        case eOperation::OpThreadId:
+            if ( logMsg.logThreadId != 0 )
+            {
+                count = _writeDecimal( static_cast<uint64_t>(logMsg.logThreadId), 6u, pos, remain );
+            }
+            break;
+
+        case eOperation::OpModuleName:
+            if ( (logMsg.logDataType == NELogging::eLogDataType::LogDataLocal) || (logMsg.logCookie == NEService::COOKIE_LOCAL) )
+            {
+                count = _writeText( mModuleName.getString( ), static_cast<uint32_t>(mModuleName.getLength( )), pos, remain );
+            }
+            else if ( (logMsg.logCookie != NEService::COOKIE_UNKNOWN) && (logMsg.logModuleLen != 0) )
+            {
+                count = _writeText( logMsg.logModule, MACRO_MIN( logMsg.logModuleLen, NELogging::LOG_NAMES_SIZE ), pos, remain );
+            }
+            else
+            {
+                count = _writeText( _UNKNOWN_MODULE.data( ), static_cast<uint32_t>(_UNKNOWN_MODULE.length( )), pos, remain );
+            }
+            break;
+
+        case eOperation::OpThreadName:
+            if ( logMsg.logDataType == NELogging::eLogDataType::LogDataLocal )
+            {
+                const String & thread{ _getThreadName( static_cast<id_type>(logMsg.logThreadId) ) };
+                count = _writeText( thread.getString( ), static_cast<uint32_t>(thread.getLength( )), pos, remain );
+            }
+            else
+            {
+                count = _writeText( logMsg.logThread, MACRO_MIN( logMsg.logThreadLen, NELogging::LOG_NAMES_SIZE ), pos, remain );
+            }
+
+            if ( count == 0 )
+            {
+                count = _writeText( _UNKNOWN_THREAD.data( ), static_cast<uint32_t>(_UNKNOWN_THREAD.length( )), pos, remain );
+            }
+            break;
+
+        case eOperation::OpScopeName:
+            count = _writeText( logMsg.logMessage, MACRO_MIN( logMsg.logMessageLen, NELogging::LOG_MESSAGE_IZE ), pos, remain );
+            break;
+
+        default:
+            ASSERT( false );
+            break;
+        }
+
+        pos    += count;
+        remain -= count;
+    }
+
+    return (size - remain);
+}
+
+void LogLayout::_addText( const char * text, uint32_t length )
+{
+    if ( length == 0 )
+        return;
+
+    const uint32_t textPos{ static_cast<uint32_t>(mText.getLength( )) };
+    mText.append( text, static_cast<NEString::CharCount>(length) );
+    mMaxLength += length;
+
+    if ( (mOperations.empty( ) == false) && (mOperations.back( ).opCode == eOperation::OpText) )
+    {
+        // The text operations are merged, the texts are saved one after another.
+        mOperations.back( ).textLen += length;
+    }
+    else
+    {
+        mOperations.push_back( sOperation{ eOperation::OpText, textPos, length } );
+    }
+}
+
+void LogLayout::_addOperation( eOperation opCode, uint32_t maxLength )
+{
+    mOperations.push_back( sOperation{ opCode, 0u, 0u } );
+    mMaxLength += maxLength;
+}
+
+uint32_t LogLayout::_renderDayTime( TIME64 timestamp, char * buffer, uint32_t size )
+{
+    if ( timestamp == 0 )
+        return 0u;
+
+    const uint64_t second{ static_cast<uint64_t>(timestamp / NEUtilities::SEC_TO_MICROSECS) };
+    if ( (second != mTimeSecond) || (mTimeLength == 0) )
+    {
+        struct tm conv { };
+        NEUtilities::convToLocalTm( timestamp, conv );
+        mTimeLength = static_cast<uint32_t>(std::strftime( mTimeText, sizeof( mTimeText ) - _MILLI_DIGITS, _TIME_SECOND_FORMAT, &conv ));
+        mTimeSecond = second;
+        if ( mTimeLength == 0 )
+            return 0u;
+    }
+
+    uint32_t milli{ static_cast<uint32_t>((timestamp % NEUtilities::SEC_TO_MICROSECS) / NEUtilities::MILLISEC_TO_MICROSECS) };
+    for ( uint32_t i = _MILLI_DIGITS; i > 0; -- i )
+    {
+        mTimeText[ mTimeLength + i - 1 ] = static_cast<char>('0' + (milli % 10));
+        milli /= 10;
+    }
+
+    return _writeText( mTimeText, mTimeLength + _MILLI_DIGITS, buffer, size );
+}
+
+const String & LogLayout::_getThreadName( id_type threadId )
+{
+    const uint32_t unregistered{ Thread::getUnregisteredCount( ) };
+    if ( unregistered != mThreadsUnregistered )
+    {
+        // The IDs of unregistered threads can be reused, the cached names are invalid.
+        for ( sThreadName & entry : mThreadNames )
+        {
+            entry.threadId = Thread::INVALID_THREAD_ID;
+        }
+
+        mThreadsUnregistered = unregistered;
+    }
+
+    sThreadName & entry{ mThreadNames[ _threadSlot( threadId, THREAD_CACHE_SIZE ) ] };
+    if ( entry.threadId != threadId )
+    {
+        const String & name{ Thread::getThreadName( threadId ) };
+        if ( name.isEmpty( ) )
+            return name;
+
+        entry.threadId   = threadId;
+        entry.threadName = name;
+    }
+
+    return entry.threadName;
+}
+
+#endif  // AREG_LOGS
@@ -24,6 +24,29 @@
 #include "areg/logging/private/LogMessage.hpp"
 
 #if AREG_LOGS
+
+namespace
+{
+    /**
+     * \brief   The ring buffer of log records of the thread.
+     *          The ring buffer is closed when the thread exits.
+     **/
+    struct sThreadRing
+    {
+        ~sThreadRing( void )
+        {
+            if ( ringBuffer != nullptr )
+            {
+                ringBuffer->closeBuffer( );
+            }
+        }
+
+        std::shared_ptr<LogRingBuffer>  ringBuffer{ };
+    };
+
+    //!< The ring buffer of log records of the calling thread.
+    thread_local sThreadRing    _threadRing;
+}
 //////////////////////////////////////////////////////////////////////////
 // LogManager class implementation
 //////////////////////////////////////////////////////////////////////////
@@ -53,6 +76,11 @@ void LogManager::logMessage(const RemoteMessage& logData)
     LogManager::getInstance().sendLogEvent( LoggingEventData(LoggingEventData::eLoggingAction::LoggingLogMessage, logData) );
 }
 
+void LogManager::logRecord(const unsigned char* record, unsigned int size)
+{
+    LogManager::getInstance().writeRecord(record, size);
+}
+
 void LogManager::sendCommandMessage(LoggingEventData::eLoggingAction cmd, const SharedBuffer& data)
 {
     LogManager::getInstance().sendLogEvent(LoggingEventData(cmd, data));
@@ -198,6 +226,15 @@ LogManager::LogManager(void)
 
     , mLogStarted       ( false, false )
     , mLock             ( )
+    , mRingList         ( )
+    , mDrainList        ( )
+    , mDrainHeads       ( )
+    , mRingLock         ( )
+    , mRingSize         ( NELogging::LOG_RING_SIZE )
+    , mRingOverflow     ( NELogging::eLogOverflow::OverflowBlock )
+    , mRingEnabled      ( false )
+    , mDrainPending     ( false )
+    , mDroppedRecords   ( 0u )
 {
 }
 
@@ -329,6 +366,11 @@ void LogManager::startLogs( void )
         {
             mLoggerDatabase.openLogger();
         }
+
+        mRingSize       = mLogConfig.getRingSize();
+        mRingOverflow   = mLogConfig.getRingOverflow();
+        mDrainPending.store(false);
+        mRingEnabled.store(true, std::memory_order_release);
     }
 
     mIsStarted = true;
@@ -342,6 +384,9 @@ void LogManager::stopLogs(void)
 
     mIsStarted = false;
 
+    mRingEnabled.store( false, std::memory_order_release );
+    drainRecords( true );
+
     mLoggerDebug.closeLogger( );
     mLoggerFile.closeLogger( );
     mLoggerTcp.closeLogger( );
@@ -349,20 +394,131 @@ void LogManager::stopLogs(void)
     triggerExit( );
 }
 
-void LogManager::writeLogMessage( const NELogging::sLogMessage & logMessage )
+void LogManager::writeLogMessage( const NELogging::sLogMessage & logMessage, bool canFlush /*= true*/ )
 {
     mLoggerFile.logMessage( logMessage );
     mLoggerDebug.logMessage( logMessage );
     mLoggerTcp.logMessage( logMessage );
     mLoggerDatabase.logMessage(logMessage);
 
-    if ( hasMoreEvents() == false )
+    if ( canFlush && (hasMoreEvents() == false) )
     {
-        mLoggerFile.flushLogs();
+        mLoggerTcp.flushLogs();
         mLoggerDatabase.flushLogs();
     }
 }
 
+void LogManager::writeRecord( const unsigned char * record, unsigned int size )
+{
+    if ( mRingEnabled.load( std::memory_order_acquire ) == false )
+        return;
+
+    LogRingBuffer & ring{ getThreadRing( ) };
+    bool isWritten{ ring.writeRecord( record, size, mRingOverflow == NELogging::eLogOverflow::OverflowDropOldest ) };
+    if ( (isWritten == false) && (mRingOverflow == NELogging::eLogOverflow::OverflowBlock) && (Thread::getCurrentThreadId( ) != getId( )) )
+    {
+        // Wait until the logging thread reads the records. The logging thread cannot wait for itself.
+        do
+        {
+            requestDrain( );
+            Thread::switchThread( );
+            isWritten = ring.writeRecord( record, size, false );
+        } while ( (isWritten == false) && mRingEnabled.load( std::memory_order_acquire ) );
+    }
+
+    if ( isWritten )
+    {
+        requestDrain( );
+    }
+    else
+    {
+        ring.recordDropped( );
+    }
+}
+
+void LogManager::drainRecords( bool drainAll )
+{
+    // Reset the flag before reading the heads, so that the records written
+    // after reading the heads either are read now or trigger new event.
+    mDrainPending.store( false );
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+
+    do
+    {
+        mRingLock.lock( );
+        for ( uint32_t i = mRingList.getSize( ); i > 0; -- i )
+        {
+            if ( mRingList[i - 1]->isExpired( ) )
+            {
+                mRingList.removeAt( i - 1 );
+            }
+        }
+
+        mDrainList = mRingList;
+        mRingLock.unlock( );
+
+        const uint32_t count{ mDrainList.getSize( ) };
+        mDrainHeads.resize( count );
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            mDrainHeads[i] = mDrainList[i]->getHead( );
+            mDrainList[i]->readPending( mDrainHeads[i] );
+        }
+
+        // Merge the records of the threads in the order of timestamps.
+        uint32_t written{ 0 };
+        LogMessage logMessage( NELogging::eLogMessageType::LogMessageText );
+        for ( ; ; ++ written )
+        {
+            LogRingBuffer * next{ nullptr };
+            uint32_t nextIndex{ 0 };
+            for ( uint32_t i = 0; i < count; ++ i )
+            {
+                LogRingBuffer * ring{ mDrainList[i].get( ) };
+                if ( ring->hasPending( ) && ((next == nullptr) || (ring->getPendingTimestamp( ) < next->getPendingTimestamp( ))) )
+                {
+                    next = ring;
+                    nextIndex = i;
+                }
+            }
+
+            if ( next == nullptr )
+                break;
+
+            LogRecord::formatRecord( next->getPendingData( ), next->getPendingSize( ), logMessage );
+            writeLogMessage( logMessage, false );
+            next->releasePending( );
+            next->readPending( mDrainHeads[nextIndex] );
+        }
+
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            const uint32_t dropped{ mDrainList[i]->takeDropped( ) };
+            if ( dropped != 0u )
+            {
+                mDroppedRecords += dropped;
+                LogMessage warning( NELogging::eLogMessageType::LogMessageText, NELogging::LOG_SCOPE_ID_NONE, 0u, 0u, NELogging::eLogPriority::PrioWarning, nullptr, 0u );
+                warning.logThreadId = mDrainList[i]->getThreadId( );
+                warning.logMessageLen = static_cast<uint32_t>(String::formatString( warning.logMessage
+                                                                                  , static_cast<int>(NELogging::LOG_MESSAGE_IZE)
+                                                                                  , "The ring buffer of log records of the thread is full, dropped [ %u ] log messages, total dropped [ %llu ]"
+                                                                                  , dropped
+                                                                                  , static_cast<unsigned long long>(mDroppedRecords) ));
+                writeLogMessage( warning, false );
+            }
+        }
+
+        mDrainList.clear( );
+        drainAll = drainAll && (written != 0);
+    } while ( drainAll );
+
+    if ( hasMoreEvents( ) == false )
+    {
+        mLoggerTcp.flushLogs( );
+        mLoggerDatabase.flushLogs( );
+    }
+}
+
 bool LogManager::postEvent(Event & eventElem)
 {
     return EventDispatcher::postEvent(eventElem);
@@ -373,6 +529,28 @@ inline void LogManager::sendLogEvent( const LoggingEventData & data, Event::eEve
     LoggingEvent::sendEvent( data, static_cast<IELoggingEventConsumer &>(self( )), static_cast<DispatcherThread &>(self( )), eventPrio );
 }
 
+inline void LogManager::requestDrain( void )
+{
+    // The fence orders the written record before the check of the flag, which is reset by the logging thread.
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( (mDrainPending.load( std::memory_order_relaxed ) == false) && (mDrainPending.exchange( true ) == false) )
+    {
+        sendLogEvent( LoggingEventData( LoggingEventData::eLoggingAction::LoggingDrainRecords ) );
+    }
+}
+
+inline LogRingBuffer & LogManager::getThreadRing( void )
+{
+    if ( _threadRing.ringBuffer == nullptr )
+    {
+        _threadRing.ringBuffer = std::make_shared<LogRingBuffer>( mRingSize, static_cast<ITEM_ID>(Thread::getCurrentThreadId( )) );
+        Lock lock( mRingLock );
+        mRingList.add( _threadRing.ringBuffer );
+    }
+
+    return *_threadRing.ringBuffer;
+}
+
 void LogManager::changeScopePriority( const String & scopeName, unsigned int scopeId, unsigned int scopePrio )
 {
     mScopeController.changeScopeActivityStatus( scopeName, scopeId, scopePrio );
@@ -32,7 +32,10 @@
 #include "areg/logging/private/NetTcpLogger.hpp"
 #include "areg/logging/private/DatabaseLogger.hpp"
 #include "areg/logging/private/LogEventProcessor.hpp"
+#include "areg/logging/private/LogRingBuffer.hpp"
 
+#include <atomic>
+#include <memory>
 #include <string_view>
 
 #if AREG_LOGS
@@ -78,6 +81,9 @@ private:
     //!< Reconnect timeout in milliseconds
     static constexpr unsigned int       LOG_RECONNECT_TIMEOUT       { NECommon::TIMEOUT_1_SEC * 5 };
 
+    //!< The list of ring buffers of log records of the threads.
+    using RingList  = TEArrayList<std::shared_ptr<LogRingBuffer>>;
+
 public:
 
     /**
@@ -99,6 +105,17 @@ public:
      **/
     static void logMessage( const RemoteMessage& logData );
 
+    /**
+     * \brief   Writes the binary log record created locally in the same process in the
+     *          ring buffer of the calling thread. The logging thread formats and logs the
+     *          records of all threads in the order of timestamps. If the ring buffer is full,
+     *          the record is either dropped or the calling thread waits for the free space,
+     *          depending on the overflow policy in the configuration.
+     * \param   record  The data of the binary log record.
+     * \param   size    The size in bytes of the log record.
+     **/
+    static void logRecord( const unsigned char * record, unsigned int size );
+
     /**
      * \brief   Generates and queues a message to execute internal command.
      * \param   cmd     The command to execute.
@@ -412,8 +429,36 @@ private:
     /**
      * \brief   Writes a log message to the existing loggers.
      * \param   logMessage  The message to log.
+     * \param   canFlush    If true, the logs are flushed if there are no more events to process.
+     **/
+    void writeLogMessage( const NELogging::sLogMessage & logMessage, bool canFlush = true );
+
+    /**
+     * \brief   Writes the log record in the ring buffer of the calling thread
+     *          and notifies the logging thread to read the records.
+     * \param   record  The data of the binary log record.
+     * \param   size    The size in bytes of the log record.
+     **/
+    void writeRecord( const unsigned char * record, unsigned int size );
+
+    /**
+     * \brief   Reads the log records from the ring buffers of all threads, formats and
+     *          writes log messages in the order of timestamps. Called in the logging thread.
+     * \param   drainAll    If true, reads records until the ring buffers are empty.
+     *                      Otherwise, reads the records, which were written before the call.
+     **/
+    void drainRecords( bool drainAll );
+
+    /**
+     * \brief   Notifies the logging thread to read the log records, if it is not notified yet.
+     **/
+    inline void requestDrain( void );
+
+    /**
+     * \brief   Returns the ring buffer of log records of the calling thread.
+     *          The ring buffer is created when the thread logs the first message.
      **/
-    void writeLogMessage( const NELogging::sLogMessage & logMessage );
+    inline LogRingBuffer & getThreadRing( void );
 
     /**
      * \brief   Sends log event with the preferred priority.
@@ -483,6 +528,39 @@ private:
      * \brief   Synchronization object used to synchronize data access.
      **/
     mutable ResourceLock    mLock;
+    /**
+     * \brief   The ring buffers of log records of the threads.
+     **/
+    RingList            mRingList;
+    /**
+     * \brief   The list of ring buffers and the head positions to read the records. Used in logging thread.
+     **/
+    RingList            mDrainList;
+    TEArrayList<uint32_t> mDrainHeads;
+    /**
+     * \brief   Synchronization object used to access the list of ring buffers.
+     **/
+    SpinLock            mRingLock;
+    /**
+     * \brief   The size in bytes of ring buffer of log records created for each thread.
+     **/
+    uint32_t            mRingSize;
+    /**
+     * \brief   The policy of the thread when its ring buffer of log records is full.
+     **/
+    NELogging::eLogOverflow mRingOverflow;
+    /**
+     * \brief   Flag, indicating whether the log records are written in the ring buffers.
+     **/
+    std::atomic_bool    mRingEnabled;
+    /**
+     * \brief   Flag, indicating that the logging thread is notified to read the log records.
+     **/
+    std::atomic_bool    mDrainPending;
+    /**
+     * \brief   The total number of dropped log records. Used in logging thread.
+     **/
+    uint64_t            mDroppedRecords;
 
 private:
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,558 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogRecord.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Binary log record with deferred formatting.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/logging/LogRecord.hpp"
+
+#include "areg/base/DateTime.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/logging/private/LogManager.hpp"
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The size of the header of the log record.
+    constexpr uint32_t  _headerSize     { static_cast<uint32_t>(sizeof(LogRecord::sRecordHeader)) };
+    //!< The size of the buffer to format one argument.
+    constexpr uint32_t  _formatSize     { LogRecord::RECORD_SIZE };
+    //!< The maximum width and precision of the formatted argument.
+    constexpr int       _maxWidth       { static_cast<int>(NELogging::LOG_MESSAGE_IZE) };
+    //!< The maximum precision of the formatted floating point argument.
+    constexpr int       _maxPrecision   { 64 };
+    //!< The string to output if the string argument is null.
+    constexpr char      _nullString[]   { "(null)" };
+
+    /**
+     * \brief   The argument read from the log record.
+     **/
+    struct sArgument
+    {
+        LogRecord::eArgType argType { LogRecord::eArgType::ArgInvalid };    //!< The type of argument.
+        uint64_t            argValue{ 0u };         //!< The value of argument of fixed size.
+        const char *        argText { nullptr };    //!< The text of string argument.
+        uint32_t            argLength{ 0u };        //!< The length of string argument.
+    };
+
+    /**
+     * \brief   The length modifiers of the format specification.
+     **/
+    enum class eLength
+    {
+          LengthNone    //!< No length modifier.
+        , LengthChar    //!< 'hh'
+        , LengthShort   //!< 'h'
+        , LengthLong    //!< 'l'
+        , LengthLongLong//!< 'll', 'j', 'z', 't', 'I64' and 'I'
+        , LengthDouble  //!< 'L'
+    };
+
+    /**
+     * \brief   Reads next argument of the record. Returns false if there are no more arguments.
+     **/
+    inline bool _readArgument( const unsigned char *& pos, const unsigned char * end, sArgument & OUT arg )
+    {
+        if ( pos >= end )
+            return false;
+
+        arg.argType = static_cast<LogRecord::eArgType>(*pos ++);
+        if ( arg.argType == LogRecord::eArgType::ArgString )
+        {
+            uint16_t len{ 0 };
+            if ( (pos + sizeof(uint16_t)) > end )
+                return false;
+
+            NEMemory::memCopy( reinterpret_cast<unsigned char *>(&len), sizeof(uint16_t), pos, sizeof(uint16_t) );
+            pos += sizeof(uint16_t);
+            arg.argLength = MACRO_MIN( static_cast<uint32_t>(len), static_cast<uint32_t>(end - pos) );
+            arg.argText   = reinterpret_cast<const char *>(pos);
+            pos += arg.argLength;
+        }
+        else
+        {
+            if ( (pos + sizeof(uint64_t)) > end )
+                return false;
+
+            NEMemory::memCopy( reinterpret_cast<unsigned char *>(&arg.argValue), sizeof(uint64_t), pos, sizeof(uint64_t) );
+            pos += sizeof(uint64_t);
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief   Returns the value of argument as a floating point value.
+     **/
+    inline double _toDouble( const sArgument & arg )
+    {
+        double result{ 0.0 };
+        switch ( arg.argType )
+        {
+        case LogRecord::eArgType::ArgDouble:
+            NEMemory::memCopy( reinterpret_cast<unsigned char *>(&result), sizeof(double), reinterpret_cast<const unsigned char *>(&arg.argValue), sizeof(uint64_t) );
+            break;
+
+        case LogRecord::eArgType::ArgSigned:
+            result = static_cast<double>(static_cast<int64_t>(arg.argValue));
+            break;
+
+        case LogRecord::eArgType::ArgUnsigned:  // fall through
+        case LogRecord::eArgType::ArgPointer:
+            result = static_cast<double>(arg.argValue);
+            break;
+
+        default:
+            break;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Returns the value of argument as an integer value.
+     **/
+    inline uint64_t _toInteger( const sArgument & arg )
+    {
+        if ( arg.argType == LogRecord::eArgType::ArgDouble )
+            return static_cast<uint64_t>(static_cast<int64_t>(_toDouble(arg)));
+        else if ( arg.argType == LogRecord::eArgType::ArgString )
+            return 0u;
+        else
+            return arg.argValue;
+    }
+
+    /**
+     * \brief   Formats the signed integer argument with the length modifier of the specification.
+     **/
+    inline int _formatSigned( char * buffer, const char * spec, eLength length, int64_t value )
+    {
+        switch ( length )
+        {
+        case eLength::LengthChar:
+            return String::formatString( buffer, _formatSize, spec, static_cast<int>(static_cast<signed char>(value)) );
+        case eLength::LengthShort:
+            return String::formatString( buffer, _formatSize, spec, static_cast<int>(static_cast<short>(value)) );
+        case eLength::LengthLong:
+            return String::formatString( buffer, _formatSize, spec, static_cast<long>(value) );
+        case eLength::LengthLongLong:
+            return String::formatString( buffer, _formatSize, spec, static_cast<long long>(value) );
+        default:
+            return String::formatString( buffer, _formatSize, spec, static_cast<int>(value) );
+        }
+    }
+
+    /**
+     * \brief   Formats the unsigned integer argument with the length modifier of the specification.
+     **/
+    inline int _formatUnsigned( char * buffer, const char * spec, eLength length, uint64_t value )
+    {
+        switch ( length )
+        {
+        case eLength::LengthChar:
+            return String::formatString( buffer, _formatSize, spec, static_cast<unsigned int>(static_cast<unsigned char>(value)) );
+        case eLength::LengthShort:
+            return String::formatString( buffer, _formatSize, spec, static_cast<unsigned int>(static_cast<unsigned short>(value)) );
+        case eLength::LengthLong:
+            return String::formatString( buffer, _formatSize, spec, static_cast<unsigned long>(value) );
+        case eLength::LengthLongLong:
+            return String::formatString( buffer, _formatSize, spec, static_cast<unsigned long long>(value) );
+        default:
+            return String::formatString( buffer, _formatSize, spec, static_cast<unsigned int>(value) );
+        }
+    }
+
+    /**
+     * \brief   Appends the text to the formatted message. Returns the new length of the message.
+     **/
+    inline uint32_t _appendText( char * message, uint32_t msgLen, const char * text, int textLen )
+    {
+        if ( textLen > 0 )
+        {
+            msgLen += NEMemory::memCopy( message + msgLen, NELogging::LOG_MESSAGE_IZE - 1 - msgLen, text, static_cast<uint32_t>(textLen) );
+        }
+
+        return msgLen;
+    }
+
+    /**
+     * \brief   Reads the width or precision of the format specification, which is either
+     *          the number or the '*', which takes the value of the next argument.
+     *          Returns true if the number is read. The value is negative if the argument is negative.
+     **/
+    inline bool _readNumber( const char *& format, const unsigned char *& pos, const unsigned char * end, int & OUT number )
+    {
+        number = 0;
+        if ( *format == '*' )
+        {
+            ++ format;
+            sArgument arg;
+            number = _readArgument( pos, end, arg ) ? static_cast<int>(static_cast<int64_t>(_toInteger(arg))) : 0;
+            return true;
+        }
+
+        bool result{ false };
+        for ( ; (*format >= '0') && (*format <= '9'); ++ format )
+        {
+            number = MACRO_MIN( number * 10 + (*format - '0'), _maxWidth );
+            result = true;
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief   Reads the length modifier of the format specification.
+     **/
+    inline eLength _readLength( const char *& format )
+    {
+        switch ( *format )
+        {
+        case 'h':
+            ++ format;
+            if ( *format == 'h' )
+            {
+                ++ format;
+                return eLength::LengthChar;
+            }
+
+            return eLength::LengthShort;
+
+        case 'l':
+            ++ format;
+            if ( *format == 'l' )
+            {
+                ++ format;
+                return eLength::LengthLongLong;
+            }
+
+            return eLength::LengthLong;
+
+        case 'j':   // fall through
+        case 'z':   // fall through
+        case 't':   // fall through
+        case 'q':
+            ++ format;
+            return eLength::LengthLongLong;
+
+        case 'L':
+            ++ format;
+            return eLength::LengthDouble;
+
+        case 'I':
+            ++ format;
+            if ( (format[0] == '6') && (format[1] == '4') )
+            {
+                format += 2;
+                return eLength::LengthLongLong;
+            }
+            else if ( (format[0] == '3') && (format[1] == '2') )
+            {
+                format += 2;
+                return eLength::LengthNone;
+            }
+
+            return eLength::LengthLongLong;
+
+        default:
+            return eLength::LengthNone;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LogRecord class implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogRecord::LogRecord( unsigned int scopeId
+                    , unsigned int sessionId
+                    , TIME64 scopeStamp
+                    , NELogging::eLogPriority msgPrio
+                    , const char * format
+                    , NELogging::eLogMessageType msgType /*= NELogging::eLogMessageType::LogMessageText*/ )
+    : mSize     ( _headerSize )
+{
+    sRecordHeader header;
+    header.recFormat    = format;
+    header.recCookie    = LogManager::getConnectionCookie();
+    header.recThreadId  = static_cast<ITEM_ID>(Thread::getCurrentThreadId());
+    header.recTimestamp = DateTime::getNow();
+    header.recDuration  = scopeStamp != 0u ? static_cast<unsigned int>(header.recTimestamp - scopeStamp) : 0u;
+    header.recScopeId   = scopeId;
+    header.recSessionId = sessionId;
+    header.recPrio      = msgPrio;
+    header.recMsgType   = msgType;
+    NEMemory::memCopy( mRecord, RECORD_SIZE, reinterpret_cast<const unsigned char *>(&header), _headerSize );
+}
+
+LogRecord::LogRecord( unsigned int scopeId
+                    , unsigned int sessionId
+                    , TIME64 scopeStamp
+                    , NELogging::eLogPriority msgPrio
+                    , const std::string_view & format )
+    : LogRecord( scopeId, sessionId, scopeStamp, msgPrio, static_cast<const char *>(nullptr) )
+{
+    _writeString( format.data(), static_cast<uint32_t>(format.size()) );
+}
+
+void LogRecord::sendRecord( void ) const
+{
+    LogManager::logRecord( mRecord, mSize );
+}
+
+void LogRecord::_writeString( const char * text, uint32_t length )
+{
+    constexpr uint32_t prefix{ static_cast<uint32_t>(sizeof(uint8_t) + sizeof(uint16_t)) };
+    if ( (mSize + prefix) <= RECORD_SIZE )
+    {
+        const uint16_t len{ static_cast<uint16_t>(MACRO_MIN(length, RECORD_SIZE - mSize - prefix)) };
+        mRecord[mSize ++] = static_cast<unsigned char>(eArgType::ArgString);
+        NEMemory::memCopy( mRecord + mSize, sizeof(uint16_t), reinterpret_cast<const unsigned char *>(&len), sizeof(uint16_t) );
+        mSize += sizeof(uint16_t);
+        mSize += NEMemory::memCopy( mRecord + mSize, RECORD_SIZE - mSize, reinterpret_cast<const unsigned char *>(text), len );
+    }
+}
+
+uint32_t LogRecord::formatRecord( const unsigned char * record, uint32_t size, NELogging::sLogMessage & OUT logMessage )
+{
+    logMessage.logMessageLen = 0;
+    logMessage.logMessage[0] = String::EmptyChar;
+    if ( (record == nullptr) || (size < _headerSize) )
+        return 0;
+
+    sRecordHeader header;
+    NEMemory::memCopy( reinterpret_cast<unsigned char *>(&header), _headerSize, record, _headerSize );
+
+    logMessage.logDataType      = NELogging::eLogDataType::LogDataLocal;
+    logMessage.logMsgType       = header.recMsgType;
+    logMessage.logMessagePrio   = header.recPrio;
+    logMessage.logSource        = NEService::COOKIE_LOCAL;
+    logMessage.logTarget        = NEService::COOKIE_LOGGER;
+    logMessage.logCookie        = header.recCookie;
+    logMessage.logModuleId      = Process::getInstance().getId();
+    logMessage.logThreadId      = header.recThreadId;
+    logMessage.logTimestamp     = header.recTimestamp;
+    logMessage.logReceived      = DateTime::INVALID_TIME;
+    logMessage.logDuration      = header.recDuration;
+    logMessage.logScopeId       = header.recScopeId;
+    logMessage.logSessionId     = header.recSessionId;
+
+    const unsigned char * pos{ record + _headerSize };
+    const unsigned char * end{ record + size };
+    const char * format{ header.recFormat != nullptr ? header.recFormat : String::EmptyString };
+    char copied[_formatSize];
+    if ( header.recFormat == nullptr )
+    {
+        // the format is not static and it is copied in the record as the first argument
+        sArgument arg;
+        if ( _readArgument( pos, end, arg ) && (arg.argType == eArgType::ArgString) )
+        {
+            NEMemory::memCopy( reinterpret_cast<unsigned char *>(copied), _formatSize, reinterpret_cast<const unsigned char *>(arg.argText), arg.argLength );
+            copied[arg.argLength] = String::EmptyChar;
+            format = copied;
+        }
+    }
+
+    char * message{ logMessage.logMessage };
+    uint32_t msgLen{ 0 };
+    constexpr uint32_t maxLen{ NELogging::LOG_MESSAGE_IZE - 1 };
+
+    char buffer[_formatSize];
+    char spec[32];
+
+    while ( (*format != String::EmptyChar) && (msgLen < maxLen) )
+    {
+        if ( *format != '%' )
+        {
+            message[msgLen ++] = *format ++;
+            continue;
+        }
+
+        const char * begin{ format ++ };
+        if ( *format == '%' )
+        {
+            message[msgLen ++] = *format ++;
+            continue;
+        }
+
+        // flags, skip the flags, which are not supported on all platforms.
+        uint32_t specLen{ 0 };
+        spec[specLen ++] = '%';
+        for ( ; (*format == '-') || (*format == '+') || (*format == ' ') || (*format == '#') || (*format == '0') || (*format == '\''); ++ format)
+        {
+            if ( (*format != '\'') && (specLen < 8) )
+            {
+                spec[specLen ++] = *format;
+            }
+        }
+
+        // width and precision
+        int width{ 0 };
+        int precision{ -1 };
+        bool hasWidth{ _readNumber( format, pos, end, width ) };
+        if ( hasWidth && (width < 0) )
+        {
+            spec[specLen ++] = '-';
+            width = -width;
+        }
+
+        if ( *format == '.' )
+        {
+            ++ format;
+            _readNumber( format, pos, end, precision );
+        }
+
+        const eLength length{ _readLength( format ) };
+        const char conversion{ *format };
+        if ( conversion == String::EmptyChar )
+        {
+            msgLen = _appendText( message, msgLen, begin, static_cast<int>(format - begin) );
+            break;
+        }
+
+        ++ format;
+        const bool isFloat{ (conversion == 'f') || (conversion == 'F') || (conversion == 'e') || (conversion == 'E') || (conversion == 'g') || (conversion == 'G') || (conversion == 'a') || (conversion == 'A') };
+        if ( hasWidth )
+        {
+            specLen += static_cast<uint32_t>(String::formatString( spec + specLen, 8, "%d", MACRO_MIN(width, _maxWidth) ));
+        }
+
+        if ( precision >= 0 )
+        {
+            specLen += static_cast<uint32_t>(String::formatString( spec + specLen, 8, ".%d", MACRO_MIN(precision, isFloat ? _maxPrecision : _maxWidth) ));
+        }
+
+        sArgument arg;
+        int len{ 0 };
+        switch ( conversion )
+        {
+        case 'd':   // fall through
+        case 'i':
+            if ( _readArgument( pos, end, arg ) )
+            {
+                if ( length == eLength::LengthLongLong )
+                {
+                    spec[specLen ++] = 'l';
+                    spec[specLen ++] = 'l';
+                }
+                else if ( length == eLength::LengthLong )
+                {
+                    spec[specLen ++] = 'l';
+                }
+
+                spec[specLen ++] = conversion;
+                spec[specLen] = String::EmptyChar;
+                len = _formatSigned( buffer, spec, length, static_cast<int64_t>(_toInteger(arg)) );
+            }
+            break;
+
+        case 'u':   // fall through
+        case 'o':   // fall through
+        case 'x':   // fall through
+        case 'X':
+            if ( _readArgument( pos, end, arg ) )
+            {
+                if ( length == eLength::LengthLongLong )
+                {
+                    spec[specLen ++] = 'l';
+                    spec[specLen ++] = 'l';
+                }
+                else if ( length == eLength::LengthLong )
+                {
+                    spec[specLen ++] = 'l';
+                }
+
+                spec[specLen ++] = conversion;
+                spec[specLen] = String::EmptyChar;
+                len = _formatUnsigned( buffer, spec, length, _toInteger(arg) );
+            }
+            break;
+
+        case 'c':
+            if ( _readArgument( pos, end, arg ) )
+            {
+                spec[specLen ++] = conversion;
+                spec[specLen] = String::EmptyChar;
+                len = String::formatString( buffer, _formatSize, spec, static_cast<int>(static_cast<char>(_toInteger(arg))) );
+            }
+            break;
+
+        case 'f':   // fall through
+        case 'F':   // fall through
+        case 'e':   // fall through
+        case 'E':   // fall through
+        case 'g':   // fall through
+        case 'G':   // fall through
+        case 'a':   // fall through
+        case 'A':
+            if ( _readArgument( pos, end, arg ) )
+            {
+                spec[specLen ++] = conversion;
+                spec[specLen] = String::EmptyChar;
+                len = String::formatString( buffer, _formatSize, spec, _toDouble(arg) );
+            }
+            break;
+
+        case 's':
+            if ( _readArgument( pos, end, arg ) )
+            {
+                // the string arguments are not null-terminated in the record.
+                char text[RECORD_SIZE];
+                if ( arg.argType == eArgType::ArgString )
+                {
+                    NEMemory::memCopy( text, RECORD_SIZE, arg.argText, arg.argLength );
+                    text[arg.argLength] = String::EmptyChar;
+                }
+                else
+                {
+                    NEMemory::memCopy( text, RECORD_SIZE, _nullString, static_cast<uint32_t>(sizeof(_nullString)) );
+                }
+
+                spec[specLen ++] = conversion;
+                spec[specLen] = String::EmptyChar;
+                len = String::formatString( buffer, _formatSize, spec, text );
+            }
+            break;
+
+        case 'p':
+            if ( _readArgument( pos, end, arg ) )
+            {
+                spec[specLen ++] = conversion;
+                spec[specLen] = String::EmptyChar;
+                len = String::formatString( buffer, _formatSize, spec, reinterpret_cast<const void *>(static_cast<uintptr_t>(_toInteger(arg))) );
+            }
+            break;
+
+        case 'n':
+            // nothing to output, skip the argument
+            _readArgument( pos, end, arg );
+            break;
+
+        default:
+            // unknown conversion, output as it is.
+            msgLen = _appendText( message, msgLen, begin, static_cast<int>(format - begin) );
+            break;
+        }
+
+        msgLen = _appendText( message, msgLen, buffer, MACRO_MIN(len, static_cast<int>(_formatSize) - 1) );
+    }
+
+    message[msgLen] = String::EmptyChar;
+    logMessage.logMessageLen = msgLen;
+    return msgLen;
+}
+
+#endif  // AREG_LOGS
@@ -0,0 +1,155 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogRingBuffer.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The lock-free ring buffer of log records of one thread.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/logging/private/LogRingBuffer.hpp"
+
+#include "areg/base/NEMemory.hpp"
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The size of the prefix of each entry, which contains the size of the record.
+    constexpr uint32_t  _prefixSize { static_cast<uint32_t>(sizeof(uint32_t)) };
+
+    //!< Returns the capacity aligned to the power of 2.
+    inline uint32_t _alignCapacity( uint32_t capacity )
+    {
+        uint32_t result{ LogRingBuffer::MIN_CAPACITY };
+        while ( (result < capacity) && (result < 0x8000'0000u) )
+        {
+            result <<= 1;
+        }
+
+        return result;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LogRingBuffer class implementation
+//////////////////////////////////////////////////////////////////////////////
+
+LogRingBuffer::LogRingBuffer( uint32_t capacity, ITEM_ID threadId )
+    : mCapacity     ( _alignCapacity(capacity) )
+    , mBuffer       ( DEBUG_NEW unsigned char[mCapacity] )
+    , mThreadId     ( threadId )
+    , mHead         ( 0u )
+    , mTail         ( 0u )
+    , mDropped      ( 0u )
+    , mClosed       ( false )
+    , mPendingSize  ( 0u )
+    , mPending      { 0 }
+{
+}
+
+LogRingBuffer::~LogRingBuffer( void )
+{
+    delete[] mBuffer;
+    mBuffer = nullptr;
+}
+
+bool LogRingBuffer::writeRecord( const unsigned char * record, uint32_t size, bool dropOldest )
+{
+    ASSERT( (size != 0u) && (size <= LogRecord::RECORD_SIZE) );
+
+    const uint32_t entry{ _prefixSize + size };
+    const uint32_t head{ mHead.load( std::memory_order_relaxed ) };
+    uint32_t tail{ mTail.load( std::memory_order_acquire ) };
+    while ( (head - tail + entry) > mCapacity )
+    {
+        if ( dropOldest == false )
+            return false;
+
+        // The data is changed only by the producer, the size of the oldest record is valid
+        // even if the consumer has already moved the tail. In this case the tail is reloaded.
+        uint32_t oldest{ 0u };
+        _copyFrom( tail, reinterpret_cast<unsigned char *>(&oldest), _prefixSize );
+        if ( mTail.compare_exchange_weak( tail, tail + _prefixSize + oldest, std::memory_order_acq_rel, std::memory_order_acquire ) )
+        {
+            tail += _prefixSize + oldest;
+            recordDropped( );
+        }
+    }
+
+    _copyTo( head, reinterpret_cast<const unsigned char *>(&size), _prefixSize );
+    _copyTo( head + _prefixSize, record, size );
+    mHead.store( head + entry, std::memory_order_release );
+    return true;
+}
+
+bool LogRingBuffer::readPending( uint32_t head )
+{
+    if ( mPendingSize != 0u )
+        return true;
+
+    uint32_t tail{ mTail.load( std::memory_order_acquire ) };
+    while ( static_cast<int32_t>(head - tail) > 0 )
+    {
+        // If the producer drops the oldest records, it may overwrite the record
+        // while it is copied. The copy is valid only if the tail is not changed.
+        uint32_t size{ 0u };
+        _copyFrom( tail, reinterpret_cast<unsigned char *>(&size), _prefixSize );
+        const bool isValid{ (size != 0u) && (size <= LogRecord::RECORD_SIZE) };
+        if ( isValid )
+        {
+            _copyFrom( tail + _prefixSize, mPending, size );
+        }
+
+        if ( isValid && mTail.compare_exchange_strong( tail, tail + _prefixSize + size, std::memory_order_acq_rel, std::memory_order_acquire ) )
+        {
+            mPendingSize = size;
+            return true;
+        }
+        else if ( isValid == false )
+        {
+            // The size is invalid if the record is overwritten and the tail is moved.
+            // If the tail is not moved, the records are damaged and are skipped.
+            if ( mTail.load( std::memory_order_acquire ) == tail )
+            {
+                mTail.compare_exchange_strong( tail, head, std::memory_order_acq_rel, std::memory_order_acquire );
+            }
+
+            tail = mTail.load( std::memory_order_acquire );
+        }
+    }
+
+    return false;
+}
+
+inline void LogRingBuffer::_copyFrom( uint32_t position, unsigned char * dst, uint32_t size ) const
+{
+    const uint32_t index{ position & (mCapacity - 1u) };
+    const uint32_t first{ MACRO_MIN( size, mCapacity - index ) };
+    NEMemory::memCopy( dst, size, mBuffer + index, first );
+    if ( first < size )
+    {
+        NEMemory::memCopy( dst + first, size - first, mBuffer, size - first );
+    }
+}
+
+inline void LogRingBuffer::_copyTo( uint32_t position, const unsigned char * src, uint32_t size )
+{
+    const uint32_t index{ position & (mCapacity - 1u) };
+    const uint32_t first{ MACRO_MIN( size, mCapacity - index ) };
+    NEMemory::memCopy( mBuffer + index, first, src, first );
+    if ( first < size )
+    {
+        NEMemory::memCopy( mBuffer, size - first, src + first, size - first );
+    }
+}
+
+#endif  // AREG_LOGS
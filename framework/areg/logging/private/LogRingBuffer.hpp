@@ -0,0 +1,287 @@
+#ifndef AREG_LOGGING_PRIVATE_LOGRINGBUFFER_HPP
+#define AREG_LOGGING_PRIVATE_LOGRINGBUFFER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        areg/logging/private/LogRingBuffer.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, The lock-free ring buffer of log records of one thread.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "areg/base/GEGlobal.h"
+#include "areg/logging/LogRecord.hpp"
+
+#include <atomic>
+
+#if AREG_LOGS
+
+//////////////////////////////////////////////////////////////////////////////
+// LogRingBuffer class declaration
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The lock-free single producer and single consumer ring buffer of
+ *          binary log records. Each thread that logs messages owns one ring
+ *          buffer and is the only producer, and the logging thread is the
+ *          only consumer. Each entry in the buffer is the 32-bit size of the
+ *          record followed by the data of the record. The head and the tail
+ *          are positions that only grow and wrap around the capacity of the
+ *          buffer, which is the power of 2.
+ *
+ *          When the producer drops the oldest records to free the space, it
+ *          moves the tail, which is moved by the consumer as well. In this case
+ *          the consumer copies the record and moves the tail only if it was
+ *          not changed by the producer, otherwise the copy is ignored.
+ *
+ *          The consumer keeps one pending record, which is already removed
+ *          from the ring buffer, to compare timestamps of the records of
+ *          different threads and write them in the order of timestamps.
+ **/
+class LogRingBuffer
+{
+//////////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   The minimum capacity of the ring buffer in bytes.
+     **/
+    static constexpr uint32_t   MIN_CAPACITY    { 4 * LogRecord::RECORD_SIZE };
+
+    /**
+     * \brief   The size of the cache line to separate data changed by producer and consumer.
+     **/
+    static constexpr uint32_t   CACHE_LINE_SIZE { 64 };
+
+//////////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////////
+public:
+    /**
+     * \brief   Allocates the ring buffer. The capacity is aligned to the power of 2
+     *          and is not less than MIN_CAPACITY.
+     * \param   capacity    The capacity in bytes of the ring buffer.
+     * \param   threadId    The ID of the thread, which owns the ring buffer.
+     **/
+    LogRingBuffer( uint32_t capacity, ITEM_ID threadId );
+
+    ~LogRingBuffer( void );
+
+//////////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////////
+public:
+
+/************************************************************************/
+// Producer operations
+/************************************************************************/
+
+    /**
+     * \brief   Writes the log record in the ring buffer.
+     *          Called only by the thread, which owns the ring buffer.
+     * \param   record      The data of the log record.
+     * \param   size        The size in bytes of the log record, should not be bigger than LogRecord::RECORD_SIZE.
+     * \param   dropOldest  If true and there is not enough space, the oldest records
+     *                      are dropped to free the space.
+     * \return  Returns true if the record is written. Returns false if there is no space.
+     **/
+    bool writeRecord( const unsigned char * record, uint32_t size, bool dropOldest );
+
+    /**
+     * \brief   Increases the number of dropped log records.
+     **/
+    inline void recordDropped( void );
+
+    /**
+     * \brief   Marks the ring buffer as closed when the thread owning it exits.
+     **/
+    inline void closeBuffer( void );
+
+/************************************************************************/
+// Consumer operations
+/************************************************************************/
+
+    /**
+     * \brief   Returns the current head position. The consumer reads the records up to this position.
+     **/
+    inline uint32_t getHead( void ) const;
+
+    /**
+     * \brief   Removes the next record from the ring buffer and makes it pending.
+     *          The record is read only if there is no pending record and the
+     *          position of the record is before the specified head position.
+     * \param   head    The head position up to which the records are read.
+     * \return  Returns true if there is a pending record.
+     **/
+    bool readPending( uint32_t head );
+
+    /**
+     * \brief   Returns true if the ring buffer has pending record.
+     **/
+    inline bool hasPending( void ) const;
+
+    /**
+     * \brief   Returns the timestamp of the pending record.
+     **/
+    inline TIME64 getPendingTimestamp( void ) const;
+
+    /**
+     * \brief   Returns the data of the pending record.
+     **/
+    inline const unsigned char * getPendingData( void ) const;
+
+    /**
+     * \brief   Returns the size of the pending record.
+     **/
+    inline uint32_t getPendingSize( void ) const;
+
+    /**
+     * \brief   Releases the pending record.
+     **/
+    inline void releasePending( void );
+
+    /**
+     * \brief   Returns the number of dropped records since last call and resets the counter.
+     **/
+    inline uint32_t takeDropped( void );
+
+    /**
+     * \brief   Returns true if the thread owning the ring buffer exited and there are no records.
+     **/
+    inline bool isExpired( void ) const;
+
+    /**
+     * \brief   Returns the capacity of the ring buffer in bytes.
+     **/
+    inline uint32_t getCapacity( void ) const;
+
+    /**
+     * \brief   Returns the ID of the thread, which owns the ring buffer.
+     **/
+    inline const ITEM_ID & getThreadId( void ) const;
+
+//////////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Copies data from the ring buffer starting at the specified position.
+     **/
+    inline void _copyFrom( uint32_t position, unsigned char * dst, uint32_t size ) const;
+
+    /**
+     * \brief   Copies data into the ring buffer starting at the specified position.
+     **/
+    inline void _copyTo( uint32_t position, const unsigned char * src, uint32_t size );
+
+//////////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////////
+private:
+    //!< The capacity of the ring buffer, the power of 2.
+    const uint32_t          mCapacity;
+    //!< The data of the ring buffer.
+    unsigned char *         mBuffer;
+    //!< The ID of the thread, which owns the ring buffer.
+    const ITEM_ID           mThreadId;
+    //!< The position to write next record. Changed only by producer.
+    alignas(CACHE_LINE_SIZE)
+    std::atomic<uint32_t>   mHead;
+    //!< The position to read next record. Changed by consumer, and by producer when drops the oldest records.
+    alignas(CACHE_LINE_SIZE)
+    std::atomic<uint32_t>   mTail;
+    //!< The number of dropped records.
+    std::atomic<uint32_t>   mDropped;
+    //!< Flag, indicating that the thread owning the ring buffer exited.
+    std::atomic_bool        mClosed;
+    //!< The size of the pending record, 0 if there is no pending record. Accessed only by consumer.
+    alignas(CACHE_LINE_SIZE)
+    uint32_t                mPendingSize;
+    //!< The pending record. Accessed only by consumer.
+    unsigned char           mPending[LogRecord::RECORD_SIZE];
+
+//////////////////////////////////////////////////////////////////////////////
+// Forbidden methods
+//////////////////////////////////////////////////////////////////////////////
+private:
+    LogRingBuffer( void ) = delete;
+    DECLARE_NOCOPY_NOMOVE( LogRingBuffer );
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// LogRingBuffer class inline methods
+//////////////////////////////////////////////////////////////////////////////
+
+inline void LogRingBuffer::recordDropped( void )
+{
+    mDropped.fetch_add( 1u, std::memory_order_relaxed );
+}
+
+inline void LogRingBuffer::closeBuffer( void )
+{
+    mClosed.store( true, std::memory_order_release );
+}
+
+inline uint32_t LogRingBuffer::getHead( void ) const
+{
+    return mHead.load( std::memory_order_acquire );
+}
+
+inline bool LogRingBuffer::hasPending( void ) const
+{
+    return (mPendingSize != 0u);
+}
+
+inline TIME64 LogRingBuffer::getPendingTimestamp( void ) const
+{
+    TIME64 result{ 0 };
+    NEMemory::memCopy( reinterpret_cast<unsigned char *>(&result), sizeof(TIME64), mPending + offsetof(LogRecord::sRecordHeader, recTimestamp), sizeof(TIME64) );
+    return result;
+}
+
+inline const unsigned char * LogRingBuffer::getPendingData( void ) const
+{
+    return mPending;
+}
+
+inline uint32_t LogRingBuffer::getPendingSize( void ) const
+{
+    return mPendingSize;
+}
+
+inline void LogRingBuffer::releasePending( void )
+{
+    mPendingSize = 0u;
+}
+
+inline uint32_t LogRingBuffer::takeDropped( void )
+{
+    return mDropped.exchange( 0u, std::memory_order_relaxed );
+}
+
+inline bool LogRingBuffer::isExpired( void ) const
+{
+    return mClosed.load( std::memory_order_acquire ) && (mPendingSize == 0u) && (mHead.load( std::memory_order_acquire ) == mTail.load( std::memory_order_acquire ));
+}
+
+inline uint32_t LogRingBuffer::getCapacity( void ) const
+{
+    return mCapacity;
+}
+
+inline const ITEM_ID & LogRingBuffer::getThreadId( void ) const
+{
+    return mThreadId;
+}
+
+#endif  // AREG_LOGS
+
+#endif  // AREG_LOGGING_PRIVATE_LOGRINGBUFFER_HPP
@@ -64,6 +64,7 @@ public:
         , LoggingLogMessage     //!< Action to output logging message
         , LoggingUpdateScopes   //!< Action to update scope priorities
         , LoggingQueryScopes    //!< Action to send the list of scopes.
+        , LoggingDrainRecords   //!< Action to format and output binary log records written in the ring buffers of threads
     } eLoggingAction;
 
     /**
@@ -202,6 +203,7 @@ inline const char * LoggingEventData::getString( LoggingEventData::eLoggingActio
     CASE_MAKE_STRING(LoggingEventData::eLoggingAction::LoggingLogMessage);
     CASE_MAKE_STRING(LoggingEventData::eLoggingAction::LoggingUpdateScopes);
     CASE_MAKE_STRING(LoggingEventData::eLoggingAction::LoggingQueryScopes);
+    CASE_MAKE_STRING(LoggingEventData::eLoggingAction::LoggingDrainRecords);
     CASE_DEFAULT("ERR: Undefined LoggingEventData::eLoggingAction value!");
     }
 }
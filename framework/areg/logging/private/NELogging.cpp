@@ -483,6 +483,20 @@ AREG_API_IMPL RemoteMessage NELogging::messageConfigurationSaved(void)
     return msgScope;
 }
 
+AREG_API_IMPL RemoteMessage NELogging::messageObserverFilter(const ITEM_ID & source, const NELogging::sObserverFilter & filter)
+{
+    RemoteMessage msgFilter;
+    if ((source != NEService::COOKIE_UNKNOWN) && (msgFilter.initMessage(_getLogEmptyMessage().rbHeader) != nullptr))
+    {
+        msgFilter.setMessageId(static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogObserverFilter));
+        msgFilter.setTarget(NEService::COOKIE_LOGGER);
+        msgFilter.setSource(source);
+        msgFilter << filter;
+    }
+
+    return msgFilter;
+}
+
 AREG_API_IMPL void NELogging::setLogDatabaseEngine(IELogDatabaseEngine * dbEngine)
 {
     LogManager::setLogDatabaseEngine(dbEngine);
@@ -656,6 +670,12 @@ AREG_API_IMPL RemoteMessage NELogging::messageConfigurationSaved(void)
     return msgScope;
 }
 
+AREG_API_IMPL RemoteMessage NELogging::messageObserverFilter(const ITEM_ID & /*source*/, const NELogging::sObserverFilter & /*filter*/)
+{
+    RemoteMessage msgFilter;
+    return msgFilter;
+}
+
 AREG_API_IMPL void NELogging::setLogDatabaseEngine(IELogDatabaseEngine * /*dbEngine*/)
 {
 }
@@ -22,6 +22,7 @@
 #include "areg/appbase/Application.hpp"
 #include "areg/base/RemoteMessage.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/component/private/TimerManager.hpp"
 #include "areg/persist/ConfigManager.hpp"
 #include "areg/logging/private/LogManager.hpp"
 #include "areg/logging/private/ScopeController.hpp"
@@ -40,10 +41,17 @@ NetTcpLogger::NetTcpLogger(LogConfiguration & logConfig, ScopeController & scope
                                     , NetTcpLogger::PREFIX_THREAD)
     , IEServiceConnectionConsumer   ( )
     , IERemoteMessageHandler        ( )
+    , IETimerConsumer               ( )
 
     , mScopeController  ( scopeController )
     , mIsEnabled        ( false )
     , mRingStack        ( 0, NECommon::eRingOverlap::ShiftOnOverlap )
+    , mBatch            ( )
+    , mBatchSize        ( 0u )
+    , mBatchLinger      ( 0u )
+    , mTimerBatch       ( static_cast<IETimerConsumer &>(self()), String(NetTcpLogger::PREFIX_THREAD) + NetTcpLogger::BATCH_TIMER_NAME )
+    , mTimerThreadId    ( Thread::INVALID_THREAD_ID )
+    , mDefineNames      ( false )
 {
 }
 
@@ -59,6 +67,10 @@ bool NetTcpLogger::openLogger(void)
         {
             registerForServiceClientCommands();
             mRingStack.reserve(mLogConfiguration.getStackSize());
+            mBatchSize  = mLogConfiguration.getRemoteBatch();
+            mBatchLinger= mLogConfiguration.getRemoteLinger();
+            mBatch.resetNames();
+            mBatch.clearBatch();
 
             String host{ mLogConfiguration.getRemoteTcpAddress()};
             uint16_t port{ mLogConfiguration.getRemoteTcpPort() };
@@ -82,6 +94,8 @@ bool NetTcpLogger::openLogger(void)
 
 void NetTcpLogger::closeLogger(void)
 {
+    mTimerBatch.stopTimer();
+    _sendBatch();
     mRingStack.release();
     onServiceExit();
     unregisterForServiceClientCommands();
@@ -93,7 +107,14 @@ void NetTcpLogger::logMessage(const NELogging::sLogMessage& logMessage)
     {
         if (mChannel.isValid() && isConnectState())
         {
-            sendMessage(NELogging::createLogMessage(logMessage, NELogging::eLogDataType::LogDataRemote, mChannel.getCookie()), Event::eEventPriority::EventPriorityNormal);
+            if (mBatchSize != 0)
+            {
+                _batchMessage(logMessage);
+            }
+            else
+            {
+                sendMessage(NELogging::createLogMessage(logMessage, NELogging::eLogDataType::LogDataRemote, mChannel.getCookie()), Event::eEventPriority::EventPriorityNormal);
+            }
         }
         else if (mRingStack.capacity() != 0)
         {
@@ -108,6 +129,14 @@ bool NetTcpLogger::isLoggerOpened(void) const
     return isConnectedState();
 }
 
+void NetTcpLogger::flushLogs(void)
+{
+    if ((mBatch.isEmpty() == false) && (mTimerBatch.isActive() == false))
+    {
+        _sendBatch();
+    }
+}
+
 void NetTcpLogger::connectedRemoteServiceChannel(const Channel & channel)
 {
     ASSERT(channel.isValid());
@@ -116,11 +145,22 @@ void NetTcpLogger::connectedRemoteServiceChannel(const Channel & channel)
 
     mIsEnabled = true;
     const ITEM_ID& cookie = channel.getCookie();
+
+    // The queued batches refer to the names sent in the previous connection, send the names first.
+    mDefineNames.store(false);
+    mBatch.clearBatch();
+    mBatch.defineNames();
+    _sendBatch();
+
     while (mRingStack.isEmpty() == false)
     {
         RemoteMessage msgLog{ mRingStack.pop() };
         msgLog.setSource(cookie);
-        reinterpret_cast<NELogging::sLogMessage*>(msgLog.getBuffer())->logCookie = cookie;
+        if (msgLog.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage))
+        {
+            reinterpret_cast<NELogging::sLogMessage*>(msgLog.getBuffer())->logCookie = cookie;
+        }
+
         sendMessage(msgLog, Event::eEventPriority::EventPriorityNormal);
     }
 }
@@ -128,6 +168,7 @@ void NetTcpLogger::connectedRemoteServiceChannel(const Channel & channel)
 void NetTcpLogger::disconnectedRemoteServiceChannel(const Channel & /* channel */)
 {
     ASSERT(mChannel.isValid() == false);
+    _queueBatch();
     mIsEnabled = false;
     mClientConnection.setCookie(NEService::COOKIE_UNKNOWN);
 }
@@ -135,6 +176,7 @@ void NetTcpLogger::disconnectedRemoteServiceChannel(const Channel & /* channel *
 void NetTcpLogger::lostRemoteServiceChannel(const Channel & /* channel */)
 {
     ASSERT(mChannel.isValid() == false);
+    _queueBatch();
     mClientConnection.setCookie(NEService::COOKIE_UNKNOWN);
 }
 
@@ -190,6 +232,8 @@ void NetTcpLogger::processReceivedMessage(const RemoteMessage & msgReceived, Soc
 
         case NEService::eFuncIdRange::ServiceLogQueryScopes:
             {
+                // The scopes are queried by newly connected observer, which does not know the names sent in the batches.
+                mDefineNames.store(true);
                 const NELogging::ScopeList & scopes{ static_cast<const NELogging::ScopeList &>(mScopeController.getScopeList()) };
                 const ITEM_ID & targetId{ msgReceived.getSource() };
                 sendMessage(NELogging::messageRegisterScopes(mChannel.getCookie(), targetId, scopes));
@@ -220,6 +264,9 @@ void NetTcpLogger::processReceivedMessage(const RemoteMessage & msgReceived, Soc
         case NEService::eFuncIdRange::ServiceLogScopesUpdated:          // fall through
         case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
         case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+        case NEService::eFuncIdRange::ServiceMulticastMessage:          // fall through
+        case NEService::eFuncIdRange::ServiceLogMessageBatch:           // fall through
+        case NEService::eFuncIdRange::ServiceLogObserverFilter:         // fall through
         case NEService::eFuncIdRange::AttributeLastId:                  // fall through
         case NEService::eFuncIdRange::AttributeFirstId:                 // fall through
         case NEService::eFuncIdRange::ResponseLastId:                   // fall through
@@ -233,4 +280,63 @@ void NetTcpLogger::processReceivedMessage(const RemoteMessage & msgReceived, Soc
     }
 }
 
+void NetTcpLogger::processTimer(Timer & /* timer */)
+{
+    _sendBatch();
+}
+
+void NetTcpLogger::_batchMessage(const NELogging::sLogMessage & logMessage)
+{
+    if (mDefineNames.exchange(false))
+    {
+        mBatch.defineNames();
+    }
+
+    mBatch.addMessage(logMessage);
+    if (mBatch.getSize() >= mBatchSize)
+    {
+        _sendBatch();
+    }
+    else if ((mBatchLinger != 0) && (mTimerBatch.isActive() == false))
+    {
+        // The messages of the logging and timer threads do not start the timer.
+        // Otherwise, the logs of the timer would start the timer again and again.
+        if (mTimerThreadId == Thread::INVALID_THREAD_ID)
+        {
+            Thread * timerThread{ Thread::findThreadByName(TimerManager::TIMER_THREAD_NAME) };
+            mTimerThreadId = timerThread != nullptr ? timerThread->getId() : Thread::INVALID_THREAD_ID;
+        }
+
+        const id_type threadId{ static_cast<id_type>(logMessage.logThreadId) };
+        if ((threadId != Thread::getCurrentThreadId()) && (threadId != mTimerThreadId) &&
+            (mTimerBatch.startTimer(mBatchLinger, mMessageDispatcher, 1) == false))
+        {
+            // The timer manager is not running, send the batches when there are no more messages to log.
+            mTimerBatch.stopTimer();
+            mBatchLinger = 0;
+        }
+    }
+}
+
+void NetTcpLogger::_sendBatch(void)
+{
+    if (mBatch.isEmpty() == false)
+    {
+        sendMessage(mBatch.createBatch(mChannel.getCookie()), Event::eEventPriority::EventPriorityNormal);
+    }
+}
+
+void NetTcpLogger::_queueBatch(void)
+{
+    mTimerBatch.stopTimer();
+    if (mBatch.isEmpty() == false)
+    {
+        RemoteMessage msgBatch{ mBatch.createBatch(mChannel.getCookie()) };
+        if (mRingStack.capacity() != 0)
+        {
+            mRingStack.push(msgBatch);
+        }
+    }
+}
+
 #endif  // AREG_LOGS
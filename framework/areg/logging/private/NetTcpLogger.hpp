@@ -30,8 +30,12 @@
 #include "areg/base/Thread.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/component/IETimerConsumer.hpp"
+#include "areg/component/Timer.hpp"
 #include "areg/ipc/ClientConnection.hpp"
+#include "areg/logging/LogBatch.hpp"
 
+#include <atomic>
 #include <string_view>
 
 #if AREG_LOGS
@@ -51,11 +55,16 @@ class SharedBuffer;
  * \brief   Network TCP/IP logging object to log messages to remote device.
  *          The object uses TCP/IP connection to the remote log collector service
  *          and forwards log messages to the remote service.
+ *
+ *          If the batching is enabled, the log messages are encoded in the batch,
+ *          which is sent when it reaches the configured size, when the linger
+ *          timeout expires, or when the logging thread has no more messages to log.
  **/
 class NetTcpLogger  : public    LoggerBase
                     , public    ServiceClientConnectionBase
                     , private   IEServiceConnectionConsumer
                     , private   IERemoteMessageHandler
+                    , private   IETimerConsumer
 {
 //////////////////////////////////////////////////////////////////////////
 // Internal types and constants.
@@ -67,6 +76,9 @@ private:
     //!< A prefix to add in front of thread and timer names.
     static constexpr std::string_view   PREFIX_THREAD{ "logger_" };
 
+    //!< The name of the timer to send the incomplete batch of log messages.
+    static constexpr std::string_view   BATCH_TIMER_NAME{ "batch_timer" };
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -119,6 +131,18 @@ public:
      **/
     virtual bool isLoggerOpened( void ) const override;
 
+//////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Called when the logging thread has no more messages to log.
+     *          Sends the incomplete batch of log messages, if the linger timer
+     *          is not running.
+     **/
+    void flushLogs( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -179,6 +203,16 @@ private:
      **/
     virtual void processReceivedMessage( const RemoteMessage & msgReceived, Socket & whichSource ) override;
 
+/************************************************************************/
+// IETimerConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Triggered when the linger timer is expired to send the batch of log messages.
+     * \param   timer   The expired timer.
+     **/
+    virtual void processTimer( Timer & timer ) override;
+
 //////////////////////////////////////////////////////////////////////////
 // Hidden methods
 //////////////////////////////////////////////////////////////////////////
@@ -187,6 +221,24 @@ private:
 // Internal methods
 /************************************************************************/
 
+    /**
+     * \brief   Adds the log message in the batch and sends the batch if it reaches the size.
+     *          Starts the linger timer when the batch receives the first message of the
+     *          application thread.
+     **/
+    void _batchMessage( const NELogging::sLogMessage & logMessage );
+
+    /**
+     * \brief   Sends the batch of log messages, if it is not empty.
+     **/
+    void _sendBatch( void );
+
+    /**
+     * \brief   Moves the batch of log messages in the ring stack, if it is not empty.
+     *          Called when the connection is lost to send the messages when connected again.
+     **/
+    void _queueBatch( void );
+
     //!< Wrapper of 'this' pointer.
     inline NetTcpLogger& self(void);
 
@@ -200,6 +252,18 @@ private:
     bool                mIsEnabled;
     //!< The ring stack to queue log messages if the connection setup did not complete yet.
     RingStack           mRingStack;
+    //!< The encoder of the batch of log messages.
+    LogBatchEncoder     mBatch;
+    //!< The size in bytes of the batch of log messages. The value 0 disables the batching.
+    uint32_t            mBatchSize;
+    //!< The timeout in milliseconds to send the incomplete batch of log messages.
+    uint32_t            mBatchLinger;
+    //!< The timer to send the incomplete batch of log messages.
+    Timer               mTimerBatch;
+    //!< The ID of the thread of the timer manager.
+    id_type             mTimerThreadId;
+    //!< The flag, indicating that the names of the module and threads should be sent again.
+    std::atomic_bool    mDefineNames;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -15,26 +15,43 @@
 
 #include "areg/logging/ScopeMessage.hpp"
 
+#include "areg/base/DateTime.hpp"
+#include "areg/logging/LogRecord.hpp"
 #include "areg/logging/LogScope.hpp"
-#include "areg/logging/private/LogMessage.hpp"
-#include "areg/logging/private/LoggingEvent.hpp"
-#include "areg/logging/private/LogManager.hpp"
 
 #include <stdarg.h>
+#include <string_view>
 
 #if AREG_LOGS
 
+namespace
+{
+    //!< The format of the log record, which contains the text of the message or the name of the scope.
+    constexpr char  _textFormat[]   { "%s" };
+
+    /**
+     * \brief   Returns true if the scope or any log message of the scope is enabled.
+     *          Otherwise, the scope message neither starts the session nor gets the
+     *          timestamp, so that the disabled scope does not cost more than the check.
+     **/
+    inline bool _isScopeActive( const LogScope & logScope )
+    {
+        return (logScope.getPriority( ) > static_cast<unsigned int>(NELogging::eLogPriority::PrioNotset));
+    }
+}
+
 ScopeMessage::ScopeMessage( const LogScope & logScope )
     : mScopeName( logScope.getScopeName() )
     , mScopeId  ( logScope.mScopeId       )
-    , mSessionId( logScope.nextSession()  )
-    , mTimestamp( DateTime::getNow()      )
+    , mSessionId( _isScopeActive(logScope) ? logScope.nextSession() : 0u )
+    , mTimestamp( _isScopeActive(logScope) ? DateTime::getNow().getTime() : 0u )
     , mScopePrio( logScope.mScopePrio     )
 {
     if ( isScopeEnabled() )
     {
-        LogMessage msg{ NELogging::eLogMessageType::LogMessageScopeEnter, mScopeId, mSessionId, 0u, NELogging::PrioScope, mScopeName };
-        LogManager::logMessage(msg);
+        LogRecord record( mScopeId, mSessionId, 0u, NELogging::PrioScope, _textFormat, NELogging::eLogMessageType::LogMessageScopeEnter );
+        record.addArgument( mScopeName );
+        record.sendRecord( );
     }
 }
 
@@ -42,8 +59,9 @@ ScopeMessage::~ScopeMessage( void )
 {
     if ( isScopeEnabled() )
     {
-        LogMessage msg{ NELogging::eLogMessageType::LogMessageScopeExit, mScopeId, mSessionId, mTimestamp, NELogging::PrioScope, mScopeName };
-        LogManager::logMessage(msg);
+        LogRecord record( mScopeId, mSessionId, mTimestamp, NELogging::PrioScope, _textFormat, NELogging::eLogMessageType::LogMessageScopeExit );
+        record.addArgument( mScopeName );
+        record.sendRecord( );
     }
 }
 
@@ -120,9 +138,16 @@ void ScopeMessage::log( NELogging::eLogPriority logPrio, const char * format, ..
 
 inline void ScopeMessage::_sendLog( unsigned int scopeId, unsigned int sessionId, TIME64 scopeStamp, NELogging::eLogPriority msgPrio, const char * format, va_list args )
 {
-    LogMessage logData(NELogging::eLogMessageType::LogMessageText, scopeId, sessionId, scopeStamp, msgPrio, nullptr, 0);
-    logData.logMessageLen = static_cast<uint32_t>(String::formatStringList( logData.logMessage, NELogging::LOG_MESSAGE_IZE, format, args ));
-    LogManager::logMessage( logData );
+    char text[NELogging::LOG_MESSAGE_IZE];
+    int len = String::formatStringList( text, NELogging::LOG_MESSAGE_IZE, format, args );
+    ScopeMessage::_sendText( scopeId, sessionId, scopeStamp, msgPrio, text, len );
+}
+
+void ScopeMessage::_sendText( unsigned int scopeId, unsigned int sessionId, TIME64 scopeStamp, NELogging::eLogPriority msgPrio, const char * text, int length )
+{
+    LogRecord record( scopeId, sessionId, scopeStamp, msgPrio, _textFormat );
+    record.addArgument( std::string_view( text, static_cast<uint32_t>(MACRO_MIN( MACRO_MAX( length, 0 ), static_cast<int>(NELogging::LOG_MESSAGE_IZE) - 1 )) ) );
+    record.sendRecord( );
 }
 
 #else   // AREG_LOGS
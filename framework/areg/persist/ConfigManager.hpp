@@ -742,6 +742,134 @@ public:
      **/
     void setRemoteServicePort(NERemoteService::eRemoteServices serviceType, NERemoteService::eConnectionTypes connectType, uint16_t newValue, bool isTemporary = false);
 
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the remote service.
+     *          Returns NEApplication::DEFAULT_SERVICE_WORKERS if the property is not set.
+     * \param   service     The string value of the remote service.
+     **/
+    uint32_t getRemoteServiceWorkers(const String& service) const;
+
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the remote service.
+     *          Returns NEApplication::DEFAULT_SERVICE_WORKERS if the property is not set.
+     * \param   serviceType The remote service.
+     **/
+    uint32_t getRemoteServiceWorkers(NERemoteService::eRemoteServices serviceType) const;
+
+    /**
+     * \brief   Sets the number of threads to send and receive messages of the remote service.
+     * \param   service     The string value of the remote service.
+     * \param   newValue    The number of threads to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceWorkers(const String& service, uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Sets the number of threads to send and receive messages of the remote service.
+     * \param   serviceType The remote service.
+     * \param   newValue    The number of threads to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceWorkers(NERemoteService::eRemoteServices serviceType, uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the flag, indicating whether the remote service verifies the checksum of received messages.
+     *          Returns NEApplication::DEFAULT_SERVICE_CHECKSUM if the property is not set.
+     * \param   service     The string value of the remote service.
+     **/
+    bool getRemoteServiceChecksum(const String& service) const;
+
+    /**
+     * \brief   Returns the flag, indicating whether the remote service verifies the checksum of received messages.
+     *          Returns NEApplication::DEFAULT_SERVICE_CHECKSUM if the property is not set.
+     * \param   serviceType The remote service.
+     **/
+    bool getRemoteServiceChecksum(NERemoteService::eRemoteServices serviceType) const;
+
+    /**
+     * \brief   Sets the flag, indicating whether the remote service verifies the checksum of received messages.
+     * \param   service     The string value of the remote service.
+     * \param   newValue    The flag to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceChecksum(const String& service, bool newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Sets the flag, indicating whether the remote service verifies the checksum of received messages.
+     * \param   serviceType The remote service.
+     * \param   newValue    The flag to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceChecksum(NERemoteService::eRemoteServices serviceType, bool newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the maximum number of messages of the remote service sent by one system call.
+     *          Returns NEApplication::DEFAULT_SERVICE_BATCH if the property is not set.
+     * \param   service     The string value of the remote service.
+     **/
+    uint32_t getRemoteServiceBatch(const String& service) const;
+
+    /**
+     * \brief   Returns the maximum number of messages of the remote service sent by one system call.
+     *          Returns NEApplication::DEFAULT_SERVICE_BATCH if the property is not set.
+     * \param   serviceType The remote service.
+     **/
+    uint32_t getRemoteServiceBatch(NERemoteService::eRemoteServices serviceType) const;
+
+    /**
+     * \brief   Sets the maximum number of messages of the remote service sent by one system call.
+     * \param   service     The string value of the remote service.
+     * \param   newValue    The number of messages to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceBatch(const String& service, uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Sets the maximum number of messages of the remote service sent by one system call.
+     * \param   serviceType The remote service.
+     * \param   newValue    The number of messages to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceBatch(NERemoteService::eRemoteServices serviceType, uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the timeout in milliseconds to wait for more messages of the remote service to send by one system call.
+     *          Returns NEApplication::DEFAULT_SERVICE_LINGER if the property is not set.
+     * \param   service     The string value of the remote service.
+     **/
+    uint32_t getRemoteServiceLinger(const String& service) const;
+
+    /**
+     * \brief   Returns the timeout in milliseconds to wait for more messages of the remote service to send by one system call.
+     *          Returns NEApplication::DEFAULT_SERVICE_LINGER if the property is not set.
+     * \param   serviceType The remote service.
+     **/
+    uint32_t getRemoteServiceLinger(NERemoteService::eRemoteServices serviceType) const;
+
+    /**
+     * \brief   Sets the timeout in milliseconds to wait for more messages of the remote service to send by one system call.
+     * \param   service     The string value of the remote service.
+     * \param   newValue    The timeout in milliseconds to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceLinger(const String& service, uint32_t newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Sets the timeout in milliseconds to wait for more messages of the remote service to send by one system call.
+     * \param   serviceType The remote service.
+     * \param   newValue    The timeout in milliseconds to set.
+     * \param   isTemporary Flag, indicating whether the modification is temporary or not.
+     *                      The temporary changes are not saved in the configuration file.
+     **/
+    void setRemoteServiceLinger(NERemoteService::eRemoteServices serviceType, uint32_t newValue, bool isTemporary = false);
+
     /**
      * \brief   Returns the log database property entry of specified position.
      * \param   whichPosition   The position of log database property.
@@ -758,6 +886,54 @@ public:
      **/
     void setLogDatabaseProperty(const String & whichPosition, const String & newValue, bool isTemporary = false);
 
+    /**
+     * \brief   Returns the property entry of the ring buffer of log records of specified position.
+     * \param   whichPosition   The position of the property of log ring buffer.
+     **/
+    String getLogRingProperty(const String& whichPosition);
+
+    /**
+     * \brief   Sets the permanent or temporary value of the ring buffer of log records of the specified position.
+     * \param   whichPosition   The position of the property of log ring buffer to set the value.
+     * \param   newValue        The value to set for the specified position.
+     * \param   isTemporary     The flag, indicating whether the new value is permanent of temporary.
+     *                          Unlike the permanent value, the temporary values are not saved in
+     *                          the configuration file.
+     **/
+    void setLogRingProperty(const String & whichPosition, const String & newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the property entry of the log file of specified position.
+     * \param   whichPosition   The position of the property of log file.
+     **/
+    String getLogFileProperty(const String& whichPosition);
+
+    /**
+     * \brief   Sets the permanent or temporary value of the log file of the specified position.
+     * \param   whichPosition   The position of the property of log file to set the value.
+     * \param   newValue        The value to set for the specified position.
+     * \param   isTemporary     The flag, indicating whether the new value is permanent of temporary.
+     *                          Unlike the permanent value, the temporary values are not saved in
+     *                          the configuration file.
+     **/
+    void setLogFileProperty(const String & whichPosition, const String & newValue, bool isTemporary = false);
+
+    /**
+     * \brief   Returns the property entry of the remote logging of specified position.
+     * \param   whichPosition   The position of the property of remote logging.
+     **/
+    String getLogRemoteProperty(const String& whichPosition);
+
+    /**
+     * \brief   Sets the permanent or temporary value of the remote logging of the specified position.
+     * \param   whichPosition   The position of the property of remote logging to set the value.
+     * \param   newValue        The value to set for the specified position.
+     * \param   isTemporary     The flag, indicating whether the new value is permanent of temporary.
+     *                          Unlike the permanent value, the temporary values are not saved in
+     *                          the configuration file.
+     **/
+    void setLogRemoteProperty(const String & whichPosition, const String & newValue, bool isTemporary = false);
+
     /**
      * \brief   Returns the buffer default block size set in the configuration file.
      * \param   whichModule     The name of the module or `*` for generic settings.
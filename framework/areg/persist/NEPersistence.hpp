@@ -185,7 +185,28 @@ namespace NEPersistence
         , EntryDefaultMessageQueue  = 28    //!< The default size of message queue in the dispatcher thread. The default `0` means to ignore the limitation, increase by need.
         , EntryDefaultQueueType     = 29
 
-        , EntryAnyKey               = 30    //!< Indicates any key type.
+        , EntryServiceWorkers       = 30    //!< The number of threads to send and receive messages of the remote service.
+
+        , EntryLogDatabaseBatch     = 31    //!< The maximum number of log rows inserted in one database transaction.
+        , EntryLogDatabaseFlush     = 32    //!< The timeout in milliseconds to commit pending log rows in the database.
+        , EntryLogDatabaseJournal   = 33    //!< The journal mode of the log database.
+        , EntryLogDatabaseSync      = 34    //!< The synchronous mode of the log database.
+        , EntryLogDatabaseSearch    = 35    //!< The flag to enable the full-text search index of the log database.
+        , EntryLogRingSize          = 36    //!< The size in bytes of the ring buffer of log records of each thread.
+        , EntryLogRingOverflow      = 37    //!< The policy when the ring buffer of log records is full.
+        , EntryLogFileBuffer        = 38    //!< The size in bytes of the buffer to write logs in the file.
+        , EntryLogFileFlush         = 39    //!< The timeout in milliseconds to write buffered logs in the file.
+        , EntryLogFileMaxSize       = 40    //!< The size in bytes of the log file to rotate.
+        , EntryLogFilePeriod        = 41    //!< The period in seconds to rotate the log file.
+        , EntryLogFileCompress      = 42    //!< The flag to compress rotated log files.
+        , EntryLogRemoteBatch       = 43    //!< The size in bytes of the batch of remote log messages.
+        , EntryLogRemoteLinger      = 44    //!< The timeout in milliseconds to send incomplete batch of remote log messages.
+
+        , EntryServiceChecksum      = 45    //!< The flag to verify the checksum of messages received by the remote service.
+        , EntryServiceBatch         = 46    //!< The maximum number of messages sent by one system call.
+        , EntryServiceLinger        = 47    //!< The timeout in milliseconds to wait for more messages to send in one system call.
+
+        , EntryAnyKey               = 48    //!< Indicates any key type.
     };
 
     /**
@@ -230,7 +251,30 @@ namespace NEPersistence
             , {"config" , "*"   , "default" , "messagequeue"    }   //! 28  , The default message queue size in the dispatcher thread.
             , {"config" , "*"   , "default" , "fixedqueue"      }   //! 29  , The type of message queue -- either fixed or dynamic.
 
-            , {"*"      , "*"   , "*"       , "*"               }   //! 30  , Indicates any key type.
+            , {"*"      , "*"   , "workers" , ""                }   //! 30  , The number of threads to send and receive messages of the remote service.
+
+            , {"log"    , "*"   , "db"      , "batch"           }   //! 31  , The maximum number of log rows inserted in one database transaction.
+            , {"log"    , "*"   , "db"      , "flush"           }   //! 32  , The timeout in milliseconds to commit pending log rows in the database.
+            , {"log"    , "*"   , "db"      , "journal"         }   //! 33  , The journal mode of the log database.
+            , {"log"    , "*"   , "db"      , "sync"            }   //! 34  , The synchronous mode of the log database.
+            , {"log"    , "*"   , "db"      , "search"          }   //! 35  , The flag to enable the full-text search index of the log database.
+
+            , {"log"    , "*"   , "ring"    , "size"            }   //! 36  , The size in bytes of the ring buffer of log records of each thread.
+            , {"log"    , "*"   , "ring"    , "overflow"        }   //! 37  , The policy when the ring buffer of log records is full: block, drop-newest or drop-oldest.
+
+            , {"log"    , "*"   , "file"    , "buffer"          }   //! 38  , The size in bytes of the buffer to write logs in the file.
+            , {"log"    , "*"   , "file"    , "flush"           }   //! 39  , The timeout in milliseconds to write buffered logs in the file.
+            , {"log"    , "*"   , "file"    , "maxsize"         }   //! 40  , The size in bytes of the log file to rotate, 0 means no rotation by size.
+            , {"log"    , "*"   , "file"    , "period"          }   //! 41  , The period in seconds to rotate the log file, 0 means no rotation by time.
+            , {"log"    , "*"   , "file"    , "compress"        }   //! 42  , The flag to compress rotated log files.
+            , {"log"    , "*"   , "remote"  , "batch"           }   //! 43  , The size in bytes of the batch of remote log messages, 0 means no batching.
+            , {"log"    , "*"   , "remote"  , "linger"          }   //! 44  , The timeout in milliseconds to send incomplete batch of remote log messages.
+
+            , {"*"      , "*"   , "checksum", ""                }   //! 45  , The flag to verify the checksum of messages received by the remote service.
+            , {"*"      , "*"   , "batch"   , ""                }   //! 46  , The maximum number of messages sent by one system call.
+            , {"*"      , "*"   , "linger"  , ""                }   //! 47  , The timeout in milliseconds to wait for more messages to send in one system call.
+
+            , {"*"      , "*"   , "*"       , "*"               }   //! 48  , Indicates any key type.
         };
 
     /**
@@ -323,6 +367,26 @@ namespace NEPersistence
      **/
     inline const NEPersistence::sPropertyKey& getServicePort(void);
 
+    /**
+     * \brief   Returns the number of threads to send and receive messages of the remote service property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceWorkers(void);
+
+    /**
+     * \brief   Returns the flag to verify the checksum of received messages of the remote service property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceChecksum(void);
+
+    /**
+     * \brief   Returns the maximum number of messages sent by one system call of the remote service property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceBatch(void);
+
+    /**
+     * \brief   Returns the timeout to wait for more messages to send in one system call of the remote service property structure.
+     **/
+    inline const NEPersistence::sPropertyKey& getServiceLinger(void);
+
     /**
      * \brief   Returns the name of log database engine.
      **/
@@ -364,6 +428,76 @@ namespace NEPersistence
      **/
     inline const NEPersistence::sPropertyKey& getLogDatabasePassword(void);
 
+    /**
+     * \brief   The maximum number of log rows inserted in one database transaction.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabaseBatch(void);
+
+    /**
+     * \brief   The timeout in milliseconds to commit pending log rows in the database.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabaseFlush(void);
+
+    /**
+     * \brief   The journal mode of the log database, for example `wal`.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabaseJournal(void);
+
+    /**
+     * \brief   The synchronous mode of the log database, for example `normal`.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabaseSync(void);
+
+    /**
+     * \brief   The flag to enable the full-text search index of the log database.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogDatabaseSearch(void);
+
+    /**
+     * \brief   The size in bytes of the ring buffer of log records of each thread.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogRingSize(void);
+
+    /**
+     * \brief   The policy when the ring buffer of log records is full.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogRingOverflow(void);
+
+    /**
+     * \brief   The size in bytes of the buffer to write logs in the file.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileBuffer(void);
+
+    /**
+     * \brief   The timeout in milliseconds to write buffered logs in the file.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileFlush(void);
+
+    /**
+     * \brief   The size in bytes of the log file to rotate.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileMaxSize(void);
+
+    /**
+     * \brief   The period in seconds to rotate the log file.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFilePeriod(void);
+
+    /**
+     * \brief   The flag to compress rotated log files.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogFileCompress(void);
+
+    /**
+     * \brief   The size in bytes of the batch of remote log messages.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogRemoteBatch(void);
+
+    /**
+     * \brief   The timeout in milliseconds to send incomplete batch of remote log messages.
+     **/
+    inline const NEPersistence::sPropertyKey& getLogRemoteLinger(void);
+
     /**
      * \brief   The default block size in bytes to allocate in shared buffer to minimize de-fragmentation.
      **/
@@ -475,6 +609,26 @@ inline const NEPersistence::sPropertyKey& NEPersistence::getServicePort(void)
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServicePort)];
 }
 
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceWorkers(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceWorkers)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceChecksum(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceChecksum)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceBatch(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceBatch)];
+}
+
+inline const NEPersistence::sPropertyKey& NEPersistence::getServiceLinger(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryServiceLinger)];
+}
+
 const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseEngine(void)
 {
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseEngine)];
@@ -515,6 +669,76 @@ const NEPersistence::sPropertyKey& NEPersistence::getLogDatabasePassword(void)
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabasePassword)];
 }
 
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseBatch(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseBatch)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseFlush(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseFlush)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseJournal(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseJournal)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseSync(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseSync)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogDatabaseSearch(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogDatabaseSearch)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogRingSize(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogRingSize)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogRingOverflow(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogRingOverflow)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogFileBuffer(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileBuffer)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogFileFlush(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileFlush)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogFileMaxSize(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileMaxSize)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogFilePeriod(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFilePeriod)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogFileCompress(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogFileCompress)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogRemoteBatch(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogRemoteBatch)];
+}
+
+const NEPersistence::sPropertyKey& NEPersistence::getLogRemoteLinger(void)
+{
+    return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryLogRemoteLinger)];
+}
+
 const NEPersistence::sPropertyKey& NEPersistence::getDefaultBufferBlockSize(void)
 {
     return NEPersistence::DefaultPropertyKeys[static_cast<int>(NEPersistence::eConfigKeys::EntryDefaultBufferBlock)];
@@ -1055,6 +1055,146 @@ void ConfigManager::setRemoteServicePort(NERemoteService::eRemoteServices servic
     setRemoteServicePort(service, connect, newValue, isTemporary);
 }
 
+uint32_t ConfigManager::getRemoteServiceWorkers(const String& service) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWorkers;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWorkers();
+    const PropertyValue* value = getPropertyValue(service, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_SERVICE_WORKERS);
+}
+
+uint32_t ConfigManager::getRemoteServiceWorkers(NERemoteService::eRemoteServices serviceType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    return getRemoteServiceWorkers(service);
+}
+
+void ConfigManager::setRemoteServiceWorkers(const String& service, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceWorkers;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceWorkers();
+    setModuleProperty(service, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+void ConfigManager::setRemoteServiceWorkers(NERemoteService::eRemoteServices serviceType, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    setRemoteServiceWorkers(service, newValue, isTemporary);
+}
+
+bool ConfigManager::getRemoteServiceChecksum(const String& service) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceChecksum;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceChecksum();
+    const PropertyValue* value = getPropertyValue(service, key.property, key.position, confKey);
+    return (value != nullptr ? value->getBoolean() : NEApplication::DEFAULT_SERVICE_CHECKSUM);
+}
+
+bool ConfigManager::getRemoteServiceChecksum(NERemoteService::eRemoteServices serviceType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    return getRemoteServiceChecksum(service);
+}
+
+void ConfigManager::setRemoteServiceChecksum(const String& service, bool newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceChecksum;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceChecksum();
+    setModuleProperty(service, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+void ConfigManager::setRemoteServiceChecksum(NERemoteService::eRemoteServices serviceType, bool newValue, bool isTemporary /*= false*/)
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    setRemoteServiceChecksum(service, newValue, isTemporary);
+}
+
+uint32_t ConfigManager::getRemoteServiceBatch(const String& service) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceBatch;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceBatch();
+    const PropertyValue* value = getPropertyValue(service, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_SERVICE_BATCH);
+}
+
+uint32_t ConfigManager::getRemoteServiceBatch(NERemoteService::eRemoteServices serviceType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    return getRemoteServiceBatch(service);
+}
+
+void ConfigManager::setRemoteServiceBatch(const String& service, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceBatch;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceBatch();
+    setModuleProperty(service, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+void ConfigManager::setRemoteServiceBatch(NERemoteService::eRemoteServices serviceType, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    setRemoteServiceBatch(service, newValue, isTemporary);
+}
+
+uint32_t ConfigManager::getRemoteServiceLinger(const String& service) const
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceLinger;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceLinger();
+    const PropertyValue* value = getPropertyValue(service, key.property, key.position, confKey);
+    return (value != nullptr ? value->getInteger() : NEApplication::DEFAULT_SERVICE_LINGER);
+}
+
+uint32_t ConfigManager::getRemoteServiceLinger(NERemoteService::eRemoteServices serviceType) const
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    return getRemoteServiceLinger(service);
+}
+
+void ConfigManager::setRemoteServiceLinger(const String& service, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    Lock lock(mLock);
+
+    constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryServiceLinger;
+    const NEPersistence::sPropertyKey& key = NEPersistence::getServiceLinger();
+    setModuleProperty(service, key.property, key.position, String::makeString(newValue), confKey, isTemporary);
+}
+
+void ConfigManager::setRemoteServiceLinger(NERemoteService::eRemoteServices serviceType, uint32_t newValue, bool isTemporary /*= false*/)
+{
+    const String& service = Identifier::convToString( static_cast<unsigned int>(serviceType)
+                                                    , NEApplication::RemoteServiceIdentifiers
+                                                    , static_cast<unsigned int>(NERemoteService::eRemoteServices::ServiceUnknown));
+    setRemoteServiceLinger(service, newValue, isTemporary);
+}
+
 String ConfigManager::getLogDatabaseProperty(const String& whichPosition)
 {
     const NEPersistence::sPropertyKey& key = NEPersistence::getLogDatabaseName();
@@ -1068,6 +1208,45 @@ void ConfigManager::setLogDatabaseProperty(const String& whichPosition, const St
     setModuleProperty(key.section, key.property, whichPosition, newValue, NEPersistence::EntryAnyKey, isTemporary);
 }
 
+String ConfigManager::getLogRingProperty(const String& whichPosition)
+{
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogRingSize();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, whichPosition);
+    return (value != nullptr ? value->getValue() : String::getEmptyString());
+}
+
+void ConfigManager::setLogRingProperty(const String& whichPosition, const String& newValue, bool isTemporary /*= false*/)
+{
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogRingSize();
+    setModuleProperty(key.section, key.property, whichPosition, newValue, NEPersistence::EntryAnyKey, isTemporary);
+}
+
+String ConfigManager::getLogFileProperty(const String& whichPosition)
+{
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileBuffer();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, whichPosition);
+    return (value != nullptr ? value->getValue() : String::getEmptyString());
+}
+
+void ConfigManager::setLogFileProperty(const String& whichPosition, const String& newValue, bool isTemporary /*= false*/)
+{
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogFileBuffer();
+    setModuleProperty(key.section, key.property, whichPosition, newValue, NEPersistence::EntryAnyKey, isTemporary);
+}
+
+String ConfigManager::getLogRemoteProperty(const String& whichPosition)
+{
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogRemoteBatch();
+    const PropertyValue* value = getPropertyValue(key.section, key.property, whichPosition);
+    return (value != nullptr ? value->getValue() : String::getEmptyString());
+}
+
+void ConfigManager::setLogRemoteProperty(const String& whichPosition, const String& newValue, bool isTemporary /*= false*/)
+{
+    const NEPersistence::sPropertyKey& key = NEPersistence::getLogRemoteBatch();
+    setModuleProperty(key.section, key.property, whichPosition, newValue, NEPersistence::EntryAnyKey, isTemporary);
+}
+
 uint16_t ConfigManager::getDefaultBufferBlockSize(const String& whichModule /*= NEString::EmptyStringA*/)
 {
     constexpr NEPersistence::eConfigKeys confKey = NEPersistence::eConfigKeys::EntryDefaultBufferBlock;
@@ -24,9 +24,15 @@
 #include "areg/component/NEService.hpp"
 #include "areg/logging/NELogging.hpp"
 #include "areg/logging/IELogDatabaseEngine.hpp"
+#include "areg/base/Containers.hpp"
+#include "areg/base/IEThreadConsumer.hpp"
 #include "areg/base/String.hpp"
 #include "areg/base/SynchObjects.hpp"
+#include "areg/base/Thread.hpp"
 
+#include <atomic>
+#include <deque>
+#include <string_view>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////
@@ -34,9 +40,72 @@
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The logging database engine, responsible to log messages in the database.
+ *          When the group commit is enabled, the log messages are queued and inserted
+ *          in the database by the flush thread in one transaction per batch of rows
+ *          or when the flush timeout expires. The flush thread as well checkpoints
+ *          the write-ahead log when there are no more logs to insert.
  **/
-class LogSqliteDatabase : public IELogDatabaseEngine
+class LogSqliteDatabase : public    IELogDatabaseEngine
+                        , private   IEThreadConsumer
 {
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The default maximum number of log rows inserted in one transaction.
+    static constexpr uint32_t           DEFAULT_BATCH_ROWS      { 256 };
+
+    //!< The default timeout in milliseconds to commit pending log rows.
+    static constexpr uint32_t           DEFAULT_FLUSH_TIMEOUT   { 100 };
+
+    //!< The default journal mode of the log database.
+    static constexpr std::string_view   DEFAULT_JOURNAL_MODE    { "wal" };
+
+    //!< The default synchronous mode of the log database.
+    static constexpr std::string_view   DEFAULT_SYNC_MODE       { "normal" };
+
+    //!< The maximum number of log rows added to the full-text search index in one transaction.
+    static constexpr uint32_t           SEARCH_BATCH_ROWS       { 1'024 };
+
+    //!< The maximum number of batches of pending log rows. When the queue is full, the logs are inserted immediately.
+    static constexpr uint32_t           MAX_PENDING_BATCHES     { 64 };
+
+    /**
+     * \brief   The filter of log messages read by pages.
+     **/
+    struct sLogFilter
+    {
+        //!< The time of the first log to read. If 0, the time is not limited.
+        TIME64                  filterTimeBegin { 0 };
+        //!< The time of the last log to read. If 0, the time is not limited.
+        TIME64                  filterTimeEnd   { 0 };
+        //!< The bitwise mask of log priorities to read.
+        uint32_t                filterPrio      { static_cast<uint32_t>(NELogging::eLogPriority::PrioValid) };
+        //!< The ID of the instance to read logs. If NEService::COOKIE_ANY, reads logs of all instances.
+        ITEM_ID                 filterInstance  { NEService::COOKIE_ANY };
+        //!< The IDs of the scopes to read logs. If empty, reads logs of all scopes.
+        std::vector<uint32_t>   filterScopes    { };
+    };
+
+    /**
+     * \brief   The key of the last log message of the page. The next page starts after the key.
+     *          The default key starts reading from the first log message.
+     **/
+    struct sLogPageKey
+    {
+        //!< The time of the last read log message.
+        TIME64      keyTime { 0 };
+        //!< The unique ID of the last read log message in the database.
+        uint64_t    keyId   { 0 };
+    };
+
+private:
+    //!< The list of log messages to insert in the database. The queued messages are not relocated.
+    using LogRows   = std::deque<NELogging::sLogMessage>;
+
+    //!< The keys of the thread or module names in the database, where the map key is the name and the ID.
+    using NameKeys  = TEStringHashMap<uint32_t>;
+
 //////////////////////////////////////////////////////////////////////////
 // Static methods
 //////////////////////////////////////////////////////////////////////////
@@ -101,6 +170,53 @@ public:
     inline SqliteDatabase& getDatabase(void);
     inline const SqliteDatabase& getDatabase(void) const;
 
+    /**
+     * \brief   Sets the group commit parameters of the log messages.
+     *          Should be set before connecting to the database.
+     * \param   batchRows       The maximum number of log rows inserted in one transaction.
+     *                          If 0, uses the default number `DEFAULT_BATCH_ROWS`.
+     *                          If 1, the group commit is disabled and each log is inserted immediately.
+     * \param   flushTimeout    The timeout in milliseconds to commit pending log rows.
+     *                          If 0, uses the default timeout `DEFAULT_FLUSH_TIMEOUT`.
+     **/
+    inline void setGroupCommit(uint32_t batchRows, uint32_t flushTimeout);
+
+    /**
+     * \brief   Returns the maximum number of log rows inserted in one transaction.
+     *          If 1, the group commit is disabled.
+     **/
+    inline uint32_t getBatchRows(void) const;
+
+    /**
+     * \brief   Sets the journal and synchronous modes of the log database.
+     *          Should be set before connecting to the database. The empty values are
+     *          replaced by the defaults `DEFAULT_JOURNAL_MODE` and `DEFAULT_SYNC_MODE`.
+     *          The unsupported values are ignored and SQLite defaults are used.
+     * \param   journalMode     The journal mode, one of `delete`, `truncate`, `persist`, `memory`, `wal` or `off`.
+     * \param   syncMode        The synchronous mode, one of `off`, `normal`, `full` or `extra`.
+     **/
+    inline void setJournalMode(const String & journalMode, const String & syncMode);
+
+    /**
+     * \brief   Enables or disables the full-text search index of log messages.
+     *          Should be set before connecting to the database. When enabled, the log
+     *          messages are added to the index in batches by the flush thread, and the
+     *          search uses the index. Otherwise, the search scans the log messages.
+     * \param   enable  Flag, indicating whether the full-text search index is enabled.
+     **/
+    inline void setSearchEnabled(bool enable);
+
+    /**
+     * \brief   Returns true if the opened database has the full-text search index.
+     **/
+    inline bool hasSearchIndex(void) const;
+
+    /**
+     * \brief   Inserts all pending log messages in the database.
+     * \return  Returns the number of inserted log messages.
+     **/
+    uint32_t flushLogs(void);
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -166,8 +282,10 @@ public:
 
     /**
      * \brief   Called when logging message should be saved in the database.
+     *          If the group commit is enabled, the message is queued and inserted
+     *          in the database by the flush thread.
      * \param   message     The structure of the message to log.
-     * \return  Returns true if succeeded to save the log in the database.
+     * \return  Returns true if succeeded to save or to queue the log.
      **/
     virtual bool logMessage(const NELogging::sLogMessage & message) override;
 
@@ -337,6 +455,35 @@ public:
     void getLogMessages(std::vector<SharedBuffer>& OUT messages, ITEM_ID IN instId, uint32_t IN scopeId);
     std::vector<SharedBuffer> getLogMessages(ITEM_ID IN instId, uint32_t IN scopeId);
 
+    /**
+     * \brief   Call to get the page of log messages, which match the filter, ordered by the time of creation.
+     *          The page starts after the specified key. On output, the key is the one of the last
+     *          read log message and can be used to read the next page. The logs are read by the
+     *          indexes of the time, the instance and the priority, and the number of read logs
+     *          does not depend on the position of the page.
+     * \param   messages    On output, the vector contains log messages of the page.
+     * \param   filter      The filter of the log messages to read.
+     * \param   pageKey     On input, the key of the last log message of the previous page.
+     *                      On output, the key of the last log message of the page.
+     * \param   maxEntries  The maximum number of log messages in the page.
+     * \return  Returns the number of log messages in the page. If less than `maxEntries`, there are no more logs.
+     **/
+    uint32_t getLogMessagesPage(std::vector<SharedBuffer>& OUT messages, const sLogFilter& IN filter, sLogPageKey& IN OUT pageKey, uint32_t IN maxEntries);
+
+    /**
+     * \brief   Call to search the log messages, which contain the text and match the filter.
+     *          If the database has the full-text search index, the text is searched as a phrase
+     *          of words and the results are ranked by relevance. Otherwise, the text is searched
+     *          as a part of the message and the results are ordered by the time of creation.
+     * \param   messages    On output, the vector contains the page of found log messages.
+     * \param   text        The text to search in log messages.
+     * \param   filter      The filter of the log messages to search.
+     * \param   startAt     The position of the first found log message of the page.
+     * \param   maxEntries  The maximum number of log messages in the page.
+     * \return  Returns the number of log messages in the page.
+     **/
+    uint32_t searchLogMessages(std::vector<SharedBuffer>& OUT messages, const String& IN text, const sLogFilter& IN filter, uint32_t IN startAt, uint32_t IN maxEntries);
+
     /**
      * \brief   Call to get log scopes using SQLite Statement object. The SQLite Statement should be already initialized
      *          and the parameters should be bound, if there is any. The method will extract the log scopes from the statement
@@ -453,6 +600,50 @@ public:
 //////////////////////////////////////////////////////////////////////////
 private:
 
+/************************************************************************/
+// IEThreadConsumer interface overrides
+/************************************************************************/
+
+    /**
+     * \brief   Runs the flush thread, which inserts pending log messages
+     *          in the database and checkpoints the write-ahead log.
+     **/
+    virtual void onThreadRuns(void) override;
+
+    /**
+     * \brief   Binds the log message to the insert statement and executes it.
+     * \param   message     The log message to insert.
+     * \return  Returns true if succeeded to insert the log message.
+     **/
+    inline bool _insertLog(const NELogging::sLogMessage& message);
+
+    /**
+     * \brief   Inserts the pending log messages in the database in one transaction.
+     * \param   rows    The temporary list to move pending rows. On output, the list is empty.
+     * \return  Returns the number of inserted log messages.
+     **/
+    uint32_t _flushPending(LogRows& rows);
+
+    /**
+     * \brief   Sets the journal and synchronous modes of the opened database.
+     **/
+    inline void _setupJournal(void);
+
+    /**
+     * \brief   Starts the flush thread if the group commit is enabled.
+     **/
+    inline void _startFlushThread(void);
+
+    /**
+     * \brief   Stops the flush thread and inserts the remaining pending log messages.
+     **/
+    inline void _stopFlushThread(void);
+
+    /**
+     * \brief   Returns the instance of the object.
+     **/
+    inline LogSqliteDatabase& self(void);
+
     /**
      * \brief   Opens or creates the specified database file.
      *          The path can be relative or absolute, it may as contain the mask.
@@ -472,11 +663,46 @@ private:
      **/
     inline void _createIndexes(void);
 
+    /**
+     * \brief   Checks whether the opened database has the tables of thread and module names.
+     *          If the database is created by previous version, creates temporary views
+     *          to read log messages and thread names.
+     * \return  Returns true if the database has tables of thread and module names.
+     **/
+    inline bool _setupNameTables(void);
+
+    /**
+     * \brief   Creates the full-text search index if enabled and the database is writable.
+     * \param   readOnly    Flag, indicating whether the database is opened in read-only mode.
+     * \return  Returns true if the database has the full-text search index.
+     **/
+    inline bool _setupSearch(bool readOnly);
+
+    /**
+     * \brief   Adds the next batch of log messages to the full-text search index in one transaction.
+     * \param   maxRows     The maximum number of log messages to add.
+     * \return  Returns the number of log messages added to the index.
+     **/
+    uint32_t _indexSearch(uint32_t maxRows);
+
     /**
      * \brief   Logs the initial information in the database like logging version and application name.
      **/
     inline void _initialize(void);
 
+    /**
+     * \brief   Returns the key of the thread or module name in the database.
+     *          If the name is not in the database, inserts the name.
+     * \param   keys        The cached keys of the names.
+     * \param   sqlInsert   The script to insert the name with the ID.
+     * \param   sqlSelect   The script to select the key of the name with the ID.
+     * \param   id          The ID of the thread or module.
+     * \param   name        The name of the thread or module.
+     * \param   nameLen     The length of the name.
+     * \return  Returns the key of the name or 0 if failed.
+     **/
+    uint32_t _getNameKey(NameKeys& keys, const std::string_view& sqlInsert, const std::string_view& sqlSelect, const ITEM_ID& id, const char* name, uint32_t nameLen);
+
     /**
      * \brief   Extracts the log message from the SqliteStatement and copies it to the SharedBuffer.
      * \param   stmt    The SqliteStatement to extract the log message.
@@ -517,9 +743,54 @@ protected:
     //!< Flag, indicating whether the database logging is enabled or not.
     bool            mDbLogEnabled;
 
+    //!< Flag, indicating whether the database has tables of thread and module names.
+    bool            mHasNameTables;
+
+    //!< The cached keys of the thread names.
+    NameKeys        mThreadKeys;
+
+    //!< The cached keys of the module names.
+    NameKeys        mModuleKeys;
+
+    //!< Flag, indicating whether the full-text search index should be created.
+    bool            mSearchEnabled;
+
+    //!< Flag, indicating whether the database has the full-text search index.
+    bool            mHasSearch;
+
+    //!< The ID of the last log message added to the full-text search index.
+    uint64_t        mSearchIndexed;
+
     //!< Mutex to protect database operations.
     Mutex           mLock;
 
+    //!< The maximum number of log rows inserted in one transaction.
+    uint32_t        mBatchRows;
+
+    //!< The timeout in milliseconds to commit pending log rows.
+    uint32_t        mFlushTimeout;
+
+    //!< The journal mode of the log database.
+    String          mJournalMode;
+
+    //!< The synchronous mode of the log database.
+    String          mSyncMode;
+
+    //!< The log messages to insert in the database by the flush thread.
+    LogRows         mPending;
+
+    //!< The lock to protect the list of pending log messages.
+    SpinLock        mPendingLock;
+
+    //!< The event signaled when the batch of log messages is ready to insert.
+    SynchEvent      mFlushEvent;
+
+    //!< The flag, indicating whether the flush thread should exit.
+    std::atomic_bool mFlushExit;
+
+    //!< The thread to insert pending log messages in the database.
+    Thread          mFlushThread;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -561,4 +832,39 @@ inline const SqliteDatabase& LogSqliteDatabase::getDatabase(void) const
     return mDatabase;
 }
 
+inline void LogSqliteDatabase::setGroupCommit(uint32_t batchRows, uint32_t flushTimeout)
+{
+    Lock lock(mLock);
+    mBatchRows      = batchRows != 0 ? batchRows : DEFAULT_BATCH_ROWS;
+    mFlushTimeout   = flushTimeout != 0 ? flushTimeout : DEFAULT_FLUSH_TIMEOUT;
+}
+
+inline uint32_t LogSqliteDatabase::getBatchRows(void) const
+{
+    return mBatchRows;
+}
+
+inline void LogSqliteDatabase::setJournalMode(const String& journalMode, const String& syncMode)
+{
+    Lock lock(mLock);
+    mJournalMode    = journalMode.isEmpty() ? String(DEFAULT_JOURNAL_MODE) : journalMode;
+    mSyncMode       = syncMode.isEmpty() ? String(DEFAULT_SYNC_MODE) : syncMode;
+}
+
+inline void LogSqliteDatabase::setSearchEnabled(bool enable)
+{
+    Lock lock(mLock);
+    mSearchEnabled = enable;
+}
+
+inline bool LogSqliteDatabase::hasSearchIndex(void) const
+{
+    return mHasSearch;
+}
+
+inline LogSqliteDatabase& LogSqliteDatabase::self(void)
+{
+    return (*this);
+}
+
 #endif  // AREG_AREGEXTEND_DB_LOGSQLITEDATABASE_HPP
@@ -146,40 +146,100 @@ namespace
         "UPDATE scopes SET time_inactivated = %llu, scope_is_active = 0 WHERE cookie_id = %llu AND scope_id = %u AND scope_is_active = 1;"
     };
 
+    //! Create a table with the names of logging threads. Each thread of the logging
+    //! module is saved once and the log messages refer to the key of the thread.
+    constexpr std::string_view  _sqlCreateTbThreads
+    {
+        "CREATE TABLE \"threads\" ("
+            "\"thread_key\"	    INTEGER PRIMARY KEY,"
+            "\"thread_id\"	        INTEGER,"
+            "\"thread_name\"	    TEXT,"
+            "CONSTRAINT \"u_thread\" UNIQUE(\"thread_id\", \"thread_name\")"
+            ");"
+    };
+
+    //! Create a table with the names of logging modules. Each logging module
+    //! is saved once and the log messages refer to the key of the module.
+    constexpr std::string_view  _sqlCreateTbModules
+    {
+        "CREATE TABLE \"modules\" ("
+            "\"module_key\"	    INTEGER PRIMARY KEY,"
+            "\"module_id\"	        INTEGER,"
+            "\"module_name\"	    TEXT,"
+            "CONSTRAINT \"u_module\" UNIQUE(\"module_id\", \"module_name\")"
+            ");"
+    };
+
     //! Create a table with logs that contain information of application cookie ID,
-    //! scope ID, log priority, log message, and information like thread.
+    //! scope ID, log priority, log message, and the keys of the thread and the module.
     constexpr std::string_view  _sqlCreateTbLogs
     {
         "CREATE TABLE \"logs\" ("
-            "\"id\"	                INTEGER NOT NULL UNIQUE,"
+            "\"id\"	                INTEGER PRIMARY KEY AUTOINCREMENT,"
             "\"cookie_id\"	        INTEGER,"
             "\"scope_id\"	        INTEGER,"
             "\"session_id\"         INTEGER,"
             "\"msg_type\"	        INTEGER,"
             "\"msg_prio\"	        INTEGER,"
-            "\"msg_module_id\"	    INTEGER,"
-            "\"msg_thread_id\"	    INTEGER,"
+            "\"thread_key\"	    INTEGER,"
+            "\"module_key\"	    INTEGER,"
             "\"msg_log\"	        TEXT,"
-            "\"msg_thread\"	        TEXT,"
-            "\"msg_module\"	        TEXT,"
             "\"time_created\"	    NUMERIC,"
             "\"time_received\"      NUMERIC,"
-            "\"time_duration\"      NUMERIC,"
-            "CONSTRAINT \"pk_msg_id\" PRIMARY KEY(\"id\" AUTOINCREMENT)"
+            "\"time_duration\"      NUMERIC"
             ");"
     };
 
-    //! A string format to create INSERT statement to insert new log message in the logs table.
-    constexpr std::string_view _fmtLog
+    //! Create a view of log messages with the names of the threads and modules.
+    //! All log messages are read from the view.
+    constexpr std::string_view  _sqlCreateViewLogs
+    {
+        "CREATE VIEW \"log_messages\" AS SELECT "
+            "logs.id AS id, logs.cookie_id AS cookie_id, logs.scope_id AS scope_id, logs.session_id AS session_id, "
+            "logs.msg_type AS msg_type, logs.msg_prio AS msg_prio, modules.module_id AS msg_module_id, threads.thread_id AS msg_thread_id, "
+            "logs.msg_log AS msg_log, threads.thread_name AS msg_thread, modules.module_name AS msg_module, "
+            "logs.time_created AS time_created, logs.time_received AS time_received, logs.time_duration AS time_duration "
+        "FROM logs "
+            "LEFT JOIN threads ON threads.thread_key = logs.thread_key "
+            "LEFT JOIN modules ON modules.module_key = logs.module_key;"
+    };
+
+    //! A script to check whether the database has tables of the thread and module names.
+    //! The databases created by previous versions keep the names in the logs table.
+    constexpr std::string_view  _sqlHasNameTables
+    {
+        "SELECT COUNT(name) FROM sqlite_master WHERE type = 'table' AND name = 'threads';"
+    };
+
+    //! Create a temporary view of log messages of the database created by previous versions.
+    constexpr std::string_view  _sqlCreateTempViewLogs
+    {
+        "CREATE TEMP VIEW IF NOT EXISTS \"log_messages\" AS SELECT "
+            "id, cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, "
+            "msg_log, msg_thread, msg_module, time_created, time_received, time_duration "
+        "FROM logs;"
+    };
+
+    //! Create a temporary view of thread names of the database created by previous versions.
+    constexpr std::string_view  _sqlCreateTempViewThreads
+    {
+        "CREATE TEMP VIEW IF NOT EXISTS \"threads\" AS SELECT "
+            "msg_thread_id AS thread_id, msg_thread AS thread_name "
+        "FROM logs GROUP BY msg_thread_id, msg_thread;"
+    };
+
+    //! A string to create INSERT statement to insert new log message in the logs table.
+    constexpr std::string_view _sqlInsertLog
     {
         "INSERT INTO logs "
-        "(cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created, time_received, time_duration)"
+        "(cookie_id, scope_id, session_id, msg_type, msg_prio, thread_key, module_key, msg_log, time_created, time_received, time_duration)"
         "VALUES "
-        "(%llu, %u, %u, %u, %u, %llu, %llu, \'%s\', \'%s\', \'%s\', %llu, %llu, %llu);"
+        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
     };
 
-    //! A string format to create INSERT statement to insert new log message in the logs table.
-    constexpr std::string_view _sqlInsertLog
+    //! A string to create INSERT statement to insert new log message in the logs table
+    //! of the database created by previous versions.
+    constexpr std::string_view _sqlInsertLogNames
     {
         "INSERT INTO logs "
         "(cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created, time_received, time_duration)"
@@ -187,6 +247,30 @@ namespace
         "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
     };
 
+    //! A string to create INSERT statement to insert the thread name if it does not exist.
+    constexpr std::string_view _sqlInsertThread
+    {
+        "INSERT OR IGNORE INTO threads (thread_id, thread_name) VALUES (?, ?);"
+    };
+
+    //! A script to get the key of the thread name.
+    constexpr std::string_view _sqlGetThreadKey
+    {
+        "SELECT thread_key FROM threads WHERE thread_id = ? AND thread_name = ?;"
+    };
+
+    //! A string to create INSERT statement to insert the module name if it does not exist.
+    constexpr std::string_view _sqlInsertModule
+    {
+        "INSERT OR IGNORE INTO modules (module_id, module_name) VALUES (?, ?);"
+    };
+
+    //! A script to get the key of the module name.
+    constexpr std::string_view _sqlGetModuleKey
+    {
+        "SELECT module_key FROM modules WHERE module_id = ? AND module_name = ?;"
+    };
+
     //! A script to create index of the instances table. 
     constexpr std::string_view  _sqlCraeteIdxCookie
     {
@@ -199,10 +283,22 @@ namespace
         "CREATE UNIQUE INDEX \"idx_scope_id\" ON \"scopes\" (\"scope_id\", \"cookie_id\", \"time_received\", \"time_inactivated\");"
     };
 
-    //! A script to create index of the logs table
-    constexpr std::string_view  _sqlCreateIdxLogs
+    //! A script to create index of the logs table by the time of the logs.
+    constexpr std::string_view  _sqlCreateIdxLogsTime
+    {
+        "CREATE INDEX \"idx_logs_time\" ON \"logs\" (\"time_created\");"
+    };
+
+    //! A script to create index of the logs table by the instances and the time of the logs.
+    constexpr std::string_view  _sqlCreateIdxLogsInst
     {
-        "CREATE INDEX \"idx_logs\" ON \"logs\" (\"cookie_id\", \"scope_id\", \"msg_thread_id\"); "
+        "CREATE INDEX \"idx_logs_inst\" ON \"logs\" (\"cookie_id\", \"time_created\");"
+    };
+
+    //! A script to create index of the logs table by the priorities.
+    constexpr std::string_view  _sqlCreateIdxLogsPrio
+    {
+        "CREATE INDEX \"idx_logs_prio\" ON \"logs\" (\"msg_prio\", \"time_created\");"
     };
 
     //! A script to extract the names of connected log instances
@@ -220,13 +316,13 @@ namespace
     //! A script to extract the names of logging threads
     constexpr std::string_view _sqlGetThreadNames
     {
-        "SELECT msg_thread FROM logs GROUP BY msg_thread;"
+        "SELECT thread_name FROM threads GROUP BY thread_name;"
     };
 
     //! A script to extract the IDs of logging threads
     constexpr std::string_view _sqlGetThreadIds
     {
-        "SELECT msg_thread_id FROM logs GROUP BY msg_thread_id;"
+        "SELECT thread_id FROM threads GROUP BY thread_id;"
     };
 
     //! A script to extract the logging instances with their information.
@@ -250,25 +346,113 @@ namespace
     //! A script to extract all logged messages
     constexpr std::string_view _sqlGetAllLogMessages
     {
-        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM logs ORDER BY time_created;"
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM log_messages ORDER BY time_created, id;"
     };
 
     //! A script to extract logged messages of the certain instance source
     constexpr std::string_view _sqlGetInstLogMessages
     {
-        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM logs WHERE cookie_id = ? ORDER BY time_created;"
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM log_messages WHERE cookie_id = ? ORDER BY time_created, id;"
     };
 
     //! A script to extract logged messages of the certain instance source
     constexpr std::string_view _sqlGetScopeLogMessages
     {
-        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM logs WHERE scope_id = ? ORDER BY time_created;"
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM log_messages WHERE scope_id = ? ORDER BY time_created, id;"
     };
 
     //! A script to extract logged messages of the certain instance source
     constexpr std::string_view _sqlGetInstScopeLogMessages
     {
-        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM logs WHERE cookie_id = ? AND scope_id = ? ORDER BY time_created;"
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module FROM log_messages WHERE cookie_id = ? AND scope_id = ? ORDER BY time_created, id;"
+    };
+
+    //! A script to extract the page of logged messages after the given time and ID of the last read log.
+    //! The filter conditions are appended to the script before the page order.
+    constexpr std::string_view _sqlGetPageLogMessages
+    {
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module, id FROM log_messages WHERE (time_created, id) > (?, ?)"
+    };
+
+    //! The order and the size of the page of logged messages.
+    constexpr std::string_view _sqlPageOrder
+    {
+        " ORDER BY time_created, id LIMIT ?;"
+    };
+
+    //! Create the full-text search index of log messages. The index refers to the
+    //! text in the logs table and does not keep a copy of the messages.
+    constexpr std::string_view _sqlCreateTbSearch
+    {
+        "CREATE VIRTUAL TABLE IF NOT EXISTS \"logs_search\" USING fts5(msg_log, content='logs', content_rowid='id');"
+    };
+
+    //! Create a table with the ID of the last log message added to the full-text search index.
+    constexpr std::string_view _sqlCreateTbSearchState
+    {
+        "CREATE TABLE IF NOT EXISTS \"search_state\" (\"indexed_id\" INTEGER NOT NULL);"
+    };
+
+    //! A script to insert the initial entry in the search state table.
+    constexpr std::string_view _sqlInitSearchState
+    {
+        "INSERT INTO search_state (indexed_id) SELECT 0 WHERE NOT EXISTS (SELECT indexed_id FROM search_state);"
+    };
+
+    //! A script to check whether the database has the full-text search index.
+    constexpr std::string_view _sqlHasSearch
+    {
+        "SELECT COUNT(name) FROM sqlite_master WHERE type = 'table' AND name = 'search_state';"
+    };
+
+    //! A script to get the ID of the last log message added to the full-text search index.
+    constexpr std::string_view _sqlGetSearchState
+    {
+        "SELECT MAX(indexed_id) FROM search_state;"
+    };
+
+    //! A script to update the ID of the last log message added to the full-text search index.
+    constexpr std::string_view _sqlSetSearchState
+    {
+        "UPDATE search_state SET indexed_id = ?;"
+    };
+
+    //! A script to get the number of log messages and the last ID of the next batch to index.
+    constexpr std::string_view _sqlGetSearchBatch
+    {
+        "SELECT COUNT(id), MAX(id) FROM (SELECT id FROM logs WHERE id > ? ORDER BY id LIMIT ?);"
+    };
+
+    //! A script to add the batch of log messages to the full-text search index.
+    constexpr std::string_view _sqlIndexSearchBatch
+    {
+        "INSERT INTO logs_search (rowid, msg_log) SELECT id, msg_log FROM logs WHERE id > ? AND id <= ?;"
+    };
+
+    //! A script to search the log messages in the full-text search index, ranked by relevance.
+    //! The filter conditions are appended to the script before the order.
+    constexpr std::string_view _sqlSearchLogMessages
+    {
+        "SELECT m.msg_type, m.msg_prio, m.cookie_id, m.msg_module_id, m.msg_thread_id, m.time_created, m.time_received, m.time_duration, m.scope_id, m.session_id, m.msg_log, m.msg_thread, m.msg_module, m.id FROM logs_search JOIN log_messages AS m ON m.id = logs_search.rowid WHERE logs_search MATCH ?"
+    };
+
+    //! The order and the page of the searched log messages.
+    constexpr std::string_view _sqlSearchOrder
+    {
+        " ORDER BY logs_search.rank, m.time_created, m.id LIMIT ? OFFSET ?;"
+    };
+
+    //! A script to search the log messages without full-text search index.
+    //! The filter conditions are appended to the script before the order.
+    constexpr std::string_view _sqlScanLogMessages
+    {
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module, id FROM log_messages WHERE msg_log LIKE ? ESCAPE '\\'"
+    };
+
+    //! The order and the page of the log messages searched without full-text search index.
+    constexpr std::string_view _sqlScanOrder
+    {
+        " ORDER BY time_created, id LIMIT ? OFFSET ?;"
     };
 
     constexpr std::string_view _sqlCountInstanceLogs
@@ -296,8 +480,170 @@ namespace
         "SELECT COUNT(cookie_id) from instances;"
     };
 
+    //! A string format to set the journal mode of the database.
+    constexpr std::string_view _fmtJournalMode
+    {
+        "PRAGMA journal_mode = %s;"
+    };
+
+    //! A string format to set the synchronous mode of the database.
+    constexpr std::string_view _fmtSyncMode
+    {
+        "PRAGMA synchronous = %s;"
+    };
+
+    //! A script to checkpoint the write-ahead log without blocking readers and writers.
+    constexpr std::string_view _sqlCheckpoint
+    {
+        "PRAGMA wal_checkpoint(PASSIVE);"
+    };
+
+    //! The journal modes supported by SQLite.
+    constexpr std::string_view _journalModes[]  { "delete", "truncate", "persist", "memory", "wal", "off" };
+
+    //! The synchronous modes supported by SQLite.
+    constexpr std::string_view _syncModes[]     { "off", "normal", "full", "extra" };
+
+    //! The priorities of the log messages saved in the database.
+    constexpr NELogging::eLogPriority _logPriorities[]
+    {
+          NELogging::eLogPriority::PrioNotset
+        , NELogging::eLogPriority::PrioScope
+        , NELogging::eLogPriority::PrioFatal
+        , NELogging::eLogPriority::PrioError
+        , NELogging::eLogPriority::PrioWarning
+        , NELogging::eLogPriority::PrioInfo
+        , NELogging::eLogPriority::PrioDebug
+        , NELogging::eLogPriority::PrioIgnore
+        , NELogging::eLogPriority::PrioMarker
+        , NELogging::eLogPriority::PrioMarkerError
+        , NELogging::eLogPriority::PrioMarkerWarning
+        , NELogging::eLogPriority::PrioMarkerInfo
+        , NELogging::eLogPriority::PrioIgnoreLayout
+    };
+
+    //! The prefix of the name of the flush thread.
+    constexpr std::string_view _flushThreadName { "_LogSqliteDatabaseFlush_" };
+
     //! The size of the string buffer to format SQL scripts
     constexpr uint32_t  SQL_LEN     { 768 };
+
+    //! Returns true if the mode is in the list of supported modes.
+    template<std::size_t N>
+    inline bool _isSupportedMode(const String& mode, const std::string_view (&modes)[N])
+    {
+        for (const std::string_view& entry : modes)
+        {
+            if (mode.compare(entry, false) == NEMath::eCompare::Equal)
+                return true;
+        }
+
+        return false;
+    }
+
+    //! Appends to the SQL script the condition with the list of parameters to bind.
+    inline void _appendParamList(String& sql, const std::string_view& condition, uint32_t count)
+    {
+        if (count != 0)
+        {
+            sql += condition;
+            sql += " IN (?";
+            for (uint32_t i = 1; i < count; ++ i)
+            {
+                sql += ", ?";
+            }
+
+            sql += ")";
+        }
+    }
+
+    //! Fills the list of log priorities saved in the database, which match the mask.
+    //! The list is empty if all priorities match. Returns false if no priority matches.
+    inline bool _makePriorities(uint32_t prioMask, std::vector<uint32_t>& OUT prios)
+    {
+        prios.clear();
+        for (NELogging::eLogPriority prio : _logPriorities)
+        {
+            if ((static_cast<uint32_t>(prio) & prioMask) != 0)
+            {
+                prios.push_back(static_cast<uint32_t>(prio));
+            }
+        }
+
+        if (prios.empty())
+            return false;
+
+        if (static_cast<uint32_t>(prios.size()) == MACRO_ARRAYLEN(_logPriorities))
+        {
+            // all priorities match, no condition is needed.
+            prios.clear();
+        }
+
+        return true;
+    }
+
+    //! Appends to the SQL script the conditions of the log filter.
+    inline void _appendFilter(String& sql, const LogSqliteDatabase::sLogFilter& filter, const std::vector<uint32_t>& prios)
+    {
+        if (filter.filterTimeBegin != 0)
+        {
+            sql += " AND time_created >= ?";
+        }
+
+        if (filter.filterTimeEnd != 0)
+        {
+            sql += " AND time_created <= ?";
+        }
+
+        if (filter.filterInstance != NEService::COOKIE_ANY)
+        {
+            sql += " AND cookie_id = ?";
+        }
+
+        _appendParamList(sql, " AND scope_id", static_cast<uint32_t>(filter.filterScopes.size()));
+        _appendParamList(sql, " AND msg_prio", static_cast<uint32_t>(prios.size()));
+    }
+
+    //! Binds the parameters of the log filter starting at the given index. Returns the next index.
+    inline int _bindFilter(SqliteStatement& stmt, int index, const LogSqliteDatabase::sLogFilter& filter, const std::vector<uint32_t>& prios)
+    {
+        if (filter.filterTimeBegin != 0)
+        {
+            stmt.bindUint64(index ++, static_cast<uint64_t>(filter.filterTimeBegin));
+        }
+
+        if (filter.filterTimeEnd != 0)
+        {
+            stmt.bindUint64(index ++, static_cast<uint64_t>(filter.filterTimeEnd));
+        }
+
+        if (filter.filterInstance != NEService::COOKIE_ANY)
+        {
+            stmt.bindUint64(index ++, static_cast<uint64_t>(filter.filterInstance));
+        }
+
+        for (uint32_t scopeId : filter.filterScopes)
+        {
+            stmt.bindUint32(index ++, scopeId);
+        }
+
+        for (uint32_t prio : prios)
+        {
+            stmt.bindUint32(index ++, prio);
+        }
+
+        return index;
+    }
+
+    //! Returns the unique name of the flush thread of the log database.
+    inline String _makeFlushThreadName(void)
+    {
+        static std::atomic_uint _count{ 0 };
+
+        String result(_flushThreadName);
+        result += String::makeString(static_cast<uint32_t>(++ _count));
+        return result;
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -327,12 +673,29 @@ LogSqliteDatabase::LogSqliteDatabase(void)
     , mDbInitPath           ( )
     , mIsInitialized        ( false )
     , mDbLogEnabled         ( true )
+    , mHasNameTables        ( true )
+    , mThreadKeys           ( )
+    , mModuleKeys           ( )
+    , mSearchEnabled        ( false )
+    , mHasSearch            ( false )
+    , mSearchIndexed        ( 0 )
     , mLock                 ( false )
+    , mBatchRows            ( DEFAULT_BATCH_ROWS )
+    , mFlushTimeout         ( DEFAULT_FLUSH_TIMEOUT )
+    , mJournalMode          ( DEFAULT_JOURNAL_MODE )
+    , mSyncMode             ( DEFAULT_SYNC_MODE )
+    , mPending              ( )
+    , mPendingLock          ( )
+    , mFlushEvent           ( true, true )
+    , mFlushExit            ( false )
+    , mFlushThread          ( static_cast<IEThreadConsumer &>(self()), _makeFlushThreadName() )
 {
 }
 
 LogSqliteDatabase::~LogSqliteDatabase(void)
 {
+    _stopFlushThread();
+    flushLogs();
     mStmtLogs.finalize();
     mDatabase.disconnect();
     mIsInitialized = false;
@@ -346,6 +709,8 @@ inline bool LogSqliteDatabase::_open(const String& dbPath, bool readOnly)
     bool result{ true };
     mDatabase.disconnect();
     mIsInitialized = false;
+    mThreadKeys.clear();
+    mModuleKeys.clear();
     if (dbPath.isEmpty() == false)
     {
         mDbInitPath = dbPath;
@@ -366,14 +731,94 @@ inline void LogSqliteDatabase::_createTables(void)
     VERIFY(mDatabase.execute(_sqlCreateTbVersion));
     VERIFY(mDatabase.execute(_sqlCreateTbInstances));
     VERIFY(mDatabase.execute(_sqlCreateTbScopes));
+    VERIFY(mDatabase.execute(_sqlCreateTbThreads));
+    VERIFY(mDatabase.execute(_sqlCreateTbModules));
     VERIFY(mDatabase.execute(_sqlCreateTbLogs));
+    VERIFY(mDatabase.execute(_sqlCreateViewLogs));
 }
 
 inline void LogSqliteDatabase::_createIndexes(void)
 {
     VERIFY(mDatabase.execute(_sqlCraeteIdxCookie));
     VERIFY(mDatabase.execute(_sqlCreateIdxScopes));
-    VERIFY(mDatabase.execute(_sqlCreateIdxLogs));
+    VERIFY(mDatabase.execute(_sqlCreateIdxLogsTime));
+    VERIFY(mDatabase.execute(_sqlCreateIdxLogsInst));
+    VERIFY(mDatabase.execute(_sqlCreateIdxLogsPrio));
+}
+
+inline bool LogSqliteDatabase::_setupNameTables(void)
+{
+    SqliteStatement stmt(mDatabase, _sqlHasNameTables);
+    if ((stmt.next() == SqliteStatement::eQueryResult::HasMore) && (stmt.getUint32(0) != 0))
+        return true;
+
+    // the database is created by previous version, read logs and threads from temporary views.
+    stmt.finalize();
+    mDatabase.execute(_sqlCreateTempViewLogs);
+    mDatabase.execute(_sqlCreateTempViewThreads);
+    return false;
+}
+
+inline bool LogSqliteDatabase::_setupSearch(bool readOnly)
+{
+    mSearchIndexed = 0;
+    if (mSearchEnabled && (readOnly == false))
+    {
+        // the index is not available if SQLite is built without FTS5 extension.
+        if ((mDatabase.execute(_sqlCreateTbSearch) == false) || (mDatabase.execute(_sqlCreateTbSearchState) == false))
+            return false;
+
+        mDatabase.execute(_sqlInitSearchState);
+    }
+
+    SqliteStatement stmt(mDatabase, _sqlHasSearch);
+    if ((stmt.next() != SqliteStatement::eQueryResult::HasMore) || (stmt.getUint32(0) == 0))
+        return false;
+
+    SqliteStatement state(mDatabase, _sqlGetSearchState);
+    if (state.next() == SqliteStatement::eQueryResult::HasMore)
+    {
+        mSearchIndexed = state.getUint64(0);
+    }
+
+    return true;
+}
+
+uint32_t LogSqliteDatabase::_indexSearch(uint32_t maxRows)
+{
+    Lock lock(mLock);
+    if ((mHasSearch == false) || (mStmtLogs.isValid() == false))
+        return 0;
+
+    SqliteStatement stmt(mDatabase, _sqlGetSearchBatch);
+    stmt.bindUint64(0, mSearchIndexed);
+    stmt.bindUint32(1, maxRows);
+    if ((stmt.next() != SqliteStatement::eQueryResult::HasMore) || (stmt.getUint32(0) == 0))
+        return 0;
+
+    const uint32_t result{ stmt.getUint32(0) };
+    const uint64_t lastId{ stmt.getUint64(1) };
+    stmt.finalize();
+
+    mDatabase.begin();
+    SqliteStatement index(mDatabase, _sqlIndexSearchBatch);
+    index.bindUint64(0, mSearchIndexed);
+    index.bindUint64(1, lastId);
+    bool succeeded{ index.next() != SqliteStatement::eQueryResult::Failed };
+    index.finalize();
+
+    SqliteStatement state(mDatabase, _sqlSetSearchState);
+    state.bindUint64(0, lastId);
+    succeeded = succeeded && (state.next() != SqliteStatement::eQueryResult::Failed);
+    state.finalize();
+
+    mDatabase.commit(succeeded);
+    if (succeeded)
+    {
+        mSearchIndexed = lastId;
+    }
+
+    return (succeeded ? result : 0u);
 }
 
 inline void LogSqliteDatabase::_initialize(void)
@@ -395,22 +840,180 @@ inline void LogSqliteDatabase::_initialize(void)
                         );
     VERIFY(mDatabase.execute(sql));
 
-    String::formatString(sql, SQL_LEN, _fmtLog.data()
-                        , static_cast<uint64_t>(NEService::COOKIE_LOCAL)
-                        , static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE)
-                        , static_cast<uint32_t>(0u)
-                        , static_cast<uint32_t>(NELogging::eLogMessageType::LogMessageText)
-                        , static_cast<uint32_t>(NELogging::eLogPriority::PrioIgnore)
-                        , static_cast<uint64_t>(proc.getId())
-                        , static_cast<uint64_t>(threadId)
-                        , "Starting database logging..."
-                        , thread.getString()
-                        , module.getString()
-                        , static_cast<uint64_t>(now.getTime())
-                        , static_cast<uint64_t>(now.getTime())
-                        , static_cast<uint32_t>(0u)
-                        );
-    VERIFY(mDatabase.execute(sql));
+    constexpr std::string_view message{ "Starting database logging..." };
+    NELogging::sLogMessage log(NELogging::eLogMessageType::LogMessageText);
+    log.logCookie       = NEService::COOKIE_LOCAL;
+    log.logScopeId      = static_cast<uint32_t>(NEMath::CHECKSUM_IGNORE);
+    log.logMessagePrio  = NELogging::eLogPriority::PrioIgnore;
+    log.logModuleId     = static_cast<ITEM_ID>(proc.getId());
+    log.logThreadId     = static_cast<ITEM_ID>(threadId);
+    log.logTimestamp    = static_cast<TIME64>(now.getTime());
+    log.logReceived     = static_cast<TIME64>(now.getTime());
+    log.logMessageLen   = NEMemory::memCopy(log.logMessage, NELogging::LOG_MESSAGE_IZE - 1, message.data(), static_cast<uint32_t>(message.length()));
+    log.logMessage[log.logMessageLen] = String::EmptyChar;
+    log.logThreadLen    = NEMemory::memCopy(log.logThread, NELogging::LOG_NAMES_SIZE - 1, thread.getString(), thread.getLength());
+    log.logThread[log.logThreadLen] = String::EmptyChar;
+    log.logModuleLen    = NEMemory::memCopy(log.logModule, NELogging::LOG_NAMES_SIZE - 1, module.getString(), module.getLength());
+    log.logModule[log.logModuleLen] = String::EmptyChar;
+    VERIFY(_insertLog(log));
+}
+
+uint32_t LogSqliteDatabase::_getNameKey(NameKeys& keys, const std::string_view& sqlInsert, const std::string_view& sqlSelect, const ITEM_ID& id, const char* name, uint32_t nameLen)
+{
+    // the name is unique only together with the ID of the thread or the module.
+    String key(name, nameLen);
+    key += '\n';
+    key += String::makeString(static_cast<uint64_t>(id));
+
+    uint32_t result{ 0 };
+    if (keys.find(key, result) == false)
+    {
+        const String value(name, nameLen);
+        SqliteStatement stmtInsert(mDatabase, sqlInsert);
+        stmtInsert.bindUint64(0, static_cast<uint64_t>(id));
+        stmtInsert.bindText(  1, value);
+        stmtInsert.next();
+
+        SqliteStatement stmtSelect(mDatabase, sqlSelect);
+        stmtSelect.bindUint64(0, static_cast<uint64_t>(id));
+        stmtSelect.bindText(  1, value);
+        if (stmtSelect.next() == SqliteStatement::eQueryResult::HasMore)
+        {
+            result = stmtSelect.getUint32(0);
+            keys.setAt(key, result);
+        }
+    }
+
+    return result;
+}
+
+inline bool LogSqliteDatabase::_insertLog(const NELogging::sLogMessage& message)
+{
+    mStmtLogs.bindUint64( 0, static_cast<uint64_t>(message.logCookie));
+    mStmtLogs.bindUint32( 1, static_cast<uint32_t>(message.logScopeId));
+    mStmtLogs.bindUint32( 2, static_cast<uint32_t>(message.logSessionId));
+    mStmtLogs.bindUint32( 3, static_cast<uint32_t>(message.logMsgType));
+    mStmtLogs.bindUint32( 4, static_cast<uint32_t>(message.logMessagePrio));
+    if (mHasNameTables)
+    {
+        mStmtLogs.bindUint32( 5, _getNameKey(mThreadKeys, _sqlInsertThread, _sqlGetThreadKey, message.logThreadId, message.logThread, message.logThreadLen));
+        mStmtLogs.bindUint32( 6, _getNameKey(mModuleKeys, _sqlInsertModule, _sqlGetModuleKey, message.logModuleId, message.logModule, message.logModuleLen));
+        mStmtLogs.bindText(   7, message.logMessage);
+        mStmtLogs.bindUint64( 8, static_cast<uint64_t>(message.logTimestamp));
+        mStmtLogs.bindUint64( 9, static_cast<uint64_t>(message.logReceived));
+        mStmtLogs.bindUint32(10, static_cast<uint32_t>(message.logDuration));
+    }
+    else
+    {
+        mStmtLogs.bindUint64( 5, static_cast<uint64_t>(message.logModuleId));
+        mStmtLogs.bindUint64( 6, static_cast<uint64_t>(message.logThreadId));
+        mStmtLogs.bindText(   7, message.logMessage);
+        mStmtLogs.bindText(   8, message.logThread);
+        mStmtLogs.bindText(   9, message.logModule);
+        mStmtLogs.bindUint64(10, static_cast<uint64_t>(message.logTimestamp));
+        mStmtLogs.bindUint64(11, static_cast<uint64_t>(message.logReceived));
+        mStmtLogs.bindUint32(12, static_cast<uint32_t>(message.logDuration));
+    }
+
+    bool result{ mStmtLogs.next() == SqliteStatement::eQueryResult::HasNoMore };
+    mStmtLogs.reset();
+    mStmtLogs.clearBindings();
+    return result;
+}
+
+uint32_t LogSqliteDatabase::_flushPending(LogRows& rows)
+{
+    // keep the database lock while moving rows to preserve the order of logs.
+    Lock lock(mLock);
+    do
+    {
+        Lock lockPending(mPendingLock);
+        rows.swap(mPending);
+    } while (false);
+
+    uint32_t result{ 0 };
+    if ((rows.empty() == false) && mStmtLogs.isValid())
+    {
+        mDatabase.begin();
+        for (const NELogging::sLogMessage& row : rows)
+        {
+            result += _insertLog(row) ? 1 : 0;
+        }
+
+        mDatabase.commit(true);
+    }
+
+    rows.clear();
+    return result;
+}
+
+inline void LogSqliteDatabase::_setupJournal(void)
+{
+    char sql[SQL_LEN]{};
+    if (_isSupportedMode(mJournalMode, _journalModes))
+    {
+        String::formatString(sql, SQL_LEN, _fmtJournalMode.data(), mJournalMode.getString());
+        mDatabase.execute(sql);
+    }
+
+    if (_isSupportedMode(mSyncMode, _syncModes))
+    {
+        String::formatString(sql, SQL_LEN, _fmtSyncMode.data(), mSyncMode.getString());
+        mDatabase.execute(sql);
+    }
+}
+
+inline void LogSqliteDatabase::_startFlushThread(void)
+{
+    if (((mBatchRows > 1) || mHasSearch) && (mFlushThread.isRunning() == false))
+    {
+        mFlushExit = false;
+        mFlushEvent.resetEvent();
+        mFlushThread.createThread(NECommon::WAIT_INFINITE);
+    }
+}
+
+inline void LogSqliteDatabase::_stopFlushThread(void)
+{
+    if (mFlushThread.isRunning())
+    {
+        mFlushExit = true;
+        mFlushEvent.setEvent();
+        mFlushThread.shutdownThread(NECommon::WAIT_INFINITE);
+    }
+}
+
+void LogSqliteDatabase::onThreadRuns(void)
+{
+    LogRows rows;
+    bool doCheckpoint{ false };
+    bool hasMore{ false };
+
+    while (mFlushExit == false)
+    {
+        // do not wait if there are more logs to add in the search index.
+        bool isSignaled{ mFlushEvent.lock(hasMore ? NECommon::DO_NOT_WAIT : mFlushTimeout) };
+        uint32_t inserted{ _flushPending(rows) };
+        uint32_t indexed{ _indexSearch(SEARCH_BATCH_ROWS) };
+        hasMore = (indexed == SEARCH_BATCH_ROWS);
+        if ((inserted != 0) || (indexed != 0))
+        {
+            doCheckpoint = true;
+        }
+        else if (doCheckpoint && (isSignaled == false))
+        {
+            // no logs during the timeout, checkpoint the write-ahead log while the database is idle.
+            Lock lock(mLock);
+            mDatabase.execute(_sqlCheckpoint);
+            doCheckpoint = false;
+        }
+    }
+}
+
+uint32_t LogSqliteDatabase::flushLogs(void)
+{
+    LogRows rows;
+    return _flushPending(rows);
 }
 
 inline void LogSqliteDatabase::_copyLogMessage(SqliteStatement& stmt, SharedBuffer& buf)
@@ -480,18 +1083,30 @@ bool LogSqliteDatabase::connect(const String& dbPath, bool readOnly)
         ASSERT(mIsInitialized == false);
         if (_open(dbPath, readOnly))
         {
+            if (readOnly == false)
+            {
+                _setupJournal();
+            }
+
             if (exists == false)
             {
                 _createTables();
                 _createIndexes();
-                _initialize();
-                commit(true);
             }
 
+            mHasNameTables = _setupNameTables();
+            mHasSearch = _setupSearch(readOnly);
             mIsInitialized = true;
             if (readOnly == false)
             {
-                mStmtLogs.prepare(_sqlInsertLog);
+                mStmtLogs.prepare(mHasNameTables ? _sqlInsertLog : _sqlInsertLogNames);
+                if (exists == false)
+                {
+                    _initialize();
+                    commit(true);
+                }
+
+                _startFlushThread();
             }
         }
     }
@@ -501,15 +1116,22 @@ bool LogSqliteDatabase::connect(const String& dbPath, bool readOnly)
 
 void LogSqliteDatabase::disconnect(void)
 {
+    // stop the flush thread before locking, it uses the database lock.
+    _stopFlushThread();
+
     Lock lock(mLock);
     if ((mDatabase.isOperable() == false) || (mIsInitialized == false))
         return;
 
+    flushLogs();
     if (mStmtLogs.isValid())
         mStmtLogs.finalize();
 
     mDatabase.commit(true);
     mDatabase.disconnect();
+    mThreadKeys.clear();
+    mModuleKeys.clear();
+    mHasSearch = false;
     mIsInitialized = false;
 }
 
@@ -528,6 +1150,11 @@ bool LogSqliteDatabase::begin(void)
 bool LogSqliteDatabase::commit(bool doCommit)
 {
     Lock lock(mLock);
+    if (doCommit)
+    {
+        flushLogs();
+    }
+
     return mDatabase.commit(doCommit);
 }
 
@@ -538,30 +1165,36 @@ bool LogSqliteDatabase::areTablesInitialized(void) const
 
 bool LogSqliteDatabase::logMessage(const NELogging::sLogMessage& message)
 {
-    Lock lock(mLock);
-    if (mStmtLogs.isValid() == false)
+    if ((mBatchRows > 1) && mFlushThread.isRunning())
     {
-        return false;
-    }
+        uint32_t pending{ 0 };
+        do
+        {
+            Lock lock(mPendingLock);
+            NELogging::sLogMessage& row = mPending.emplace_back(message);
+            // the copy constructor does not copy the names of the thread and the module.
+            row.logThreadLen = NEMemory::memCopy(row.logThread, NELogging::LOG_NAMES_SIZE - 1, message.logThread, message.logThreadLen);
+            row.logThread[row.logThreadLen] = String::EmptyChar;
+            row.logModuleLen = NEMemory::memCopy(row.logModule, NELogging::LOG_NAMES_SIZE - 1, message.logModule, message.logModuleLen);
+            row.logModule[row.logModuleLen] = String::EmptyChar;
+            pending = static_cast<uint32_t>(mPending.size());
+        } while (false);
+
+        if (pending >= mBatchRows * MAX_PENDING_BATCHES)
+        {
+            // the flush thread is behind, insert the logs in the calling thread.
+            flushLogs();
+        }
+        else if (pending >= mBatchRows)
+        {
+            mFlushEvent.setEvent();
+        }
 
-    mStmtLogs.bindUint64( 0, static_cast<uint64_t>(message.logCookie));
-    mStmtLogs.bindUint32( 1, static_cast<uint32_t>(message.logScopeId));
-    mStmtLogs.bindUint32( 2, static_cast<uint32_t>(message.logSessionId));
-    mStmtLogs.bindUint32( 3, static_cast<uint32_t>(message.logMsgType));
-    mStmtLogs.bindUint32( 4, static_cast<uint32_t>(message.logMessagePrio));
-    mStmtLogs.bindUint64( 5, static_cast<uint64_t>(message.logModuleId));
-    mStmtLogs.bindUint64( 6, static_cast<uint64_t>(message.logThreadId));
-    mStmtLogs.bindText(   7, message.logMessage);
-    mStmtLogs.bindText(   8, message.logThread);
-    mStmtLogs.bindText(   9, message.logModule);
-    mStmtLogs.bindUint64(10, static_cast<uint64_t>(message.logTimestamp));
-    mStmtLogs.bindUint64(11, static_cast<uint64_t>(message.logReceived));
-    mStmtLogs.bindUint32(12, static_cast<uint64_t>(message.logDuration));
+        return true;
+    }
 
-    bool result{ mStmtLogs.next() == SqliteStatement::eQueryResult::HasNoMore };
-    mStmtLogs.reset();
-    mStmtLogs.clearBindings();
-    return result;
+    Lock lock(mLock);
+    return (mStmtLogs.isValid() && _insertLog(message));
 }
 
 bool LogSqliteDatabase::logInstanceConnected(const NEService::sServiceConnectedInstance& instance, const DateTime& timestamp)
@@ -730,6 +1363,7 @@ std::vector<String> LogSqliteDatabase::getLogThreadNames(void)
 void LogSqliteDatabase::getLogThreadNames(std::vector<String>& OUT names)
 {
     Lock lock(mLock);
+    flushLogs();
     names.clear();
     SqliteStatement stmt(mDatabase, _sqlGetThreadNames);
     if (stmt.isValid())
@@ -754,6 +1388,7 @@ std::vector<ITEM_ID> LogSqliteDatabase::getLogThreads(void)
 void LogSqliteDatabase::getLogThreads(std::vector<ITEM_ID>& OUT ids)
 {
     Lock lock(mLock);
+    flushLogs();
     ids.clear();
     SqliteStatement stmt(mDatabase, _sqlGetThreadIds);
     if (stmt.isValid())
@@ -850,6 +1485,7 @@ std::vector<SharedBuffer> LogSqliteDatabase::getLogMessages(void)
 void LogSqliteDatabase::getLogMessages(std::vector<SharedBuffer>& OUT messages)
 {
     Lock lock(mLock);
+    flushLogs();
     messages.clear();
     SqliteStatement stmt(mDatabase, _sqlGetAllLogMessages);
     if (stmt.isValid())
@@ -881,6 +1517,7 @@ void LogSqliteDatabase::getLogInstMessages(std::vector<SharedBuffer>& OUT messag
     }
 
     Lock lock(mLock);
+    flushLogs();
     messages.clear();
     SqliteStatement stmt(mDatabase, _sqlGetInstLogMessages);
     if (stmt.isValid())
@@ -913,6 +1550,7 @@ void LogSqliteDatabase::getLogScopeMessages(std::vector<SharedBuffer>& OUT messa
     }
 
     Lock lock(mLock);
+    flushLogs();
     messages.clear();
     SqliteStatement stmt(mDatabase, _sqlGetScopeLogMessages);
     if (stmt.isValid())
@@ -941,6 +1579,7 @@ std::vector<SharedBuffer> LogSqliteDatabase::getLogMessages(ITEM_ID IN instId, u
     }
 
     Lock lock(mLock);
+    flushLogs();
     std::vector<SharedBuffer> result;
     SqliteStatement stmt(mDatabase, _sqlGetInstScopeLogMessages);
     if (stmt.isValid())
@@ -976,6 +1615,7 @@ void LogSqliteDatabase::getLogMessages(std::vector<SharedBuffer>& OUT messages,
     }
 
     Lock lock(mLock);
+    flushLogs();
     messages.clear();
     SqliteStatement stmt(mDatabase, _sqlGetInstScopeLogMessages);
     if (stmt.isValid())
@@ -993,6 +1633,98 @@ void LogSqliteDatabase::getLogMessages(std::vector<SharedBuffer>& OUT messages,
     ASSERT(stmt.getRowPos() == static_cast<uint32_t>(messages.size()));
 }
 
+uint32_t LogSqliteDatabase::getLogMessagesPage(std::vector<SharedBuffer>& OUT messages, const sLogFilter& IN filter, sLogPageKey& IN OUT pageKey, uint32_t IN maxEntries)
+{
+    Lock lock(mLock);
+    flushLogs();
+    messages.clear();
+
+    std::vector<uint32_t> prios;
+    if ((mDatabase.isOperable() == false) || (_makePriorities(filter.filterPrio, prios) == false) || (maxEntries == 0))
+        return 0;
+
+    String sql(_sqlGetPageLogMessages);
+    _appendFilter(sql, filter, prios);
+    sql += _sqlPageOrder;
+
+    SqliteStatement stmt(mDatabase, sql);
+    if (stmt.isValid() == false)
+        return 0;
+
+    stmt.bindUint64(0, static_cast<uint64_t>(pageKey.keyTime));
+    stmt.bindUint64(1, pageKey.keyId);
+    int index{ _bindFilter(stmt, 2, filter, prios) };
+    stmt.bindUint32(index, maxEntries);
+    while (stmt.next() == SqliteStatement::eQueryResult::HasMore)
+    {
+        SharedBuffer buf;
+        _copyLogMessage(stmt, buf);
+        messages.push_back(buf);
+        pageKey.keyTime = static_cast<TIME64>(stmt.getUint64(5));
+        pageKey.keyId   = stmt.getUint64(13);
+    }
+
+    return static_cast<uint32_t>(messages.size());
+}
+
+uint32_t LogSqliteDatabase::searchLogMessages(std::vector<SharedBuffer>& OUT messages, const String& IN text, const sLogFilter& IN filter, uint32_t IN startAt, uint32_t IN maxEntries)
+{
+    Lock lock(mLock);
+    flushLogs();
+    messages.clear();
+
+    std::vector<uint32_t> prios;
+    if ((mDatabase.isOperable() == false) || text.isEmpty() || (_makePriorities(filter.filterPrio, prios) == false) || (maxEntries == 0))
+        return 0;
+
+    String pattern;
+    String sql;
+    if (mHasSearch)
+    {
+        // index the rest of logs, and search the text as a phrase.
+        uint32_t indexed{ 0 };
+        do
+        {
+            indexed = _indexSearch(SEARCH_BATCH_ROWS);
+        } while (indexed == SEARCH_BATCH_ROWS);
+
+        pattern = text;
+        pattern.replace("\"", "\"\"");
+        pattern = "\"" + pattern + "\"";
+        sql = _sqlSearchLogMessages;
+        _appendFilter(sql, filter, prios);
+        sql += _sqlSearchOrder;
+    }
+    else
+    {
+        pattern = text;
+        pattern.replace("\\", "\\\\");
+        pattern.replace("%", "\\%");
+        pattern.replace("_", "\\_");
+        pattern = "%" + pattern + "%";
+        sql = _sqlScanLogMessages;
+        _appendFilter(sql, filter, prios);
+        sql += _sqlScanOrder;
+    }
+
+    SqliteStatement stmt(mDatabase, sql);
+    if (stmt.isValid() == false)
+        return 0;
+
+    stmt.bindText(0, pattern);
+    int index{ _bindFilter(stmt, 1, filter, prios) };
+    stmt.bindUint32(index ++, maxEntries);
+    stmt.bindUint32(index ++, startAt);
+    while (stmt.next() == SqliteStatement::eQueryResult::HasMore)
+    {
+        SharedBuffer buf;
+        _copyLogMessage(stmt, buf);
+        messages.push_back(buf);
+    }
+
+    return static_cast<uint32_t>(messages.size());
+}
+
 int LogSqliteDatabase::getLogInstScopes(std::vector<NELogging::sScopeInfo>& OUT scopes, SqliteStatement& IN stmt, int IN maxEntries /*= -1*/)
 {
     int result{ 0 };
@@ -1115,6 +1847,7 @@ bool LogSqliteDatabase::setupStatementReadLogs(SqliteStatement& IN OUT stmt, ITE
 uint32_t LogSqliteDatabase::countLogEntries(ITEM_ID instId)
 {
     Lock lock(mLock);
+    flushLogs();
     if (mDatabase.isOperable() == false)
         return 0;
 
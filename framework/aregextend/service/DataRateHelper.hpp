@@ -24,6 +24,9 @@
 #include "aregextend/service/private/ServerSendThread.hpp"
 #include "aregextend/service/private/ServerReceiveThread.hpp"
 
+#include <memory>
+#include <vector>
+
 /************************************************************************
  * Dependencies.
  ************************************************************************/
@@ -56,6 +59,12 @@ public:
     //!< The type of data rate. Contains value and the associated literal.
     using DataRate  = std::pair<float, std::string>;
 
+    //!< The list of threads to send messages to clients.
+    using ListSendThreads       = std::vector<std::unique_ptr<ServerSendThread>>;
+
+    //!< The list of threads to receive messages from clients.
+    using ListReceiveThreads    = std::vector<std::unique_ptr<ServerReceiveThread>>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor.
 //////////////////////////////////////////////////////////////////////////
@@ -64,12 +73,12 @@ public:
      * \brief   Initializes the object, sets threads that the rate can be queried.
      *          If passed 'verbose' parameter is 'false' on each query it returns zero.
      *          Otherwise, returns the actual value.
-     * \param   sendThread      The thread that can be queried the data size sent.
-     * \param   receiveThread   The threat that can be queried the data size received.
+     * \param   sendThreads     The threads that can be queried the data size sent.
+     * \param   receiveThreads  The threads that can be queried the data size received.
      * \param   verbose         The flag, indicating whether the actual size should be
      *                          computed or should return zero.
      **/
-    DataRateHelper(ServerSendThread& sendThread, ServerReceiveThread& receiveThread, bool verbose);
+    DataRateHelper(const ListSendThreads& sendThreads, const ListReceiveThreads& receiveThreads, bool verbose);
 
     ~DataRateHelper(void) = default;
 
@@ -93,13 +102,13 @@ public:
      * \brief   Return the size in bytes of data sent since last query.
      *          If verbose flag is false, returns zero.
      **/
-    inline uint32_t queryBytesSent(void) const;
+    uint32_t queryBytesSent(void) const;
 
     /**
      * \brief   Return the size in bytes of data received since last query.
      *          If verbose flag is false, returns zero.
      **/
-    inline uint32_t queryBytesReceived(void) const;
+    uint32_t queryBytesReceived(void) const;
 
     /**
      * \brief   Return the size of data sent since last query with literal.
@@ -120,8 +129,9 @@ public:
 // Hidden member variables.
 //////////////////////////////////////////////////////////////////////////
 private:
-    ServerSendThread &      mSendThread;    //!< The thread to query the sent data size in bytes.
-    ServerReceiveThread &   mReceiveThread; //!< The thread to query the received data size in bytes.
+    const ListSendThreads &     mSendThreads;   //!< The threads to query the sent data size in bytes.
+    const ListReceiveThreads &  mReceiveThreads;//!< The threads to query the received data size in bytes.
+    bool                        mVerbose;       //!< The flag, indicating whether the data rate is computed.
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
@@ -135,16 +145,6 @@ private:
 // DataRateHelper class inline methods.
 //////////////////////////////////////////////////////////////////////////
 
-inline uint32_t DataRateHelper::queryBytesSent(void) const
-{
-    return mSendThread.extractDataSend();
-}
-
-inline uint32_t DataRateHelper::queryBytesReceived(void) const
-{
-    return mReceiveThread.extractDataReceive();
-}
-
 inline DataRateHelper::DataRate DataRateHelper::queryBytesSentWithLiterals(void) const
 {
     return DataRateHelper::DataRateHelper::convertDataRateLiterals(queryBytesSent());
@@ -27,6 +27,8 @@
 #include "areg/base/SocketServer.hpp"
 #include "areg/base/SynchObjects.hpp"
 
+#include <atomic>
+
 //////////////////////////////////////////////////////////////////////////
 // ServerConnection class declaration.
 //////////////////////////////////////////////////////////////////////////
@@ -106,6 +108,45 @@ public:
      **/
     void closeAllConnections( void );
 
+    /**
+     * \brief   Sets the flag, indicating whether the checksum of received messages is verified.
+     *          If false, the connected clients are notified not to calculate the checksum of sent messages.
+     **/
+    inline void setVerifyChecksum( bool verify );
+
+    /**
+     * \brief   Returns true if the checksum of received messages is verified.
+     **/
+    inline bool isVerifyChecksum( void ) const;
+
+    /**
+     * \brief   Sets the flag, indicating whether the checksum of messages sent to the client is calculated.
+     *          Set false only if the client does not verify the checksum. By default, the checksum is calculated.
+     * \param   clientCookie    The cookie of the accepted client connection.
+     * \param   calculate       If true, the checksum of sent messages is calculated.
+     **/
+    void setCalculateChecksum( const ITEM_ID & clientCookie, bool calculate );
+
+    /**
+     * \brief   Returns true if the checksum of messages sent to the client is calculated.
+     * \param   clientCookie    The cookie of the accepted client connection.
+     **/
+    bool isCalculateChecksum( const ITEM_ID & clientCookie ) const;
+
+    /**
+     * \brief   Sets the flag, indicating whether the client processes the multicast messages.
+     *          The client notifies it when connects. By default, the client does not process them.
+     * \param   clientCookie    The cookie of the accepted client connection.
+     * \param   supported       If true, the client processes the multicast messages.
+     **/
+    void setMulticastSupported( const ITEM_ID & clientCookie, bool supported );
+
+    /**
+     * \brief   Returns true if the client processes the multicast messages.
+     * \param   clientCookie    The cookie of the accepted client connection.
+     **/
+    bool isMulticastSupported( const ITEM_ID & clientCookie ) const;
+
     /**
      * \brief   If socket is valid, sends data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -127,6 +168,23 @@ public:
      **/
     inline int sendMessage( const RemoteMessage & in_message, const SocketAccepted & clientSocket ) const;
 
+    /**
+     * \brief   If socket is valid, sends the list of messages using existing socket connection
+     *          by as few system calls as possible and returns total length in bytes of sent data.
+     *          The invalid messages are skipped. Returns negative number if either socket is invalid,
+     *          or failed to send data to remote host.
+     *          Note:   The call is blocking and method will not return until all data are not sent
+     *                  or if data sending fails.
+     * \param   messages        The list of messages to send.
+     * \param   count           The number of messages in the list.
+     * \param   clientSocket    The accepted socket object
+     * \param   out_sent        If not nullptr, on output contains the number of messages from the
+     *                          beginning of the list, which are completely sent.
+     * \return  Returns total length in bytes of messages sent to remote host.
+     *          Returns negative number if socket is not valid of failed to send.
+     **/
+    inline int sendMessages( const RemoteMessage * messages, uint32_t count, const SocketAccepted & clientSocket, uint32_t * out_sent = nullptr ) const;
+
     /**
      * \brief   If socket is valid, receives data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -145,6 +203,20 @@ public:
      **/
     inline int receiveMessage( RemoteMessage & out_message, const SocketAccepted & clientSocket ) const;
 
+    /**
+     * \brief   Extracts the next message from the receive buffer of the accepted connection. If the buffer
+     *          does not contain the complete message, receives available data from the socket until
+     *          the message is complete. The extracted message refers to the received data without copying.
+     * \param   out_message     The instance of Remote Buffer to receive data. If checksum is invalid,
+     *                          the data will invalidated and dropped.
+     * \param   clientSocket    The accepted socket object
+     * \param   recvBuffer      The receive buffer of the accepted connection.
+     * \return  Returns length in bytes of data in Remote Buffer received from remote host.
+     *          Returns negative number if socket is not valid, the connection is closed or failed to receive.
+     *          Returns zero, if checksum in Remote Buffer was not validated.
+     **/
+    inline int receiveMessage( RemoteMessage & out_message, const SocketAccepted & clientSocket, MessageReceiveBuffer & recvBuffer ) const;
+
     /**
      * \brief   If socket is valid, sends data using existing socket connection and returns length in bytes
      *          of data in Remote Buffer. And returns negative number if either socket is invalid,
@@ -193,6 +265,30 @@ private:
      **/
     const ITEM_ID               mChannelId;
 
+    /**
+     * \brief   The flag, indicating whether the checksum of received messages is verified.
+     **/
+    std::atomic_bool            mVerifyChecksum;
+
+    /**
+     * \brief   The cookies of the clients, which do not verify the checksum of received messages.
+     **/
+    TEHashMap<ITEM_ID, bool>    mNoChecksumClients;
+
+    /**
+     * \brief   The cookies of the clients, which process the multicast messages.
+     **/
+    TEHashMap<ITEM_ID, bool>    mMulticastClients;
+
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns true if the checksum of messages sent to the accepted socket is calculated.
+     **/
+    bool _isCalculateChecksum( const SocketAccepted & clientSocket ) const;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
 //////////////////////////////////////////////////////////////////////////
@@ -210,24 +306,44 @@ inline const ITEM_ID & ServerConnection::getChannelId(void) const
     return mChannelId;
 }
 
+inline void ServerConnection::setVerifyChecksum( bool verify )
+{
+    mVerifyChecksum.store( verify, std::memory_order_relaxed );
+}
+
+inline bool ServerConnection::isVerifyChecksum( void ) const
+{
+    return mVerifyChecksum.load( std::memory_order_relaxed );
+}
+
 inline int ServerConnection::sendMessage(const RemoteMessage & in_message, const SocketAccepted & clientSocket) const
 {
-    return SocketConnectionBase::sendMessage(in_message, clientSocket);
+    return SocketConnectionBase::sendMessage(in_message, clientSocket, _isCalculateChecksum(clientSocket));
+}
+
+inline int ServerConnection::sendMessages(const RemoteMessage * messages, uint32_t count, const SocketAccepted & clientSocket, uint32_t * out_sent /*= nullptr*/) const
+{
+    return SocketConnectionBase::sendMessages(messages, count, clientSocket, _isCalculateChecksum(clientSocket), out_sent);
 }
 
 inline int ServerConnection::sendMessage(const RemoteMessage & in_message, const ITEM_ID & clientCookie) const
 {
-    return SocketConnectionBase::sendMessage(in_message, getClientByCookie(clientCookie) );
+    return SocketConnectionBase::sendMessage(in_message, getClientByCookie(clientCookie), isCalculateChecksum(clientCookie) );
 }
 
 inline int ServerConnection::receiveMessage(RemoteMessage & out_message, const SocketAccepted & clientSocket) const
 {
-    return SocketConnectionBase::receiveMessage(out_message, clientSocket);
+    return SocketConnectionBase::receiveMessage(out_message, clientSocket, isVerifyChecksum());
+}
+
+inline int ServerConnection::receiveMessage(RemoteMessage & out_message, const SocketAccepted & clientSocket, MessageReceiveBuffer & recvBuffer) const
+{
+    return SocketConnectionBase::receiveMessage(out_message, clientSocket, recvBuffer, isVerifyChecksum());
 }
 
 inline int ServerConnection::receiveMessage(RemoteMessage & out_message, const ITEM_ID & clientCookie) const
 {
-    return SocketConnectionBase::receiveMessage(out_message,getClientByCookie(clientCookie));
+    return SocketConnectionBase::receiveMessage(out_message,getClientByCookie(clientCookie), isVerifyChecksum());
 }
 
 #endif  // AREG_AREGEXTEND_SERVICE_SERVERCONNECTION_HPP
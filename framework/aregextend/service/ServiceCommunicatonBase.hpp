@@ -152,6 +152,42 @@ public:
      **/
     inline bool sendMessage(const RemoteMessage & data, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
 
+    /**
+     * \brief   Queues the message for sending to the specified target. The message buffer
+     *          is not copied, so that the same message can be sent to several targets.
+     * \param   data        The data of the message.
+     * \param   target      The cookie of the target connection to send the message.
+     * \param   eventPrio   The priority of the message to set.
+     **/
+    inline bool sendMessage(const RemoteMessage & data, const ITEM_ID & target, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
+
+    /**
+     * \brief   Sets the number of workers to receive and send messages. Each worker is a pair
+     *          of receive and send threads. The connections are distributed between receive
+     *          workers, and the messages are distributed between send workers by the target,
+     *          so that the order of messages of each source and to each target is kept.
+     *          The number of workers can be changed only when the service connection is not started.
+     * \param   count   The number of workers. It is limited by ServerConnectionBase::MAX_CONNECTION_SHARDS.
+     * \return  Returns true if succeeded to set the number of workers.
+     **/
+    bool setServiceWorkers(uint32_t count);
+
+    /**
+     * \brief   Returns the number of workers to receive and send messages.
+     **/
+    inline uint32_t getServiceWorkers(void) const;
+
+    /**
+     * \brief   Sets the parameters of the batch of messages, which each send worker sends by
+     *          one system call. The parameters can be changed only when the send workers are not started.
+     * \param   maxMessages The maximum number of messages in the batch. If zero, sends one message.
+     * \param   maxLinger   The maximum time in milliseconds to wait for more messages
+     *                      when the queue is empty. If zero, the batch is sent as soon
+     *                      as there are no more queued messages.
+     * \return  Returns true if succeeded to set the parameters of the batch.
+     **/
+    bool setSendBatch(uint32_t maxMessages, uint32_t maxLinger);
+
     /**
      * \brief   Returns the instance of data rate helper object to use when computing data rate.
      **/
@@ -438,7 +474,8 @@ public:
     inline bool sendCommunicationMessage(ServiceEventData::eServiceEventCommands cmd, const RemoteMessage & msg, Event::eEventPriority eventPrio = Event::eEventPriority::EventPriorityNormal );
 
     /**
-     * \brief   Call to send the disconnect event. It disconnects the socket  and exits the thread.
+     * \brief   Call to send the disconnect event to all send threads. The first send thread
+     *          disconnects the socket, and all threads exit.
      * \param   eventPrio   The priority of set to the event.
      **/
     inline void disconnectService( Event::eEventPriority eventPrio );
@@ -488,9 +525,11 @@ protected:
     const unsigned int                      mConnectTypes;      //!< The bitwise flags of remote service connections.
     ServerConnection                        mServerConnection;  //!< The instance of server connection object.
     Timer                                   mTimerConnect;      //!< The timer object to trigger in case if failed to create server socket.
-    ServerSendThread                        mThreadSend;        //!< The thread to send messages to clients
-    ServerReceiveThread                     mThreadReceive;     //!< The thread to receive messages from clients
+    DataRateHelper::ListSendThreads         mThreadsSend;       //!< The threads to send messages to clients
+    DataRateHelper::ListReceiveThreads      mThreadsReceive;    //!< The threads to receive messages from clients
     DataRateHelper                          mDataRateHelper;    //!< The helper object to query information of sent and receive bytes.
+    uint32_t                                mBatchSize;         //!< The maximum number of messages sent by one system call.
+    uint32_t                                mBatchLinger;       //!< The maximum time in milliseconds to wait for more messages to send.
     StringArray                             mWhiteList;         //!< The list of enabled fixed client hosts.
     StringArray                             mBlackList;         //!< The list of disabled fixes client hosts.
     ServiceServerEventConsumer              mEventConsumer;     //!< The custom event consumer object
@@ -579,12 +618,28 @@ inline bool ServiceCommunicatonBase::sendCommunicationMessage( ServiceEventData:
 
 inline bool ServiceCommunicatonBase::sendMessage( const RemoteMessage & data, Event::eEventPriority eventPrio /*= Event::eEventPriority::EventPriorityNormal*/ )
 {
+    // the messages to the same target are sent by the same thread to keep the order.
+    ServerSendThread & threadSend = *mThreadsSend[static_cast<uint32_t>(data.getTarget( ) % mThreadsSend.size( ))];
     return SendMessageEvent::sendEvent( SendMessageEventData( data )
-                                        , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                        , static_cast<DispatcherThread &>(mThreadSend)
+                                        , static_cast<IESendMessageEventConsumer &>(threadSend)
+                                        , static_cast<DispatcherThread &>(threadSend)
                                         , eventPrio );
 }
 
+inline bool ServiceCommunicatonBase::sendMessage( const RemoteMessage & data, const ITEM_ID & target, Event::eEventPriority eventPrio /*= Event::eEventPriority::EventPriorityNormal*/ )
+{
+    ServerSendThread & threadSend = *mThreadsSend[static_cast<uint32_t>(target % mThreadsSend.size( ))];
+    return SendMessageEvent::sendEvent( SendMessageEventData( data, target )
+                                        , static_cast<IESendMessageEventConsumer &>(threadSend)
+                                        , static_cast<DispatcherThread &>(threadSend)
+                                        , eventPrio );
+}
+
+inline uint32_t ServiceCommunicatonBase::getServiceWorkers(void) const
+{
+    return static_cast<uint32_t>(mThreadsSend.size());
+}
+
 inline DataRateHelper& ServiceCommunicatonBase::getDataRateHelper(void) const
 {
     return const_cast<DataRateHelper &>(mDataRateHelper);
@@ -612,10 +667,13 @@ inline bool ServiceCommunicatonBase::isCalculateDataRateEnabled(void) const
 
 inline void ServiceCommunicatonBase::disconnectService( Event::eEventPriority eventPrio )
 {
-    SendMessageEvent::sendEvent( SendMessageEventData( )
-                                 , static_cast<IESendMessageEventConsumer &>(mThreadSend)
-                                 , static_cast<DispatcherThread &>(mThreadSend)
-                                 , eventPrio );
+    for ( const auto & threadSend : mThreadsSend )
+    {
+        SendMessageEvent::sendEvent( SendMessageEventData( )
+                                     , static_cast<IESendMessageEventConsumer &>(*threadSend)
+                                     , static_cast<DispatcherThread &>(*threadSend)
+                                     , eventPrio );
+    }
 }
 
 #endif  // AREG_AREGEXTEND_SERVICE_SERVICECOMMUNICATONBASE_HPP
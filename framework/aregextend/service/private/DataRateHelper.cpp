@@ -23,23 +23,53 @@
 // DataRateHelper class implementation
 //////////////////////////////////////////////////////////////////////////
 
-DataRateHelper::DataRateHelper(ServerSendThread& sendThread, ServerReceiveThread& receiveThread, bool verbose)
-    : mSendThread   (sendThread)
-    , mReceiveThread(receiveThread)
+DataRateHelper::DataRateHelper(const ListSendThreads& sendThreads, const ListReceiveThreads& receiveThreads, bool verbose)
+    : mSendThreads   (sendThreads)
+    , mReceiveThreads(receiveThreads)
+    , mVerbose       (verbose)
 {
-    mSendThread.setEnableCalculateData(verbose);
-    mReceiveThread.setEnableCalculateData(verbose);
+    setVerbose(verbose);
 }
 
 void DataRateHelper::setVerbose(bool verbose)
 {
-    mSendThread.setEnableCalculateData(verbose);
-    mReceiveThread.setEnableCalculateData(verbose);
+    mVerbose = verbose;
+    for (const auto& sendThread : mSendThreads)
+    {
+        sendThread->setEnableCalculateData(verbose);
+    }
+
+    for (const auto& receiveThread : mReceiveThreads)
+    {
+        receiveThread->setEnableCalculateData(verbose);
+    }
 }
 
 bool DataRateHelper::isVerbose(void) const
 {
-    return mSendThread.isCalculateDataEnabled() && mReceiveThread.isCalculateDataEnabled();
+    return mVerbose;
+}
+
+uint32_t DataRateHelper::queryBytesSent(void) const
+{
+    uint32_t result{ 0 };
+    for (const auto& sendThread : mSendThreads)
+    {
+        result += sendThread->extractDataSend();
+    }
+
+    return result;
+}
+
+uint32_t DataRateHelper::queryBytesReceived(void) const
+{
+    uint32_t result{ 0 };
+    for (const auto& receiveThread : mReceiveThreads)
+    {
+        result += receiveThread->extractDataReceive();
+    }
+
+    return result;
 }
 
 DataRateHelper::DataRate DataRateHelper::convertDataRateLiterals(uint32_t sizeBytes)
@@ -21,6 +21,9 @@ ServerConnection::ServerConnection(const ITEM_ID & channelId )
     : ServerConnectionBase  ( )
     , SocketConnectionBase  ( )
     , mChannelId            ( channelId )
+    , mVerifyChecksum       ( true )
+    , mNoChecksumClients    ( )
+    , mMulticastClients     ( )
 {
 }
 
@@ -28,6 +31,9 @@ ServerConnection::ServerConnection(const ITEM_ID & channelId, const char * hostN
     : ServerConnectionBase  ( hostName, portNr)
     , SocketConnectionBase  ( )
     , mChannelId            ( channelId )
+    , mVerifyChecksum       ( true )
+    , mNoChecksumClients    ( )
+    , mMulticastClients     ( )
 {
 }
 
@@ -35,6 +41,9 @@ ServerConnection::ServerConnection(const ITEM_ID & channelId, const NESocket::So
     : ServerConnectionBase  ( serverAddress )
     , SocketConnectionBase  ( )
     , mChannelId            ( channelId )
+    , mVerifyChecksum       ( true )
+    , mNoChecksumClients    ( )
+    , mMulticastClients     ( )
 {
 }
 
@@ -69,10 +78,63 @@ void ServerConnection::closeAllConnections(void)
         }
     }
 
-    mMasterList.clear();
+    releaseConnectionEvents();
+    mNoChecksumClients.clear();
+    mMulticastClients.clear();
     mCookieToSocket.clear();
     mSocketToCookie.clear();
     mAcceptedConnections.clear();
 
     mCookieGenerator    = NEService::COOKIE_REMOTE_SERVICE;
 }
+
+void ServerConnection::setCalculateChecksum(const ITEM_ID & clientCookie, bool calculate)
+{
+    Lock lock( mLock );
+    if ( calculate )
+    {
+        mNoChecksumClients.removeAt( clientCookie );
+    }
+    else
+    {
+        mNoChecksumClients.setAt( clientCookie, true );
+    }
+}
+
+bool ServerConnection::isCalculateChecksum(const ITEM_ID & clientCookie) const
+{
+    Lock lock( mLock );
+    return (mNoChecksumClients.isEmpty() || (mNoChecksumClients.contains( clientCookie ) == false));
+}
+
+void ServerConnection::setMulticastSupported(const ITEM_ID & clientCookie, bool supported)
+{
+    Lock lock( mLock );
+    if ( supported )
+    {
+        mMulticastClients.setAt( clientCookie, true );
+    }
+    else
+    {
+        mMulticastClients.removeAt( clientCookie );
+    }
+}
+
+bool ServerConnection::isMulticastSupported(const ITEM_ID & clientCookie) const
+{
+    Lock lock( mLock );
+    return mMulticastClients.contains( clientCookie );
+}
+
+bool ServerConnection::_isCalculateChecksum(const SocketAccepted & clientSocket) const
+{
+    Lock lock( mLock );
+    bool result{ true };
+    if ( mNoChecksumClients.isEmpty() == false )
+    {
+        MapSocketToCookie::MAPPOS pos{ mSocketToCookie.find( clientSocket.getHandle() ) };
+        result = (mSocketToCookie.isValidPosition( pos ) == false) || (mNoChecksumClients.contains( mSocketToCookie.valueAtPosition( pos ) ) == false);
+    }
+
+    return result;
+}
@@ -25,14 +25,17 @@
 
 
 DEF_LOG_SCOPE(areg_aregextend_service_ServerReceiveThread_runDispatcher);
+DEF_LOG_SCOPE(areg_aregextend_service_ServerReceiveThread__receiveMessages);
 
-ServerReceiveThread::ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler & remoteService, ServerConnection & connection )
-    : DispatcherThread  ( NEConnection::SERVER_RECEIVE_MESSAGE_THREAD )
+ServerReceiveThread::ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler & remoteService, ServerConnection & connection, uint32_t worker /*= 0*/ )
+    : DispatcherThread  ( worker == 0 ? String(NEConnection::SERVER_RECEIVE_MESSAGE_THREAD) : NEConnection::SERVER_RECEIVE_MESSAGE_THREAD + ('_' + String::makeString(worker)) )
     , mConnectHandler   ( connectHandler )
     , mRemoteService    ( remoteService )
     , mConnection       ( connection )
+    , mWorker           ( worker )
     , mBytesReceive     ( 0 )
     , mSaveDataReceive  ( false )
+    , mReceiveBuffers   ( )
 {
 }
 
@@ -43,12 +46,12 @@ bool ServerReceiveThread::runDispatcher(void)
 
     readyForEvents(true);
     int whichEvent{ static_cast<int>(EventDispatcherBase::eEventOrder::EventError) };
-    if ( mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) )
+    // Only the first worker listens and accepts new connections.
+    if ( (mWorker != 0) || mConnection.serverListen( NESocket::MAXIMUM_LISTEN_QUEUE_SIZE) )
     {
         IESynchObject* syncObjects[2] = {&mEventExit, &mEventQueue};
         MultiLock multiLock(syncObjects, 2, false);
 
-        RemoteMessage msgReceived;
         uint32_t retryCount = 0;
         do 
         {
@@ -57,7 +60,8 @@ bool ServerReceiveThread::runDispatcher(void)
             {
                 whichEvent = static_cast<int>(EventDispatcherBase::eEventOrder::EventQueue); // escape quit
                 NESocket::SocketAddress addrAccepted;
-                SOCKETHANDLE hSocket = mConnection.waitForConnectionEvent(addrAccepted);
+                bool isClosed{ false };
+                SOCKETHANDLE hSocket = mConnection.waitForConnectionEvent(addrAccepted, isClosed, mWorker);
 
                 if (mConnection.isValid() == false)
                 {
@@ -102,6 +106,11 @@ bool ServerReceiveThread::runDispatcher(void)
                                             , addrAccepted.getHostPort());
                             
                             mConnection.acceptConnection(clientSocket);
+                            if (mConnection.getConnectionShard(hSocket) != mWorker)
+                            {
+                                // the worker of the connection receives the events of the socket.
+                                continue;
+                            }
                         }
                         else if ( clientSocket.isAlive() )
                         {
@@ -125,36 +134,7 @@ bool ServerReceiveThread::runDispatcher(void)
                         }
                     }
 
-#if AREG_LOGS
-                    const NESocket::SocketAddress& addSocket = clientSocket.getAddress();
-#endif // AREG_LOGS
-                    int sizeReceived = mConnection.receiveMessage(msgReceived, clientSocket);
-                    if (sizeReceived > 0 )
-                    {
-                        if (mSaveDataReceive)
-                        {
-                            mBytesReceive += static_cast<uint32_t>(sizeReceived);
-                        }
-
-                        LOG_DBG("Received message [ %p ] from source [ %p ], client [ %s : %d ]"
-                                    , static_cast<id_type>(msgReceived.getMessageId())
-                                    , static_cast<id_type>(msgReceived.getSource())
-                                    , addSocket.getHostAddress().getString()
-                                    , addSocket.getHostPort());
-
-                        mRemoteService.processReceivedMessage(msgReceived, clientSocket);
-                    }
-                    else
-                    {
-                        LOG_DBG("Failed to receive message from client socket [ %s : %d ], socket [ %u ]. Going to close connection"
-                                        , addSocket.getHostAddress().getString()
-                                        , addSocket.getHostPort()
-                                        , clientSocket.getHandle());
-
-                        mRemoteService.failedReceiveMessage(clientSocket);
-                    }
-
-                    msgReceived.invalidate();
+                    _receiveMessages(clientSocket, isClosed);
                 }
             }
             else
@@ -168,7 +148,90 @@ bool ServerReceiveThread::runDispatcher(void)
 
     readyForEvents(false);
     removeAllEvents();
+    mReceiveBuffers.clear();
 
     LOG_DBG("Dispatcher [ %s ] completed job and stopping running.", mDispatcherName.getString());
     return (whichEvent == static_cast<int>(EventDispatcherBase::eEventOrder::EventExit));
 }
+
+void ServerReceiveThread::_receiveMessages(SocketAccepted & clientSocket, bool isClosed)
+{
+    LOG_SCOPE( areg_aregextend_service_ServerReceiveThread__receiveMessages );
+
+    const SOCKETHANDLE hSocket{ clientSocket.getHandle() };
+#if AREG_LOGS
+    const NESocket::SocketAddress& addSocket = clientSocket.getAddress();
+#endif // AREG_LOGS
+
+    // The handle of closed connection can be reused, drop the data of previous connection.
+    const ITEM_ID cookie{ mConnection.getCookie(hSocket) };
+    ReceiveBuffer& entry = mReceiveBuffers[hSocket];
+    if ((entry.second == nullptr) || (entry.first != cookie))
+    {
+        entry.first = cookie;
+        entry.second.reset(DEBUG_NEW MessageReceiveBuffer());
+    }
+
+    std::unique_ptr<MessageReceiveBuffer>& buffer = entry.second;
+
+    // The socket event is fired only when new data arrives, so that either receive
+    // all available data or continue the connection after others.
+    // Only the available data is received, so that the calls do not block.
+    RemoteMessage msgReceived;
+    uint32_t processed{ 0 };
+    bool hasData{ true };
+    bool isFailed{ false };
+    while ((processed < READ_BUDGET) && hasData && (isFailed == false))
+    {
+        if (buffer->hasMessage())
+        {
+            int sizeReceived = mConnection.receiveMessage(msgReceived, clientSocket, *buffer);
+            if (sizeReceived > 0)
+            {
+                if (mSaveDataReceive)
+                {
+                    mBytesReceive += static_cast<uint32_t>(sizeReceived);
+                }
+
+                LOG_DBG("Received message [ %p ] from source [ %p ], client [ %s : %d ]"
+                            , static_cast<id_type>(msgReceived.getMessageId())
+                            , static_cast<id_type>(msgReceived.getSource())
+                            , addSocket.getHostAddress().getString()
+                            , addSocket.getHostPort());
+
+                mRemoteService.processReceivedMessage(msgReceived, clientSocket);
+                ++ processed;
+            }
+            else
+            {
+                isFailed = true;
+            }
+
+            msgReceived.invalidate();
+        }
+        else if (clientSocket.pendingRead() > 0)
+        {
+            isFailed = buffer->receiveData(clientSocket) <= 0;
+        }
+        else
+        {
+            hasData = false;
+        }
+    }
+
+    if (isFailed || (isClosed && (hasData == false)))
+    {
+        LOG_DBG("Failed to receive message from client socket [ %s : %d ], socket [ %u ]. Going to close connection"
+                        , addSocket.getHostAddress().getString()
+                        , addSocket.getHostPort()
+                        , hSocket);
+
+        mReceiveBuffers.erase(hSocket);
+        mRemoteService.failedReceiveMessage(clientSocket);
+    }
+    else if (hasData)
+    {
+        LOG_DBG("The client [ %s : %d ] has more data, continue after other connections", addSocket.getHostAddress().getString(), addSocket.getHostPort());
+        mConnection.continueConnectionEvent(hSocket, isClosed);
+    }
+}
@@ -21,7 +21,11 @@
 #include "areg/base/GEGlobal.h"
 #include "areg/component/DispatcherThread.hpp"
 
+#include "areg/ipc/MessageReceiveBuffer.hpp"
+
 #include <atomic>
+#include <memory>
+#include <unordered_map>
 
 /************************************************************************
  * Dependencies
@@ -29,18 +33,32 @@
 class IEServiceConnectionHandler;
 class IERemoteMessageHandler;
 class ServerConnection;
+class SocketAccepted;
 
 //////////////////////////////////////////////////////////////////////////
 // ServerConnection class declaration.
 //////////////////////////////////////////////////////////////////////////
 /**
  * \brief   The IPC message receiving thread of server socket.
+ *          The server may have several receiving threads (workers), where each
+ *          thread receives messages of own shard of connections, so that the
+ *          messages of each client are received and processed in the order.
+ *          The first thread as well accepts new connections.
  **/
 class ServerReceiveThread    : public    DispatcherThread
 {
     //!< Number of retries to accept socket connection
     static constexpr uint32_t RETRY_COUNT   { 5 };
 
+    //!< The maximum number of messages to receive from one connection before processing other connections.
+    static constexpr uint32_t READ_BUDGET   { 16 };
+
+    //!< The receive buffer of accepted connection and the cookie of connection.
+    using ReceiveBuffer     = std::pair<ITEM_ID, std::unique_ptr<MessageReceiveBuffer>>;
+
+    //!< The receive buffers of accepted connections.
+    using MapReceiveBuffers = std::unordered_map<SOCKETHANDLE, ReceiveBuffer>;
+
 //////////////////////////////////////////////////////////////////////////
 // Constructor / Destructor
 //////////////////////////////////////////////////////////////////////////
@@ -50,8 +68,9 @@ public:
      * \param   connectHandler  The instance of server socket connect / disconnect handling interface
      * \param   remoteService   The instance of remote servicing handler
      * \param   connection      The instance of server connection object.
+     * \param   worker          The index of the receiving thread, which is the index of shard of connections.
      **/
-    ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler& remoteService, ServerConnection & connection );
+    ServerReceiveThread( IEServiceConnectionHandler & connectHandler, IERemoteMessageHandler& remoteService, ServerConnection & connection, uint32_t worker = 0 );
     /**
      * \brief   Destructor
      **/
@@ -93,6 +112,20 @@ protected:
      **/
     virtual bool runDispatcher( void ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Receives and processes the messages of the accepted connection without blocking,
+     *          at most READ_BUDGET messages. If the connection has more data, it is queued to
+     *          continue after other connections. If the connection is closed or failed, notifies
+     *          the remote service handler.
+     * \param   clientSocket    The accepted connection to receive messages.
+     * \param   isClosed        Flag, indicating whether the connection is closed by remote side.
+     **/
+    void _receiveMessages( SocketAccepted & clientSocket, bool isClosed );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -109,6 +142,10 @@ private:
      * \brief   The instance of server connection object
      **/
     ServerConnection &          mConnection;
+    /**
+     * \brief   The index of the receiving thread and the shard of connections.
+     **/
+    const uint32_t              mWorker;
     /**
      * \brief   Accumulative value of received data size.
      */
@@ -117,6 +154,10 @@ private:
      * \brief   Flag, indicating whether data calculation is enabled or disabled. By default, it is disabled.
      **/
     bool                        mSaveDataReceive;
+    /**
+     * \brief   The buffers to receive messages of accepted connections.
+     **/
+    MapReceiveBuffers           mReceiveBuffers;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
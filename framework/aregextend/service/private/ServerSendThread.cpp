@@ -14,23 +14,36 @@
  ************************************************************************/
 #include "aregextend/service/private/ServerSendThread.hpp"
 
+#include "areg/appbase/NEApplication.hpp"
+#include "areg/base/NEUtilities.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
 #include "areg/ipc/IERemoteMessageHandler.hpp"
 #include "areg/logging/GELog.h"
 #include "aregextend/service/ServerConnection.hpp"
 
+#include <algorithm>
+
 
 DEF_LOG_SCOPE(areg_aregextend_service_ServerSendThread_processEvent);
+DEF_LOG_SCOPE(areg_aregextend_service_ServerSendThread__sendBatch);
 
-ServerSendThread::ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection)
-    : DispatcherThread          ( NEConnection::SERVER_SEND_MESSAGE_THREAD )
+ServerSendThread::ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection, uint32_t worker /*= 0*/)
+    : DispatcherThread          ( worker == 0 ? String(NEConnection::SERVER_SEND_MESSAGE_THREAD) : NEConnection::SERVER_SEND_MESSAGE_THREAD + ('_' + String::makeString(worker)) )
     , IESendMessageEventConsumer( )
     , mRemoteService            ( remoteService )
     , mConnection               ( connection )
+    , mWorker                   ( worker )
     , mBytesSend                ( 0 )
     , mSaveDataSend             ( false )
+    , mSendBatch                ( )
+    , mSendGroup                ( )
+    , mBatchSize                ( NEApplication::DEFAULT_SERVICE_BATCH )
+    , mBatchLinger              ( NEApplication::DEFAULT_SERVICE_LINGER )
+    , mBatchStarted             ( 0 )
 {
+    mSendBatch.reserve( mBatchSize );
+    mSendGroup.reserve( mBatchSize );
 }
 
 void ServerSendThread::readyForEvents( bool isReady )
@@ -44,58 +57,128 @@ void ServerSendThread::readyForEvents( bool isReady )
     {
         DispatcherThread::readyForEvents( false );
         SendMessageEvent::removeListener( static_cast<IESendMessageEventConsumer &>(*this), static_cast<DispatcherThread &>(*this) );
-        mConnection.closeAllConnections( );
-        mConnection.disableSend( );
+        _sendBatch( );
+        if ( mWorker == 0 )
+        {
+            mConnection.closeAllConnections( );
+            mConnection.disableSend( );
+        }
     }
 }
 
 void ServerSendThread::processEvent( const SendMessageEventData & data )
 {
-    LOG_SCOPE( areg_aregextend_service_ServerSendThread_processEvent );
     if (data.isForwardMessage())
     {
         const RemoteMessage & msgSend = data.getRemoteMessage( );
         ASSERT( msgSend.isValid( ) );
 
-        const ITEM_ID & target{ msgSend.getTarget() };
-        SocketAccepted client{ mConnection.getClientByCookie(target) };
+        if ( mSendBatch.empty( ) )
+        {
+            mBatchStarted = NEUtilities::getTickCount( );
+        }
 
-        LOG_DBG("Sending message [ %s ] (ID = [ %u ]) to client [ %s : %d ] of socket [ %u ]. The message sent from source [ %u ] to target [ %u ]"
-                    , NEService::getString(static_cast<NEService::eFuncIdRange>(msgSend.getMessageId()))
-                    , static_cast<unsigned int>(msgSend.getMessageId())
+        mSendBatch.emplace_back( data.getTarget( ), msgSend );
+        if ( _waitNextMessage( ) == false )
+        {
+            _sendBatch( );
+        }
+    }
+    else if (data.isExitThreadMessage() )
+    {
+        LOG_SCOPE( areg_aregextend_service_ServerSendThread_processEvent );
+        LOG_DBG("Going to quite send message thread");
+        _sendBatch( );
+        if ( mWorker == 0 )
+        {
+            mConnection.closeAllConnections( );
+            mConnection.closeSocket( );
+        }
+
+        triggerExit( );
+    }
+}
+
+bool ServerSendThread::_waitNextMessage( void )
+{
+    bool result{ false };
+    if ( mSendBatch.size( ) < static_cast<size_t>(mBatchSize) )
+    {
+        if ( static_cast<EventQueue &>(mExternaEvents).isEmpty( ) == false )
+        {
+            result = true;
+        }
+        else if ( mBatchLinger != 0 )
+        {
+            TIME64 elapsed = NEUtilities::getTickCount( ) - mBatchStarted;
+            result = (elapsed < mBatchLinger) && mEventQueue.lock( static_cast<unsigned int>(mBatchLinger - elapsed) );
+        }
+    }
+
+    return result;
+}
+
+void ServerSendThread::_sendBatch( void )
+{
+    LOG_SCOPE( areg_aregextend_service_ServerSendThread__sendBatch );
+    if ( mSendBatch.empty( ) )
+        return;
+
+    // Group the messages by target, keeping the order of messages of each target.
+    std::stable_sort( mSendBatch.begin( ), mSendBatch.end( ), [](const std::pair<ITEM_ID, RemoteMessage> & lhs, const std::pair<ITEM_ID, RemoteMessage> & rhs) -> bool
+        {
+            return (lhs.first < rhs.first);
+        });
+
+    size_t first{ 0 };
+    while ( first < mSendBatch.size( ) )
+    {
+        const ITEM_ID target{ mSendBatch[first].first };
+        mSendGroup.clear( );
+        size_t last{ first };
+        while ( (last < mSendBatch.size( )) && (mSendBatch[last].first == target) )
+        {
+            // the multicast messages share the same buffer between targets.
+            mSendGroup.push_back( mSendBatch[last].second );
+            ++ last;
+        }
+
+        SocketAccepted client{ mConnection.getClientByCookie( target ) };
+        uint32_t count{ static_cast<uint32_t>(mSendGroup.size( )) };
+
+        LOG_DBG("Sending [ %u ] messages to client [ %s : %d ] of socket [ %u ], the target is [ %u ]"
+                    , count
                     , client.getAddress().getHostAddress().getString()
                     , client.getAddress().getHostPort()
-                    , ((unsigned int)(client.getHandle()))
-                    , static_cast<unsigned int>(msgSend.getSource())
-                    , static_cast<unsigned int>(msgSend.getTarget()));
+                    , static_cast<unsigned int>(client.getHandle())
+                    , static_cast<unsigned int>(target));
 
-        int sentBytes = 0;
-        if ((client.isAlive() == false) || ((sentBytes = mConnection.sendMessage(msgSend, client)) <= 0))
+        uint32_t sent{ 0 };
+        int sentBytes = client.isAlive() ? mConnection.sendMessages(mSendGroup.data(), count, client, &sent) : -1;
+        if (sentBytes <= 0)
         {
-            LOG_WARN("Failed to send message [ %u ] to target [ %u ], client is [ %s ]"
-                        , msgSend.getMessageId()
-                        , static_cast<unsigned int>(msgSend.getTarget())
+            LOG_WARN("Failed to send [ %u ] of [ %u ] messages to target [ %u ], client is [ %s ]"
+                        , count - sent
+                        , count
+                        , static_cast<unsigned int>(target)
                         , client.isAlive() ? "ALIVE" : "DEAD");
 
-            mRemoteService.failedSendMessage(msgSend, client);
-        }
-        else
-        {
-            if (mSaveDataSend)
+            // the messages at the beginning of the group are already sent.
+            for ( uint32_t i = sent; i < count; ++ i )
             {
-                mBytesSend += static_cast<uint32_t>(sentBytes);
+                mRemoteService.failedSendMessage(mSendGroup[i], client);
             }
-
-            LOG_DBG("Succeeded to send message [ %u ] to target [ %p ]", msgSend.getMessageId(), static_cast<id_type>(msgSend.getTarget()));
         }
+        else if (mSaveDataSend)
+        {
+            mBytesSend += static_cast<uint32_t>(sentBytes);
+        }
+
+        first = last;
     }
-    else if (data.isExitThreadMessage() )
-    {
-        LOG_DBG("Going to quite send message thread");
-        mConnection.closeAllConnections( );
-        mConnection.closeSocket( );
-        triggerExit( );
-    }
+
+    mSendBatch.clear( );
+    mSendGroup.clear( );
 }
 
 bool ServerSendThread::postEvent(Event & eventElem)
@@ -23,6 +23,7 @@
 #include "areg/ipc/SendMessageEvent.hpp"
 
 #include <atomic>
+#include <vector>
 
 /************************************************************************
  * Dependencies
@@ -34,7 +35,12 @@ class ServerConnection;
 // ServerSendThread class declaration.
 //////////////////////////////////////////////////////////////////////////
 /**
- * \brief   The IPC message sender thread
+ * \brief   The IPC message sender thread. The thread collects the queued messages
+ *          in the batch and sends the messages of each target client by one system
+ *          call when the queue is empty, the batch is full or the messages in the
+ *          batch wait longer than the linger time.
+ *          The server may have several sender threads (workers), where the messages
+ *          of each target client are sent by the same worker.
  **/
 class ServerSendThread  : public    DispatcherThread
                         , public    IESendMessageEventConsumer
@@ -47,8 +53,10 @@ public:
      * \brief   Initializes connection servicing handler and server connection objects.
      * \param   remoteService   The instance of remote servicing handle to set.
      * \param   connection      The instance of server socket connection object.
+     * \param   worker          The index of the sender thread. The first sender thread
+     *                          closes the connections when stops sending messages.
      **/
-    ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection );
+    ServerSendThread(IERemoteMessageHandler& remoteService, ServerConnection & connection, uint32_t worker = 0 );
 
     /**
      * \brief   Destructor
@@ -77,6 +85,16 @@ public:
      **/
     inline bool isCalculateDataEnabled(void) const;
 
+    /**
+     * \brief   Sets the parameters of the batch of messages sent by one system call.
+     *          Should be called before the thread is started.
+     * \param   maxMessages The maximum number of messages in the batch. Must be not zero.
+     * \param   maxLinger   The maximum time in milliseconds to wait for more messages
+     *                      when the queue is empty. If zero, the batch is sent as soon
+     *                      as there are no more queued messages.
+     **/
+    inline void setSendBatch( uint32_t maxMessages, uint32_t maxLinger );
+
 protected:
 /************************************************************************/
 // DispatcherThread overrides
@@ -117,6 +135,23 @@ private:
      **/
     virtual void processEvent( const SendMessageEventData & data ) override;
 
+//////////////////////////////////////////////////////////////////////////
+// Hidden methods.
+//////////////////////////////////////////////////////////////////////////
+private:
+    /**
+     * \brief   Returns true if more messages can be added in the batch before sending.
+     *          If the queue is empty and the linger time is not elapsed, waits for
+     *          the next message until the linger time elapses.
+     **/
+    bool _waitNextMessage( void );
+
+    /**
+     * \brief   Sends the collected batch of messages to the target clients and empties the batch.
+     *          The messages of the same client are sent in the order they were queued.
+     **/
+    void _sendBatch( void );
+
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -129,6 +164,10 @@ private:
      * \brief   The instance of server connection object
      **/
     ServerConnection &          mConnection;
+    /**
+     * \brief   The index of the sender thread.
+     **/
+    const uint32_t              mWorker;
     /**
      * \brief   Accumulative value of sent data size.
      **/
@@ -137,6 +176,26 @@ private:
      * \brief   Flag, indicating whether should calculate send data size or not. By default it does not compute.
      **/
     bool                        mSaveDataSend;
+    /**
+     * \brief   The batch of messages to send and the cookies of target connections.
+     **/
+    std::vector<std::pair<ITEM_ID, RemoteMessage>>  mSendBatch;
+    /**
+     * \brief   The messages of the batch to send to one target connection.
+     **/
+    std::vector<RemoteMessage>  mSendGroup;
+    /**
+     * \brief   The maximum number of messages in the batch.
+     **/
+    uint32_t                    mBatchSize;
+    /**
+     * \brief   The maximum time in milliseconds to wait for more messages in the batch.
+     **/
+    uint32_t                    mBatchLinger;
+    /**
+     * \brief   The tick count in milliseconds when the first message of the batch was queued.
+     **/
+    TIME64                      mBatchStarted;
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls
@@ -169,4 +228,13 @@ inline bool ServerSendThread::isCalculateDataEnabled(void) const
     return mSaveDataSend;
 }
 
+inline void ServerSendThread::setSendBatch( uint32_t maxMessages, uint32_t maxLinger )
+{
+    ASSERT( maxMessages != 0 );
+    mBatchSize  = maxMessages;
+    mBatchLinger= maxLinger;
+    mSendBatch.reserve( mBatchSize );
+    mSendGroup.reserve( mBatchSize );
+}
+
 #endif  // AREG_AREGEXTEND_SERVICE_PRIVATE_SERVERSENDTHREAD_HPP
@@ -14,7 +14,9 @@
  ************************************************************************/
 #include "aregextend/service/ServiceCommunicatonBase.hpp"
 
+#include "areg/appbase/NEApplication.hpp"
 #include "areg/base/DateTime.hpp"
+#include "areg/component/RemoteEventFactory.hpp"
 #include "areg/ipc/NERemoteService.hpp"
 #include "areg/ipc/ConnectionConfiguration.hpp"
 #include "areg/ipc/private/NEConnection.hpp"
@@ -61,9 +63,11 @@ ServiceCommunicatonBase::ServiceCommunicatonBase( const ITEM_ID & serviceId
     , mConnectTypes     ( connectTypes )
     , mServerConnection ( serviceId )
     , mTimerConnect     ( static_cast<IETimerConsumer &>(mTimerConsumer), NEConnection::SERVER_CONNECT_TIMER_NAME.data( ) )
-    , mThreadSend       ( static_cast<IERemoteMessageHandler&>(self()), mServerConnection )
-    , mThreadReceive    ( static_cast<IEServiceConnectionHandler&>(self()), static_cast<IERemoteMessageHandler&>(self()), mServerConnection )
-    , mDataRateHelper   ( mThreadSend, mThreadReceive, NESystemService::DEFAULT_VERBOSE )
+    , mThreadsSend      ( )
+    , mThreadsReceive   ( )
+    , mDataRateHelper   ( mThreadsSend, mThreadsReceive, NESystemService::DEFAULT_VERBOSE )
+    , mBatchSize        ( NEApplication::DEFAULT_SERVICE_BATCH )
+    , mBatchLinger      ( NEApplication::DEFAULT_SERVICE_LINGER )
     , mWhiteList        ( )
     , mBlackList        ( )
     , mEventConsumer    ( self() )
@@ -72,6 +76,7 @@ ServiceCommunicatonBase::ServiceCommunicatonBase( const ITEM_ID & serviceId
     , mEventSendStop    ( false, false )
     , mLock             ( )
 {
+    setServiceWorkers( NEApplication::DEFAULT_SERVICE_WORKERS );
 }
 
 void ServiceCommunicatonBase::addInstance(const ITEM_ID & cookie, const NEService::sServiceConnectedInstance & instance)
@@ -84,6 +89,8 @@ void ServiceCommunicatonBase::removeInstance(const ITEM_ID & cookie)
 {
     Lock lock(mLock);
     mInstanceMap.removeAt(cookie);
+    mServerConnection.setCalculateChecksum(cookie, true);
+    mServerConnection.setMulticastSupported(cookie, false);
 }
 
 void ServiceCommunicatonBase::removeAllInstances(void)
@@ -105,6 +112,9 @@ bool ServiceCommunicatonBase::setupServiceConnectionData(NERemoteService::eRemot
                 String address{ config.getConnectionAddress() };
                 unsigned short port{ config.getConnectionPort() };
                 result = mServerConnection.setAddress(address, port);
+                setServiceWorkers(config.getServiceWorkers());
+                setSendBatch(config.getServiceBatch(), config.getServiceLinger());
+                mServerConnection.setVerifyChecksum(config.getServiceChecksum());
             }
         }
     }
@@ -112,6 +122,64 @@ bool ServiceCommunicatonBase::setupServiceConnectionData(NERemoteService::eRemot
     return result;
 }
 
+bool ServiceCommunicatonBase::setServiceWorkers(uint32_t count)
+{
+    count = MACRO_MIN(MACRO_MAX(count, 1u), ServerConnectionBase::MAX_CONNECTION_SHARDS);
+    if (count == static_cast<uint32_t>(mThreadsSend.size()))
+        return true;
+
+    if (mServerConnection.isValid())
+        return false;
+
+    for (const auto& threadSend : mThreadsSend)
+    {
+        if (threadSend->isRunning())
+            return false;
+    }
+
+    for (const auto& threadReceive : mThreadsReceive)
+    {
+        if (threadReceive->isRunning())
+            return false;
+    }
+
+    if (mServerConnection.setShardCount(count) == false)
+        return false;
+
+    const bool verbose{ mDataRateHelper.isVerbose() };
+    mThreadsSend.clear();
+    mThreadsReceive.clear();
+    mThreadsSend.reserve(count);
+    mThreadsReceive.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        mThreadsSend.emplace_back(DEBUG_NEW ServerSendThread(static_cast<IERemoteMessageHandler&>(self()), mServerConnection, i));
+        mThreadsSend.back()->setSendBatch(mBatchSize, mBatchLinger);
+        mThreadsReceive.emplace_back(DEBUG_NEW ServerReceiveThread(static_cast<IEServiceConnectionHandler&>(self()), static_cast<IERemoteMessageHandler&>(self()), mServerConnection, i));
+    }
+
+    mDataRateHelper.setVerbose(verbose);
+    return true;
+}
+
+bool ServiceCommunicatonBase::setSendBatch(uint32_t maxMessages, uint32_t maxLinger)
+{
+    for (const auto& threadSend : mThreadsSend)
+    {
+        if (threadSend->isRunning())
+            return false;
+    }
+
+    mBatchSize = MACRO_MAX(maxMessages, 1u);
+    mBatchLinger = maxLinger;
+    for (const auto& threadSend : mThreadsSend)
+    {
+        threadSend->setSendBatch(mBatchSize, mBatchLinger);
+    }
+
+    return true;
+}
+
 void ServiceCommunicatonBase::applyServiceConnectionData(const String & hostName, unsigned short portNr)
 {
     mServerConnection.setAddress( hostName, portNr );
@@ -293,8 +361,8 @@ bool ServiceCommunicatonBase::startConnection(void)
 
     ASSERT(mServerConnection.getAddress().isValid());
     ASSERT(mServerConnection.isValid() == false);
-    ASSERT(mThreadReceive.isRunning() == false);
-    ASSERT(mThreadSend.isRunning() == false);
+    ASSERT(mThreadsReceive.front()->isRunning() == false);
+    ASSERT(mThreadsSend.front()->isRunning() == false);
 
     bool result = false;
     mTimerConnect.stopTimer();
@@ -343,29 +411,60 @@ void ServiceCommunicatonBase::stopConnection(void)
     LOG_SCOPE(areg_aregextend_service_ServiceCommunicatonBase_stopConnection);
     LOG_WARN("Stopping remote servicing connection");
 
-    mThreadReceive.triggerExit();
+    for (const auto& threadReceive : mThreadsReceive)
+    {
+        threadReceive->triggerExit();
+    }
 
     disconnectServices( );
-    disconnectService( Event::eEventPriority::EventPriorityNormal );
 
-    // Wait without triggering exit.
-    mThreadSend.completionWait( NECommon::WAIT_INFINITE );
+    // The first send thread closes the connections, stop other send threads before.
+    for (uint32_t i = static_cast<uint32_t>(mThreadsSend.size()); i > 0; --i)
+    {
+        ServerSendThread& threadSend = *mThreadsSend[i - 1];
+        SendMessageEvent::sendEvent( SendMessageEventData( )
+                                     , static_cast<IESendMessageEventConsumer &>(threadSend)
+                                     , static_cast<DispatcherThread &>(threadSend)
+                                     , Event::eEventPriority::EventPriorityNormal );
+        // Wait without triggering exit.
+        threadSend.completionWait( NECommon::WAIT_INFINITE );
+    }
+
     mServerConnection.closeSocket( );
     // Trigger exit and clean resources.
-    mThreadSend.shutdownThread( NECommon::WAIT_INFINITE );
-    mThreadReceive.shutdownThread( NECommon::WAIT_INFINITE );
+    for (const auto& threadSend : mThreadsSend)
+    {
+        threadSend->shutdownThread( NECommon::WAIT_INFINITE );
+    }
+
+    for (const auto& threadReceive : mThreadsReceive)
+    {
+        threadReceive->shutdownThread( NECommon::WAIT_INFINITE );
+    }
 }
 
 bool ServiceCommunicatonBase::startSendThread( void )
 {
-    return mThreadSend.createThread( NECommon::WAIT_INFINITE ) && 
-           mThreadSend.waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    bool result{ true };
+    for (const auto& threadSend : mThreadsSend)
+    {
+        result = result && threadSend->createThread( NECommon::WAIT_INFINITE ) &&
+                           threadSend->waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    }
+
+    return result;
 }
 
 bool ServiceCommunicatonBase::startReceiveThread( void )
 {
-    return mThreadReceive.createThread( NECommon::WAIT_INFINITE ) &&
-           mThreadReceive.waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    bool result{ true };
+    for (const auto& threadReceive : mThreadsReceive)
+    {
+        result = result && threadReceive->createThread( NECommon::WAIT_INFINITE ) &&
+                           threadReceive->waitForDispatcherStart( NECommon::WAIT_INFINITE );
+    }
+
+    return result;
 }
 
 #ifdef DEBUG
@@ -437,6 +536,36 @@ void ServiceCommunicatonBase::processReceivedMessage(const RemoteMessage & msgRe
                 sendMessage(msgReceived);
             }
         }
+        else if ( (source >= NEService::COOKIE_REMOTE_SERVICE) && (msgId == NEService::eFuncIdRange::ServiceMulticastMessage) )
+        {
+            // Send the same message once to each connection of the targets.
+            TEArrayList<ITEM_ID> targets;
+            RemoteEventFactory::getMulticastTargets(msgReceived, targets);
+            LOG_DBG("Forwarding multicast message to [ %u ] targets", targets.getSize());
+            msgReceived.bufferCompletionFix();
+            for (uint32_t i = 0; i < targets.getSize(); ++i)
+            {
+                if (targets[i] == NEService::TARGET_UNKNOWN)
+                {
+                    continue;
+                }
+                else if (mServerConnection.isMulticastSupported(targets[i]))
+                {
+                    sendMessage(msgReceived, targets[i]);
+                }
+                else
+                {
+                    // The target does not process multicast messages, send one message per target proxy.
+                    TEArrayList<RemoteMessage> messages;
+                    RemoteEventFactory::createStreamsFromMulticastStream(msgReceived, targets[i], messages);
+                    LOG_DBG("Target [ %u ] does not process multicast messages, sending [ %u ] messages", static_cast<uint32_t>(targets[i]), messages.getSize());
+                    for (uint32_t j = 0; j < messages.getSize(); ++j)
+                    {
+                        sendMessage(messages[j]);
+                    }
+                }
+            }
+        }
         else if ( (source == cookie) && (msgId != NEService::eFuncIdRange::SystemServiceConnect) )
         {
             LOG_DBG("Going to process received message [ 0x%X ]", static_cast<uint32_t>(msgId));
@@ -454,6 +583,22 @@ void ServiceCommunicatonBase::processReceivedMessage(const RemoteMessage & msgRe
             instance.ciTimestamp = static_cast<TIME64>(DateTime::getNow());
             instance.ciCookie = cookie;
             addInstance(cookie, instance);
+
+            // The client verifies the checksum of received messages, unless it explicitly notifies otherwise.
+            // The client processes the multicast messages only if it explicitly notifies it.
+            bool verifyChecksum{ true };
+            bool multicast{ false };
+            if (msgReceived.isEndOfBuffer() == false)
+            {
+                msgReceived >> verifyChecksum;
+                if (msgReceived.isEndOfBuffer() == false)
+                {
+                    msgReceived >> multicast;
+                }
+            }
+
+            mServerConnection.setCalculateChecksum(cookie, verifyChecksum);
+            mServerConnection.setMulticastSupported(cookie, multicast);
             RemoteMessage msgConnect(createServiceConnectMessage(mServerConnection.getChannelId(), cookie, NEService::eMessageSource::MessageSourceService));
             LOG_DBG("Received request connect message, sending response [ %s ] of id [ 0x%X ], to new target [ %u ], connection socket [ %u ], checksum [ %u ]"
                         , NEService::getString( static_cast<NEService::eFuncIdRange>(msgConnect.getMessageId()))
@@ -502,6 +647,8 @@ RemoteMessage ServiceCommunicatonBase::createServiceConnectMessage(const ITEM_ID
     RemoteMessage result{ NERemoteService::createConnectNotify(source, target) };
     result.moveToEnd();
     result << msgSource;
+    result << mServerConnection.isVerifyChecksum();
+    result << true; // forwards multicast messages
     return result;
 }
 
@@ -166,6 +166,48 @@ struct sLogMessage
     char            msgModule[LENGTH_NAME];
 };
 
+/**
+ * \brief   The filter of the searched log messages.
+ **/
+struct sLogSearchFilter
+{
+    /* The cookie ID of the instance to search log messages. If ID_IGNORE (or 0), searches log messages of all instances. */
+    ITEM_ID         lsfInstance;
+    /* The timestamp of the first log message to search. If 0, the time is not limited. */
+    TIME64          lsfTimeBegin;
+    /* The timestamp of the last log message to search. If 0, the time is not limited. */
+    TIME64          lsfTimeEnd;
+    /* The bitwise combination of eLogPriority values of the searched log messages. If PrioInvalid (or 0), searches messages of any priority. */
+    uint32_t        lsfPriorities;
+    /* The number of scope IDs in the lsfScopes list. If 0, searches log messages of all scopes. */
+    uint32_t        lsfScopeCount;
+    /* The list of IDs of the scopes to search log messages. Same as indicated in sLogScope::lsId. */
+    const uint32_t* lsfScopes;
+};
+
+/**
+ * \brief   The filter of log messages, which the log collector forwards to the observer.
+ *          The log message is forwarded if it matches all criteria of the filter.
+ *          The criteria, which are not set, match any log message.
+ **/
+struct sLogObserverFilter
+{
+    /* The number of cookie IDs in the lofInstances list. If 0, forwards log messages of all instances. */
+    uint32_t        lofInstanceCount;
+    /* The list of cookie IDs of the instances to forward log messages. Same as indicated in sLogInstance::liCookie. */
+    const ITEM_ID*  lofInstances;
+    /* The number of scope IDs in the lofScopes list. If 0 and lofScopePrefix is not set, forwards log messages of all scopes. */
+    uint32_t        lofScopeCount;
+    /* The list of IDs of the scopes to forward log messages. Same as indicated in sLogScope::lsId. */
+    const uint32_t* lofScopes;
+    /* The null-terminated prefix of the names of scopes to forward log messages. For example 'areg_base_'. Ignored if null or empty. */
+    const char*     lofScopePrefix;
+    /* The bitwise combination of eLogPriority values of the log messages to forward. If PrioInvalid (or 0), forwards messages of any priority. */
+    uint32_t        lofPriorities;
+    /* The null-terminated text, which the forwarded log messages should contain. Ignored if null or empty. */
+    const char*     lofText;
+};
+
 /**
  * \brief   The states of the log observer.
  **/
@@ -464,6 +506,16 @@ LOGGER_API bool logObserverRequestChangeScopePrio(ITEM_ID target, const sLogScop
  **/
 LOGGER_API bool logObserverRequestSaveConfig(ITEM_ID target);
 
+/**
+ * \brief   Call to set the filter of log messages, which the log collector forwards to the observer.
+ *          The log collector filters the messages before sending, so that the observer receives only
+ *          the messages it is interested in. The filter replaces the previous filter and is set again
+ *          each time the observer connects to the log collector.
+ * \param   filter  The filter of log messages to forward. If null, the log collector forwards all log messages.
+ * \return  Returns true if processed with success. Otherwise, returns false.
+ **/
+LOGGER_API bool logObserverRequestFilter(const struct sLogObserverFilter* filter);
+
 /**
  * \brief   Call to get active database full path.
  * \param   dbPath  The buffer to write the full path of the active database.
@@ -525,6 +577,21 @@ LOGGER_API int logObserverGetConfigDatabaseName(char* dbName, int space);
  **/
 LOGGER_API bool logObserverSetConfigDatabaseName(const char* dbName);
 
+/**
+ * \brief   Call to search the log messages in the active log database, which contain the text and match the filter.
+ *          If the full-text search index of the log database is enabled in the configuration, the text is searched
+ *          as a phrase of words and the found messages are ranked by relevance. Otherwise, the text is searched as
+ *          a part of the message and the found messages are ordered by the time of creation.
+ * \param   text        The null-terminated text to search in the log messages.
+ * \param   filter      The filter of the log messages to search. If null, searches all log messages.
+ * \param   startAt     The position of the first found log message to copy. Used to get found log messages by pages.
+ * \param   messages    The buffer to copy the found log messages.
+ * \param   count       The maximum number of log messages to copy in the `messages` buffer.
+ * \return  Returns the number of log messages copied in the `messages` buffer. If less than `count`, there are no more found messages.
+ *          Returns -1 if the log observer is not initialized or the parameters are invalid.
+ **/
+LOGGER_API int logObserverSearchLogs(const char* text, const struct sLogSearchFilter* filter, uint32_t startAt, struct sLogMessage* messages, uint32_t count);
+
 /**
  * \brief   Call to change the IP-address and TCP port of the log collector service. If required changes are written in configuration file.
  * \param   address     The IP-address of the log collector service to set in configuration. If empty or null, it is not modified and ignored.
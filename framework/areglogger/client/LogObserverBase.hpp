@@ -25,6 +25,7 @@
 #include "areg/base/NESocket.hpp"
 #include "areg/component/NEService.hpp"
 #include "areg/logging/NELogging.hpp"
+#include "aregextend/db/LogSqliteDatabase.hpp"
 
 #include <map>
 #include <string>
@@ -334,6 +335,20 @@ public:
      **/
     void getLogMessages(std::vector<SharedBuffer>& messages, ITEM_ID instId, uint32_t scopeId);
 
+    /**
+     * \brief   Call to search the log messages in the log database, which contain the text and match the filter.
+     *          If the full-text search index is enabled, the text is searched as a phrase of words and
+     *          the found messages are ranked by relevance. Otherwise, the text is searched as a part
+     *          of the message and the found messages are ordered by the time of creation.
+     * \param   messages    On output, contains the page of found log messages.
+     * \param   text        The text to search in log messages.
+     * \param   filter      The filter of the log messages to search.
+     * \param   startAt     The position of the first found log message of the page.
+     * \param   maxEntries  The maximum number of log messages in the page.
+     * \return  Returns the number of log messages in the page.
+     **/
+    uint32_t searchLogMessages(std::vector<SharedBuffer>& messages, const String& text, const LogSqliteDatabase::sLogFilter& filter, uint32_t startAt, uint32_t maxEntries);
+
 //////////////////////////////////////////////////////////////////////////
 // Actions
 //////////////////////////////////////////////////////////////////////////
@@ -377,6 +392,14 @@ public:
      **/
     bool requestSaveConfig(ITEM_ID target = NEService::TARGET_ALL);
 
+    /**
+     * \brief   Call to set the filter of log messages, which the log collector forwards to the observer.
+     *          The filter replaces the previous filter and is set again each time the observer connects.
+     * \param   filter  The filter of log messages to forward. If null, the log collector forwards all log messages.
+     * \return  Returns true if processed with success. Otherwise, returns false.
+     **/
+    bool requestFilter(const sLogObserverFilter* filter);
+
     /**
      * \brief   Saves the configuration of the log observer in the configuration file.
      **/
@@ -392,6 +392,37 @@ LOGGER_API_IMPL bool logObserverRequestSaveConfig(ITEM_ID target /* = ID_IGNORED
     return result;
 }
 
+LOGGER_API_IMPL bool logObserverRequestFilter(const struct sLogObserverFilter* filter)
+{
+    sLogObserverStruct& theObserver { logObserverData() };
+    bool result{ false };
+    Lock lock(theObserver.losLock);
+    if (_isInitialized(theObserver.losState))
+    {
+        NELogging::sObserverFilter logFilter;
+        if (filter != nullptr)
+        {
+            for (uint32_t i = 0; (filter->lofInstances != nullptr) && (i < filter->lofInstanceCount); ++i)
+            {
+                logFilter.ofInstances.add(filter->lofInstances[i]);
+            }
+
+            for (uint32_t i = 0; (filter->lofScopes != nullptr) && (i < filter->lofScopeCount); ++i)
+            {
+                logFilter.ofScopes.add(filter->lofScopes[i]);
+            }
+
+            logFilter.ofScopePrefix = filter->lofScopePrefix;
+            logFilter.ofPriorities  = filter->lofPriorities;
+            logFilter.ofText        = filter->lofText;
+        }
+
+        result = LoggerClient::getInstance().requestFilter(logFilter);
+    }
+
+    return result;
+}
+
 LOGGER_API_IMPL int logObserverGetActiveDatabasePath(char* dbPath, int space)
 {
     String path{ LoggerClient::getInstance().getActiveDatabasePath() };
@@ -467,6 +498,53 @@ LOGGER_API_IMPL bool logObserverSetConfigDatabaseName(const char* dbName)
     return LoggerClient::getInstance().setConfigDatabaseName(dbName);
 }
 
+LOGGER_API_IMPL int logObserverSearchLogs(const char* text, const sLogSearchFilter* filter, uint32_t startAt, sLogMessage* messages, uint32_t count)
+{
+    sLogObserverStruct& theObserver{ logObserverData() };
+    Lock lock(theObserver.losLock);
+    if ((_isInitialized(theObserver.losState) == false) || (text == nullptr) || ((messages == nullptr) && (count != 0)))
+        return -1;
+
+    LogSqliteDatabase::sLogFilter search;
+    if (filter != nullptr)
+    {
+        search.filterInstance   = filter->lsfInstance != ID_IGNORE ? static_cast<ITEM_ID>(filter->lsfInstance) : NEService::COOKIE_ANY;
+        search.filterTimeBegin  = static_cast<TIME64>(filter->lsfTimeBegin);
+        search.filterTimeEnd    = static_cast<TIME64>(filter->lsfTimeEnd);
+        search.filterPrio       = filter->lsfPriorities != static_cast<uint32_t>(eLogPriority::PrioInvalid) ? filter->lsfPriorities : search.filterPrio;
+        if (filter->lsfScopes != nullptr)
+        {
+            search.filterScopes.assign(filter->lsfScopes, filter->lsfScopes + filter->lsfScopeCount);
+        }
+    }
+
+    std::vector<SharedBuffer> found;
+    LoggerClient::getInstance().searchLogMessages(found, text, search, startAt, count);
+    for (uint32_t i = 0; i < static_cast<uint32_t>(found.size()); ++ i)
+    {
+        const NELogging::sLogMessage* msgFound{ reinterpret_cast<const NELogging::sLogMessage*>(found[i].getBuffer()) };
+        sLogMessage& msgLog{ messages[i] };
+
+        msgLog.msgType      = static_cast<eLogType>(msgFound->logMsgType);
+        msgLog.msgPriority  = static_cast<eLogPriority>(msgFound->logMessagePrio);
+        msgLog.msgSource    = static_cast<unsigned long long>(msgFound->logSource);
+        msgLog.msgCookie    = static_cast<unsigned long long>(msgFound->logCookie);
+        msgLog.msgModuleId  = static_cast<unsigned long long>(msgFound->logModuleId);
+        msgLog.msgThreadId  = static_cast<unsigned long long>(msgFound->logThreadId);
+        msgLog.msgTimestamp = static_cast<unsigned long long>(msgFound->logTimestamp);
+        msgLog.msgReceived  = static_cast<unsigned long long>(msgFound->logReceived);
+        msgLog.msgDuration  = static_cast<unsigned int>(msgFound->logDuration);
+        msgLog.msgScopeId   = static_cast<unsigned int>(msgFound->logScopeId);
+        msgLog.msgSessionId = static_cast<unsigned int>(msgFound->logSessionId);
+
+        NEMemory::memCopy(msgLog.msgLogText, LENGTH_MESSAGE , msgFound->logMessage , msgFound->logMessageLen + 1);
+        NEMemory::memCopy(msgLog.msgThread,  LENGTH_NAME    , msgFound->logThread  , msgFound->logThreadLen  + 1);
+        NEMemory::memCopy(msgLog.msgModule,  LENGTH_NAME    , msgFound->logModule  , msgFound->logModuleLen  + 1);
+    }
+
+    return static_cast<int>(found.size());
+}
+
 LOGGER_API_IMPL bool logObserverConfigUpdate(const char* address, uint16_t port, const char* dbFilePath, bool makeSave)
 {
     LoggerClient& logger = LoggerClient::getInstance();
@@ -204,6 +204,11 @@ bool LogObserverBase::requestSaveConfig(ITEM_ID target /*= NEService::TARGET_ALL
     return logObserverRequestSaveConfig(target);
 }
 
+bool LogObserverBase::requestFilter(const sLogObserverFilter* filter)
+{
+    return logObserverRequestFilter(filter);
+}
+
 void LogObserverBase::saveLoggerConfig(void)
 {
     LoggerClient::getInstance().saveConfiguration();
@@ -263,3 +268,8 @@ void LogObserverBase::getLogMessages(std::vector<SharedBuffer>& messages, ITEM_I
 {
     LoggerClient::getInstance().getLogMessages(messages, instId, scopeId);
 }
+
+uint32_t LogObserverBase::searchLogMessages(std::vector<SharedBuffer>& messages, const String& text, const LogSqliteDatabase::sLogFilter& filter, uint32_t startAt, uint32_t maxEntries)
+{
+    return LoggerClient::getInstance().searchLogMessages(messages, text, filter, startAt, maxEntries);
+}
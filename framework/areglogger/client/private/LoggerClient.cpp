@@ -50,6 +50,7 @@ LoggerClient::LoggerClient(void)
     , mIsPaused                  ( false )
     , mInstances                 ( )
     , mLogDatabase               ( )
+    , mFilter                    ( )
 {
 }
 
@@ -223,14 +224,30 @@ bool LoggerClient::requestSaveConfiguration(const ITEM_ID& target /*= NEService:
     return result;
 }
 
+bool LoggerClient::requestFilter(const NELogging::sObserverFilter & filter)
+{
+    bool result{ true };
+    Lock lock(mLock);
+    mFilter = filter;
+    if (mChannel.getCookie() != NEService::COOKIE_UNKNOWN)
+    {
+        result = sendMessage(NELogging::messageObserverFilter(mChannel.getCookie(), mFilter));
+    }
+
+    return result;
+}
+
 bool LoggerClient::openLoggingDatabase(const char* dbPath /*= nullptr*/)
 {
     String filePath (dbPath);
+    LogConfiguration config;
+    mLogDatabase.setGroupCommit(config.getDatabaseBatch(), config.getDatabaseFlush());
+    mLogDatabase.setJournalMode(config.getDatabaseJournal(), config.getDatabaseSync());
+    mLogDatabase.setSearchEnabled(config.getDatabaseSearch());
     if (filePath.isEmpty())
     {
         if (isSqliteEngine())
         {
-            LogConfiguration config;
             mLogDatabase.setDatabaseLoggingEnabled(true);
             filePath = File::makeFileFullPath(config.getDatabaseLocation(), config.getDatabaseName());
         }
@@ -509,6 +526,7 @@ void LoggerClient::connectedRemoteServiceChannel(const Channel& channel)
     String address;
     uint16_t port{ NESocket::InvalidPort };
     bool isStarted{ false };
+    NELogging::sObserverFilter filter;
 
     do
     {
@@ -517,6 +535,7 @@ void LoggerClient::connectedRemoteServiceChannel(const Channel& channel)
         address = addr.getHostAddress();
         port = addr.getHostPort();
         isStarted = mIsPaused ? false : isConnectionStarted();
+        filter = mFilter;
 
         if (mCallbacks != nullptr)
         {
@@ -525,6 +544,12 @@ void LoggerClient::connectedRemoteServiceChannel(const Channel& channel)
         }
     } while (false);
 
+    if (filter.isEmpty() == false)
+    {
+        // The filter is set before the log messages are requested.
+        sendMessage(NELogging::messageObserverFilter(channel.getCookie(), filter));
+    }
+
     sendMessage(NELogging::messageQueryInstances(channel.getCookie(), LoggerClient::TargetID));
 
     if (LogObserverBase::_theLogObserver != nullptr)
@@ -670,6 +695,13 @@ void LoggerClient::processReceivedMessage(const RemoteMessage& msgReceived, Sock
             }
             break;
 
+        case NEService::eFuncIdRange::ServiceLogMessageBatch:
+            if (mIsPaused == false)
+            {
+                mMessageProcessor.notifyLogMessageBatch(msgReceived);
+            }
+            break;
+
         case NEService::eFuncIdRange::SystemServiceNotifyRegister:      // fall through
         case NEService::eFuncIdRange::ServiceLastId:                    // fall through
         case NEService::eFuncIdRange::SystemServiceQueryInstances:      // fall through
@@ -693,6 +725,7 @@ void LoggerClient::processReceivedMessage(const RemoteMessage& msgReceived, Sock
         case NEService::eFuncIdRange::ServiceLogUpdateScopes:           // fall through
         case NEService::eFuncIdRange::ServiceLogQueryScopes:            // fall through
         case NEService::eFuncIdRange::ServiceSaveLogConfiguration:      // fall through
+        case NEService::eFuncIdRange::ServiceLogObserverFilter:         // fall through
         default:
             ASSERT(false);
         }
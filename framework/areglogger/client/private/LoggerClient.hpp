@@ -212,6 +212,16 @@ public:
      **/
     bool requestSaveConfiguration(const ITEM_ID & target = NEService::TARGET_ALL);
 
+    /**
+     * \brief   Sets the filter of log messages, which the log collector forwards to the observer.
+     *          The filter is saved and sent again each time the observer connects to the log collector.
+     *          The empty filter forwards all log messages.
+     * \param   filter  The filter of log messages to set.
+     * \return  Returns true if the filter is saved. If the observer is connected, returns true
+     *          if the message to set the filter is sent with success.
+     **/
+    bool requestFilter(const NELogging::sObserverFilter & filter);
+
     /**
      * \brief   Creates of opens the database for the logging. If specified path is null or empty,
      *          if uses the location specified in the configuration file.
@@ -368,6 +378,17 @@ public:
      **/
     inline void getLogMessages(std::vector<SharedBuffer>& messages, ITEM_ID instId, uint32_t scopeId);
 
+    /**
+     * \brief   Call to search the log messages in the log database, which contain the text and match the filter.
+     * \param   messages    On output, contains the page of found log messages.
+     * \param   text        The text to search in log messages.
+     * \param   filter      The filter of the log messages to search.
+     * \param   startAt     The position of the first found log message of the page.
+     * \param   maxEntries  The maximum number of log messages in the page.
+     * \return  Returns the number of log messages in the page.
+     **/
+    inline uint32_t searchLogMessages(std::vector<SharedBuffer>& messages, const String& text, const LogSqliteDatabase::sLogFilter& filter, uint32_t startAt, uint32_t maxEntries);
+
 //////////////////////////////////////////////////////////////////////////
 // Overrides
 //////////////////////////////////////////////////////////////////////////
@@ -543,6 +564,11 @@ private:
      **/
     LogSqliteDatabase           mLogDatabase;
 
+    /**
+     * \brief   The filter of log messages, which the log collector forwards to the observer.
+     **/
+    NELogging::sObserverFilter  mFilter;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -609,6 +635,11 @@ inline void LoggerClient::getLogMessages(std::vector<SharedBuffer>& messages, IT
     mLogDatabase.getLogMessages(messages, instId, scopeId);
 }
 
+inline uint32_t LoggerClient::searchLogMessages(std::vector<SharedBuffer>& messages, const String& text, const LogSqliteDatabase::sLogFilter& filter, uint32_t startAt, uint32_t maxEntries)
+{
+    return mLogDatabase.searchLogMessages(messages, text, filter, startAt, maxEntries);
+}
+
 inline LoggerClient& LoggerClient::self(void)
 {
     return (*this);
@@ -33,6 +33,7 @@
 
 ObserverMessageProcessor::ObserverMessageProcessor(LoggerClient& loggerClient)
     : mLoggerClient (loggerClient)
+    , mBatchDecoder ( )
 {
 }
 
@@ -49,6 +50,7 @@ void ObserverMessageProcessor::notifyServiceConnection(const RemoteMessage& msgR
     switch (connection)
     {
     case NEService::eServiceConnection::ServiceConnected:
+        mBatchDecoder.clear();
         log.logMessageLen = String::formatString(log.logMessage, NELogging::LOG_MESSAGE_IZE, "Log observer connected to log collector service.");
         break;
     case NEService::eServiceConnection::ServicePending:
@@ -226,8 +228,6 @@ void ObserverMessageProcessor::notifyLogMessage(const RemoteMessage& msgReceived
             break;
         }
 
-        mLoggerClient.mLogDatabase.commit(true);
-
         if (LogObserverBase::_theLogObserver != nullptr)
         {
             LogObserverBase::_theLogObserver->onLogMessage(msgReceived);
@@ -273,6 +273,18 @@ void ObserverMessageProcessor::notifyLogMessage(const RemoteMessage& msgReceived
     }
 }
 
+void ObserverMessageProcessor::notifyLogMessageBatch(const RemoteMessage& msgReceived)
+{
+    if (mBatchDecoder.startBatch(msgReceived))
+    {
+        NELogging::sLogMessage logMessage{};
+        while (mBatchDecoder.nextMessage(logMessage))
+        {
+            notifyLogMessage(mBatchDecoder.createLogMessage(logMessage));
+        }
+    }
+}
+
 void ObserverMessageProcessor::_clientsConnected(const RemoteMessage& msgReceived)
 {
     TEArrayList< NEService::sServiceConnectedInstance > listConnected;
@@ -403,6 +415,7 @@ void ObserverMessageProcessor::_clientsDisconnected(const RemoteMessage& msgRece
                 {
                     const NEService::sServiceConnectedInstance& instance = mLoggerClient.mInstances.getAt(client);
                     listDisconnected.add(instance);
+                    mBatchDecoder.removeSource(client);
                     if (mLoggerClient.mInstances.removeAt(client))
                     {
                         mLoggerClient.mLogDatabase.logInstanceDisconnected(client, now);
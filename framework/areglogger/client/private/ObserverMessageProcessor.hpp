@@ -20,6 +20,7 @@
   * Include files.
   ************************************************************************/
 #include "areglogger/client/LogObserverSwitches.h"
+#include "areg/logging/LogBatch.hpp"
 
 /************************************************************************
  * Dependencies
@@ -84,6 +85,13 @@ public:
      **/
     void notifyLogMessage(const RemoteMessage& msgReceived);
 
+    /**
+     * \brief   Triggered to notify to log the batch of messages. The messages of the batch
+     *          are decoded and notified one by one as single log messages.
+     * \param   msgReceived     The buffer with the batch of log messages.
+     **/
+    void notifyLogMessageBatch(const RemoteMessage& msgReceived);
+
 private:
 
     //!< Triggered to process client connected message.
@@ -100,6 +108,7 @@ private:
 //////////////////////////////////////////////////////////////////////////
 private:
     LoggerClient &  mLoggerClient;  //!< The object of the observer client.
+    LogBatchDecoder mBatchDecoder;  //!< The decoder of the batches of log messages.
 
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
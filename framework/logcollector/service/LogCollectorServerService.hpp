@@ -22,6 +22,7 @@
 #include "areg/component/IETimerConsumer.hpp"
 
 #include "areg/component/Timer.hpp"
+#include "areg/logging/LogBatch.hpp"
 #include "areg/logging/NELogging.hpp"
 #include "aregextend/service/ServiceCommunicatonBase.hpp"
 #include "logcollector/service/private/LogCollectorMessageProcessor.hpp"
@@ -198,6 +199,8 @@ private:
     NEService::MapInstances         mObservers;
     //!< The timer used when trigger multiple requests to save configuration.
     Timer                           mSaveTimer;
+    //!< The decoder of the batches of log messages to log them locally.
+    LogBatchDecoder                 mBatchDecoder;
 
 //////////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
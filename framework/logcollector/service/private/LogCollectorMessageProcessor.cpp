@@ -17,11 +17,14 @@
 #include "logcollector/app/LogCollector.hpp"
 #include "logcollector/service/LogCollectorServerService.hpp"
 #include "areg/ipc/NERemoteService.hpp"
+#include "areg/logging/LogBatch.hpp"
 
 LogCollectorMessageProcessor::LogCollectorMessageProcessor(LogCollectorServerService & loggerService)
     : mLoggerService    ( loggerService )
     , mListSaveConfig   ( )
     , mPendingSave      ( NEService::COOKIE_UNKNOWN )
+    , mFilters          ( )
+    , mScopeNames       ( )
 {
 }
 
@@ -122,7 +125,7 @@ void LogCollectorMessageProcessor::notifyDisconnectedInstances(const TEArrayList
     }
 }
 
-void LogCollectorMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgReceived) const
+void LogCollectorMessageProcessor::registerScopesAtObserver(const RemoteMessage & msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogRegisterScopes));
     msgReceived.moveToBegin();
@@ -135,6 +138,7 @@ void LogCollectorMessageProcessor::registerScopesAtObserver(const RemoteMessage
     msgStatus.format(fmt, static_cast<uint32_t>(msgReceived.getSource()), scopeCount);
 
     LogCollector::printStatus(msgStatus);
+    _saveScopeNames(msgReceived);
     _forwardMessageToObservers(msgReceived);
 }
 
@@ -181,9 +185,16 @@ void LogCollectorMessageProcessor::saveLogSourceConfiguration(const RemoteMessag
 void LogCollectorMessageProcessor::logSourceScopesUpadated(const RemoteMessage& msgReceived)
 {
     ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogScopesUpdated));
+    _saveScopeNames(msgReceived);
     _forwardMessageToObservers(msgReceived);
 }
 
+void LogCollectorMessageProcessor::removeAllFilters(void)
+{
+    mFilters.clear();
+    mScopeNames.clear();
+}
+
 #ifdef      DEBUG
 void LogCollectorMessageProcessor::logSourceConfigurationSaved(const RemoteMessage& msgReceived)
 {
@@ -216,13 +227,72 @@ void LogCollectorMessageProcessor::clientDisconnected(const ITEM_ID& cookie)
     {
         processNextSaveConfig();
     }
+
+    mFilters.erase(cookie);
 }
 
 void LogCollectorMessageProcessor::logMessage(const RemoteMessage & msgReceived) const
 {
-    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage));
-    ASSERT(NELogging::eLogDataType::LogDataRemote == reinterpret_cast<const NELogging::sLogMessage *>(msgReceived.getBuffer())->logDataType);
-    _forwardMessageToObservers(msgReceived);
+    const NELogging::sLogMessage* logMessage{ reinterpret_cast<const NELogging::sLogMessage*>(msgReceived.getBuffer()) };
+    ASSERT((msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage)) && (NELogging::eLogDataType::LogDataRemote == logMessage->logDataType));
+    if (msgReceived.getSizeUsed() >= static_cast<uint32_t>(sizeof(NELogging::sLogMessage)))
+    {
+        _forwardLogToObservers(msgReceived, logMessage);
+    }
+}
+
+bool LogCollectorMessageProcessor::logMessageBatch(const RemoteMessage& msgReceived) const
+{
+    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessageBatch));
+    return _forwardLogToObservers(msgReceived, nullptr);
+}
+
+void LogCollectorMessageProcessor::logBatchMessage(const NELogging::sLogMessage& logMessage, const LogBatchDecoder& decoder) const
+{
+    RemoteMessage msgLog;
+    const ITEM_ID & source{ logMessage.logCookie };
+    const auto& observers = mLoggerService.getObservers();
+    for (const auto& observer : observers.getData())
+    {
+        auto pos = mFilters.find(observer.first);
+        if ((pos == mFilters.end()) || (pos->second.hasMessageFilter() == false))
+            continue;
+
+        const ObserverFilter& filter{ pos->second };
+        if (filter.isSourceMatch(source) && filter.isMessageMatch(logMessage))
+        {
+            if (msgLog.isValid() == false)
+            {
+                msgLog = decoder.createLogMessage(logMessage);
+                msgLog.bufferCompletionFix();
+            }
+
+            mLoggerService.sendMessage(msgLog, observer.first);
+        }
+    }
+}
+
+void LogCollectorMessageProcessor::setObserverFilter(const RemoteMessage& msgReceived)
+{
+    ASSERT(msgReceived.getMessageId() == static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogObserverFilter));
+
+    const ITEM_ID & source{ msgReceived.getSource() };
+    const NEService::MapInstances& instances = mLoggerService.getInstances();
+    auto srcPos = instances.find(source);
+    if (instances.isValidPosition(srcPos) && isLogObserver(instances.valueAtPosition(srcPos).ciSource))
+    {
+        NELogging::sObserverFilter filter;
+        msgReceived.moveToBegin();
+        msgReceived >> filter;
+        if (filter.isEmpty())
+        {
+            mFilters.erase(source);
+        }
+        else
+        {
+            mFilters[source].setFilter(filter, mScopeNames);
+        }
+    }
 }
 
 bool LogCollectorMessageProcessor::isLogSource(NEService::eMessageSource msgSource)
@@ -307,3 +377,86 @@ inline void LogCollectorMessageProcessor::_forwardMessageToObservers(const Remot
         }
     }
 }
+
+bool LogCollectorMessageProcessor::_forwardLogToObservers(const RemoteMessage& msgReceived, const NELogging::sLogMessage* logMessage) const
+{
+    const auto& observers = mLoggerService.getObservers();
+    if (observers.isEmpty())
+        return false;
+
+    const ITEM_ID & source{ msgReceived.getSource() };
+    const ITEM_ID & target{ msgReceived.getTarget() };
+    const NEService::MapInstances& instances = mLoggerService.getInstances();
+
+    auto srcPos = instances.find(source);
+    if ((instances.isValidPosition(srcPos) == false) || (isLogSource(instances.valueAtPosition(srcPos).ciSource) == false))
+        return false;
+
+    if ((target != NEService::COOKIE_LOGGER) && (target != NEService::TARGET_ALL))
+    {
+        // The message to the certain observer is not filtered.
+        auto dstPos = instances.find(target);
+        if (instances.isValidPosition(dstPos) && isLogObserver(instances.valueAtPosition(dstPos).ciSource))
+        {
+            mLoggerService.sendMessage(msgReceived);
+        }
+
+        return false;
+    }
+
+    bool result{ false };
+    bool isFixed{ false };
+    for (const auto& observer : observers.getData())
+    {
+        ASSERT(isLogObserver(observer.second.ciSource));
+        auto pos = mFilters.find(observer.first);
+        if (pos != mFilters.end())
+        {
+            const ObserverFilter& filter{ pos->second };
+            if (filter.isSourceMatch(source) == false)
+            {
+                continue;
+            }
+            else if (filter.hasMessageFilter() && (logMessage == nullptr))
+            {
+                result = true;
+                continue;
+            }
+            else if (filter.hasMessageFilter() && (filter.isMessageMatch(*logMessage) == false))
+            {
+                continue;
+            }
+        }
+
+        if (isFixed == false)
+        {
+            // The message is not modified, it is shared between all observers.
+            msgReceived.bufferCompletionFix();
+            isFixed = true;
+        }
+
+        mLoggerService.sendMessage(msgReceived, observer.first);
+    }
+
+    return result;
+}
+
+void LogCollectorMessageProcessor::_saveScopeNames(const RemoteMessage& msgReceived)
+{
+    uint32_t scopeCount{ 0 };
+    msgReceived.moveToBegin();
+    msgReceived >> scopeCount;
+    for (uint32_t i = 0; i < scopeCount; ++i)
+    {
+        NELogging::sScopeInfo scope;
+        msgReceived >> scope;
+        for (auto& filter : mFilters)
+        {
+            filter.second.addScope(scope.scopeId, scope.scopeName);
+        }
+
+        mScopeNames[scope.scopeId] = scope.scopeName;
+    }
+
+    msgReceived.moveToBegin();
+}
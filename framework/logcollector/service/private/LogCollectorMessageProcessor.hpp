@@ -23,10 +23,14 @@
 #include "areg/component/NEService.hpp"
 #include "areg/base/TEArrayList.hpp"
 #include "aregextend/service/ServiceCommunicatonBase.hpp"
+#include "logcollector/service/private/ObserverFilter.hpp"
+
+#include <unordered_map>
 
 /************************************************************************
  * Dependencies
  ************************************************************************/
+class LogBatchDecoder;
 class LogCollectorServerService;
 class RemoteMessage;
 
@@ -90,9 +94,10 @@ public:
      * \brief   Called when a connected instance of application requests to register scopes.
      *          The scopes contain names and message priorities to log.
      *          The message is forwarded to the all connected observers to register scopes.
+     *          The names of the scopes are saved to resolve the scope prefixes of observer filters.
      * \param   msgReceived     The message to process.
      **/
-    void registerScopesAtObserver(const RemoteMessage & msgReceived) const;
+    void registerScopesAtObserver(const RemoteMessage & msgReceived);
 
     /**
      * \brief   Called when a connected instance of observer requests to update scopes
@@ -121,11 +126,41 @@ public:
     void saveLogSourceConfiguration(const RemoteMessage & msgReceived);
 
     /**
-     * \brief   Called to forward the log message to the observer application.
+     * \brief   Called to forward the log message to the observer applications. The message is sent
+     *          only to the observers, which filters match the log message. The same message buffer is
+     *          shared between all matching observers.
      * \param   msgReceived     The message to process.
      **/
     void logMessage(const RemoteMessage& msgReceived) const;
 
+    /**
+     * \brief   Called to forward the batch of log messages to the observer applications. The batch is
+     *          forwarded as it is to the observers, which filter log messages only by the log source.
+     *          The observers, which filter log messages by the scope, priority or text, receive the
+     *          messages of the batch one by one, see logBatchMessage().
+     * \param   msgReceived     The message with the batch of log messages to process.
+     * \return  Returns true if there are observers, which should receive the messages of the batch
+     *          one by one. In this case the batch should be decoded and each message should be passed
+     *          to the logBatchMessage() method.
+     **/
+    bool logMessageBatch(const RemoteMessage& msgReceived) const;
+
+    /**
+     * \brief   Called to forward the decoded message of the batch to the observers, which filter the
+     *          log messages by the scope, priority or text. The remote message is created only if
+     *          the log message matches at least one filter, and it is shared between all matching observers.
+     * \param   logMessage      The decoded log message of the batch.
+     * \param   decoder         The decoder of the batch to create the remote message of the log message.
+     **/
+    void logBatchMessage(const NELogging::sLogMessage& logMessage, const LogBatchDecoder& decoder) const;
+
+    /**
+     * \brief   Called when a connected instance of observer sets the filter of log messages to receive.
+     *          The filter replaces the previous filter of the observer. The empty filter is removed.
+     * \param   msgReceived     The message to process.
+     **/
+    void setObserverFilter(const RemoteMessage& msgReceived);
+
     /**
      * \brief   Called when the connected instance of log source updates the scope priorities.
      *          The message contains the list of scope names, ID and log priority.
@@ -135,6 +170,11 @@ public:
      **/
     void logSourceScopesUpadated(const RemoteMessage& msgReceived);
 
+    /**
+     * \brief   Removes the filters of all observers.
+     **/
+    void removeAllFilters(void);
+
     /**
      * \brief   Called when the connected instance of log source saves current configuration.
      *          It notifies the log observer that the configuration is saved, so that the
@@ -149,7 +189,8 @@ public:
     void processNextSaveConfig(void);
 
     /**
-     * \brief   Called when an instance of a log source is disconnected.
+     * \brief   Called when an instance of a log source or observer is disconnected.
+     *          Removes the filter of the disconnected observer.
      * \param   cookie      The ID of disconnected application.
      **/
     void clientDisconnected(const ITEM_ID& cookie);
@@ -190,6 +231,24 @@ private:
      * \param   msgReceived     The remote message received from a client.
      **/
     inline void _forwardMessageToObservers(const RemoteMessage& msgReceived) const;
+
+    /**
+     * \brief   Forwards the log message or the batch of log messages to the observers, which filters match.
+     *          If the target in the remote message is the certain observer, the message is sent without filtering.
+     *          The same message buffer is shared between all matching observers.
+     * \param   msgReceived     The remote message with the log message or the batch of log messages.
+     * \param   logMessage      The log message to check the filters. If nullptr, the message is a batch and
+     *                          the observers, which filter by the scope, priority or text are skipped.
+     * \return  Returns true if skipped the observers, which should receive the messages of the batch one by one.
+     **/
+    bool _forwardLogToObservers(const RemoteMessage& msgReceived, const NELogging::sLogMessage* logMessage) const;
+
+    /**
+     * \brief   Reads the list of scopes of the message and saves the names of scopes.
+     *          The IDs of scopes, which names match the prefix, are added to the observer filters.
+     * \param   msgReceived     The message with the list of scopes.
+     **/
+    void _saveScopeNames(const RemoteMessage& msgReceived);
 //////////////////////////////////////////////////////////////////////////
 // Member variables
 //////////////////////////////////////////////////////////////////////////
@@ -203,6 +262,12 @@ private:
     //!< The ID of an application pending to save the configuration.
     ITEM_ID                     mPendingSave;
 
+    //!< The filters of log messages of the observers.
+    std::unordered_map<ITEM_ID, ObserverFilter> mFilters;
+
+    //!< The names of the scopes registered by the log sources.
+    ObserverFilter::ScopeNames  mScopeNames;
+
 //////////////////////////////////////////////////////////////////////////
 // Forbidden calls.
 //////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@ LogCollectorServerService::LogCollectorServerService( void )
     , mLoggerProcessor          ( self() )
     , mObservers                ( )
     , mSaveTimer                ( static_cast<IETimerConsumer &>(self()), "ConfigSaveTimer", LogCollectorServerService::TIMEOUT_SAVE_CONFIG)
+    , mBatchDecoder             ( )
 {
 }
 
@@ -73,6 +74,7 @@ void LogCollectorServerService::removeInstance(const ITEM_ID & cookie)
     ServiceCommunicatonBase::removeInstance(cookie);
    
     mLoggerProcessor.clientDisconnected(cookie);
+    mBatchDecoder.removeSource(cookie);
     if (exists && LogCollectorMessageProcessor::isLogSource(instance.ciSource))
     {
         NELogging::sLogMessage logMsgBye(NELogging::eLogMessageType::LogMessageText, 0u, 0u, 0u, NELogging::eLogPriority::PrioAny, nullptr, 0);
@@ -115,6 +117,8 @@ void LogCollectorServerService::removeAllInstances(void)
         String::formatString(logMsgClose.logMessage, NELogging::LOG_MESSAGE_IZE, "Disconnecting and removing [ %u ] instances.", mInstanceMap.getSize());
         NELogging::logAnyMessageLocal(logMsgClose);
         ServiceCommunicatonBase::removeAllInstances();
+        mBatchDecoder.clear();
+        mLoggerProcessor.removeAllFilters();
 
         if (listIds.isEmpty() == false)
         {
@@ -164,6 +168,9 @@ void LogCollectorServerService::dispatchAndForwardLoggerMessage(const RemoteMess
     case NEService::eFuncIdRange::ServiceLogScopesUpdated:          // fall through
     case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+    case NEService::eFuncIdRange::ServiceMulticastMessage:          // fall through
+    case NEService::eFuncIdRange::ServiceLogMessageBatch:           // fall through
+    case NEService::eFuncIdRange::ServiceLogObserverFilter:         // fall through
     case NEService::eFuncIdRange::RequestFirstId:                   // fall through
     case NEService::eFuncIdRange::ResponseFirstId:                  // fall through
     case NEService::eFuncIdRange::AttributeFirstId:                 // fall through
@@ -226,6 +233,30 @@ void LogCollectorServerService::onServiceMessageReceived(const RemoteMessage &ms
         NELogging::logMessage(msgReceived);
         break;
 
+    case NEService::eFuncIdRange::ServiceLogMessageBatch:
+        {
+            // The batch is forwarded as it is to observers, which do not filter messages by scope, priority or text.
+            // The batch is decoded to log the messages locally and to forward the matching messages to other observers.
+            const bool filterMessages{ mLoggerProcessor.logMessageBatch(msgReceived) };
+            if (mBatchDecoder.startBatch(msgReceived))
+            {
+                NELogging::sLogMessage logMessage{};
+                while (mBatchDecoder.nextMessage(logMessage))
+                {
+                    NELogging::logAnyMessageLocal(logMessage);
+                    if (filterMessages)
+                    {
+                        mLoggerProcessor.logBatchMessage(logMessage, mBatchDecoder);
+                    }
+                }
+            }
+        }
+        break;
+
+    case NEService::eFuncIdRange::ServiceLogObserverFilter:
+        mLoggerProcessor.setObserverFilter(msgReceived);
+        break;
+
     case NEService::eFuncIdRange::SystemServiceConnect:
     case NEService::eFuncIdRange::SystemServiceDisconnect:
         break;
@@ -0,0 +1,84 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        logcollector/service/private/ObserverFilter.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Log Collector filter of log messages of the observer
+ ************************************************************************/
+#include "logcollector/service/private/ObserverFilter.hpp"
+
+#include <string_view>
+
+ObserverFilter::ObserverFilter(void)
+    : mInstances    ( )
+    , mScopes       ( )
+    , mScopePrefix  ( )
+    , mHasScopes    ( false )
+    , mPriorities   ( static_cast<uint32_t>(NELogging::eLogPriority::PrioInvalid) )
+    , mText         ( )
+{
+}
+
+void ObserverFilter::setFilter(const NELogging::sObserverFilter& filter, const ObserverFilter::ScopeNames& scopeNames)
+{
+    mInstances.clear();
+    mScopes.clear();
+    for (const ITEM_ID& instance : filter.ofInstances.getData())
+    {
+        mInstances.insert(instance);
+    }
+
+    for (uint32_t scopeId : filter.ofScopes.getData())
+    {
+        mScopes.insert(scopeId);
+    }
+
+    mScopePrefix= filter.ofScopePrefix;
+    mHasScopes  = (filter.ofScopes.isEmpty() == false) || (mScopePrefix.isEmpty() == false);
+    mPriorities = filter.ofPriorities;
+    mText       = filter.ofText;
+
+    if (mScopePrefix.isEmpty() == false)
+    {
+        for (const auto& scope : scopeNames)
+        {
+            addScope(scope.first, scope.second);
+        }
+    }
+}
+
+void ObserverFilter::addScope(uint32_t scopeId, const String& scopeName)
+{
+    if ((mScopePrefix.isEmpty() == false) && scopeName.startsWith(mScopePrefix))
+    {
+        mScopes.insert(scopeId);
+    }
+}
+
+bool ObserverFilter::isMessageMatch(const NELogging::sLogMessage& logMessage) const
+{
+    if ((mPriorities != static_cast<uint32_t>(NELogging::eLogPriority::PrioInvalid)) && ((mPriorities & static_cast<uint32_t>(logMessage.logMessagePrio)) == 0))
+    {
+        return false;
+    }
+    else if (mHasScopes && (mScopes.find(logMessage.logScopeId) == mScopes.end()))
+    {
+        return false;
+    }
+    else if (mText.isEmpty() == false)
+    {
+        const std::string_view text(logMessage.logMessage, MACRO_MIN(logMessage.logMessageLen, NELogging::LOG_MESSAGE_IZE));
+        return (text.find(std::string_view(mText.getString(), static_cast<size_t>(mText.getLength()))) != std::string_view::npos);
+    }
+    else
+    {
+        return true;
+    }
+}
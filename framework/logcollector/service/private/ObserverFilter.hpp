@@ -0,0 +1,133 @@
+#ifndef AREG_LOGCOLLECTOR_SERVICE_PRIVATE_OBSERVERFILTER_HPP
+#define AREG_LOGCOLLECTOR_SERVICE_PRIVATE_OBSERVERFILTER_HPP
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        logcollector/service/private/ObserverFilter.hpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, Log Collector filter of log messages of the observer
+ ************************************************************************/
+
+ /************************************************************************
+  * Include files.
+  ************************************************************************/
+#include "areg/base/GEGlobal.h"
+
+#include "areg/base/String.hpp"
+#include "areg/logging/NELogging.hpp"
+
+#include <unordered_map>
+#include <unordered_set>
+
+//////////////////////////////////////////////////////////////////////////
+// ObserverFilter class declaration
+//////////////////////////////////////////////////////////////////////////
+/**
+ * \brief   The filter of log messages, which the Log Collector forwards to the observer.
+ *          The filter is set by the observer and is checked before the log message is
+ *          sent, so that the observer receives only the log messages it is interested in.
+ *          The prefix of the scope names is resolved to the list of scope IDs when
+ *          the scopes are registered by the log sources.
+ **/
+class ObserverFilter
+{
+//////////////////////////////////////////////////////////////////////////
+// Internal types and constants
+//////////////////////////////////////////////////////////////////////////
+public:
+    //!< The names of the scopes registered by the log sources, accessed by scope ID.
+    using ScopeNames    = std::unordered_map<uint32_t, String>;
+
+//////////////////////////////////////////////////////////////////////////
+// Constructor / Destructor
+//////////////////////////////////////////////////////////////////////////
+public:
+    ObserverFilter(void);
+
+    ~ObserverFilter(void) = default;
+
+    ObserverFilter(const ObserverFilter& /*src*/) = default;
+    ObserverFilter(ObserverFilter&& /*src*/) noexcept = default;
+    ObserverFilter& operator = (const ObserverFilter& /*src*/) = default;
+    ObserverFilter& operator = (ObserverFilter&& /*src*/) noexcept = default;
+
+//////////////////////////////////////////////////////////////////////////
+// Operations and attributes
+//////////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * \brief   Sets the filter of log messages. The prefix of the scope names of the filter
+     *          is resolved to the IDs of the scopes in the list of registered scopes.
+     * \param   filter      The filter of log messages sent by the observer.
+     * \param   scopeNames  The names of the scopes registered by the log sources.
+     **/
+    void setFilter(const NELogging::sObserverFilter& filter, const ObserverFilter::ScopeNames& scopeNames);
+
+    /**
+     * \brief   Called when a log source registers the scope. If the name of the scope
+     *          starts with the prefix of the filter, the scope ID is added to the filter.
+     * \param   scopeId     The ID of the registered scope.
+     * \param   scopeName   The name of the registered scope.
+     **/
+    void addScope(uint32_t scopeId, const String& scopeName);
+
+    /**
+     * \brief   Returns true if the log messages of the specified source pass the filter.
+     * \param   source  The cookie of the log source.
+     **/
+    inline bool isSourceMatch(const ITEM_ID& source) const;
+
+    /**
+     * \brief   Returns true if the filter checks the scope, the priority or the text of the log messages.
+     *          Otherwise, the log messages are filtered only by the source.
+     **/
+    inline bool hasMessageFilter(void) const;
+
+    /**
+     * \brief   Returns true if the scope, the priority and the text of the log message pass the filter.
+     *          The source of the message is not checked.
+     * \param   logMessage  The log message to check.
+     **/
+    bool isMessageMatch(const NELogging::sLogMessage& logMessage) const;
+
+//////////////////////////////////////////////////////////////////////////
+// Member variables
+//////////////////////////////////////////////////////////////////////////
+private:
+    //!< The cookies of the log sources. If empty, the messages of all sources pass.
+    std::unordered_set<ITEM_ID>     mInstances;
+    //!< The IDs of the scopes, including resolved by the prefix of the scope names.
+    std::unordered_set<uint32_t>    mScopes;
+    //!< The prefix of the scope names. Ignored if empty.
+    String                          mScopePrefix;
+    //!< The flag, indicating whether the messages are filtered by scope.
+    bool                            mHasScopes;
+    //!< The bitwise combination of priorities. If 0, the messages of any priority pass.
+    uint32_t                        mPriorities;
+    //!< The text, which the message should contain. Ignored if empty.
+    String                          mText;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// ObserverFilter class inline methods
+//////////////////////////////////////////////////////////////////////////
+
+inline bool ObserverFilter::isSourceMatch(const ITEM_ID& source) const
+{
+    return (mInstances.empty() || (mInstances.find(source) != mInstances.end()));
+}
+
+inline bool ObserverFilter::hasMessageFilter(void) const
+{
+    return (mHasScopes || (mPriorities != static_cast<uint32_t>(NELogging::eLogPriority::PrioInvalid)) || (mText.isEmpty() == false));
+}
+
+#endif // AREG_LOGCOLLECTOR_SERVICE_PRIVATE_OBSERVERFILTER_HPP
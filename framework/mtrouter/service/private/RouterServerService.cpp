@@ -97,6 +97,9 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
             case NEService::eServiceRequestType::RegisterStub:
                 {
                     StubAddress stubService(msgReceived);
+                    NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
+                    msgReceived >> reason;
+                    stubService.setHandle(NERemoteService::readAddressHandle(msgReceived));
                     stubService.setSource(source);
                     registeredRemoteServiceProvider(stubService);
                 }
@@ -105,6 +108,9 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
             case NEService::eServiceRequestType::RegisterClient:
                 {
                     ProxyAddress proxyService(msgReceived);
+                    NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
+                    msgReceived >> reason;
+                    proxyService.setHandle(NERemoteService::readAddressHandle(msgReceived));
                     proxyService.setSource(source);
                     registeredRemoteServiceConsumer(proxyService);
                 }
@@ -115,6 +121,7 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
                     StubAddress stubService(msgReceived);
                     NEService::eDisconnectReason reason{NEService::eDisconnectReason::ReasonUndefined};
                     msgReceived >> reason;
+                    stubService.setHandle(NERemoteService::readAddressHandle(msgReceived));
                     stubService.setSource(source);
                     unregisteredRemoteServiceProvider(stubService, reason, stubService.getCookie());
                 }
@@ -125,6 +132,7 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
                     ProxyAddress proxyService(msgReceived);
                     NEService::eDisconnectReason reason { NEService::eDisconnectReason::ReasonUndefined };
                     msgReceived >> reason;
+                    proxyService.setHandle(NERemoteService::readAddressHandle(msgReceived));
                     proxyService.setSource(source);
                     unregisteredRemoteServiceConsumer(proxyService, reason, proxyService.getCookie());
                 }
@@ -183,6 +191,9 @@ void RouterServerService::onServiceMessageReceived(const RemoteMessage &msgRecei
     case NEService::eFuncIdRange::ServiceSaveLogConfiguration:      // fall through
     case NEService::eFuncIdRange::ServiceLogConfigurationSaved:     // fall through
     case NEService::eFuncIdRange::ServiceLogMessage:                // fall through
+    case NEService::eFuncIdRange::ServiceMulticastMessage:          // fall through
+    case NEService::eFuncIdRange::ServiceLogMessageBatch:           // fall through
+    case NEService::eFuncIdRange::ServiceLogObserverFilter:         // fall through
         break;
 
     case NEService::eFuncIdRange::ResponseServiceProviderConnection:// fall through
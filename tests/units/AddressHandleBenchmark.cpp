@@ -0,0 +1,178 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/AddressHandleBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of stub and proxy address handles on the wire and
+ *              benchmark of bytes and time to serialize and deserialize
+ *              the addresses with and without handles.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/StubAddress.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    //!< The cookie of the process, which owns the remote addresses.
+    constexpr ITEM_ID   REMOTE_COOKIE   { NEService::COOKIE_REMOTE_SERVICE + 10 };
+
+    //!< The cookie of the process of the test.
+    constexpr ITEM_ID   OWNER_COOKIE    { NEService::COOKIE_REMOTE_SERVICE + 20 };
+
+    //!< Returns the address of the stub of the remote process.
+    StubAddress remoteStub( uint32_t handle )
+    {
+        StubAddress addrStub( "HandleBenchmarkService", Version( 1, 0, 0 ), NEService::eServiceType::ServicePublic, "HandleBenchmarkRole", "HandleBenchmarkThread" );
+        addrStub.setCookie( REMOTE_COOKIE );
+        addrStub.setHandle( handle );
+        return addrStub;
+    }
+
+    //!< Returns the address of the proxy created in the process.
+    ProxyAddress localProxy( void )
+    {
+        return ProxyAddress( "HandleBenchmarkService", Version( 1, 0, 0 ), NEService::eServiceType::ServicePublic, "HandleBenchmarkRole", "HandleBenchmarkThread" );
+    }
+}
+
+/**
+ * \brief   Writes the remote stub address with handle and checks
+ *          that the address is restored from the handle.
+ **/
+TEST( AddressHandleBenchmark, RemoteStubRoundTrip )
+{
+    constexpr uint32_t handle{ 5 };
+    const StubAddress addrStub{ remoteStub( handle ) };
+    StubAddress::registerRemoteHandle( addrStub );
+
+    SharedBuffer full;
+    full << addrStub;
+    SharedBuffer compact;
+    addrStub.writeCompact( compact );
+    EXPECT_LT( compact.getSizeUsed( ), full.getSizeUsed( ) );
+
+    full.moveToBegin( );
+    compact.moveToBegin( );
+    StubAddress fromFull( full );
+    StubAddress fromCompact( compact );
+    EXPECT_EQ( fromCompact.getServiceName( ), fromFull.getServiceName( ) );
+    EXPECT_EQ( fromCompact.getRoleName( ), fromFull.getRoleName( ) );
+    EXPECT_EQ( fromCompact.getThread( ), fromFull.getThread( ) );
+    EXPECT_EQ( fromCompact.getCookie( ), REMOTE_COOKIE );
+    EXPECT_EQ( fromCompact.getHandle( ), handle );
+    EXPECT_EQ( fromFull.getHandle( ), NEService::INVALID_HANDLE );
+    EXPECT_TRUE( fromCompact == fromFull );
+
+    // the handle is not valid after the remote stub is unregistered.
+    StubAddress::unregisterRemoteHandle( addrStub );
+    compact.moveToBegin( );
+    StubAddress unknown( compact );
+    EXPECT_FALSE( unknown.isValid( ) );
+}
+
+/**
+ * \brief   Checks that the address created in the process is written with
+ *          handle only when the process is connected, and that released
+ *          handles are not reused with the same value.
+ **/
+TEST( AddressHandleBenchmark, LocalProxyHandle )
+{
+    ProxyAddress addrProxy{ localProxy( ) };
+    const uint32_t handle{ ProxyAddress::createHandle( addrProxy ) };
+    ASSERT_NE( handle, NEService::INVALID_HANDLE );
+    addrProxy.setHandle( handle );
+
+    SharedBuffer notConnected;
+    addrProxy.writeCompact( notConnected );
+    SharedBuffer full;
+    full << addrProxy;
+    EXPECT_EQ( notConnected.getSizeUsed( ), full.getSizeUsed( ) );
+
+    ProxyAddress::setHandleOwner( OWNER_COOKIE );
+    SharedBuffer compact;
+    addrProxy.writeCompact( compact );
+    EXPECT_LT( compact.getSizeUsed( ), full.getSizeUsed( ) );
+
+    compact.moveToBegin( );
+    ProxyAddress fromCompact( compact );
+    EXPECT_EQ( fromCompact.getServiceName( ), addrProxy.getServiceName( ) );
+    EXPECT_EQ( fromCompact.getRoleName( ), addrProxy.getRoleName( ) );
+    EXPECT_EQ( fromCompact.getThread( ), addrProxy.getThread( ) );
+    EXPECT_EQ( fromCompact.getCookie( ), OWNER_COOKIE );
+
+    ProxyAddress::releaseHandle( handle );
+    const uint32_t reused{ ProxyAddress::createHandle( addrProxy ) };
+    EXPECT_NE( reused, handle );
+    EXPECT_NE( reused, NEService::INVALID_HANDLE );
+
+    // the released handle is not resolved anymore.
+    compact.moveToBegin( );
+    ProxyAddress released( compact );
+    EXPECT_FALSE( released.isValid( ) );
+
+    ProxyAddress::releaseHandle( reused );
+    ProxyAddress::setHandleOwner( NEService::COOKIE_UNKNOWN );
+}
+
+/**
+ * \brief   Compares the bytes and the time to serialize and deserialize
+ *          the stub address with and without handle.
+ **/
+TEST( AddressHandleBenchmark, StubAddressSerialization )
+{
+    constexpr uint32_t count{ 100'000 };
+    constexpr uint32_t handle{ 7 };
+    const StubAddress addrStub{ remoteStub( handle ) };
+    StubAddress::registerRemoteHandle( addrStub );
+
+    SharedBuffer full;
+    SharedBuffer compact;
+    auto start = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        full.moveToBegin( );
+        full << addrStub;
+        full.moveToBegin( );
+        StubAddress addrRead( full );
+        ASSERT_TRUE( addrRead.isValid( ) );
+    }
+
+    auto fullTime = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+
+    start = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        compact.moveToBegin( );
+        addrStub.writeCompact( compact );
+        compact.moveToBegin( );
+        StubAddress addrRead( compact );
+        ASSERT_TRUE( addrRead.isValid( ) );
+    }
+
+    auto compactTime = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+
+    std::cout << "[ BENCHMARK ] addresses = " << count
+              << ", full bytes = " << full.getSizeUsed( )
+              << ", time ms = " << static_cast<uint64_t>(fullTime)
+              << "; handle bytes = " << compact.getSizeUsed( )
+              << ", time ms = " << static_cast<uint64_t>(compactTime) << std::endl;
+
+    EXPECT_LT( compact.getSizeUsed( ), full.getSizeUsed( ) );
+    StubAddress::unregisterRemoteHandle( addrStub );
+}
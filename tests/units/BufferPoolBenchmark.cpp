@@ -0,0 +1,163 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/BufferPoolBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the pooled byte buffers and benchmark of the
+ *              serialization of messages written field by field.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/BufferPool.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SharedBuffer.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace
+{
+    //!< The result of serializing the messages.
+    struct sWriteResult
+    {
+        double      wrMsgPerSec     { 0.0 };    //!< The serialized messages per second.
+        double      wrAllocsPerMsg  { 0.0 };    //!< The buffer allocations per message.
+        double      wrHeapPerMsg    { 0.0 };    //!< The heap allocations per message.
+        uint64_t    wrAllocations   { 0u };     //!< The number of allocated buffers.
+        uint64_t    wrReleases      { 0u };     //!< The number of released buffers.
+    };
+
+    //!< Serializes the messages of the given payload size, written field by field.
+    template<class Buffer>
+    sWriteResult writeMessages( uint32_t payload, uint32_t count )
+    {
+        const uint32_t fields{ payload / static_cast<uint32_t>(sizeof( uint32_t )) };
+        uint64_t checksum{ 0u };
+
+        const NEMemory::sPoolStatistics before{ BufferPool::getStatistics( ) };
+        auto start = std::chrono::steady_clock::now( );
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            Buffer message;
+            for ( uint32_t field = 0; field < fields; ++ field )
+            {
+                message << field;
+            }
+
+            checksum += message.getSizeUsed( );
+        }
+
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+        const NEMemory::sPoolStatistics after{ BufferPool::getStatistics( ) };
+        EXPECT_EQ( checksum, static_cast<uint64_t>(fields) * sizeof( uint32_t ) * count );
+
+        sWriteResult result;
+        result.wrMsgPerSec      = static_cast<double>(count) / elapsed;
+        result.wrAllocsPerMsg   = static_cast<double>(after.psAllocations - before.psAllocations) / count;
+        result.wrHeapPerMsg     = static_cast<double>(after.psHeapAllocs - before.psHeapAllocs) / count;
+        result.wrAllocations    = after.psAllocations - before.psAllocations;
+        result.wrReleases       = after.psReleases - before.psReleases;
+        return result;
+    }
+
+    //!< Serializes the messages with disabled and enabled pools and prints the results.
+    template<class Buffer>
+    void benchmarkMessages( const char * name, uint32_t payload, uint32_t count )
+    {
+        BufferPool::setPoolEnabled( false );
+        const sWriteResult heap{ writeMessages<Buffer>( payload, count ) };
+        BufferPool::setPoolEnabled( true );
+        const sWriteResult pool{ writeMessages<Buffer>( payload, count ) };
+
+        std::cout << "[ BENCHMARK ] " << name << ", payload = " << payload << " bytes, messages = " << count
+                  << ", allocs/msg = " << heap.wrAllocsPerMsg
+                  << ", heap allocs/msg = " << heap.wrHeapPerMsg
+                  << ", msg/sec = " << static_cast<uint64_t>(heap.wrMsgPerSec) << " (pool disabled)" << std::endl;
+        std::cout << "[ BENCHMARK ] " << name << ", payload = " << payload << " bytes, messages = " << count
+                  << ", allocs/msg = " << pool.wrAllocsPerMsg
+                  << ", heap allocs/msg = " << pool.wrHeapPerMsg
+                  << ", msg/sec = " << static_cast<uint64_t>(pool.wrMsgPerSec) << " (pool enabled)" << std::endl;
+
+        // The buffer grows geometrically, the number of reallocations is logarithmic.
+        EXPECT_EQ( heap.wrAllocations, heap.wrReleases );
+        EXPECT_EQ( pool.wrAllocations, pool.wrReleases );
+        EXPECT_LT( pool.wrAllocsPerMsg, 32.0 );
+        EXPECT_DOUBLE_EQ( heap.wrHeapPerMsg, heap.wrAllocsPerMsg );
+        if ( payload < BufferPool::MAX_BLOCK_SIZE )
+        {
+            EXPECT_LT( pool.wrHeapPerMsg, 0.1 );
+        }
+    }
+}
+
+/**
+ * \brief   Checks that the memory of the released buffer is reused by the next
+ *          buffer of the same size class, and the growing buffer keeps the data.
+ **/
+TEST( BufferPoolBenchmark, ReuseBuffers )
+{
+    ASSERT_TRUE( BufferPool::isPoolEnabled( ) );
+
+    const unsigned char * first{ nullptr };
+    {
+        SharedBuffer buffer( 1000u, NEMemory::BLOCK_SIZE );
+        first = buffer.getBuffer( );
+        ASSERT_NE( first, nullptr );
+    }
+
+    const NEMemory::sPoolStatistics before{ BufferPool::getStatistics( ) };
+    {
+        SharedBuffer buffer( 1000u, NEMemory::BLOCK_SIZE );
+        EXPECT_EQ( buffer.getBuffer( ), first );
+        EXPECT_GE( buffer.getSizeAvailable( ), 1000u );
+
+        for ( uint32_t i = 0; i < 10'000u; ++ i )
+        {
+            buffer << i;
+        }
+
+        buffer.moveToBegin( );
+        for ( uint32_t i = 0; i < 10'000u; ++ i )
+        {
+            uint32_t value{ 0u };
+            buffer >> value;
+            ASSERT_EQ( value, i );
+        }
+    }
+
+    const NEMemory::sPoolStatistics after{ BufferPool::getStatistics( ) };
+    EXPECT_EQ( after.psAllocations - before.psAllocations, after.psReleases - before.psReleases );
+    EXPECT_LT( after.psAllocations - before.psAllocations, 10u );
+}
+
+/**
+ * \brief   Measures the buffer allocations per message of the shared buffers,
+ *          written field by field, with disabled and enabled pools.
+ **/
+TEST( BufferPoolBenchmark, SharedBufferWrite )
+{
+    benchmarkMessages<SharedBuffer>( "SharedBuffer", 1024u, 20'000u );
+    benchmarkMessages<SharedBuffer>( "SharedBuffer", 64u * 1024u, 400u );
+    benchmarkMessages<SharedBuffer>( "SharedBuffer", 4u * 1024u * 1024u, 4u );
+}
+
+/**
+ * \brief   Measures the buffer allocations per message of the remote messages,
+ *          written field by field, with disabled and enabled pools.
+ **/
+TEST( BufferPoolBenchmark, RemoteMessageWrite )
+{
+    benchmarkMessages<RemoteMessage>( "RemoteMessage", 1024u, 20'000u );
+    benchmarkMessages<RemoteMessage>( "RemoteMessage", 64u * 1024u, 400u );
+    benchmarkMessages<RemoteMessage>( "RemoteMessage", 4u * 1024u * 1024u, 4u );
+}
@@ -0,0 +1,151 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/Crc32Benchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the 32-bit CRC calculation and benchmark of the
+ *              CRC throughput in gigabytes per second.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NEMath.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    //!< Calculates the 32-bit CRC of IEEE 802.3 bit by bit, used as a reference.
+    uint32_t crc32Reference( uint32_t crc, const unsigned char * data, uint32_t size )
+    {
+        for ( uint32_t i = 0; i < size; ++ i )
+        {
+            crc ^= data[i];
+            for ( int bit = 0; bit < 8; ++ bit )
+            {
+                crc = (crc & 1u) != 0 ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+            }
+        }
+
+        return crc;
+    }
+
+    //!< Creates the buffer of pseudo-random bytes.
+    std::vector<unsigned char> createData( uint32_t size )
+    {
+        std::vector<unsigned char> result( size );
+        uint32_t seed{ 0x12345678u };
+        for ( auto & elem : result )
+        {
+            seed = seed * 1'664'525u + 1'013'904'223u;
+            elem = static_cast<unsigned char>(seed >> 24);
+        }
+
+        return result;
+    }
+
+    //!< Returns the throughput in gigabytes per second of the CRC calculation function.
+    template<typename Function>
+    double measureThroughput( const std::vector<unsigned char> & data, uint32_t repeat, uint32_t expected, Function calculate )
+    {
+        uint32_t crc{ 0u };
+        auto start = std::chrono::steady_clock::now( );
+        for ( uint32_t i = 0; i < repeat; ++ i )
+        {
+            crc = calculate( data.data( ), static_cast<uint32_t>(data.size( )) );
+        }
+
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+        EXPECT_EQ( crc, expected );
+        return static_cast<double>(data.size( )) * repeat / elapsed / 1'000'000'000.0;
+    }
+}
+
+/**
+ * \brief   Checks the CRC of the standard check value and the CRC of the data of different
+ *          sizes and alignments, calculated in one step and in several steps.
+ **/
+TEST( Crc32Benchmark, MatchesReference )
+{
+    const unsigned char check[]{ '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    EXPECT_EQ( NEMath::crc32Calculate( check, static_cast<int>(sizeof( check )) ), 0xCBF43926u );
+    EXPECT_EQ( NEMath::crc32Calculate( "123456789" ), 0xCBF43926u );
+    EXPECT_EQ( NEMath::crc32Calculate( check, 0 ), 0u );
+
+    const std::vector<unsigned char> data{ createData( 4096u + 16u ) };
+    for ( uint32_t offset = 0; offset < 16u; ++ offset )
+    {
+        for ( uint32_t size = 0; size <= 512u; ++ size )
+        {
+            const unsigned char * buffer{ data.data( ) + offset };
+            const uint32_t expected{ ~crc32Reference( ~0u, buffer, size ) };
+            ASSERT_EQ( NEMath::crc32Calculate( buffer, static_cast<int>(size) ), expected ) << "offset = " << offset << ", size = " << size;
+
+            const uint32_t half{ size / 2u };
+            uint32_t crc{ NEMath::crc32Init( ) };
+            crc = NEMath::crc32Start( crc, buffer, static_cast<int>(half) );
+            crc = NEMath::crc32Start( crc, buffer + half, static_cast<int>(size - half) );
+            ASSERT_EQ( NEMath::crc32Finish( crc ), expected ) << "offset = " << offset << ", size = " << size;
+        }
+    }
+
+    const uint32_t expected{ ~crc32Reference( ~0u, data.data( ), 4096u ) };
+    EXPECT_EQ( NEMath::crc32Calculate( data.data( ), 4096 ), expected );
+}
+
+/**
+ * \brief   Measures the CRC throughput in gigabytes per second of the byte-wise lookup
+ *          and of the framework calculation of 1 KB, 64 KB and 1 MB data.
+ **/
+TEST( Crc32Benchmark, Throughput )
+{
+    const uint32_t sizes[]{ 1024u, 64u * 1024u, 1024u * 1024u };
+    for ( uint32_t size : sizes )
+    {
+        const std::vector<unsigned char> data{ createData( size ) };
+        const uint32_t expected{ ~crc32Reference( ~0u, data.data( ), size ) };
+        const uint32_t repeat{ MACRO_MAX( (64u * 1024u * 1024u) / size, 1u ) };
+
+        uint32_t table[256]{ };
+        for ( uint32_t i = 0; i < 256u; ++ i )
+        {
+            table[i] = i;
+            for ( int bit = 0; bit < 8; ++ bit )
+            {
+                table[i] = (table[i] & 1u) != 0 ? (table[i] >> 1) ^ 0xEDB88320u : (table[i] >> 1);
+            }
+        }
+
+        const double bytewise = measureThroughput( data, repeat, expected, [&table]( const unsigned char * buffer, uint32_t length ) -> uint32_t
+            {
+                uint32_t crc{ ~0u };
+                for ( uint32_t i = 0; i < length; ++ i )
+                {
+                    crc = (crc >> 8) ^ table[(crc ^ buffer[i]) & 0xFFu];
+                }
+
+                return ~crc;
+            } );
+
+        const double framework = measureThroughput( data, repeat, expected, []( const unsigned char * buffer, uint32_t length ) -> uint32_t
+            {
+                return NEMath::crc32Calculate( buffer, static_cast<int>(length) );
+            } );
+
+        std::cout << "[ BENCHMARK ] CRC32, size = " << size << " bytes"
+                  << ", byte-wise = " << bytewise << " GB/s"
+                  << ", NEMath = " << framework << " GB/s"
+                  << (NEMath::crc32IsAccelerated( ) ? " (carry-less multiplication)" : " (slicing-by-8)") << std::endl;
+    }
+}
@@ -0,0 +1,219 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/DispatcherThreadBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of events dispatched per second when
+ *              1..N producer threads send events to one dispatcher thread.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/component/TEEvent.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The data of the benchmark event.
+    struct BenchmarkData
+    {
+        uint32_t    mProducer{ 0 };
+        uint32_t    mSequence{ 0 };
+    };
+
+    DECLARE_EVENT(BenchmarkData, BenchmarkEvent, IEBenchmarkConsumer);
+
+    //!< Counts dispatched events and signals when all expected events are processed.
+    class BenchmarkConsumer : public IEBenchmarkConsumer
+    {
+    public:
+        BenchmarkConsumer( uint32_t expected )
+            : IEBenchmarkConsumer( )
+            , mExpected ( expected )
+            , mCount    ( 0 )
+            , mOrdered  ( true )
+            , mLastSeq  ( )
+            , mDone     ( true, false )
+        {
+        }
+
+        virtual void processEvent( const BenchmarkData & data ) override
+        {
+            if (data.mProducer >= mLastSeq.size())
+            {
+                mLastSeq.resize(data.mProducer + 1, 0);
+            }
+
+            // Events of the same producer must be dispatched in FIFO order.
+            mOrdered = mOrdered && (data.mSequence == mLastSeq[data.mProducer] + 1);
+            mLastSeq[data.mProducer] = data.mSequence;
+
+            if (++ mCount == mExpected)
+            {
+                mDone.setEvent();
+            }
+        }
+
+        uint32_t                mExpected;
+        uint32_t                mCount;
+        bool                    mOrdered;
+        std::vector<uint32_t>   mLastSeq;
+        SynchEvent              mDone;
+    };
+
+    //!< The dispatcher thread, which queues the received events.
+    class BenchmarkThread : public DispatcherThread
+    {
+    public:
+        BenchmarkThread( void )
+            : DispatcherThread( "DispatcherThreadBenchmark" )
+        {
+        }
+
+    protected:
+        virtual bool postEvent( Event & eventElem ) override
+        {
+            return EventDispatcher::postEvent( eventElem );
+        }
+    };
+
+    //!< Counts dispatched events, on the first event registers the other consumer
+    //!< and unregisters itself.
+    class SwitchingConsumer : public IEBenchmarkConsumer
+    {
+    public:
+        SwitchingConsumer( DispatcherThread & dispatcher, IEBenchmarkConsumer * next, uint32_t expected )
+            : IEBenchmarkConsumer( )
+            , mDispatcher   ( dispatcher )
+            , mNext         ( next )
+            , mExpected     ( expected )
+            , mCount        ( 0 )
+            , mDone         ( true, false )
+        {
+        }
+
+        virtual void processEvent( const BenchmarkData & /*data*/ ) override
+        {
+            if ( (++ mCount == 1) && (mNext != nullptr) )
+            {
+                BenchmarkEvent::addListener( *mNext, mDispatcher );
+                BenchmarkEvent::removeListener( *this, mDispatcher );
+            }
+
+            if ( mCount == mExpected )
+            {
+                mDone.setEvent( );
+            }
+        }
+
+        DispatcherThread &      mDispatcher;
+        IEBenchmarkConsumer *   mNext;
+        uint32_t                mExpected;
+        uint32_t                mCount;
+        SynchEvent              mDone;
+    };
+
+    //!< Sends the events from the specified number of producers and returns the rate.
+    double runProducers( uint32_t producers, uint32_t eventsPerProducer, bool & isOrdered )
+    {
+        BenchmarkThread dispatcher;
+        BenchmarkConsumer consumer( producers * eventsPerProducer );
+        dispatcher.createThread( NECommon::WAIT_INFINITE );
+        dispatcher.waitForDispatcherStart( NECommon::WAIT_INFINITE );
+        BenchmarkEvent::addListener( consumer, dispatcher );
+
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now( );
+        for ( uint32_t i = 0; i < producers; ++ i )
+        {
+            threads.emplace_back( [i, eventsPerProducer, &dispatcher]( )
+                {
+                    for ( uint32_t seq = 1; seq <= eventsPerProducer; ++ seq )
+                    {
+                        BenchmarkEvent::sendEvent( BenchmarkData{ i, seq }, dispatcher );
+                    }
+                } );
+        }
+
+        for ( auto & thread : threads )
+        {
+            thread.join( );
+        }
+
+        Lock wait( consumer.mDone, false );
+        wait.lock( NECommon::WAIT_INFINITE );
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+
+        BenchmarkEvent::removeListener( consumer, dispatcher );
+        dispatcher.shutdownThread( NECommon::WAIT_INFINITE );
+        isOrdered = consumer.mOrdered && (consumer.mCount == consumer.mExpected);
+
+        return (static_cast<double>(producers * eventsPerProducer) / elapsed);
+    }
+}
+
+/**
+ * \brief   Measures the events per second dispatched by one dispatcher thread
+ *          when the events are sent by 1, 2, 4 and 8 producers.
+ **/
+TEST( DispatcherThreadBenchmark, EventsPerSecond )
+{
+    constexpr uint32_t eventsPerProducer{ 20'000 };
+
+    for ( uint32_t producers : { 1u, 2u, 4u, 8u } )
+    {
+        bool isOrdered{ false };
+        double rate = runProducers( producers, eventsPerProducer, isOrdered );
+        std::cout << "[ BENCHMARK ] producers = " << producers
+                  << ", events = " << producers * eventsPerProducer
+                  << ", events/sec = " << static_cast<uint64_t>(rate) << std::endl;
+
+        EXPECT_TRUE( isOrdered );
+    }
+}
+
+/**
+ * \brief   Checks that the consumers registered or unregistered while dispatching
+ *          the event are applied starting with the next event.
+ **/
+TEST( DispatcherThreadBenchmark, RegisterWhileDispatching )
+{
+    constexpr uint32_t eventCount{ 3 };
+
+    BenchmarkThread dispatcher;
+    ASSERT_TRUE( dispatcher.createThread( NECommon::WAIT_INFINITE ) );
+    ASSERT_TRUE( dispatcher.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
+
+    SwitchingConsumer second( dispatcher, nullptr, eventCount - 1 );
+    SwitchingConsumer first( dispatcher, &second, 1 );
+    BenchmarkEvent::addListener( first, dispatcher );
+
+    for ( uint32_t seq = 1; seq <= eventCount; ++ seq )
+    {
+        BenchmarkEvent::sendEvent( BenchmarkData{ 0, seq }, dispatcher );
+    }
+
+    Lock wait( second.mDone, false );
+    EXPECT_TRUE( wait.lock( 5'000 ) );
+    BenchmarkEvent::removeListener( second, dispatcher );
+    dispatcher.shutdownThread( NECommon::WAIT_INFINITE );
+
+    EXPECT_EQ( first.mCount, 1u );
+    EXPECT_EQ( second.mCount, eventCount - 1 );
+}
@@ -0,0 +1,213 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/EventAllocatorBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the pooled allocation of events and benchmark of
+ *              the heap allocations per dispatched event.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/component/EventAllocator.hpp"
+#include "areg/component/TEEvent.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The maximum number of sent and not processed events.
+    constexpr uint32_t  EVENTS_IN_FLIGHT    { 256u };
+
+    //!< The data of the small event.
+    struct AllocatorData
+    {
+        uint32_t    mProducer{ 0 };
+        uint32_t    mSequence{ 0 };
+    };
+
+    DECLARE_EVENT(AllocatorData, AllocatorEvent, IEAllocatorConsumer);
+
+    //!< The event with the payload of the specified size.
+    template<size_t Size>
+    class SizedEvent : public Event
+    {
+    public:
+        SizedEvent( uint8_t value )
+            : Event ( Event::eEventType::EventCustom )
+        {
+            mPayload[ 0 ] = value;
+        }
+
+        uint8_t mPayload[ Size ];
+    };
+
+    //!< The event smaller than the first size class.
+    using SmallEvent    = SizedEvent<8>;
+
+    //!< The event bigger than the largest size class.
+    using BigEvent      = SizedEvent<EventAllocator::BLOCK_GRANULARITY * EventAllocator::SIZE_CLASS_COUNT>;
+
+    //!< Counts dispatched events and signals when all expected events are processed.
+    class AllocatorConsumer : public IEAllocatorConsumer
+    {
+    public:
+        AllocatorConsumer( uint32_t expected )
+            : IEAllocatorConsumer( )
+            , mExpected ( expected )
+            , mCount    ( 0 )
+            , mDone     ( true, false )
+        {
+        }
+
+        virtual void processEvent( const AllocatorData & /*data*/ ) override
+        {
+            if (mCount.fetch_add(1u, std::memory_order_release) + 1u == mExpected)
+            {
+                mDone.setEvent();
+            }
+        }
+
+        uint32_t                mExpected;
+        std::atomic<uint32_t>   mCount;
+        SynchEvent              mDone;
+    };
+
+    //!< The dispatcher thread, which queues the received events.
+    class AllocatorThread : public DispatcherThread
+    {
+    public:
+        AllocatorThread( void )
+            : DispatcherThread( "EventAllocatorBenchmark" )
+        {
+        }
+
+    protected:
+        virtual bool postEvent( Event & eventElem ) override
+        {
+            return EventDispatcher::postEvent( eventElem );
+        }
+    };
+
+    //!< The result of sending events.
+    struct sSendResult
+    {
+        double      srRate          { 0.0 };    //!< The events per second.
+        double      srHeapPerEvent  { 0.0 };    //!< The heap allocations per event.
+        uint64_t    srAllocations   { 0u };     //!< The number of allocated events.
+        uint64_t    srReleases      { 0u };     //!< The number of released events.
+    };
+
+    //!< Sends the events from the producer thread to the dispatcher thread.
+    //!< The producer waits when the dispatcher has too many events to process.
+    sSendResult sendEvents( uint32_t count )
+    {
+        AllocatorThread dispatcher;
+        AllocatorConsumer consumer( count );
+        dispatcher.createThread( NECommon::WAIT_INFINITE );
+        AllocatorEvent::addListener( consumer, dispatcher );
+
+        const NEMemory::sPoolStatistics before{ EventAllocator::getStatistics( ) };
+        auto start = std::chrono::steady_clock::now( );
+        std::thread producer( [count, &dispatcher, &consumer]( )
+            {
+                for ( uint32_t seq = 1; seq <= count; ++ seq )
+                {
+                    while ( seq - consumer.mCount.load( std::memory_order_acquire ) > EVENTS_IN_FLIGHT )
+                    {
+                        std::this_thread::yield( );
+                    }
+
+                    AllocatorEvent::sendEvent( AllocatorData{ 0u, seq }, dispatcher );
+                }
+            } );
+
+        producer.join( );
+        Lock wait( consumer.mDone, false );
+        wait.lock( NECommon::WAIT_INFINITE );
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+
+        AllocatorEvent::removeListener( consumer, dispatcher );
+        dispatcher.shutdownThread( NECommon::WAIT_INFINITE );
+        const NEMemory::sPoolStatistics after{ EventAllocator::getStatistics( ) };
+
+        sSendResult result;
+        result.srRate           = static_cast<double>(count) / elapsed;
+        result.srHeapPerEvent   = static_cast<double>(after.psHeapAllocs - before.psHeapAllocs) / count;
+        result.srAllocations    = after.psAllocations - before.psAllocations;
+        result.srReleases       = after.psReleases - before.psReleases;
+        return result;
+    }
+}
+
+/**
+ * \brief   Checks that the released event block is reused by the next event
+ *          of the same size class, and the big events are allocated in the heap.
+ **/
+TEST( EventAllocatorBenchmark, ReuseBlocks )
+{
+    ASSERT_TRUE( EventAllocator::isPoolEnabled( ) );
+
+    SmallEvent * first{ DEBUG_NEW SmallEvent( 1u ) };
+    first->destroy( );
+    const NEMemory::sPoolStatistics before{ EventAllocator::getStatistics( ) };
+
+    SmallEvent * second{ DEBUG_NEW SmallEvent( 2u ) };
+    EXPECT_EQ( static_cast<void *>(second), static_cast<void *>(first) );
+    EXPECT_EQ( second->mPayload[ 0 ], 2u );
+    second->destroy( );
+
+    BigEvent * big{ DEBUG_NEW BigEvent( 3u ) };
+    big->destroy( );
+
+    const NEMemory::sPoolStatistics after{ EventAllocator::getStatistics( ) };
+    EXPECT_EQ( after.psAllocations - before.psAllocations, 2u );
+    EXPECT_EQ( after.psReleases - before.psReleases, 2u );
+    EXPECT_EQ( after.psHeapAllocs - before.psHeapAllocs, 1u );
+    EXPECT_EQ( after.psHeapReleases - before.psHeapReleases, 1u );
+}
+
+/**
+ * \brief   Measures the heap allocations per event sent by one thread and
+ *          dispatched by another thread, with disabled and enabled pools.
+ *          The number of not processed events is limited, so that the
+ *          benchmark measures the steady state of sending and dispatching.
+ **/
+TEST( EventAllocatorBenchmark, AllocationsPerEvent )
+{
+    constexpr uint32_t count{ 200'000 };
+
+    EventAllocator::setPoolEnabled( false );
+    const sSendResult heap{ sendEvents( count ) };
+    EventAllocator::setPoolEnabled( true );
+    const sSendResult pool{ sendEvents( count ) };
+
+    std::cout << "[ BENCHMARK ] events = " << count
+              << ", heap allocs/event = " << heap.srHeapPerEvent
+              << ", events/sec = " << static_cast<uint64_t>(heap.srRate) << " (pool disabled)" << std::endl;
+    std::cout << "[ BENCHMARK ] events = " << count
+              << ", heap allocs/event = " << pool.srHeapPerEvent
+              << ", events/sec = " << static_cast<uint64_t>(pool.srRate) << " (pool enabled)" << std::endl;
+
+    EXPECT_GE( heap.srAllocations, count );
+    EXPECT_EQ( heap.srAllocations, heap.srReleases );
+    EXPECT_GE( heap.srHeapPerEvent, 1.0 );
+    EXPECT_GE( pool.srAllocations, count );
+    EXPECT_EQ( pool.srAllocations, pool.srReleases );
+    EXPECT_LT( pool.srHeapPerEvent, 0.1 );
+}
@@ -0,0 +1,255 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogBatchBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the encoding and decoding of the batches of log messages,
+ *              and benchmark of the bytes per log message sent to the log collector.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/Process.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/logging/LogBatch.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The text of the log messages.
+    constexpr std::string_view  LOG_TEXT    { "the request [ ConnectService ] is processed with result [ -1 ]" };
+
+    //!< The cookie of the log source.
+    constexpr ITEM_ID           LOG_SOURCE  { 257u };
+
+    //!< Creates the local log message of the current thread.
+    NELogging::sLogMessage makeMessage( uint32_t sequence )
+    {
+        NELogging::sLogMessage logMsg( NELogging::eLogMessageType::LogMessageText, 1234u + sequence % 8u, sequence, 0u, NELogging::eLogPriority::PrioDebug, nullptr, 0u );
+        logMsg.logMessageLen = static_cast<uint32_t>(String::formatString( logMsg.logMessage, NELogging::LOG_MESSAGE_IZE, "%s, sequence %u", LOG_TEXT.data( ), sequence ));
+        return logMsg;
+    }
+
+    //!< Checks that the decoded message is same as the original.
+    void checkMessage( const NELogging::sLogMessage & decoded, const NELogging::sLogMessage & original )
+    {
+        const String & threadName{ Thread::getThreadName( static_cast<id_type>(original.logThreadId) ) };
+        const String & moduleName{ Process::getInstance( ).getAppName( ) };
+
+        EXPECT_EQ( decoded.logDataType, NELogging::eLogDataType::LogDataRemote );
+        EXPECT_EQ( decoded.logMsgType, original.logMsgType );
+        EXPECT_EQ( decoded.logMessagePrio, original.logMessagePrio );
+        EXPECT_EQ( decoded.logSource, original.logSource );
+        EXPECT_EQ( decoded.logTarget, original.logTarget );
+        EXPECT_EQ( decoded.logCookie, LOG_SOURCE );
+        EXPECT_EQ( decoded.logModuleId, original.logModuleId );
+        EXPECT_EQ( decoded.logThreadId, original.logThreadId );
+        EXPECT_EQ( decoded.logTimestamp, original.logTimestamp );
+        EXPECT_EQ( decoded.logDuration, original.logDuration );
+        EXPECT_EQ( decoded.logScopeId, original.logScopeId );
+        EXPECT_EQ( decoded.logSessionId, original.logSessionId );
+        EXPECT_EQ( std::string( decoded.logMessage, decoded.logMessageLen ), std::string( original.logMessage, original.logMessageLen ) );
+        EXPECT_EQ( std::string( decoded.logThread, decoded.logThreadLen ), std::string( threadName.getString( ) ) );
+        EXPECT_EQ( std::string( decoded.logModule, decoded.logModuleLen ), std::string( moduleName.getString( ) ) );
+    }
+}
+
+/**
+ * \brief   Encodes the log messages with timestamps in random order in the batch,
+ *          and checks that the decoded messages are same as the original messages.
+ **/
+TEST( LogBatchBenchmark, EncodeDecode )
+{
+    constexpr uint32_t count{ 100 };
+    std::vector<NELogging::sLogMessage> messages;
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        messages.push_back( makeMessage( i ) );
+        // The messages of different threads are not sorted by timestamp.
+        messages.back( ).logTimestamp -= (i % 3u) * 1'000u;
+        messages.back( ).logDuration   = i * 7u;
+    }
+
+    messages[ 1 ].logMsgType     = NELogging::eLogMessageType::LogMessageScopeEnter;
+    messages[ 1 ].logMessagePrio = NELogging::eLogPriority::PrioScope;
+    messages[ 2 ].logMessageLen  = 0u;
+    messages[ 2 ].logMessage[ 0 ]= String::EmptyChar;
+
+    LogBatchEncoder encoder;
+    for ( const NELogging::sLogMessage & logMsg : messages )
+    {
+        encoder.addMessage( logMsg );
+    }
+
+    EXPECT_EQ( encoder.getCount( ), count );
+    RemoteMessage msgBatch{ encoder.createBatch( LOG_SOURCE ) };
+    EXPECT_TRUE( encoder.isEmpty( ) );
+    ASSERT_TRUE( msgBatch.isValid( ) );
+    EXPECT_EQ( msgBatch.getMessageId( ), static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessageBatch) );
+    EXPECT_EQ( msgBatch.getSource( ), LOG_SOURCE );
+    EXPECT_EQ( msgBatch.getTarget( ), NEService::COOKIE_LOGGER );
+
+    LogBatchDecoder decoder;
+    ASSERT_TRUE( decoder.startBatch( msgBatch ) );
+    NELogging::sLogMessage decoded{ };
+    uint32_t decodedCount{ 0 };
+    while ( decoder.nextMessage( decoded ) )
+    {
+        ASSERT_LT( decodedCount, count );
+        checkMessage( decoded, messages[ decodedCount ] );
+        ++ decodedCount;
+    }
+
+    EXPECT_EQ( decodedCount, count );
+
+    RemoteMessage msgLog{ decoder.createLogMessage( decoded ) };
+    EXPECT_EQ( msgLog.getMessageId( ), static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogMessage) );
+    EXPECT_EQ( msgLog.getSource( ), LOG_SOURCE );
+    EXPECT_EQ( msgLog.getSizeUsed( ), static_cast<uint32_t>(sizeof( NELogging::sLogMessage )) );
+
+    // The truncated batch is decoded until the corrupted message.
+    RemoteMessage msgTruncated{ msgBatch.clone( ) };
+    msgTruncated.setSizeUsed( msgBatch.getSizeUsed( ) - 10u );
+    ASSERT_TRUE( decoder.startBatch( msgTruncated ) );
+    decodedCount = 0;
+    while ( decoder.nextMessage( decoded ) )
+    {
+        ++ decodedCount;
+    }
+
+    EXPECT_EQ( decodedCount, count - 1u );
+    EXPECT_FALSE( decoder.startBatch( msgLog ) );
+}
+
+/**
+ * \brief   Checks that the names of the module and threads are sent once,
+ *          and the receiver, which missed the names, gets them after the
+ *          names are defined again.
+ **/
+TEST( LogBatchBenchmark, InternNames )
+{
+    const NELogging::sLogMessage logMsg{ makeMessage( 0u ) };
+    const String & threadName{ Thread::getThreadName( static_cast<id_type>(logMsg.logThreadId) ) };
+
+    LogBatchEncoder encoder;
+    encoder.addMessage( logMsg );
+    RemoteMessage msgFirst{ encoder.createBatch( LOG_SOURCE ) };
+    encoder.addMessage( logMsg );
+    RemoteMessage msgSecond{ encoder.createBatch( LOG_SOURCE ) };
+
+    // The second batch does not contain the names.
+    const uint32_t namesSize{ msgFirst.getSizeUsed( ) - msgSecond.getSizeUsed( ) };
+    EXPECT_GE( namesSize, static_cast<uint32_t>(threadName.getLength( ) + Process::getInstance( ).getAppName( ).getLength( )) );
+
+    NELogging::sLogMessage decoded{ };
+    LogBatchDecoder decoder;
+    ASSERT_TRUE( decoder.startBatch( msgFirst ) );
+    ASSERT_TRUE( decoder.nextMessage( decoded ) );
+    ASSERT_TRUE( decoder.startBatch( msgSecond ) );
+    ASSERT_TRUE( decoder.nextMessage( decoded ) );
+    checkMessage( decoded, logMsg );
+
+    // The new receiver did not get the names.
+    LogBatchDecoder observer;
+    ASSERT_TRUE( observer.startBatch( msgSecond ) );
+    ASSERT_TRUE( observer.nextMessage( decoded ) );
+    EXPECT_EQ( decoded.logThreadLen, 0u );
+    EXPECT_EQ( decoded.logThreadId, 0u );
+    EXPECT_EQ( decoded.logModuleLen, 0u );
+
+    encoder.defineNames( );
+    encoder.addMessage( logMsg );
+    RemoteMessage msgThird{ encoder.createBatch( LOG_SOURCE ) };
+    ASSERT_TRUE( observer.startBatch( msgThird ) );
+    ASSERT_TRUE( observer.nextMessage( decoded ) );
+    checkMessage( decoded, logMsg );
+    EXPECT_FALSE( observer.nextMessage( decoded ) );
+
+    // The names are removed with the source.
+    observer.removeSource( LOG_SOURCE );
+    ASSERT_TRUE( observer.startBatch( msgSecond ) );
+    ASSERT_TRUE( observer.nextMessage( decoded ) );
+    EXPECT_EQ( decoded.logThreadId, 0u );
+    EXPECT_EQ( decoded.logModuleLen, 0u );
+}
+
+/**
+ * \brief   Measures the number of bytes per log message sent in the batches,
+ *          compared with the single log messages, and the number of encoded
+ *          and decoded messages per second.
+ **/
+TEST( LogBatchBenchmark, BytesPerMessage )
+{
+    constexpr uint32_t count{ 200'000 };
+    std::vector<NELogging::sLogMessage> messages;
+    for ( uint32_t i = 0; i < 64; ++ i )
+    {
+        messages.push_back( makeMessage( i ) );
+    }
+
+    const uint32_t sizeSingle{ NELogging::createLogMessage( messages[ 0 ], NELogging::eLogDataType::LogDataRemote, LOG_SOURCE ).getSizeUsed( ) };
+
+    LogBatchEncoder encoder;
+    std::vector<RemoteMessage> batches;
+    uint64_t sizeBatches{ 0 };
+    auto begin = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        NELogging::sLogMessage & logMsg{ messages[ i % 64u ] };
+        logMsg.logTimestamp += 10u;
+        encoder.addMessage( logMsg );
+        if ( encoder.getSize( ) >= NELogging::LOG_REMOTE_BATCH_SIZE )
+        {
+            batches.push_back( encoder.createBatch( LOG_SOURCE ) );
+            sizeBatches += batches.back( ).getSizeUsed( );
+        }
+    }
+
+    batches.push_back( encoder.createBatch( LOG_SOURCE ) );
+    sizeBatches += batches.back( ).getSizeUsed( );
+    const double elapsedEncode{ std::chrono::duration<double>( std::chrono::steady_clock::now( ) - begin ).count( ) };
+
+    LogBatchDecoder decoder;
+    NELogging::sLogMessage decoded{ };
+    uint32_t decodedCount{ 0 };
+    begin = std::chrono::steady_clock::now( );
+    for ( const RemoteMessage & msgBatch : batches )
+    {
+        ASSERT_TRUE( decoder.startBatch( msgBatch ) );
+        while ( decoder.nextMessage( decoded ) )
+        {
+            ++ decodedCount;
+        }
+    }
+
+    const double elapsedDecode{ std::chrono::duration<double>( std::chrono::steady_clock::now( ) - begin ).count( ) };
+    const double bytesBatch{ static_cast<double>(sizeBatches) / count };
+
+    std::cout << "[ BENCHMARK ] messages = " << count
+              << ", batches = " << batches.size( )
+              << ", bytes/message single = " << sizeSingle
+              << ", bytes/message batch = " << bytesBatch << std::endl;
+    std::cout << "[ BENCHMARK ] encoded messages/sec = " << static_cast<uint64_t>(count / elapsedEncode)
+              << ", decoded messages/sec = " << static_cast<uint64_t>(count / elapsedDecode) << std::endl;
+
+    EXPECT_EQ( decodedCount, count );
+    EXPECT_LT( bytesBatch * 4.0, static_cast<double>(sizeSingle) );
+}
+
+#endif  // AREG_LOGS
@@ -0,0 +1,228 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogFileWriterBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the rotation and compression of log files, and
+ *              benchmark of the number of system calls to write log lines.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/base/File.hpp"
+#include "areg/logging/GELog.h"
+#include "areg/logging/LogConfiguration.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if AREG_LOGS
+
+DEF_LOG_SCOPE( areg_unit_tests_LogFileWriterBenchmark_logLines );
+
+namespace
+{
+    //!< The default config file
+    constexpr std::string_view  DEFAULT_CONFIG_FILE { NEApplication::DEFAULT_CONFIG_FILE };
+
+    //!< The name of the scope to log messages.
+    constexpr char              LOG_SCOPE_NAME[]    { "areg_unit_tests_LogFileWriterBenchmark_logLines" };
+
+    //!< The prefix of the log messages, which are checked in the log files.
+    constexpr std::string_view  LOG_PREFIX          { "file log: sequence " };
+
+    //!< Creates empty directory and returns the path of the log file in the directory.
+    String prepareLogDir( const char * dirName )
+    {
+        const String logDir{ File::makeFileFullPath( File::getSpecialDir( File::eSpecialFolder::SpecialTemp ), dirName ) };
+        std::error_code err;
+        std::filesystem::remove_all( logDir.getString( ), err );
+        std::filesystem::create_directories( logDir.getString( ), err );
+        return File::makeFileFullPath( logDir, "areg_file_writer.log" );
+    }
+
+    //!< Removes the directory of the log file.
+    void removeLogDir( const String & logFile )
+    {
+        std::error_code err;
+        std::filesystem::remove_all( File::getFileDirectory( logFile ).getString( ), err );
+    }
+
+    //!< Loads the configuration and sets the log file with the specified rotation settings.
+    bool setupLogFile( const String & logFile, uint32_t bufferSize, uint64_t maxSize, bool compress )
+    {
+        Application::setWorkingDirectory( nullptr );
+        if ( Application::loadConfiguration( DEFAULT_CONFIG_FILE.data( ) ) == false )
+            return false;
+
+        LogConfiguration config;
+        config.setLogFile( logFile );
+        config.setAppendData( false );
+        config.setLogEnabled( NELogging::eLogingTypes::LogTypeFile, true );
+        config.setLogEnabled( NELogging::eLogingTypes::LogTypeRemote, false );
+        config.setFileBuffer( bufferSize, true );
+        config.setFileMaxSize( maxSize, true );
+        config.setFilePeriod( 0u, true );
+        config.setFileCompress( compress, true );
+        config.setRingOverflow( NELogging::eLogOverflow::OverflowBlock, true );
+
+        if ( LOGGING_START( DEFAULT_CONFIG_FILE.data( ) ) == false )
+            return false;
+
+        NELogging::setScopePriority( LOG_SCOPE_NAME, static_cast<unsigned int>(NELogging::eLogPriority::PrioDebug) );
+        return true;
+    }
+
+    //!< Logs the specified number of messages.
+    void logLines( uint32_t count )
+    {
+        LOG_SCOPE( areg_unit_tests_LogFileWriterBenchmark_logLines );
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            LOG_DBG( "file log: sequence %u, the request [ %s ] is processed with result [ %d ]", i, "ConnectService", -1 );
+        }
+    }
+
+    //!< Returns the number of write system calls made by the process, or 0 if not available.
+    uint64_t getWriteSyscalls( void )
+    {
+        std::ifstream io( "/proc/self/io" );
+        std::string name;
+        uint64_t value{ 0 };
+        while ( io >> name >> value )
+        {
+            if ( name == "syscw:" )
+                return value;
+        }
+
+        return 0;
+    }
+}
+
+/**
+ * \brief   Logs the messages in the file, which is rotated by size, and checks
+ *          that the rotated files contain all messages in the order of logging.
+ **/
+TEST( LogFileWriterBenchmark, RotateBySize )
+{
+    constexpr uint32_t logCount{ 10'000 };
+    const String logFile{ prepareLogDir( "areg_log_rotate" ) };
+    ASSERT_TRUE( setupLogFile( logFile, 4'096, 64 * 1'024, false ) );
+    logLines( logCount );
+    LOGGING_STOP( );
+
+    std::vector<uint32_t> sequences;
+    uint32_t files{ 0 };
+    for ( const auto & entry : std::filesystem::directory_iterator( File::getFileDirectory( logFile ).getString( ) ) )
+    {
+        ++ files;
+        std::ifstream file( entry.path( ) );
+        std::string line;
+        while ( std::getline( file, line ) )
+        {
+            const std::string::size_type pos{ line.find( LOG_PREFIX ) };
+            if ( pos != std::string::npos )
+            {
+                sequences.push_back( static_cast<uint32_t>(std::stoul( line.substr( pos + LOG_PREFIX.length( ) ) )) );
+            }
+        }
+    }
+
+    std::sort( sequences.begin( ), sequences.end( ) );
+    EXPECT_GT( files, 2u );
+    ASSERT_EQ( sequences.size( ), static_cast<size_t>(logCount) );
+    for ( uint32_t i = 0; i < logCount; ++ i )
+    {
+        EXPECT_EQ( sequences[i], i );
+    }
+
+    removeLogDir( logFile );
+}
+
+/**
+ * \brief   Logs the messages in the file, which is rotated by size, and checks
+ *          that the rotated files are compressed in gzip format.
+ **/
+TEST( LogFileWriterBenchmark, CompressRotated )
+{
+    constexpr uint32_t logCount{ 10'000 };
+    const String logFile{ prepareLogDir( "areg_log_compress" ) };
+    ASSERT_TRUE( setupLogFile( logFile, 4'096, 64 * 1'024, true ) );
+    logLines( logCount );
+    LOGGING_STOP( );
+
+    uint32_t compressed{ 0 };
+    uint32_t plain{ 0 };
+    uint64_t sizeCompressed{ 0 };
+    for ( const auto & entry : std::filesystem::directory_iterator( File::getFileDirectory( logFile ).getString( ) ) )
+    {
+        if ( entry.path( ).extension( ) != ".gz" )
+        {
+            ++ plain;
+            continue;
+        }
+
+        ++ compressed;
+        sizeCompressed += static_cast<uint64_t>(entry.file_size( ));
+        std::ifstream file( entry.path( ), std::ios::binary );
+        unsigned char header[3]{ 0 };
+        file.read( reinterpret_cast<char *>(header), 3 );
+        EXPECT_EQ( header[0], 0x1F );
+        EXPECT_EQ( header[1], 0x8B );
+        EXPECT_EQ( header[2], 0x08 );
+    }
+
+    EXPECT_EQ( plain, 1u );
+    EXPECT_GT( compressed, 1u );
+    EXPECT_LT( sizeCompressed, static_cast<uint64_t>(compressed) * 64 * 1'024 / 2 );
+    removeLogDir( logFile );
+}
+
+/**
+ * \brief   Measures the number of write system calls and the time to log
+ *          the messages in the file. The logs are buffered and should be
+ *          written with less than one system call per 50 log lines.
+ **/
+TEST( LogFileWriterBenchmark, SyscallsPerLine )
+{
+    constexpr uint32_t logCount{ 50'000 };
+    const String logFile{ prepareLogDir( "areg_log_syscalls" ) };
+    ASSERT_TRUE( setupLogFile( logFile, NELogging::LOG_FILE_BUFFER_SIZE, 0u, false ) );
+
+    const uint64_t syscalls{ getWriteSyscalls( ) };
+    auto start = std::chrono::steady_clock::now( );
+    logLines( logCount );
+    LOGGING_STOP( );
+    const auto elapsed = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - start ).count( );
+    const uint64_t writes{ getWriteSyscalls( ) - syscalls };
+
+    std::cout << "[ BENCHMARK ] lines = " << logCount
+              << ", write syscalls = " << writes
+              << ", ns/line = " << static_cast<uint64_t>(elapsed * 1'000'000.0 / logCount) << std::endl;
+    removeLogDir( logFile );
+
+    if ( syscalls == 0 )
+    {
+        GTEST_SKIP( ) << "The number of system calls is not available.";
+    }
+
+    EXPECT_LT( writes * 50, static_cast<uint64_t>(logCount) );
+}
+
+#endif  // AREG_LOGS
@@ -0,0 +1,200 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogLayoutBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the compiled layouts of log messages, and
+ *              benchmark of the formatted lines per second of default layouts.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/NEApplication.hpp"
+#include "areg/base/DateTime.hpp"
+#include "areg/base/NEMemory.hpp"
+#include "areg/base/NEUtilities.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/logging/LogLayout.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The text of the log messages.
+    constexpr std::string_view  LOG_TEXT    { "the request [ ConnectService ] is processed with result [ -1 ]" };
+
+    //!< Creates the local log message.
+    NELogging::sLogMessage makeMessage( NELogging::eLogMessageType msgType, NELogging::eLogPriority prio )
+    {
+        return NELogging::sLogMessage( msgType, 1u, 0u, 0u, prio, LOG_TEXT.data( ), static_cast<unsigned int>(LOG_TEXT.length( )) );
+    }
+
+    //!< Renders the message with the layout and returns the text.
+    std::string render( LogLayout & layout, const NELogging::sLogMessage & logMsg )
+    {
+        std::string result( layout.getMaxLength( ), '\0' );
+        result.resize( layout.renderMessage( logMsg, result.data( ), static_cast<uint32_t>(result.size( )) ) );
+        return result;
+    }
+
+    //!< Formats the thread ID as the layout does. The invalid thread ID is not output.
+    std::string formatThreadId( ITEM_ID threadId )
+    {
+        if ( threadId == 0 )
+            return std::string( );
+
+        char buffer[ 32 ];
+        String::formatString( buffer, 32, "%06llu", static_cast<unsigned long long>(threadId) );
+        return std::string( buffer );
+    }
+}
+
+/**
+ * \brief   Compiles the default layout of log messages and checks the operations.
+ *          The '%%' is compiled as text, and the repeated exclusive specifier is skipped.
+ **/
+TEST( LogLayoutBenchmark, CompileLayout )
+{
+    using eOp = LogLayout::eOperation;
+
+    LogLayout layout;
+    ASSERT_TRUE( layout.compile( "%d: [ %t  %p >>> ] %m%n" ) );
+
+    const eOp expected[]{ eOp::OpDayTime, eOp::OpText, eOp::OpThreadId, eOp::OpText, eOp::OpPriority, eOp::OpText, eOp::OpMessage, eOp::OpEndOfLine };
+    const std::vector<LogLayout::sOperation> & ops{ layout.getOperations( ) };
+    ASSERT_EQ( ops.size( ), sizeof( expected ) / sizeof( expected[ 0 ] ) );
+    for ( uint32_t i = 0; i < ops.size( ); ++ i )
+    {
+        EXPECT_EQ( ops[ i ].opCode, expected[ i ] ) << "operation " << i;
+    }
+
+    NELogging::sLogMessage logMsg{ makeMessage( NELogging::eLogMessageType::LogMessageText, NELogging::eLogPriority::PrioInfo ) };
+    ASSERT_TRUE( layout.compile( "100%% %m %z %q%" ) );
+    EXPECT_EQ( layout.getOperations( ).size( ), 3u );
+    EXPECT_EQ( render( layout, logMsg ), std::string( "100% " ) + LOG_TEXT.data( ) + "  %q%" );
+
+    EXPECT_FALSE( layout.compile( "" ) );
+    EXPECT_FALSE( layout.isValid( ) );
+}
+
+/**
+ * \brief   Renders the messages with timestamps of the same and of different
+ *          seconds, and checks that the output is same as the message formatted
+ *          with the date-time, thread ID and priority.
+ **/
+TEST( LogLayoutBenchmark, RenderMessage )
+{
+    LogLayout layout;
+    ASSERT_TRUE( layout.compile( NEApplication::DEFAULT_LAYOUT_LOG_MESSAGE.data( ) ) );
+    NELogging::sLogMessage logMsg{ makeMessage( NELogging::eLogMessageType::LogMessageText, NELogging::eLogPriority::PrioWarning ) };
+    const TIME64 start{ logMsg.logTimestamp };
+
+    for ( TIME64 offset : { 0LL, 1'000LL, 999'999LL, 2'000'000LL, 61'001'000LL, 3'600'000'000LL } )
+    {
+        logMsg.logTimestamp = start + offset;
+        String timestamp;
+        DateTime::formatTime( DateTime( logMsg.logTimestamp ), timestamp, NEUtilities::TIME_FORMAT_ISO8601_OUTPUT );
+
+        const std::string expected{ std::string( timestamp.getString( ) ) + ": [ " + formatThreadId( logMsg.logThreadId ) + " "
+                                  + NELogging::logPrioToString( logMsg.logMessagePrio ).getString( ) + " >>> ] " + LOG_TEXT.data( ) + " \n" };
+        EXPECT_EQ( render( layout, logMsg ), expected ) << "offset " << offset;
+    }
+
+    logMsg.logMessagePrio = NELogging::eLogPriority::PrioIgnoreLayout;
+    EXPECT_EQ( render( layout, logMsg ), std::string( LOG_TEXT ) );
+}
+
+/**
+ * \brief   Renders the names, the cookie and the scope of the remote message,
+ *          and checks that the output is truncated if the buffer is small.
+ **/
+TEST( LogLayoutBenchmark, RenderRemoteMessage )
+{
+    constexpr char threadName[]{ "remote_thread" };
+    constexpr char moduleName[]{ "remote_module" };
+
+    LogLayout layout;
+    ASSERT_TRUE( layout.compile( "%y|%x|%a|%s|%z" ) );
+
+    NELogging::sLogMessage logMsg{ makeMessage( NELogging::eLogMessageType::LogMessageScopeEnter, NELogging::eLogPriority::PrioScope ) };
+    logMsg.logDataType  = NELogging::eLogDataType::LogDataRemote;
+    logMsg.logCookie    = 5u;
+    logMsg.logScopeId   = 1234u;
+    logMsg.logThreadLen = NEMemory::memCopy( logMsg.logThread, NELogging::LOG_NAMES_SIZE, threadName, static_cast<uint32_t>(sizeof( threadName ) - 1) );
+    logMsg.logModuleLen = NEMemory::memCopy( logMsg.logModule, NELogging::LOG_NAMES_SIZE, moduleName, static_cast<uint32_t>(sizeof( moduleName ) - 1) );
+
+    const std::string expected{ std::string( "remote_thread|remote_module|005|1234|" ) + LOG_TEXT.data( ) };
+    EXPECT_EQ( render( layout, logMsg ), expected );
+
+    logMsg.logThreadLen = 0u;
+    logMsg.logCookie    = NEService::COOKIE_UNKNOWN;
+    EXPECT_EQ( render( layout, logMsg ).substr( 0, 30 ), std::string( "Unknown_Thread|Unknown_Module|" ) );
+
+    char buffer[ 8 ]{ 0 };
+    EXPECT_EQ( layout.renderMessage( logMsg, buffer, 8u ), 8u );
+    EXPECT_EQ( std::string( buffer, 8 ), std::string( "Unknown_" ) );
+}
+
+/**
+ * \brief   Measures the number of formatted lines per second of the default
+ *          layouts of log messages, enter and exit scopes. For comparison,
+ *          measures the number of timestamps formatted per second by DateTime.
+ **/
+TEST( LogLayoutBenchmark, FormattedLinesPerSecond )
+{
+    constexpr uint32_t lineCount{ 200'000 };
+    const std::string_view layouts[]
+    {
+          NEApplication::DEFAULT_LAYOUT_LOG_MESSAGE
+        , NEApplication::DEFAULT_LAYOUT_SCOPE_ENTER
+        , NEApplication::DEFAULT_LAYOUT_SCOPE_EXIT
+    };
+
+    NELogging::sLogMessage logMsg{ makeMessage( NELogging::eLogMessageType::LogMessageText, NELogging::eLogPriority::PrioDebug ) };
+    const TIME64 start{ logMsg.logTimestamp };
+    for ( const std::string_view & format : layouts )
+    {
+        LogLayout layout;
+        ASSERT_TRUE( layout.compile( format.data( ) ) );
+        std::string buffer( layout.getMaxLength( ), '\0' );
+
+        uint64_t total{ 0 };
+        auto begin = std::chrono::steady_clock::now( );
+        for ( uint32_t i = 0; i < lineCount; ++ i )
+        {
+            logMsg.logTimestamp = start + static_cast<TIME64>(i) * 10;
+            total += layout.renderMessage( logMsg, buffer.data( ), static_cast<uint32_t>(buffer.size( )) );
+        }
+
+        const double elapsed{ std::chrono::duration<double>( std::chrono::steady_clock::now( ) - begin ).count( ) };
+        EXPECT_GT( total, static_cast<uint64_t>(lineCount) );
+        std::cout << "[ BENCHMARK ] layout = \"" << format << "\""
+                  << ", lines/sec = " << static_cast<uint64_t>(lineCount / elapsed) << std::endl;
+    }
+
+    String timestamp;
+    auto begin = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < lineCount; ++ i )
+    {
+        DateTime::formatTime( DateTime( start + static_cast<TIME64>(i) * 10 ), timestamp, NEUtilities::TIME_FORMAT_ISO8601_OUTPUT );
+    }
+
+    const double elapsed{ std::chrono::duration<double>( std::chrono::steady_clock::now( ) - begin ).count( ) };
+    std::cout << "[ BENCHMARK ] DateTime::formatTime, timestamps/sec = " << static_cast<uint64_t>(lineCount / elapsed) << std::endl;
+}
+
+#endif  // AREG_LOGS
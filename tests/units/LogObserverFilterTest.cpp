@@ -0,0 +1,209 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogObserverFilterTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the message to set the filter of log messages,
+ *              which the log collector forwards to the observer, and
+ *              of the filtering of log messages in the log collector.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/component/NEService.hpp"
+#include "areg/logging/NELogging.hpp"
+#include "logcollector/service/private/ObserverFilter.hpp"
+
+#if AREG_LOGS
+
+/**
+ * \brief   Creates the message to set the filter of the observer, and checks
+ *          that the filter read from the message is same as the original.
+ **/
+TEST( LogObserverFilterTest, FilterMessage )
+{
+    constexpr ITEM_ID observer{ 300u };
+
+    NELogging::sObserverFilter filter;
+    EXPECT_TRUE( filter.isEmpty( ) );
+
+    filter.ofInstances.add( 257u );
+    filter.ofInstances.add( 258u );
+    filter.ofScopes.add( NELogging::makeScopeId( "areg_base_Thread_run" ) );
+    filter.ofScopePrefix = "areg_component_";
+    filter.ofPriorities  = static_cast<uint32_t>(NELogging::eLogPriority::PrioError) | static_cast<uint32_t>(NELogging::eLogPriority::PrioWarning);
+    filter.ofText        = "failed";
+    EXPECT_FALSE( filter.isEmpty( ) );
+
+    RemoteMessage msgFilter{ NELogging::messageObserverFilter( observer, filter ) };
+    ASSERT_TRUE( msgFilter.isValid( ) );
+    EXPECT_EQ( msgFilter.getMessageId( ), static_cast<uint32_t>(NEService::eFuncIdRange::ServiceLogObserverFilter) );
+    EXPECT_EQ( msgFilter.getSource( ), observer );
+    EXPECT_EQ( msgFilter.getTarget( ), NEService::COOKIE_LOGGER );
+
+    NELogging::sObserverFilter received;
+    msgFilter.moveToBegin( );
+    msgFilter >> received;
+    EXPECT_EQ( received.ofInstances, filter.ofInstances );
+    EXPECT_EQ( received.ofScopes, filter.ofScopes );
+    EXPECT_EQ( received.ofScopePrefix, filter.ofScopePrefix );
+    EXPECT_EQ( received.ofPriorities, filter.ofPriorities );
+    EXPECT_EQ( received.ofText, filter.ofText );
+
+    // The empty filter is sent to forward all log messages.
+    msgFilter = NELogging::messageObserverFilter( observer, NELogging::sObserverFilter( ) );
+    msgFilter.moveToBegin( );
+    msgFilter >> received;
+    EXPECT_TRUE( received.isEmpty( ) );
+
+    EXPECT_FALSE( NELogging::messageObserverFilter( NEService::COOKIE_UNKNOWN, filter ).isValid( ) );
+}
+
+namespace
+{
+    //!< Creates the text log message of the specified scope and priority.
+    NELogging::sLogMessage makeMessage( uint32_t scopeId, NELogging::eLogPriority prio, const char * text )
+    {
+        return NELogging::sLogMessage( NELogging::eLogMessageType::LogMessageText, scopeId, 0u, 0u, prio, text, static_cast<unsigned int>(NEString::getStringLength<char>( text )) );
+    }
+}
+
+/**
+ * \brief   Checks that the empty filter passes the log messages of any source,
+ *          scope, priority and text.
+ **/
+TEST( LogObserverFilterTest, EmptyFilterPassesAll )
+{
+    ObserverFilter filter;
+    EXPECT_FALSE( filter.hasMessageFilter( ) );
+    EXPECT_TRUE( filter.isSourceMatch( 257u ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "any text" ) ) );
+
+    filter.setFilter( NELogging::sObserverFilter( ), ObserverFilter::ScopeNames{ { 1u, "areg_base_Thread" } } );
+    EXPECT_FALSE( filter.hasMessageFilter( ) );
+    EXPECT_TRUE( filter.isSourceMatch( 258u ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 2u, NELogging::eLogPriority::PrioFatal, "" ) ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 3u, NELogging::eLogPriority::PrioScope, "enter" ) ) );
+}
+
+/**
+ * \brief   Checks that only the log messages of the priorities in the mask pass the filter.
+ **/
+TEST( LogObserverFilterTest, PriorityMask )
+{
+    NELogging::sObserverFilter observer;
+    observer.ofInstances.add( 257u );
+    observer.ofPriorities = static_cast<uint32_t>(NELogging::eLogPriority::PrioError) | static_cast<uint32_t>(NELogging::eLogPriority::PrioWarning);
+
+    ObserverFilter filter;
+    filter.setFilter( observer, ObserverFilter::ScopeNames( ) );
+    EXPECT_TRUE( filter.hasMessageFilter( ) );
+    EXPECT_TRUE( filter.isSourceMatch( 257u ) );
+    EXPECT_FALSE( filter.isSourceMatch( 258u ) );
+
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioError, "error" ) ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioWarning, "warning" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioFatal, "fatal" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioInfo, "info" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "debug" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioScope, "scope" ) ) );
+}
+
+/**
+ * \brief   Checks that only the log messages of the scopes in the set of scope IDs pass the filter.
+ **/
+TEST( LogObserverFilterTest, ScopeIds )
+{
+    const uint32_t scopeThread{ NELogging::makeScopeId( "areg_base_Thread_run" ) };
+    const uint32_t scopeTimer{ NELogging::makeScopeId( "areg_component_Timer_start" ) };
+
+    NELogging::sObserverFilter observer;
+    observer.ofScopes.add( scopeThread );
+
+    ObserverFilter filter;
+    filter.setFilter( observer, ObserverFilter::ScopeNames{ { scopeTimer, "areg_component_Timer_start" } } );
+    EXPECT_TRUE( filter.hasMessageFilter( ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( scopeThread, NELogging::eLogPriority::PrioDebug, "run" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( scopeTimer, NELogging::eLogPriority::PrioDebug, "start" ) ) );
+
+    // without the prefix, the registered scopes are not added to the filter.
+    filter.addScope( scopeTimer, "areg_component_Timer_start" );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( scopeTimer, NELogging::eLogPriority::PrioDebug, "start" ) ) );
+}
+
+/**
+ * \brief   Checks that the prefix of the scope names is resolved to the scopes registered
+ *          before the filter is set, and to the scopes registered after the filter is set.
+ **/
+TEST( LogObserverFilterTest, ScopePrefix )
+{
+    const ObserverFilter::ScopeNames scopeNames
+    {
+          { 10u, "areg_component_Timer_start" }
+        , { 11u, "areg_base_Thread_run" }
+    };
+
+    NELogging::sObserverFilter observer;
+    observer.ofScopePrefix = "areg_component_";
+
+    ObserverFilter filter;
+    filter.setFilter( observer, scopeNames );
+    EXPECT_TRUE( filter.hasMessageFilter( ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 10u, NELogging::eLogPriority::PrioInfo, "start" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 11u, NELogging::eLogPriority::PrioInfo, "run" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 12u, NELogging::eLogPriority::PrioInfo, "stop" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 13u, NELogging::eLogPriority::PrioInfo, "process" ) ) );
+
+    // the scopes registered later are resolved by the prefix.
+    filter.addScope( 12u, "areg_component_Timer_stop" );
+    filter.addScope( 13u, "areg_base_Process_run" );
+    filter.addScope( 14u, "areg_compo" );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 12u, NELogging::eLogPriority::PrioInfo, "stop" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 13u, NELogging::eLogPriority::PrioInfo, "process" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 14u, NELogging::eLogPriority::PrioInfo, "short" ) ) );
+
+    // the new filter replaces the resolved scopes.
+    observer.ofScopePrefix = "areg_base_";
+    filter.setFilter( observer, scopeNames );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 10u, NELogging::eLogPriority::PrioInfo, "start" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 12u, NELogging::eLogPriority::PrioInfo, "stop" ) ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 11u, NELogging::eLogPriority::PrioInfo, "run" ) ) );
+}
+
+/**
+ * \brief   Checks that only the log messages containing the text pass the filter,
+ *          and that the text is checked together with the priority and the scope.
+ **/
+TEST( LogObserverFilterTest, TextMatch )
+{
+    NELogging::sObserverFilter observer;
+    observer.ofText = "failed";
+
+    ObserverFilter filter;
+    filter.setFilter( observer, ObserverFilter::ScopeNames( ) );
+    EXPECT_TRUE( filter.hasMessageFilter( ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "failed" ) ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "the request failed to start" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "the request is processed" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "FAILED" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioDebug, "" ) ) );
+
+    observer.ofScopes.add( 2u );
+    observer.ofPriorities = static_cast<uint32_t>(NELogging::eLogPriority::PrioError);
+    filter.setFilter( observer, ObserverFilter::ScopeNames( ) );
+    EXPECT_TRUE( filter.isMessageMatch( makeMessage( 2u, NELogging::eLogPriority::PrioError, "connection failed" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 1u, NELogging::eLogPriority::PrioError, "connection failed" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 2u, NELogging::eLogPriority::PrioWarning, "connection failed" ) ) );
+    EXPECT_FALSE( filter.isMessageMatch( makeMessage( 2u, NELogging::eLogPriority::PrioError, "connection lost" ) ) );
+}
+
+#endif  // AREG_LOGS
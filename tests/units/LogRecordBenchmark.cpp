@@ -0,0 +1,188 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogRecordBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the deferred formatting of binary log records,
+ *              and benchmark of the cost of logging on the calling thread
+ *              compared with the formatting of the log message.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SharedBuffer.hpp"
+#include "areg/logging/LogRecord.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< Formats the record and returns the text of the log message.
+    String formatRecord(const LogRecord& record)
+    {
+        NELogging::sLogMessage logMessage;
+        LogRecord::formatRecord(record.getData(), record.getSize(), logMessage);
+        EXPECT_EQ(logMessage.logMessageLen, static_cast<uint32_t>(NEString::getStringLength<char>(logMessage.logMessage)));
+        return String(logMessage.logMessage);
+    }
+
+    //!< Checks that the record is formatted same as the text formatted with 'printf' rules.
+    template<uint32_t Size, typename ... Args>
+    void checkFormat(const char (&format)[Size], const Args& ... args)
+    {
+        LogRecord record(1u, 2u, 0u, NELogging::eLogPriority::PrioDebug, format);
+        record.addArguments(args ...);
+
+        char expected[NELogging::LOG_MESSAGE_IZE];
+        String::formatString(expected, static_cast<int>(NELogging::LOG_MESSAGE_IZE), format, args ...);
+        EXPECT_EQ(formatRecord(record), String(expected)) << "format: " << format;
+    }
+
+    enum class eTestValue : uint16_t
+    {
+        TestValue = 7
+    };
+}
+
+/**
+ * \brief   Checks that the arguments saved in the binary log record are
+ *          formatted same as formatted by 'printf'.
+ **/
+TEST(LogRecordBenchmark, FormatArguments)
+{
+    const char* text{ "text" };
+    const void* ptr{ &text };
+    int number{ -12345 };
+
+    checkFormat("no arguments");
+    checkFormat("100%% done");
+    checkFormat("%d %i %u %x %X %o", -1, 42, 42u, 255, 255u, 8);
+    checkFormat("%hhd %hd %hu %ld %lu", 300, 70000, 70000, -5L, 5UL);
+    checkFormat("%lld %llu %llx", static_cast<long long>(-9'000'000'000LL), 18'446'744'073'709'551'615ULL, 0x1234'5678'9abc'def0ULL);
+    checkFormat("%zu %08X %-6d| %+d % d", static_cast<size_t>(12345), 0xBEEFu, 12, 3, 4);
+    checkFormat("%5.2f %e %g %.3E %10.4f", 3.14159, 2.5e-10, 0.0001, 12345.678, -1.5f);
+    checkFormat("%s %-10s| %10s| %.2s", "abc", "left", "right", "precision");
+    checkFormat("%*d|%-*d|%.*s", 6, 1, 6, 2, 3, "truncated");
+    checkFormat("%c%c%c %p %s", 'a', 'b', 'c', ptr, text);
+    checkFormat("%d %s %llu %f %s", number, text, static_cast<unsigned long long>(number), 1.0, "end");
+
+    LogRecord missing(1u, 2u, 0u, NELogging::eLogPriority::PrioDebug, "missing [%d] [%s] %");
+    missing.addArguments(1);
+    EXPECT_EQ(formatRecord(missing), String("missing [1] [] %"));
+
+    LogRecord record(1u, 2u, 0u, NELogging::eLogPriority::PrioDebug, "%s %s %s %d %d %s");
+    const String areg{ "areg" };
+    const std::string sdk{ "sdk" };
+    const char* empty{ nullptr };
+    record.addArguments(areg, sdk, empty, eTestValue::TestValue, true, std::string_view{"view"});
+    EXPECT_EQ(formatRecord(record), String("areg sdk (null) 7 1 view"));
+}
+
+/**
+ * \brief   Checks that the long text is truncated and the header of the
+ *          log record is passed to the log message.
+ **/
+TEST(LogRecordBenchmark, HeaderAndTruncation)
+{
+    const std::string longText(1'000, 'x');
+    LogRecord record(11u, 22u, 0u, NELogging::eLogPriority::PrioWarning, "[%s] %d %s");
+    record.addArguments(longText.c_str(), 5, longText);
+    EXPECT_LE(record.getSize(), LogRecord::RECORD_SIZE);
+
+    NELogging::sLogMessage logMessage;
+    uint32_t len{ LogRecord::formatRecord(record.getData(), record.getSize(), logMessage) };
+    EXPECT_EQ(len, NELogging::LOG_MESSAGE_IZE - 1);
+    EXPECT_EQ(logMessage.logMessageLen, len);
+    EXPECT_EQ(logMessage.logMessage[len], String::EmptyChar);
+    EXPECT_EQ(logMessage.logMessage[0], '[');
+    EXPECT_EQ(logMessage.logScopeId, 11u);
+    EXPECT_EQ(logMessage.logSessionId, 22u);
+    EXPECT_EQ(logMessage.logMessagePrio, NELogging::eLogPriority::PrioWarning);
+    EXPECT_EQ(logMessage.logMsgType, NELogging::eLogMessageType::LogMessageText);
+    EXPECT_NE(logMessage.logTimestamp, static_cast<TIME64>(0));
+    EXPECT_EQ(logMessage.logDuration, 0u);
+
+    EXPECT_EQ(LogRecord::formatRecord(record.getData(), 10u, logMessage), 0u);
+}
+
+/**
+ * \brief   Checks that the format in the character array on the stack is copied
+ *          in the log record, and the record is formatted correctly after the
+ *          array is modified or goes out of scope.
+ **/
+TEST(LogRecordBenchmark, StackFormat)
+{
+    char format[64]{ "stack [ %s ] value [ %d ]" };
+    const std::string_view text(format, sizeof(format));
+    LogRecord record(1u, 2u, 0u, NELogging::eLogPriority::PrioInfo, text.substr(0, text.find(String::EmptyChar)));
+    record.addArguments("format", 42);
+
+    NEMemory::memSet(reinterpret_cast<unsigned char*>(format), sizeof(format), static_cast<unsigned char>('x'));
+    format[sizeof(format) - 1] = String::EmptyChar;
+    EXPECT_EQ(formatRecord(record), String("stack [ format ] value [ 42 ]"));
+
+    LogRecord empty(1u, 2u, 0u, NELogging::eLogPriority::PrioInfo, std::string_view());
+    EXPECT_EQ(formatRecord(empty), String::EmptyString);
+}
+
+/**
+ * \brief   Compares the time spent in the thread that logs the message
+ *          when the message is formatted, and when the format and the
+ *          arguments are saved in the binary log record. The result is
+ *          copied in the shared buffer as it is passed to the logging thread.
+ **/
+TEST(LogRecordBenchmark, CallSiteCost)
+{
+    constexpr uint32_t count{ 200'000 };
+    constexpr char format[]{ "The request [ %s ] of the client [ %u ] is processed in [ %llu ] us with the result [ %d ], ratio [ %.3f ]" };
+    constexpr uint32_t logMessageSize{ static_cast<uint32_t>(sizeof(NELogging::sLogMessage)) };
+    constexpr uint32_t logLocalSize{ logMessageSize - NELogging::LOG_NAMES_SIZE * 2 };
+    const char* request{ "ConnectService" };
+
+    uint64_t total{ 0 };
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        NELogging::sLogMessage logMessage(NELogging::eLogMessageType::LogMessageText, 1u, i, 0u, NELogging::eLogPriority::PrioDebug, nullptr, 0u);
+        logMessage.logMessageLen = static_cast<uint32_t>(String::formatString(logMessage.logMessage, static_cast<int>(NELogging::LOG_MESSAGE_IZE), format, request, i, static_cast<unsigned long long>(i) * 3, -1, 0.5));
+        SharedBuffer data(logMessageSize, reinterpret_cast<const unsigned char*>(&logMessage), logLocalSize);
+        total += data.getSizeUsed();
+    }
+
+    auto formatTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t formatBytes{ total / count };
+
+    total = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; ++ i)
+    {
+        LogRecord record(1u, i, 0u, NELogging::eLogPriority::PrioDebug, format);
+        record.addArguments(request, i, static_cast<unsigned long long>(i) * 3, -1, 0.5);
+        SharedBuffer data(record.getData(), record.getSize());
+        total += data.getSizeUsed();
+    }
+
+    auto recordTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t recordBytes{ total / count };
+
+    std::cout << "[ BENCHMARK ] logs = " << count
+              << ", formatted: bytes/log = " << formatBytes << ", ns/log = " << static_cast<uint64_t>(formatTime * 1'000'000.0 / count)
+              << "; record: bytes/log = " << recordBytes << ", ns/log = " << static_cast<uint64_t>(recordTime * 1'000'000.0 / count) << std::endl;
+
+    EXPECT_LT(recordBytes, formatBytes);
+}
+
+#endif  // AREG_LOGS
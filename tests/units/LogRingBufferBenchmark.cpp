@@ -0,0 +1,229 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogRingBufferBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the delivery of log messages written by several
+ *              threads, and benchmark of the cost of enabled log call
+ *              with 1, 4 and 16 logging threads.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/base/File.hpp"
+#include "areg/logging/GELog.h"
+#include "areg/logging/LogConfiguration.hpp"
+#include "areg/logging/LogRecord.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if AREG_LOGS
+
+DEF_LOG_SCOPE( areg_unit_tests_LogRingBufferBenchmark_logThread );
+
+namespace
+{
+    //!< The default config file
+    constexpr std::string_view  DEFAULT_CONFIG_FILE { NEApplication::DEFAULT_CONFIG_FILE };
+
+    //!< The name of the scope used by logging threads.
+    constexpr char              LOG_SCOPE_NAME[]    { "areg_unit_tests_LogRingBufferBenchmark_logThread" };
+
+    //!< The prefix of the log messages, which are checked in the log file.
+    constexpr std::string_view  LOG_PREFIX          { "ring log: thread " };
+
+    //!< The prefix of the number of dropped log messages in the warning message.
+    constexpr std::string_view  DROP_PREFIX         { "dropped [ " };
+
+    //!< Starts the logging and enables debug logs of the scope.
+    bool startLogging( void )
+    {
+        Application::setWorkingDirectory( nullptr );
+        if ( LOGGING_START( DEFAULT_CONFIG_FILE.data( ) ) == false )
+            return false;
+
+        NELogging::setScopePriority( LOG_SCOPE_NAME, static_cast<unsigned int>(NELogging::eLogPriority::PrioDebug) );
+        return true;
+    }
+
+    //!< Starts the threads, each logs the messages. Returns the average time in nanoseconds of one log call.
+    uint64_t logFromThreads( uint32_t threadCount, uint32_t logCount )
+    {
+        std::atomic<uint32_t> ready{ 0 };
+        std::atomic<uint64_t> elapsed{ 0 };
+        std::vector<std::thread> threads;
+
+        for ( uint32_t t = 0; t < threadCount; ++ t )
+        {
+            threads.emplace_back( [t, threadCount, logCount, &ready, &elapsed]( )
+                {
+                    LOG_SCOPE( areg_unit_tests_LogRingBufferBenchmark_logThread );
+                    ready.fetch_add( 1 );
+                    while ( ready.load( ) < threadCount )
+                    {
+                        std::this_thread::yield( );
+                    }
+
+                    auto start = std::chrono::steady_clock::now( );
+                    for ( uint32_t i = 0; i < logCount; ++ i )
+                    {
+                        LOG_DBG( "ring log: thread %u, sequence %u, the request [ %s ] is processed with result [ %d ]", t, i, "ConnectService", -1 );
+                    }
+
+                    elapsed.fetch_add( static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now( ) - start).count( )) );
+                } );
+        }
+
+        for ( std::thread & thread : threads )
+        {
+            thread.join( );
+        }
+
+        return elapsed.load( ) / (static_cast<uint64_t>(threadCount) * logCount);
+    }
+
+    //!< Logs the messages from threads in the file with the specified ring buffer settings.
+    //!< Reads the file, checks that the messages of each thread are in the order of logging,
+    //!< and returns the number of written and dropped messages.
+    void logInFile( NELogging::eLogOverflow overflow, uint32_t ringSize, uint32_t threadCount, uint32_t logCount, uint32_t & OUT received, uint32_t & OUT dropped )
+    {
+        const String fileName{ String("areg_log_ring_") + NELogging::overflowToString( overflow ) + ".log" };
+        const String logFile{ File::makeFileFullPath( File::getSpecialDir( File::eSpecialFolder::SpecialTemp ), fileName ) };
+        File::deleteFile( logFile );
+
+        Application::setWorkingDirectory( nullptr );
+        ASSERT_TRUE( Application::loadConfiguration( DEFAULT_CONFIG_FILE.data( ) ) );
+        LogConfiguration config;
+        config.setLogFile( logFile );
+        config.setAppendData( false );
+        config.setLogEnabled( NELogging::eLogingTypes::LogTypeFile, true );
+        config.setLogEnabled( NELogging::eLogingTypes::LogTypeRemote, false );
+        config.setRingSize( ringSize, true );
+        config.setRingOverflow( overflow, true );
+
+        ASSERT_TRUE( startLogging( ) );
+        logFromThreads( threadCount, logCount );
+        LOGGING_STOP( );
+
+        std::vector<uint32_t> nextSeq( threadCount, 0 );
+        received = 0;
+        dropped = 0;
+        std::ifstream file( logFile.getString( ) );
+        std::string line;
+        while ( std::getline( file, line ) )
+        {
+            std::string::size_type pos{ line.find( DROP_PREFIX ) };
+            if ( pos != std::string::npos )
+            {
+                dropped += static_cast<uint32_t>(std::stoul( line.substr( pos + DROP_PREFIX.length( ) ) ));
+                continue;
+            }
+
+            pos = line.find( LOG_PREFIX );
+            if ( pos == std::string::npos )
+                continue;
+
+            unsigned int thread{ 0 };
+            unsigned int seqNr{ 0 };
+            ASSERT_EQ( sscanf( line.c_str( ) + pos + LOG_PREFIX.length( ), "%u, sequence %u", &thread, &seqNr ), 2 );
+            ASSERT_LT( thread, threadCount );
+            if ( overflow == NELogging::eLogOverflow::OverflowBlock )
+            {
+                EXPECT_EQ( seqNr, nextSeq[thread] );
+            }
+            else
+            {
+                EXPECT_GE( seqNr, nextSeq[thread] );
+            }
+
+            nextSeq[thread] = seqNr + 1;
+            ++ received;
+        }
+
+        file.close( );
+        File::deleteFile( logFile );
+    }
+}
+
+/**
+ * \brief   Logs messages from several threads in the file and checks that
+ *          all messages are written, and the messages of each thread are
+ *          written in the same order as they were logged.
+ **/
+TEST( LogRingBufferBenchmark, OrderedDelivery )
+{
+    constexpr uint32_t threadCount{ 4 };
+    constexpr uint32_t logCount{ 2'000 };
+
+    uint32_t received{ 0 };
+    uint32_t dropped{ 0 };
+    logInFile( NELogging::eLogOverflow::OverflowBlock, NELogging::LOG_RING_SIZE, threadCount, logCount, received, dropped );
+    EXPECT_EQ( received, threadCount * logCount );
+    EXPECT_EQ( dropped, 0u );
+}
+
+/**
+ * \brief   Logs messages in the small ring buffer, which drops records
+ *          when it is full, and checks that the number of written and
+ *          dropped messages is equal to the number of logged messages.
+ **/
+TEST( LogRingBufferBenchmark, DropRecords )
+{
+    constexpr uint32_t threadCount{ 2 };
+    constexpr uint32_t logCount{ 5'000 };
+
+    for ( NELogging::eLogOverflow overflow : { NELogging::eLogOverflow::OverflowDropNewest, NELogging::eLogOverflow::OverflowDropOldest } )
+    {
+        uint32_t received{ 0 };
+        uint32_t dropped{ 0 };
+        logInFile( overflow, 1u, threadCount, logCount, received, dropped );
+        EXPECT_EQ( received + dropped, threadCount * logCount ) << "overflow: " << NELogging::overflowToString( overflow );
+    }
+}
+
+/**
+ * \brief   Measures the time in nanoseconds of one enabled log call
+ *          when logs are written by 1, 4 and 16 threads. The ring buffer
+ *          is big enough to keep all records of a thread, so that the
+ *          time of the call does not include the waiting of the logging thread.
+ **/
+TEST( LogRingBufferBenchmark, LogCallCost )
+{
+    constexpr uint32_t logCount{ 20'000 };
+    Application::setWorkingDirectory( nullptr );
+    ASSERT_TRUE( Application::loadConfiguration( DEFAULT_CONFIG_FILE.data( ) ) );
+    LogConfiguration config;
+    config.setRingSize( logCount * LogRecord::RECORD_SIZE / 2, true );
+    config.setRingOverflow( NELogging::eLogOverflow::OverflowBlock, true );
+    ASSERT_TRUE( startLogging( ) );
+
+    for ( uint32_t threadCount : { 1u, 4u, 16u } )
+    {
+        const uint64_t nsPerLog{ logFromThreads( threadCount, logCount ) };
+        std::cout << "[ BENCHMARK ] threads = " << threadCount
+                  << ", logs/thread = " << logCount
+                  << ", ns/log = " << nsPerLog << std::endl;
+    }
+
+    LOGGING_STOP( );
+    EXPECT_FALSE( IS_LOGGING_STARTED( ) );
+}
+
+#endif  // AREG_LOGS
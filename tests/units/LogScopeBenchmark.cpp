@@ -0,0 +1,147 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogScopeBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the log messages removed at compile time,
+ *              and benchmark of the disabled log scopes and log messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+
+// The debug messages of this file are removed at compile time.
+#define AREG_LOGS_PRIO  AREG_LOGS_PRIO_INFO
+
+#include "units/GUnitTest.hpp"
+#include "areg/logging/GELog.h"
+
+#include <chrono>
+#include <iostream>
+
+#if AREG_LOGS
+
+namespace
+{
+    //!< The number of evaluated arguments of the log messages.
+    uint32_t _countArguments{ 0 };
+
+    //!< Returns the next argument of the log message.
+    uint32_t _nextArgument( void )
+    {
+        return ++ _countArguments;
+    }
+}
+
+DEF_LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_compiledOut );
+DEF_LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_disabledScope );
+DEF_LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_disabledMessage );
+DEF_LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_anyFormat );
+
+namespace
+{
+    //!< Declares the disabled scope and logs the disabled message.
+    void _logDisabledScope( uint32_t value )
+    {
+        LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_disabledScope );
+        LOG_INFO( "The disabled message with value [ %u ]", value );
+    }
+}
+
+/**
+ * \brief   Checks that the messages with the priority lower than AREG_LOGS_PRIO
+ *          are removed at compile time, so that the arguments are not evaluated
+ *          even if the priority is enabled during runtime.
+ **/
+TEST( LogScopeBenchmark, CompiledOutMessages )
+{
+    _areg_unit_tests_LogScopeBenchmark_compiledOut.setPriority( static_cast<unsigned int>(NELogging::eLogPriority::PrioDebug) );
+    LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_compiledOut );
+    EXPECT_TRUE( _messager.isDbgEnabled( ) );
+
+    _countArguments = 0;
+    LOG_DBG( "The debug message with argument [ %u ]", _nextArgument( ) );
+    EXPECT_EQ( _countArguments, 0u );
+
+    _areg_unit_tests_LogScopeBenchmark_compiledOut.setPriority( static_cast<unsigned int>(NELogging::eLogPriority::PrioNotset) );
+}
+
+/**
+ * \brief   Checks that the logging macros accept any format of the message,
+ *          and only the formats written as string literals are detected as literals.
+ **/
+TEST( LogScopeBenchmark, AnyFormat )
+{
+    const char * pointer{ "The format in the pointer [ %u ]" };
+    const String text( "The format in the string [ %u ]" );
+    char buffer[64]{ "The format in the buffer [ %u ]" };
+
+    EXPECT_TRUE( AREG_LOG_IS_LITERAL( "The literal format [ %u ]", 1u ) );
+    EXPECT_TRUE( AREG_LOG_IS_LITERAL( "The literal format" ) );
+    EXPECT_FALSE( AREG_LOG_IS_LITERAL( pointer, 1u ) );
+    EXPECT_FALSE( AREG_LOG_IS_LITERAL( text.getString( ), 1u ) );
+    EXPECT_FALSE( AREG_LOG_IS_LITERAL( buffer, 1u ) );
+
+    _areg_unit_tests_LogScopeBenchmark_anyFormat.setPriority( static_cast<unsigned int>(NELogging::eLogPriority::PrioWarning) );
+    LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_anyFormat );
+
+    _countArguments = 0;
+    LOG_WARN( "The literal format [ %u ]", _nextArgument( ) );
+    LOG_WARN( pointer, _nextArgument( ) );
+    LOG_WARN( text.getString( ), _nextArgument( ) );
+    LOG_WARN( buffer, _nextArgument( ) );
+    LOG_ERR( "The literal format without arguments" );
+    LOG_ERR( pointer );
+    EXPECT_EQ( _countArguments, 4u );
+
+    _areg_unit_tests_LogScopeBenchmark_anyFormat.setPriority( static_cast<unsigned int>(NELogging::eLogPriority::PrioNotset) );
+}
+
+/**
+ * \brief   Measures the time to declare the disabled scope and to check the disabled
+ *          log message, which is the cost of logging, when the scope is not activated.
+ **/
+TEST( LogScopeBenchmark, DisabledScope )
+{
+    constexpr uint32_t count{ 10'000'000 };
+
+    _areg_unit_tests_LogScopeBenchmark_disabledScope.setPriority( static_cast<unsigned int>(NELogging::eLogPriority::PrioNotset) );
+    _areg_unit_tests_LogScopeBenchmark_disabledMessage.setPriority( static_cast<unsigned int>(NELogging::eLogPriority::PrioWarning) );
+    const unsigned int sessionId{ _areg_unit_tests_LogScopeBenchmark_disabledScope.getSessionId( ) };
+
+    auto begin = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        _logDisabledScope( i );
+    }
+
+    const double elapsedScope{ std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now( ) - begin ).count( ) };
+
+    _countArguments = 0;
+    LOG_SCOPE( areg_unit_tests_LogScopeBenchmark_disabledMessage );
+    begin = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < count; ++ i )
+    {
+        LOG_INFO( "The disabled message with argument [ %u ]", _nextArgument( ) );
+    }
+
+    const double elapsedMessage{ std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now( ) - begin ).count( ) };
+
+    std::cout << "[ BENCHMARK ] calls = " << count
+              << ", disabled scope ns/call = " << elapsedScope / count
+              << ", disabled message ns/call = " << elapsedMessage / count << std::endl;
+
+    // The disabled scope does not start the session.
+    EXPECT_EQ( _areg_unit_tests_LogScopeBenchmark_disabledScope.getSessionId( ), sessionId );
+    EXPECT_EQ( _countArguments, 0u );
+}
+
+#endif  // AREG_LOGS
@@ -0,0 +1,98 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogSqliteDatabaseBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of log messages per second inserted in the SQLite
+ *              log database file depending on the number of rows inserted
+ *              in one transaction.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/DateTime.hpp"
+#include "areg/base/File.hpp"
+#include "areg/logging/NELogging.hpp"
+#include "aregextend/db/LogSqliteDatabase.hpp"
+
+#include <chrono>
+#include <iostream>
+
+// Use these options if compile for Windows with MSVC
+#ifdef _MSC_VER
+#if defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "sqlite3")
+#else   // defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "aregsqlite3")
+#endif  //defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+#endif // _MSC_VER
+
+namespace
+{
+    //!< The number of log messages to insert in the database.
+    constexpr uint32_t  LOG_COUNT   { 5'000 };
+
+    //!< Inserts log messages in the database file and returns the rate of inserted messages.
+    double ingestLogs(const String & dbPath, uint32_t batchRows, const char * journalMode, const char * syncMode, uint32_t & OUT logCount)
+    {
+        constexpr char message[]{ "The benchmark log message inserted in the database." };
+
+        File::deleteFile(dbPath.getString());
+        LogSqliteDatabase database;
+        database.setGroupCommit(batchRows, LogSqliteDatabase::DEFAULT_FLUSH_TIMEOUT);
+        database.setJournalMode(journalMode, syncMode);
+        if (database.connect(dbPath, false) == false)
+            return 0.0;
+
+        NELogging::sLogMessage log(NELogging::eLogMessageType::LogMessageText, 1, 0, 0, NELogging::eLogPriority::PrioDebug, message, static_cast<unsigned int>(sizeof(message) - 1));
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < LOG_COUNT; ++i)
+        {
+            log.logSessionId = i;
+            log.logReceived = static_cast<TIME64>(DateTime::getNow());
+            database.logMessage(log);
+        }
+
+        database.flushLogs();
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // the first log is written when the database is created.
+        logCount = database.countLogEntries() - 1;
+        database.disconnect();
+        File::deleteFile(dbPath.getString());
+        return (static_cast<double>(LOG_COUNT) / elapsed);
+    }
+}
+
+/**
+ * \brief   Measures the log messages per second inserted in the database
+ *          file when each log is committed and when logs are grouped.
+ **/
+TEST(LogSqliteDatabaseBenchmark, IngestionRate)
+{
+    const String dbPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_benchmark.sqlog") };
+
+    uint32_t logCount{ 0 };
+    double rate = ingestLogs(dbPath, 1u, "delete", "full", logCount);
+    std::cout << "[ BENCHMARK ] journal = delete, sync = full, batch rows = 1, logs = " << LOG_COUNT
+              << ", logs/sec = " << static_cast<uint64_t>(rate) << std::endl;
+    EXPECT_EQ(logCount, LOG_COUNT);
+
+    for (uint32_t batchRows : { 1u, 16u, 256u, 1'024u })
+    {
+        rate = ingestLogs(dbPath, batchRows, "wal", "normal", logCount);
+        std::cout << "[ BENCHMARK ] journal = wal, sync = normal, batch rows = " << batchRows
+                  << ", logs = " << LOG_COUNT
+                  << ", logs/sec = " << static_cast<uint64_t>(rate) << std::endl;
+        EXPECT_EQ(logCount, LOG_COUNT);
+    }
+}
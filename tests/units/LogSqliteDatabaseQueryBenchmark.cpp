@@ -0,0 +1,374 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogSqliteDatabaseQueryBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of paged queries of the log database, and benchmark
+ *              of the database size and query latency compared with the
+ *              logs table, which keeps the names of threads and modules
+ *              in each log row.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/File.hpp"
+#include "areg/logging/NELogging.hpp"
+#include "aregextend/db/LogSqliteDatabase.hpp"
+#include "aregextend/db/SqliteDatabase.hpp"
+#include "aregextend/db/SqliteStatement.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string_view>
+
+// Use these options if compile for Windows with MSVC
+#ifdef _MSC_VER
+#if defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "sqlite3")
+#else   // defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "aregsqlite3")
+#endif  //defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+#endif // _MSC_VER
+
+namespace
+{
+    //!< The number of logging instances.
+    constexpr uint32_t  INST_COUNT      { 2 };
+    //!< The number of logging threads of each instance.
+    constexpr uint32_t  THREAD_COUNT    { 4 };
+    //!< The number of scopes of each instance.
+    constexpr uint32_t  SCOPE_COUNT     { 8 };
+    //!< The time of the first log.
+    constexpr TIME64    TIME_FIRST      { 1'000'000 };
+
+    //!< The priorities of generated logs.
+    constexpr NELogging::eLogPriority   LOG_PRIOS[]
+    {
+          NELogging::eLogPriority::PrioDebug
+        , NELogging::eLogPriority::PrioInfo
+        , NELogging::eLogPriority::PrioDebug
+        , NELogging::eLogPriority::PrioWarning
+        , NELogging::eLogPriority::PrioDebug
+        , NELogging::eLogPriority::PrioInfo
+        , NELogging::eLogPriority::PrioDebug
+        , NELogging::eLogPriority::PrioError
+    };
+
+    //!< The logs table and the index of the previous versions of the log database.
+    constexpr std::string_view  LEGACY_SCHEMA[]
+    {
+          "CREATE TABLE \"logs\" (\"id\" INTEGER NOT NULL UNIQUE, \"cookie_id\" INTEGER, \"scope_id\" INTEGER, \"session_id\" INTEGER, "
+          "\"msg_type\" INTEGER, \"msg_prio\" INTEGER, \"msg_module_id\" INTEGER, \"msg_thread_id\" INTEGER, \"msg_log\" TEXT, "
+          "\"msg_thread\" TEXT, \"msg_module\" TEXT, \"time_created\" NUMERIC, \"time_received\" NUMERIC, \"time_duration\" NUMERIC, "
+          "CONSTRAINT \"pk_msg_id\" PRIMARY KEY(\"id\" AUTOINCREMENT));"
+        , "CREATE INDEX \"idx_logs\" ON \"logs\" (\"cookie_id\", \"scope_id\", \"msg_thread_id\");"
+    };
+
+    //!< Inserts a log message in the logs table of previous versions.
+    constexpr std::string_view  LEGACY_INSERT
+    {
+        "INSERT INTO logs (cookie_id, scope_id, session_id, msg_type, msg_prio, msg_module_id, msg_thread_id, msg_log, msg_thread, msg_module, time_created, time_received, time_duration) "
+        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"
+    };
+
+    //!< Reads a page of the logs of the instance with the priorities in the time window from the logs table of previous versions.
+    constexpr std::string_view  LEGACY_QUERY
+    {
+        "SELECT msg_type, msg_prio, cookie_id, msg_module_id, msg_thread_id, time_created, time_received, time_duration, scope_id, session_id, msg_log, msg_thread, msg_module "
+        "FROM logs WHERE cookie_id = ? AND msg_prio IN (?, ?) AND time_created >= ? ORDER BY time_created LIMIT ?;"
+    };
+
+    //!< Returns the size of the database in bytes.
+    uint64_t databaseSize(SqliteDatabase& db)
+    {
+        SqliteStatement stmt(db, "SELECT page_count * page_size FROM pragma_page_count(), pragma_page_size();");
+        return (stmt.next() == SqliteStatement::eQueryResult::HasMore ? stmt.getUint64(0) : 0u);
+    }
+
+    //!< Generates the log message with the specified sequence number.
+    //!< Every two logs have the same time of creation.
+    void makeLog(NELogging::sLogMessage& OUT log, uint32_t seqNr)
+    {
+        constexpr char message[]{ "The log message of the paged query benchmark." };
+
+        const uint32_t inst  { seqNr % INST_COUNT };
+        const uint32_t thread{ (seqNr / INST_COUNT) % THREAD_COUNT };
+        log.logMsgType      = NELogging::eLogMessageType::LogMessageText;
+        log.logMessagePrio  = LOG_PRIOS[seqNr % MACRO_ARRAYLEN(LOG_PRIOS)];
+        log.logCookie       = static_cast<ITEM_ID>(NEService::COOKIE_REMOTE_SERVICE + inst);
+        log.logModuleId     = static_cast<ITEM_ID>(1'000 + inst);
+        log.logThreadId     = static_cast<ITEM_ID>(140'000'000'000'000ull + inst * 100 + thread);
+        log.logScopeId      = (seqNr / (INST_COUNT * THREAD_COUNT)) % SCOPE_COUNT + 1;
+        log.logSessionId    = seqNr;
+        log.logTimestamp    = TIME_FIRST + seqNr / 2;
+        log.logReceived     = log.logTimestamp + 10;
+        log.logDuration     = 0;
+        log.logMessageLen   = NEMemory::memCopy(log.logMessage, NELogging::LOG_MESSAGE_IZE - 1, message, static_cast<uint32_t>(sizeof(message) - 1));
+        log.logMessage[log.logMessageLen] = String::EmptyChar;
+
+        const String threadName{ String("_BenchmarkWorkerThread_") + String::makeString(thread) };
+        log.logThreadLen    = NEMemory::memCopy(log.logThread, NELogging::LOG_NAMES_SIZE - 1, threadName.getString(), threadName.getLength());
+        log.logThread[log.logThreadLen] = String::EmptyChar;
+
+        const String moduleName{ String("benchmark_module_") + String::makeString(inst) };
+        log.logModuleLen    = NEMemory::memCopy(log.logModule, NELogging::LOG_NAMES_SIZE - 1, moduleName.getString(), moduleName.getLength());
+        log.logModule[log.logModuleLen] = String::EmptyChar;
+    }
+
+    //!< Creates the log database and inserts the logs.
+    bool createDatabase(LogSqliteDatabase& OUT database, const String& dbPath, uint32_t logCount)
+    {
+        File::deleteFile(dbPath.getString());
+        if (database.connect(dbPath, false) == false)
+            return false;
+
+        NELogging::sLogMessage log;
+        for (uint32_t i = 0; i < logCount; ++ i)
+        {
+            makeLog(log, i);
+            database.logMessage(log);
+        }
+
+        database.flushLogs();
+        return true;
+    }
+
+    //!< Creates the log database of previous versions and inserts the logs.
+    bool createLegacyDatabase(SqliteDatabase& OUT database, const String& dbPath, uint32_t logCount)
+    {
+        File::deleteFile(dbPath.getString());
+        if (database.connect(dbPath, false) == false)
+            return false;
+
+        for (const std::string_view& sql : LEGACY_SCHEMA)
+        {
+            database.execute(sql);
+        }
+
+        NELogging::sLogMessage log;
+        SqliteStatement stmt(database, LEGACY_INSERT);
+        database.begin();
+        for (uint32_t i = 0; i < logCount; ++ i)
+        {
+            makeLog(log, i);
+            stmt.bindUint64( 0, static_cast<uint64_t>(log.logCookie));
+            stmt.bindUint32( 1, log.logScopeId);
+            stmt.bindUint32( 2, log.logSessionId);
+            stmt.bindUint32( 3, static_cast<uint32_t>(log.logMsgType));
+            stmt.bindUint32( 4, static_cast<uint32_t>(log.logMessagePrio));
+            stmt.bindUint64( 5, static_cast<uint64_t>(log.logModuleId));
+            stmt.bindUint64( 6, static_cast<uint64_t>(log.logThreadId));
+            stmt.bindText(   7, log.logMessage);
+            stmt.bindText(   8, log.logThread);
+            stmt.bindText(   9, log.logModule);
+            stmt.bindUint64(10, static_cast<uint64_t>(log.logTimestamp));
+            stmt.bindUint64(11, static_cast<uint64_t>(log.logReceived));
+            stmt.bindUint32(12, log.logDuration);
+            stmt.next();
+            stmt.reset();
+            stmt.clearBindings();
+        }
+
+        stmt.finalize();
+        database.commit(true);
+        return true;
+    }
+
+    //!< Returns true if the log matches the filter.
+    bool isMatchingLog(const NELogging::sLogMessage& log, const LogSqliteDatabase::sLogFilter& filter)
+    {
+        bool hasScope{ filter.filterScopes.empty() };
+        for (uint32_t scopeId : filter.filterScopes)
+        {
+            hasScope = hasScope || (scopeId == log.logScopeId);
+        }
+
+        return hasScope
+            && ((static_cast<uint32_t>(log.logMessagePrio) & filter.filterPrio) != 0)
+            && ((filter.filterInstance == NEService::COOKIE_ANY) || (filter.filterInstance == log.logCookie))
+            && ((filter.filterTimeBegin == 0) || (log.logTimestamp >= filter.filterTimeBegin))
+            && ((filter.filterTimeEnd == 0) || (log.logTimestamp <= filter.filterTimeEnd));
+    }
+}
+
+/**
+ * \brief   Reads the logs by pages with the filter and checks that each
+ *          matching log is read once in the order of creation.
+ **/
+TEST(LogSqliteDatabaseQueryBenchmark, PagedQueries)
+{
+    constexpr uint32_t logCount{ 2'000 };
+    constexpr uint32_t pageSize{ 64 };
+    const String dbPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_paged_query.sqlog") };
+
+    LogSqliteDatabase database;
+    ASSERT_TRUE(createDatabase(database, dbPath, logCount));
+
+    LogSqliteDatabase::sLogFilter filter;
+    filter.filterTimeBegin  = TIME_FIRST + 100;
+    filter.filterTimeEnd    = TIME_FIRST + 900;
+    filter.filterPrio       = static_cast<uint32_t>(NELogging::eLogPriority::PrioWarning) | static_cast<uint32_t>(NELogging::eLogPriority::PrioError) | static_cast<uint32_t>(NELogging::eLogPriority::PrioInfo);
+    filter.filterInstance   = NEService::COOKIE_REMOTE_SERVICE + 1;
+    filter.filterScopes     = { 1, 3, 4 };
+
+    uint32_t expected{ 0 };
+    NELogging::sLogMessage log;
+    for (uint32_t i = 0; i < logCount; ++ i)
+    {
+        makeLog(log, i);
+        expected += isMatchingLog(log, filter) ? 1 : 0;
+    }
+
+    ASSERT_NE(expected, 0u);
+
+    LogSqliteDatabase::sLogPageKey pageKey;
+    std::vector<SharedBuffer> page;
+    uint32_t received{ 0 };
+    int64_t lastSession{ -1 };
+    TIME64 lastTime{ 0 };
+    uint32_t count{ 0 };
+    do
+    {
+        count = database.getLogMessagesPage(page, filter, pageKey, pageSize);
+        for (const SharedBuffer& buf : page)
+        {
+            const NELogging::sLogMessage* msg{ reinterpret_cast<const NELogging::sLogMessage*>(buf.getBuffer()) };
+            ASSERT_NE(msg, nullptr);
+            EXPECT_TRUE(isMatchingLog(*msg, filter));
+            EXPECT_GE(msg->logTimestamp, lastTime);
+            EXPECT_GT(static_cast<int64_t>(msg->logSessionId), lastSession);
+            EXPECT_EQ(String(msg->logThread).startsWith("_BenchmarkWorkerThread_"), true);
+            EXPECT_EQ(String(msg->logModule), String("benchmark_module_1"));
+            lastTime = msg->logTimestamp;
+            lastSession = static_cast<int64_t>(msg->logSessionId);
+        }
+
+        received += count;
+    } while (count == pageSize);
+
+    EXPECT_EQ(received, expected);
+
+    // the names are saved once per thread and per module.
+    EXPECT_EQ(static_cast<uint32_t>(database.getLogThreadNames().size()), THREAD_COUNT + 1);
+    EXPECT_EQ(database.countLogEntries(), logCount + 1);
+
+    database.disconnect();
+    File::deleteFile(dbPath.getString());
+}
+
+/**
+ * \brief   Opens the log database of previous versions, which keeps the
+ *          names of threads and modules in the logs table, and checks that
+ *          the logs are read and inserted.
+ **/
+TEST(LogSqliteDatabaseQueryBenchmark, PreviousVersionDatabase)
+{
+    constexpr uint32_t logCount{ 200 };
+    const String dbPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_legacy_query.sqlog") };
+
+    SqliteDatabase legacy;
+    ASSERT_TRUE(createLegacyDatabase(legacy, dbPath, logCount));
+    legacy.disconnect();
+
+    LogSqliteDatabase database;
+    ASSERT_TRUE(database.connect(dbPath, true));
+    EXPECT_EQ(static_cast<uint32_t>(database.getLogMessages().size()), logCount);
+    database.disconnect();
+
+    ASSERT_TRUE(database.connect(dbPath, false));
+    EXPECT_EQ(static_cast<uint32_t>(database.getLogMessages().size()), logCount);
+    EXPECT_EQ(static_cast<uint32_t>(database.getLogThreadNames().size()), THREAD_COUNT);
+
+    NELogging::sLogMessage log;
+    makeLog(log, logCount);
+    EXPECT_TRUE(database.logMessage(log));
+
+    LogSqliteDatabase::sLogFilter filter;
+    filter.filterTimeBegin = log.logTimestamp;
+    LogSqliteDatabase::sLogPageKey pageKey;
+    std::vector<SharedBuffer> page;
+    ASSERT_EQ(database.getLogMessagesPage(page, filter, pageKey, 10), 1u);
+    const NELogging::sLogMessage* msg{ reinterpret_cast<const NELogging::sLogMessage*>(page[0].getBuffer()) };
+    EXPECT_EQ(msg->logSessionId, logCount);
+    EXPECT_EQ(String(msg->logThread), String(log.logThread));
+
+    database.disconnect();
+    File::deleteFile(dbPath.getString());
+}
+
+/**
+ * \brief   Compares the size of the database per logs and the latency of
+ *          the query of the page of logs of the instance with priorities
+ *          in the time window.
+ **/
+TEST(LogSqliteDatabaseQueryBenchmark, SizeAndLatency)
+{
+    constexpr uint32_t logCount { 50'000 };
+    constexpr uint32_t pageSize { 100 };
+    constexpr uint32_t queries  { 100 };
+    const String dbPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_query_benchmark.sqlog") };
+    const String legacyPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_legacy_benchmark.sqlog") };
+
+    LogSqliteDatabase database;
+    SqliteDatabase legacy;
+    ASSERT_TRUE(createDatabase(database, dbPath, logCount));
+    ASSERT_TRUE(createLegacyDatabase(legacy, legacyPath, logCount));
+
+    const uint64_t dbSize{ databaseSize(database.getDatabase()) };
+    const uint64_t legacySize{ databaseSize(legacy) };
+
+    LogSqliteDatabase::sLogFilter filter;
+    filter.filterPrio       = static_cast<uint32_t>(NELogging::eLogPriority::PrioWarning) | static_cast<uint32_t>(NELogging::eLogPriority::PrioError);
+    filter.filterInstance   = NEService::COOKIE_REMOTE_SERVICE + 1;
+    std::vector<SharedBuffer> page;
+    uint32_t received{ 0 };
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < queries; ++ i)
+    {
+        filter.filterTimeBegin = TIME_FIRST + (logCount / 2 / queries) * i;
+        LogSqliteDatabase::sLogPageKey pageKey;
+        received += database.getLogMessagesPage(page, filter, pageKey, pageSize);
+    }
+
+    auto dbTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t legacyReceived{ 0 };
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < queries; ++ i)
+    {
+        SqliteStatement stmt(legacy, LEGACY_QUERY);
+        stmt.bindUint64(0, static_cast<uint64_t>(filter.filterInstance));
+        stmt.bindUint32(1, static_cast<uint32_t>(NELogging::eLogPriority::PrioWarning));
+        stmt.bindUint32(2, static_cast<uint32_t>(NELogging::eLogPriority::PrioError));
+        stmt.bindUint64(3, static_cast<uint64_t>(TIME_FIRST + (logCount / 2 / queries) * i));
+        stmt.bindUint32(4, pageSize);
+        page.clear();
+        legacyReceived += static_cast<uint32_t>(LogSqliteDatabase::getLogMessages(page, stmt));
+    }
+
+    auto legacyTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "[ BENCHMARK ] logs = " << logCount
+              << ", names in logs: bytes/log = " << (legacySize / logCount)
+              << ", page query ms = " << static_cast<uint64_t>(legacyTime)
+              << "; names in tables: bytes/log = " << (dbSize / logCount)
+              << ", page query ms = " << static_cast<uint64_t>(dbTime) << std::endl;
+
+    EXPECT_EQ(received, legacyReceived);
+    EXPECT_LT(dbSize, legacySize);
+
+    database.disconnect();
+    legacy.disconnect();
+    File::deleteFile(dbPath.getString());
+    File::deleteFile(legacyPath.getString());
+}
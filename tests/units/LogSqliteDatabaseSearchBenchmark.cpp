@@ -0,0 +1,233 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/LogSqliteDatabaseSearchBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the text search of log messages, and benchmark
+ *              of the search latency with the full-text search index
+ *              compared with the scan of the log messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/File.hpp"
+#include "areg/logging/NELogging.hpp"
+#include "aregextend/db/LogSqliteDatabase.hpp"
+
+#include <chrono>
+#include <iostream>
+
+// Use these options if compile for Windows with MSVC
+#ifdef _MSC_VER
+#if defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "sqlite3")
+#else   // defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+    #pragma comment(lib, "aregsqlite3")
+#endif  //defined(USE_SQLITE_PACKAGE) && (USE_SQLITE_PACKAGE != 0)
+#endif // _MSC_VER
+
+namespace
+{
+    //!< The number of logging instances.
+    constexpr uint32_t  INST_COUNT      { 2 };
+    //!< The time of the first log.
+    constexpr TIME64    TIME_FIRST      { 1'000'000 };
+    //!< Each this log has the searched text.
+    constexpr uint32_t  SEARCH_EACH     { 50 };
+
+    //!< Generates the log message with the specified sequence number.
+    //!< Each SEARCH_EACH log contains the text "connection refused".
+    void makeLog(NELogging::sLogMessage& OUT log, uint32_t seqNr)
+    {
+        const uint32_t inst{ seqNr % INST_COUNT };
+        const String message{ (seqNr % SEARCH_EACH) == 0
+                                ? String("Failed to connect the service, connection refused by host, 100% of attempts, session ") + String::makeString(seqNr)
+                                : String("Processed the request of the client, session ") + String::makeString(seqNr) };
+
+        log.logMsgType      = NELogging::eLogMessageType::LogMessageText;
+        log.logMessagePrio  = (seqNr % 2) == 0 ? NELogging::eLogPriority::PrioError : NELogging::eLogPriority::PrioDebug;
+        log.logCookie       = static_cast<ITEM_ID>(NEService::COOKIE_REMOTE_SERVICE + inst);
+        log.logModuleId     = static_cast<ITEM_ID>(1'000 + inst);
+        log.logThreadId     = static_cast<ITEM_ID>(140'000'000'000'000ull + inst);
+        log.logScopeId      = 1;
+        log.logSessionId    = seqNr;
+        log.logTimestamp    = TIME_FIRST + seqNr;
+        log.logReceived     = log.logTimestamp + 10;
+        log.logDuration     = 0;
+        log.logMessageLen   = NEMemory::memCopy(log.logMessage, NELogging::LOG_MESSAGE_IZE - 1, message.getString(), message.getLength());
+        log.logMessage[log.logMessageLen] = String::EmptyChar;
+        log.logThreadLen    = NEMemory::memCopy(log.logThread, NELogging::LOG_NAMES_SIZE - 1, "search_thread", 13);
+        log.logThread[log.logThreadLen] = String::EmptyChar;
+        log.logModuleLen    = NEMemory::memCopy(log.logModule, NELogging::LOG_NAMES_SIZE - 1, "search_module", 13);
+        log.logModule[log.logModuleLen] = String::EmptyChar;
+    }
+
+    //!< Creates the log database and inserts the logs.
+    bool createDatabase(LogSqliteDatabase& OUT database, const String& dbPath, uint32_t logCount, bool withSearch)
+    {
+        File::deleteFile(dbPath.getString());
+        database.setSearchEnabled(withSearch);
+        if (database.connect(dbPath, false) == false)
+            return false;
+
+        NELogging::sLogMessage log;
+        for (uint32_t i = 0; i < logCount; ++ i)
+        {
+            makeLog(log, i);
+            database.logMessage(log);
+        }
+
+        database.flushLogs();
+        return true;
+    }
+
+    //!< Reads all found log messages by pages and returns the number of found logs.
+    uint32_t searchAll(LogSqliteDatabase& database, const String& text, const LogSqliteDatabase::sLogFilter& filter, uint32_t pageSize)
+    {
+        std::vector<SharedBuffer> page;
+        uint32_t result{ 0 };
+        uint32_t count{ 0 };
+        do
+        {
+            count = database.searchLogMessages(page, text, filter, result, pageSize);
+            for (const SharedBuffer& buf : page)
+            {
+                const NELogging::sLogMessage* msg{ reinterpret_cast<const NELogging::sLogMessage*>(buf.getBuffer()) };
+                EXPECT_NE(String(msg->logMessage).findFirst(text), NEString::INVALID_POS);
+                EXPECT_TRUE((filter.filterInstance == NEService::COOKIE_ANY) || (filter.filterInstance == msg->logCookie));
+                EXPECT_NE(static_cast<uint32_t>(msg->logMessagePrio) & filter.filterPrio, 0u);
+            }
+
+            result += count;
+        } while (count == pageSize);
+
+        return result;
+    }
+}
+
+/**
+ * \brief   Searches the text in logs by pages with and without the
+ *          full-text search index, and checks that the same logs are found.
+ *          Checks that the index is caught up with logs inserted after
+ *          the search, and the database opened in read-only mode.
+ **/
+TEST(LogSqliteDatabaseSearchBenchmark, SearchWithFilter)
+{
+    constexpr uint32_t logCount{ 2'000 };
+    constexpr uint32_t pageSize{ 7 };
+    const String dbPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_search.sqlog") };
+    const String scanPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_search_scan.sqlog") };
+
+    LogSqliteDatabase database;
+    LogSqliteDatabase scan;
+    ASSERT_TRUE(createDatabase(database, dbPath, logCount, true));
+    ASSERT_TRUE(createDatabase(scan, scanPath, logCount, false));
+    ASSERT_TRUE(database.hasSearchIndex());
+    ASSERT_FALSE(scan.hasSearchIndex());
+
+    LogSqliteDatabase::sLogFilter filter;
+    const String text{ "connection refused" };
+    EXPECT_EQ(searchAll(database, text, filter, pageSize), logCount / SEARCH_EACH);
+    EXPECT_EQ(searchAll(scan, text, filter, pageSize), logCount / SEARCH_EACH);
+
+    // special characters of the search are escaped.
+    EXPECT_EQ(searchAll(scan, "100%", filter, pageSize), logCount / SEARCH_EACH);
+    EXPECT_EQ(searchAll(scan, "_", filter, pageSize), 0u);
+    std::vector<SharedBuffer> found;
+    EXPECT_EQ(database.searchLogMessages(found, "\"refused\" by", filter, 0, logCount), logCount / SEARCH_EACH);
+
+    filter.filterInstance   = NEService::COOKIE_REMOTE_SERVICE + 1;
+    EXPECT_EQ(searchAll(database, text, filter, pageSize), 0u);
+    filter.filterInstance   = NEService::COOKIE_REMOTE_SERVICE;
+    filter.filterTimeBegin  = TIME_FIRST + logCount / 2;
+    filter.filterPrio       = static_cast<uint32_t>(NELogging::eLogPriority::PrioError);
+    EXPECT_EQ(searchAll(database, text, filter, pageSize), logCount / SEARCH_EACH / 2);
+    EXPECT_EQ(searchAll(scan, text, filter, pageSize), logCount / SEARCH_EACH / 2);
+
+    // the logs inserted after the last search are found.
+    NELogging::sLogMessage log;
+    makeLog(log, logCount * SEARCH_EACH);
+    EXPECT_TRUE(database.logMessage(log));
+    EXPECT_EQ(searchAll(database, text, filter, pageSize), logCount / SEARCH_EACH / 2 + 1);
+
+    database.disconnect();
+    ASSERT_TRUE(database.connect(dbPath, true));
+    EXPECT_TRUE(database.hasSearchIndex());
+    EXPECT_EQ(searchAll(database, text, LogSqliteDatabase::sLogFilter{}, pageSize), logCount / SEARCH_EACH + 1);
+
+    database.disconnect();
+    scan.disconnect();
+    File::deleteFile(dbPath.getString());
+    File::deleteFile(scanPath.getString());
+}
+
+/**
+ * \brief   Compares the latency of the search of the text in logs with
+ *          the full-text search index and with the scan of log messages,
+ *          and the time to insert logs when the index is enabled.
+ **/
+TEST(LogSqliteDatabaseSearchBenchmark, SearchLatency)
+{
+    constexpr uint32_t logCount { 50'000 };
+    constexpr uint32_t pageSize { 100 };
+    constexpr uint32_t queries  { 20 };
+    const String dbPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_search_benchmark.sqlog") };
+    const String scanPath{ File::makeFileFullPath(File::getSpecialDir(File::eSpecialFolder::SpecialTemp), "areg_log_scan_benchmark.sqlog") };
+
+    LogSqliteDatabase database;
+    LogSqliteDatabase scan;
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(createDatabase(scan, scanPath, logCount, false));
+    auto scanInsert = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(createDatabase(database, dbPath, logCount, true));
+    auto dbInsert = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // the first search completes the index of the logs, which are not indexed in background yet.
+    LogSqliteDatabase::sLogFilter filter;
+    std::vector<SharedBuffer> page;
+    EXPECT_EQ(database.searchLogMessages(page, "connection refused", filter, 0, pageSize), pageSize);
+
+    uint32_t received{ 0 };
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < queries; ++ i)
+    {
+        received += database.searchLogMessages(page, "connection refused", filter, i * pageSize, pageSize);
+    }
+
+    auto dbTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t scanReceived{ 0 };
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < queries; ++ i)
+    {
+        scanReceived += scan.searchLogMessages(page, "connection refused", filter, i * pageSize, pageSize);
+    }
+
+    auto scanTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "[ BENCHMARK ] logs = " << logCount
+              << ", scan: insert ms = " << static_cast<uint64_t>(scanInsert)
+              << ", search ms = " << static_cast<uint64_t>(scanTime)
+              << "; index: insert ms = " << static_cast<uint64_t>(dbInsert)
+              << ", search ms = " << static_cast<uint64_t>(dbTime) << std::endl;
+
+    EXPECT_EQ(received, scanReceived);
+    EXPECT_EQ(received, (logCount / SEARCH_EACH < queries * pageSize ? logCount / SEARCH_EACH : queries * pageSize));
+
+    database.disconnect();
+    scan.disconnect();
+    File::deleteFile(dbPath.getString());
+    File::deleteFile(scanPath.getString());
+}
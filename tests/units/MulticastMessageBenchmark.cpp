@@ -0,0 +1,173 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/MulticastMessageBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of bytes serialized by the service provider to
+ *              notify remote subscribers about an attribute update, when
+ *              the message is created per subscriber and when one
+ *              multicast message is created for all subscribers.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/TEArrayList.hpp"
+#include "areg/component/Channel.hpp"
+#include "areg/component/EventDataStream.hpp"
+#include "areg/component/ProxyAddress.hpp"
+#include "areg/component/RemoteEventFactory.hpp"
+#include "areg/component/ResponseEvents.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+//!< The attribute update event sent to remote subscribers.
+class BenchmarkUpdateEvent  : public RemoteResponseEvent
+{
+    DECLARE_RUNTIME_EVENT(BenchmarkUpdateEvent)
+
+public:
+    BenchmarkUpdateEvent( const EventDataStream & args, const ProxyAddress & target, unsigned int updateId )
+        : RemoteResponseEvent( args, target, NEService::eResultType::DataOK, updateId )
+    {
+    }
+
+    virtual ~BenchmarkUpdateEvent( void ) = default;
+};
+
+IMPLEMENT_RUNTIME_EVENT(BenchmarkUpdateEvent, RemoteResponseEvent)
+
+namespace
+{
+    //!< The source cookie of the service provider.
+    constexpr ITEM_ID   PROVIDER_COOKIE { NEService::COOKIE_REMOTE_SERVICE };
+
+    //!< Returns the address of remote subscriber with the given cookie.
+    ProxyAddress subscriberAddress( ITEM_ID cookie )
+    {
+        ProxyAddress addrProxy( "BenchmarkService", Version( 1, 0, 0 ), NEService::eServiceType::ServicePublic, "subscriber", "thread" );
+        addrProxy.setCookie( cookie );
+        addrProxy.setSource( cookie );
+        return addrProxy;
+    }
+}
+
+/**
+ * \brief   Compares the bytes and the time to serialize an attribute update
+ *          for each remote subscriber, and once as a multicast message.
+ **/
+TEST( MulticastMessageBenchmark, UpdateSerialization )
+{
+    constexpr uint32_t payloadSize{ 100 * 1'024 };
+    constexpr uint32_t updateId{ static_cast<uint32_t>(NEService::eFuncIdRange::AttributeFirstId) };
+
+    EventDataStream args( EventDataStream::eEventData::EventDataExternal );
+    std::vector<unsigned char> payload( payloadSize, static_cast<unsigned char>('A') );
+    args.getStreamForWrite( ).write( payload.data( ), payloadSize );
+
+    const Channel channel( PROVIDER_COOKIE, NEService::COOKIE_ROUTER, PROVIDER_COOKIE );
+    for ( uint32_t subscribers : { 1u, 10u, 50u } )
+    {
+        std::vector<ProxyAddress> targets;
+        for ( uint32_t i = 0; i < subscribers; ++ i )
+        {
+            targets.push_back( subscriberAddress( PROVIDER_COOKIE + 1 + i ) );
+        }
+
+        uint64_t unicastBytes{ 0 };
+        auto start = std::chrono::steady_clock::now( );
+        for ( const ProxyAddress & target : targets )
+        {
+            BenchmarkUpdateEvent update( args, target, updateId );
+            RemoteMessage msg;
+            ASSERT_TRUE( RemoteEventFactory::createStreamFromEvent( msg, update, channel ) );
+            msg.bufferCompletionFix( );
+            unicastBytes += msg.getSizeUsed( );
+        }
+
+        auto unicastTime = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+
+        start = std::chrono::steady_clock::now( );
+        BenchmarkUpdateEvent update( args, targets[0], updateId );
+        for ( uint32_t i = 1; i < subscribers; ++ i )
+        {
+            update.addMulticastTarget( targets[i] );
+        }
+
+        RemoteMessage msg;
+        ASSERT_TRUE( RemoteEventFactory::createStreamFromEvent( msg, update, channel ) );
+        msg.bufferCompletionFix( );
+        const uint64_t multicastBytes{ msg.getSizeUsed( ) };
+        auto multicastTime = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+
+        std::cout << "[ BENCHMARK ] subscribers = " << subscribers
+                  << ", per subscriber bytes = " << unicastBytes
+                  << ", time us = " << static_cast<uint64_t>(unicastTime)
+                  << "; multicast bytes = " << multicastBytes
+                  << ", time us = " << static_cast<uint64_t>(multicastTime) << std::endl;
+
+        // a single subscriber is notified by the ordinary message.
+        TEArrayList<ITEM_ID> cookies;
+        EXPECT_EQ( RemoteEventFactory::getMulticastTargets( msg, cookies ), subscribers > 1 ? subscribers : 0u );
+        EXPECT_LT( multicastBytes, static_cast<uint64_t>(payloadSize) * 2 );
+    }
+}
+
+/**
+ * \brief   Checks that the multicast message is split to the messages of each target proxy
+ *          of the connection, which does not process the multicast messages, and that the
+ *          messages are same as the messages sent to the single target.
+ **/
+TEST( MulticastMessageBenchmark, SplitForTarget )
+{
+    constexpr uint32_t updateId{ static_cast<uint32_t>(NEService::eFuncIdRange::AttributeFirstId) + 1 };
+    constexpr ITEM_ID oldClient{ PROVIDER_COOKIE + 1 };
+    constexpr ITEM_ID newClient{ PROVIDER_COOKIE + 2 };
+
+    EventDataStream args( EventDataStream::eEventData::EventDataExternal );
+    args.getStreamForWrite( ) << String( "attribute value" );
+
+    ProxyAddress second( subscriberAddress( oldClient ) );
+    second.setRoleName( "second" );
+    const ProxyAddress targets[]{ subscriberAddress( oldClient ), subscriberAddress( newClient ), second };
+
+    const Channel channel( PROVIDER_COOKIE, NEService::COOKIE_ROUTER, PROVIDER_COOKIE );
+    BenchmarkUpdateEvent update( args, targets[0], updateId );
+    update.addMulticastTarget( targets[1] );
+    update.addMulticastTarget( targets[2] );
+
+    RemoteMessage multicast;
+    ASSERT_TRUE( RemoteEventFactory::createStreamFromEvent( multicast, update, channel ) );
+    multicast.bufferCompletionFix( );
+
+    TEArrayList<RemoteMessage> messages;
+    ASSERT_EQ( RemoteEventFactory::createStreamsFromMulticastStream( multicast, oldClient, messages ), 2u );
+    for ( uint32_t i = 0; i < messages.getSize( ); ++ i )
+    {
+        BenchmarkUpdateEvent single( args, targets[i == 0 ? 0 : 2], updateId );
+        RemoteMessage expected;
+        ASSERT_TRUE( RemoteEventFactory::createStreamFromEvent( expected, single, channel ) );
+
+        const RemoteMessage & msg = messages[i];
+        EXPECT_EQ( msg.getMessageId( ), updateId );
+        EXPECT_EQ( msg.getTarget( ), oldClient );
+        EXPECT_EQ( msg.getSource( ), PROVIDER_COOKIE );
+        ASSERT_EQ( msg.getSizeUsed( ), expected.getSizeUsed( ) );
+        EXPECT_TRUE( NEMemory::memEqual( msg.getBuffer( ), expected.getBuffer( ), expected.getSizeUsed( ) ) );
+    }
+
+    EXPECT_EQ( RemoteEventFactory::createStreamsFromMulticastStream( multicast, newClient, messages ), 1u );
+    const RemoteMessage unicast{ messages[0] };
+    EXPECT_EQ( RemoteEventFactory::createStreamsFromMulticastStream( unicast, newClient, messages ), 0u );
+}
@@ -0,0 +1,187 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/NESocketTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of NESocket functions sending data over the loopback connection.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NESocket.hpp"
+
+#include <csignal>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The port number of the loopback test server.
+    constexpr unsigned short    LOOPBACK_PORT   { 18'585 };
+
+    //!< The connected loopback pair of sockets.
+    struct LoopbackPair
+    {
+        LoopbackPair( void )
+            : mServer   ( NESocket::InvalidSocketHandle )
+            , mClient   ( NESocket::InvalidSocketHandle )
+            , mAccepted ( NESocket::InvalidSocketHandle )
+        {
+            NESocket::socketInitialize( );
+            mServer = NESocket::serverSocketConnect( NESocket::LocalAddress, LOOPBACK_PORT );
+            if ( NESocket::isSocketHandleValid( mServer ) && NESocket::serverListenConnection( mServer ) )
+            {
+                mClient = NESocket::clientSocketConnect( NESocket::LocalAddress, LOOPBACK_PORT );
+                if ( NESocket::isSocketHandleValid( mClient ) )
+                {
+                    const SOCKETHANDLE accepted[]{ NESocket::InvalidSocketHandle };
+                    mAccepted = NESocket::serverAcceptConnection( mServer, accepted, 0 );
+                }
+            }
+        }
+
+        ~LoopbackPair( void )
+        {
+            NESocket::socketClose( mAccepted );
+            NESocket::socketClose( mClient );
+            NESocket::socketClose( mServer );
+            NESocket::socketRelease( );
+        }
+
+        bool isValid( void ) const
+        {
+            return NESocket::isSocketHandleValid( mClient ) && NESocket::isSocketHandleValid( mAccepted );
+        }
+
+        SOCKETHANDLE    mServer;
+        SOCKETHANDLE    mClient;
+        SOCKETHANDLE    mAccepted;
+    };
+}
+
+/**
+ * \brief   Sends more buffers than passed to the system at once and more data than
+ *          fits into the socket buffers, so that the partial writes are continued,
+ *          and checks that the data is received complete and in the right order.
+ **/
+TEST( NESocketTest, SendDataVector )
+{
+    constexpr uint32_t bufferCount{ 3 * NESocket::MAX_SEND_BUFFERS + 7 };
+
+    LoopbackPair sockets;
+    ASSERT_TRUE( sockets.isValid( ) );
+
+    std::vector<std::vector<unsigned char>> data( bufferCount );
+    std::vector<NESocket::sSendBuffer> buffers( bufferCount );
+    uint32_t total{ 0 };
+    for ( uint32_t i = 0; i < bufferCount; ++ i )
+    {
+        // mix empty, small and large buffers.
+        uint32_t length = (i % 11 == 0) ? 0 : ((i % 5 == 0) ? 16'384 + i : 24 + i % 97);
+        data[i].resize( length );
+        for ( uint32_t j = 0; j < length; ++ j )
+        {
+            data[i][j] = static_cast<unsigned char>(i + j);
+        }
+
+        buffers[i].sbData   = data[i].data( );
+        buffers[i].sbLength = length;
+        total += length;
+    }
+
+    std::vector<unsigned char> received( total );
+    int receivedBytes{ 0 };
+    std::thread receiver( [&]( )
+        {
+            receivedBytes = NESocket::receiveData( sockets.mAccepted, received.data( ), total, 0 );
+        } );
+
+    uint32_t sentBuffers{ 0 };
+    int sentBytes = NESocket::sendDataVector( sockets.mClient, buffers.data( ), bufferCount, &sentBuffers );
+    receiver.join( );
+
+    EXPECT_EQ( sentBytes, static_cast<int>(total) );
+    EXPECT_EQ( sentBuffers, bufferCount );
+    ASSERT_EQ( receivedBytes, static_cast<int>(total) );
+
+    std::vector<unsigned char> expected;
+    expected.reserve( total );
+    for ( const auto & buffer : data )
+    {
+        expected.insert( expected.end( ), buffer.begin( ), buffer.end( ) );
+    }
+
+    EXPECT_TRUE( expected == received );
+}
+
+/**
+ * \brief   Checks the invalid parameters of sending vector of buffers.
+ **/
+TEST( NESocketTest, SendDataVectorInvalid )
+{
+    NESocket::sSendBuffer buffer{ nullptr, 0 };
+
+    uint32_t sentBuffers{ 1 };
+    EXPECT_LT( NESocket::sendDataVector( NESocket::InvalidSocketHandle, &buffer, 1, &sentBuffers ), 0 );
+    EXPECT_EQ( sentBuffers, 0u );
+
+    LoopbackPair sockets;
+    ASSERT_TRUE( sockets.isValid( ) );
+    EXPECT_EQ( NESocket::sendDataVector( sockets.mClient, nullptr, 0 ), 0 );
+    EXPECT_EQ( NESocket::sendDataVector( sockets.mClient, &buffer, 1 ), 0 );
+}
+
+/**
+ * \brief   Closes the receiving socket while the buffers are sent, and checks
+ *          that the number of completely sent buffers is reported. The buffers,
+ *          which are received by the remote side, are sent completely.
+ **/
+TEST( NESocketTest, SendDataVectorFailure )
+{
+    constexpr uint32_t bufferCount{ 256 };
+    constexpr uint32_t bufferSize{ 1'024 * 1'024 };
+    constexpr uint32_t receiveSize{ 4 * bufferSize + bufferSize / 2 };
+
+#ifndef _WIN32
+    // the failed sending must not stop the test.
+    void (*oldHandler)(int) = signal( SIGPIPE, SIG_IGN );
+#endif  // _WIN32
+
+    LoopbackPair sockets;
+    ASSERT_TRUE( sockets.isValid( ) );
+
+    // the buffers share the data, nothing is verified on the remote side.
+    std::vector<unsigned char> data( bufferSize, static_cast<unsigned char>(0xA5) );
+    std::vector<NESocket::sSendBuffer> buffers( bufferCount, NESocket::sSendBuffer{ data.data( ), bufferSize } );
+
+    std::vector<unsigned char> received( receiveSize );
+    int receivedBytes{ 0 };
+    std::thread receiver( [&]( )
+        {
+            receivedBytes = NESocket::receiveData( sockets.mAccepted, received.data( ), receiveSize, 0 );
+            NESocket::socketClose( sockets.mAccepted );
+            sockets.mAccepted = NESocket::InvalidSocketHandle;
+        } );
+
+    uint32_t sentBuffers{ bufferCount };
+    int sentBytes = NESocket::sendDataVector( sockets.mClient, buffers.data( ), bufferCount, &sentBuffers );
+    receiver.join( );
+
+#ifndef _WIN32
+    signal( SIGPIPE, oldHandler );
+#endif  // _WIN32
+
+    EXPECT_LT( sentBytes, 0 );
+    EXPECT_EQ( receivedBytes, static_cast<int>(receiveSize) );
+    EXPECT_GE( sentBuffers, receiveSize / bufferSize );
+    EXPECT_LT( sentBuffers, bufferCount );
+}
@@ -0,0 +1,131 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/RuntimeClassBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the runtime class identifiers and benchmark of the
+ *              runtime casting of objects of a deep class hierarchy.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/RuntimeObject.hpp"
+
+#include <chrono>
+#include <iostream>
+
+//!< The root class of the benchmark hierarchy.
+class RuntimeLevel1 : public RuntimeObject
+{
+    DECLARE_RUNTIME(RuntimeLevel1)
+public:
+    RuntimeLevel1( void ) = default;
+    virtual ~RuntimeLevel1( void ) = default;
+};
+
+//!< The classes of the benchmark hierarchy.
+class RuntimeLevel2 : public RuntimeLevel1 { DECLARE_RUNTIME(RuntimeLevel2) };
+class RuntimeLevel3 : public RuntimeLevel2 { DECLARE_RUNTIME(RuntimeLevel3) };
+class RuntimeLevel4 : public RuntimeLevel3 { DECLARE_RUNTIME(RuntimeLevel4) };
+class RuntimeLevel5 : public RuntimeLevel4 { DECLARE_RUNTIME(RuntimeLevel5) };
+class RuntimeLevel6 : public RuntimeLevel5 { DECLARE_RUNTIME(RuntimeLevel6) };
+
+//!< The class of another branch of the hierarchy.
+class RuntimeBranch : public RuntimeLevel2 { DECLARE_RUNTIME(RuntimeBranch) };
+
+IMPLEMENT_RUNTIME(RuntimeLevel1, RuntimeObject)
+IMPLEMENT_RUNTIME(RuntimeLevel2, RuntimeLevel1)
+IMPLEMENT_RUNTIME(RuntimeLevel3, RuntimeLevel2)
+IMPLEMENT_RUNTIME(RuntimeLevel4, RuntimeLevel3)
+IMPLEMENT_RUNTIME(RuntimeLevel5, RuntimeLevel4)
+IMPLEMENT_RUNTIME(RuntimeLevel6, RuntimeLevel5)
+IMPLEMENT_RUNTIME(RuntimeBranch, RuntimeLevel2)
+
+/**
+ * \brief   Checks the dense indexes of the runtime classes and the runtime casting
+ *          by Class ID, by name and by number within and across the class hierarchy.
+ **/
+TEST( RuntimeClassBenchmark, ClassHierarchy )
+{
+    const RuntimeClassID & level1 = RuntimeLevel1::_getClassId( );
+    const RuntimeClassID & level6 = RuntimeLevel6::_getClassId( );
+    const RuntimeClassID & branch = RuntimeBranch::_getClassId( );
+
+    EXPECT_NE( level1.getClassIndex( ), 0u );
+    EXPECT_NE( level1.getClassIndex( ), level6.getClassIndex( ) );
+    EXPECT_NE( level6.getClassIndex( ), branch.getClassIndex( ) );
+    EXPECT_EQ( RuntimeClassID( "RuntimeLevel6" ).getClassIndex( ), level6.getClassIndex( ) );
+    EXPECT_EQ( RuntimeClassID( "RuntimeLevel6" ), level6 );
+    EXPECT_EQ( RuntimeClassID::createEmptyClassID( ).getClassIndex( ), 0u );
+    EXPECT_FALSE( RuntimeClassID::createEmptyClassID( ).isValid( ) );
+
+    RuntimeClassID copy( level6 );
+    EXPECT_EQ( copy, level6 );
+    EXPECT_EQ( copy.getName( ), "RuntimeLevel6" );
+    EXPECT_TRUE( copy.isDerivedFrom( level1 ) );
+
+    RuntimeLevel6 object;
+    RuntimeBranch other;
+    EXPECT_EQ( RUNTIME_CAST( &object, RuntimeLevel1 ), &object );
+    EXPECT_EQ( RUNTIME_CAST( &object, RuntimeLevel4 ), &object );
+    EXPECT_EQ( RUNTIME_CAST( &object, RuntimeLevel6 ), &object );
+    EXPECT_EQ( RUNTIME_CAST( &object, RuntimeBranch ), nullptr );
+    EXPECT_EQ( RUNTIME_CAST( &other, RuntimeLevel2 ), &other );
+    EXPECT_EQ( RUNTIME_CAST( &other, RuntimeLevel3 ), nullptr );
+
+    EXPECT_TRUE( object.isInstanceOfRuntimeClass( RuntimeObject::_getClassId( ) ) );
+    EXPECT_TRUE( object.isInstanceOfRuntimeClass( RuntimeClassID( "RuntimeLevel3" ) ) );
+    EXPECT_TRUE( object.isInstanceOfRuntimeClass( "RuntimeLevel2" ) );
+    EXPECT_TRUE( object.isInstanceOfRuntimeClass( level1.getMagic( ) ) );
+    EXPECT_FALSE( object.isInstanceOfRuntimeClass( "RuntimeBranch" ) );
+    EXPECT_FALSE( object.isInstanceOfRuntimeClass( RuntimeClassID( "RuntimeUnknownClass" ) ) );
+    EXPECT_FALSE( object.isInstanceOfRuntimeClass( RuntimeClassID::createEmptyClassID( ) ) );
+}
+
+/**
+ * \brief   Measures the runtime casts per second of the object of the deepest class
+ *          to the root class of the hierarchy by Class ID and by the class number,
+ *          which checks every class of the hierarchy.
+ **/
+TEST( RuntimeClassBenchmark, CastsPerSecond )
+{
+    constexpr uint32_t castCount{ 10'000'000 };
+
+    RuntimeLevel6 object;
+    const RuntimeObject * ptr = &object;
+    const RuntimeClassID & classId = RuntimeLevel1::_getClassId( );
+    const unsigned int classMagic = classId.getMagic( );
+
+    uint32_t found{ 0 };
+    auto start = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < castCount; ++ i )
+    {
+        found += (RUNTIME_CAST( ptr, RuntimeLevel1 ) != nullptr) ? 1 : 0;
+    }
+
+    const double byClassId = castCount / std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+
+    start = std::chrono::steady_clock::now( );
+    for ( uint32_t i = 0; i < castCount; ++ i )
+    {
+        found += (ptr->runtimeCast( classMagic ) != nullptr) ? 1 : 0;
+    }
+
+    const double byNumber = castCount / std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+
+    std::cout << "[ BENCHMARK ] depth = 8, casts = " << castCount
+              << ", by class ID casts/sec = " << static_cast<uint64_t>(byClassId)
+              << ", by class number casts/sec = " << static_cast<uint64_t>(byNumber) << std::endl;
+
+    EXPECT_EQ( found, 2 * castCount );
+    EXPECT_TRUE( ptr->getRuntimeClassId( ).isDerivedFrom( classId ) );
+}
@@ -0,0 +1,320 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/ServerConnectionBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of remote messages received per second by one
+ *              server thread when many clients are connected, where only
+ *              some of them are sending messages, and by several server
+ *              threads when the connections are distributed between shards.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/MessageReceiveBuffer.hpp"
+#include "areg/ipc/ServerConnectionBase.hpp"
+#include "areg/ipc/SocketConnectionBase.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+    #include <sys/resource.h>
+#endif  // defined(__linux__)
+
+namespace
+{
+    //!< The port numbers of the benchmark servers. The tests use different
+    //!< ports, since they may run in parallel.
+    constexpr unsigned short    SERVER_PORT     { 18'587 };
+    constexpr unsigned short    SHARDED_PORT    { 18'588 };
+
+    //!< The maximum number of messages to receive from one connection at once.
+    constexpr uint32_t          READ_BUDGET     { 16 };
+
+    //!< Returns the maximum number of client connections the benchmark can open.
+    uint32_t maxConnections( void )
+    {
+#if defined(__linux__)
+        // each connection uses the client and accepted sockets.
+        struct rlimit limit { };
+        ::getrlimit( RLIMIT_NOFILE, &limit );
+        return (limit.rlim_cur > 512 ? static_cast<uint32_t>((limit.rlim_cur - 256) / 2) : 0u);
+#else   // !defined(__linux__)
+        // select() is limited by FD_SETSIZE sockets.
+        return 60u;
+#endif  // defined(__linux__)
+    }
+
+    //!< The server, which receives messages of each shard of connections in one thread.
+    class BenchmarkServer   : public    ServerConnectionBase
+                            , private   SocketConnectionBase
+    {
+    public:
+        BenchmarkServer( uint32_t shards, unsigned short port )
+            : ServerConnectionBase  ( NESocket::LocalAddress, port )
+            , SocketConnectionBase  ( )
+            , mAccepted ( 0 )
+            , mReceived ( 0 )
+            , mThreads  ( )
+        {
+            setShardCount( shards );
+        }
+
+        bool start( void )
+        {
+            if ( createSocket( ) && serverListen( ) )
+            {
+                for ( uint32_t shard = 0; shard < getShardCount( ); ++ shard )
+                {
+                    mThreads.emplace_back( [this, shard]( ) { run( shard ); } );
+                }
+
+                return true;
+            }
+
+            return false;
+        }
+
+        void stop( void )
+        {
+            closeSocket( );
+            for ( auto & thread : mThreads )
+            {
+                thread.join( );
+            }
+        }
+
+        void run( uint32_t shard )
+        {
+            std::unordered_map<SOCKETHANDLE, std::unique_ptr<MessageReceiveBuffer>> buffers;
+            while ( isValid( ) )
+            {
+                NESocket::SocketAddress addrAccepted;
+                bool isClosed{ false };
+                SOCKETHANDLE hSocket = waitForConnectionEvent( addrAccepted, isClosed, shard );
+                if ( (hSocket == NESocket::InvalidSocketHandle) || (hSocket == NESocket::FailedSocketHandle) )
+                    continue;
+
+                if ( isConnectionAccepted( hSocket ) == false )
+                {
+                    SocketAccepted client( hSocket, addrAccepted );
+                    acceptConnection( client );
+                    ++ mAccepted;
+                    if ( getConnectionShard( hSocket ) != shard )
+                        continue;
+                }
+
+                std::unique_ptr<MessageReceiveBuffer> & entry = buffers[hSocket];
+                if ( entry == nullptr )
+                {
+                    entry.reset( new MessageReceiveBuffer( ) );
+                }
+
+                SocketAccepted client( getClientByHandle( hSocket ) );
+                MessageReceiveBuffer & buffer = *entry;
+                RemoteMessage msgReceived;
+                uint32_t processed{ 0 };
+                bool hasData{ true };
+                bool isFailed{ false };
+                while ( (processed < READ_BUDGET) && hasData && (isFailed == false) )
+                {
+                    if ( buffer.hasMessage( ) )
+                    {
+                        isFailed = receiveMessage( msgReceived, client, buffer ) <= 0;
+                        processed += isFailed ? 0 : 1;
+                    }
+                    else if ( client.pendingRead( ) > 0 )
+                    {
+                        isFailed = buffer.receiveData( client ) <= 0;
+                    }
+                    else
+                    {
+                        hasData = false;
+                    }
+                }
+
+                mReceived += processed;
+                if ( isFailed || (isClosed && (hasData == false)) )
+                {
+                    closeConnection( client );
+                }
+                else if ( hasData )
+                {
+                    continueConnectionEvent( hSocket, isClosed );
+                }
+            }
+        }
+
+        std::atomic_uint            mAccepted;
+        std::atomic_uint            mReceived;
+        std::vector<std::thread>    mThreads;
+    };
+
+    //!< The clients connected to the benchmark server.
+    class BenchmarkClients  : private   SocketConnectionBase
+    {
+    public:
+        BenchmarkClients( void )
+            : SocketConnectionBase  ( )
+            , mClients  ( )
+        {
+        }
+
+        bool connect( uint32_t count, unsigned short port )
+        {
+            const NESocket::SocketAddress address( NESocket::LocalAddress, port );
+            mClients.reserve( count );
+            for ( uint32_t i = 0; i < count; ++ i )
+            {
+                SOCKETHANDLE hSocket = NESocket::clientSocketConnect( NESocket::LocalAddress, port );
+                if ( NESocket::isSocketHandleValid( hSocket ) == false )
+                    return false;
+
+                mClients.emplace_back( hSocket, address );
+            }
+
+            return true;
+        }
+
+        //!< Sends the batches of messages by the clients starting from the specified one.
+        void send( uint32_t first, uint32_t count, uint32_t messages, const std::vector<RemoteMessage> & batch ) const
+        {
+            uint32_t sent{ 0 };
+            for ( uint32_t i = 0; sent < messages; i = (i + 1) % count )
+            {
+                sendMessages( batch.data( ), static_cast<uint32_t>(batch.size( )), mClients[first + i] );
+                sent += static_cast<uint32_t>(batch.size( ));
+            }
+        }
+
+        std::vector<SocketAccepted> mClients;
+    };
+
+    //!< Connects idle and active clients, and returns the rate of messages received by server.
+    double runClients( uint32_t idle, uint32_t active, uint32_t messagesPerClient, uint32_t shards, unsigned short port, bool & isComplete )
+    {
+        constexpr uint32_t batchSize{ 32 };
+        constexpr uint32_t senders{ 4 };
+
+        isComplete = false;
+        NESocket::socketInitialize( );
+        BenchmarkServer server( shards, port );
+        if ( server.start( ) == false )
+            return 0.0;
+
+        BenchmarkClients idleClients;
+        BenchmarkClients activeClients;
+        bool connected = idleClients.connect( idle, port ) && activeClients.connect( active, port );
+        while ( connected && (server.mAccepted < idle + active) )
+        {
+            std::this_thread::yield( );
+        }
+
+        std::vector<RemoteMessage> batch( batchSize );
+        unsigned char payload[64]{ };
+        for ( RemoteMessage & msg : batch )
+        {
+            msg.write( payload, sizeof( payload ) );
+            msg.setMessageId( 1 );
+        }
+
+        const uint32_t expected{ connected ? active * messagesPerClient : 0u };
+        auto start = std::chrono::steady_clock::now( );
+        std::vector<std::thread> threads;
+        const uint32_t threadCount = MACRO_MIN( senders, active );
+        for ( uint32_t i = 0; connected && (i < threadCount); ++ i )
+        {
+            uint32_t first = i * active / threadCount;
+            uint32_t count = (i + 1) * active / threadCount - first;
+            threads.emplace_back( [&activeClients, &batch, first, count, messagesPerClient]( )
+                {
+                    activeClients.send( first, count, count * messagesPerClient, batch );
+                } );
+        }
+
+        for ( auto & thread : threads )
+        {
+            thread.join( );
+        }
+
+        while ( connected && (server.mReceived < expected) )
+        {
+            std::this_thread::yield( );
+        }
+
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+        isComplete = connected && (server.mReceived == expected);
+        server.stop( );
+        NESocket::socketRelease( );
+
+        return (static_cast<double>(expected) / elapsed);
+    }
+}
+
+/**
+ * \brief   Measures the messages per second received by one server thread
+ *          when the number of idle and active clients grows.
+ **/
+TEST( ServerConnectionBenchmark, MessagesPerSecond )
+{
+    constexpr uint32_t totalMessages{ 64 * 1'024 };
+
+    const uint32_t maxClients{ maxConnections( ) };
+    for ( uint32_t idle : { 0u, 1'000u, 5'000u } )
+    {
+        for ( uint32_t active : { 1u, 16u } )
+        {
+            if ( idle + active > maxClients )
+                continue;
+
+            bool isComplete{ false };
+            double rate = runClients( idle, active, totalMessages / active, 1u, SERVER_PORT, isComplete );
+            std::cout << "[ BENCHMARK ] idle clients = " << idle
+                      << ", active clients = " << active
+                      << ", messages = " << totalMessages
+                      << ", messages/sec = " << static_cast<uint64_t>(rate) << std::endl;
+
+            EXPECT_TRUE( isComplete );
+        }
+    }
+}
+
+/**
+ * \brief   Measures the messages per second received by the server, when
+ *          the connections are distributed between several server threads.
+ **/
+TEST( ServerConnectionBenchmark, ShardedMessagesPerSecond )
+{
+    constexpr uint32_t totalMessages{ 256 * 1'024 };
+    constexpr uint32_t active{ 16 };
+
+    for ( uint32_t shards : { 1u, 2u, 4u } )
+    {
+        bool isComplete{ false };
+        double rate = runClients( 0u, active, totalMessages / active, shards, SHARDED_PORT, isComplete );
+        std::cout << "[ BENCHMARK ] server threads = " << shards
+                  << ", active clients = " << active
+                  << ", messages = " << totalMessages
+                  << ", messages/sec = " << static_cast<uint64_t>(rate) << std::endl;
+
+        EXPECT_TRUE( isComplete );
+    }
+}
@@ -0,0 +1,169 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/ServerSendThreadTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the batch of messages sent by the server send thread,
+ *              which waits the linger time for more messages of the batch.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/IERemoteMessageHandler.hpp"
+#include "areg/ipc/SendMessageEvent.hpp"
+#include "areg/ipc/SocketConnectionBase.hpp"
+#include "aregextend/service/ServerConnection.hpp"
+#include "aregextend/service/private/ServerSendThread.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace
+{
+    //!< The port number of the test server.
+    constexpr unsigned short    SERVER_PORT     { 18'589 };
+
+    //!< The maximum number of messages in the batch.
+    constexpr uint32_t          BATCH_SIZE      { 4 };
+
+    //!< The time in milliseconds to wait for more messages of the batch.
+    constexpr uint32_t          BATCH_LINGER    { 1'000 };
+
+    //!< Counts the messages, which failed to send.
+    class MessageHandler : public IERemoteMessageHandler
+    {
+    public:
+        MessageHandler( void ) = default;
+        virtual ~MessageHandler( void ) = default;
+
+        virtual void failedSendMessage( const RemoteMessage & /*msgFailed*/, Socket & /*whichTarget*/ ) override
+        {
+            ++ mFailed;
+        }
+
+        virtual void failedReceiveMessage( Socket & /*whichSource*/ ) override
+        {
+        }
+
+        virtual void failedProcessMessage( const RemoteMessage & /*msgUnprocessed*/ ) override
+        {
+        }
+
+        virtual void processReceivedMessage( const RemoteMessage & /*msgReceived*/, Socket & /*whichSource*/ ) override
+        {
+        }
+
+        std::atomic_uint    mFailed{ 0 };
+    };
+
+    //!< The client, which receives the messages sent by the server.
+    class MessageReceiver   : public    SocketConnectionBase
+    {
+    public:
+        using SocketConnectionBase::receiveMessage;
+    };
+
+    //!< Posts the messages to send to the target by the send thread.
+    void postMessages( ServerSendThread & threadSend, const ITEM_ID & target, uint32_t count )
+    {
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            RemoteMessage msg;
+            msg.write( reinterpret_cast<const unsigned char *>(&i), sizeof(i) );
+            msg.setMessageId( i );
+            msg.setTarget( target );
+            SendMessageEvent::sendEvent( SendMessageEventData( msg, target )
+                                       , static_cast<IESendMessageEventConsumer &>(threadSend)
+                                       , static_cast<DispatcherThread &>(threadSend)
+                                       , Event::eEventPriority::EventPriorityNormal );
+        }
+    }
+
+    //!< Receives the messages and returns the time in milliseconds until the first message is received.
+    double receiveMessages( const MessageReceiver & receiver, const SocketAccepted & client, uint32_t count )
+    {
+        const auto begin = std::chrono::steady_clock::now( );
+        double elapsed{ 0.0 };
+        RemoteMessage msgReceived;
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            EXPECT_GT( receiver.receiveMessage( msgReceived, client ), 0 );
+            EXPECT_EQ( msgReceived.getMessageId( ), i );
+            if ( i == 0 )
+            {
+                elapsed = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now( ) - begin ).count( );
+            }
+        }
+
+        return elapsed;
+    }
+}
+
+/**
+ * \brief   Checks that the send thread holds the incomplete batch of messages
+ *          until the linger time expires, and sends the complete batch immediately.
+ **/
+TEST( ServerSendThreadTest, BatchLinger )
+{
+    NESocket::socketInitialize( );
+
+    ServerConnection server( 1u, NESocket::LocalAddress.data( ), SERVER_PORT );
+    ASSERT_TRUE( server.createSocket( ) && server.serverListen( ) );
+
+    SOCKETHANDLE hClient = NESocket::clientSocketConnect( NESocket::LocalAddress, SERVER_PORT );
+    ASSERT_TRUE( NESocket::isSocketHandleValid( hClient ) );
+    const SocketAccepted client( hClient, NESocket::SocketAddress( NESocket::LocalAddress, SERVER_PORT ) );
+
+    ITEM_ID target{ NEService::COOKIE_UNKNOWN };
+    while ( target == NEService::COOKIE_UNKNOWN )
+    {
+        NESocket::SocketAddress addrAccepted;
+        bool isClosed{ false };
+        SOCKETHANDLE hSocket = server.waitForConnectionEvent( addrAccepted, isClosed );
+        ASSERT_NE( hSocket, NESocket::FailedSocketHandle );
+        if ( (hSocket != NESocket::InvalidSocketHandle) && (server.isConnectionAccepted( hSocket ) == false) )
+        {
+            SocketAccepted accepted( hSocket, addrAccepted );
+            ASSERT_TRUE( server.acceptConnection( accepted ) );
+            target = server.getCookie( hSocket );
+        }
+    }
+
+    MessageHandler handler;
+    MessageReceiver receiver;
+    ServerSendThread threadSend( handler, server );
+    threadSend.setSendBatch( BATCH_SIZE, BATCH_LINGER );
+    ASSERT_TRUE( threadSend.createThread( NECommon::WAIT_INFINITE ) && threadSend.waitForDispatcherStart( NECommon::WAIT_INFINITE ) );
+
+    // The incomplete batch is sent when the linger time expires.
+    postMessages( threadSend, target, BATCH_SIZE - 1 );
+    const double elapsedIncomplete{ receiveMessages( receiver, client, BATCH_SIZE - 1 ) };
+
+    // The complete batch is sent without waiting.
+    postMessages( threadSend, target, BATCH_SIZE );
+    const double elapsedComplete{ receiveMessages( receiver, client, BATCH_SIZE ) };
+
+    SendMessageEvent::sendEvent( SendMessageEventData( )
+                               , static_cast<IESendMessageEventConsumer &>(threadSend)
+                               , static_cast<DispatcherThread &>(threadSend)
+                               , Event::eEventPriority::EventPriorityNormal );
+    threadSend.completionWait( NECommon::WAIT_INFINITE );
+    threadSend.shutdownThread( NECommon::WAIT_INFINITE );
+    NESocket::socketRelease( );
+
+    EXPECT_GE( elapsedIncomplete, BATCH_LINGER * 0.9 );
+    EXPECT_LT( elapsedComplete, BATCH_LINGER * 0.5 );
+    EXPECT_EQ( handler.mFailed, 0u );
+}
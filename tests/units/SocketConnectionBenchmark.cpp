@@ -0,0 +1,245 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SocketConnectionBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of remote messages received per second over the
+ *              loopback connection with and without the receive buffer,
+ *              and with and without the checksum of messages.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/NESocket.hpp"
+#include "areg/base/RemoteMessage.hpp"
+#include "areg/base/SocketAccepted.hpp"
+#include "areg/ipc/MessageReceiveBuffer.hpp"
+#include "areg/ipc/SocketConnectionBase.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< The port number of the loopback benchmark server.
+    constexpr unsigned short    LOOPBACK_PORT   { 18'586 };
+
+    //!< The connection object, which makes the send and receive methods accessible.
+    class BenchmarkConnection : public SocketConnectionBase
+    {
+    public:
+        BenchmarkConnection( void ) = default;
+
+        using SocketConnectionBase::sendMessages;
+        using SocketConnectionBase::receiveMessage;
+    };
+
+    //!< The connected loopback pair of sockets.
+    struct LoopbackSockets
+    {
+        LoopbackSockets( void )
+            : mSender   ( )
+            , mReceiver ( )
+        {
+            NESocket::socketInitialize( );
+            SOCKETHANDLE server = NESocket::serverSocketConnect( NESocket::LocalAddress, LOOPBACK_PORT );
+            if ( NESocket::isSocketHandleValid( server ) && NESocket::serverListenConnection( server ) )
+            {
+                SOCKETHANDLE client = NESocket::clientSocketConnect( NESocket::LocalAddress, LOOPBACK_PORT );
+                if ( NESocket::isSocketHandleValid( client ) )
+                {
+                    const SOCKETHANDLE accepted[]{ NESocket::InvalidSocketHandle };
+                    NESocket::SocketAddress address;
+                    address.resolveAddress( NESocket::LocalAddress, LOOPBACK_PORT, false );
+                    mSender     = SocketAccepted( client, address );
+                    mReceiver   = SocketAccepted( NESocket::serverAcceptConnection( server, accepted, 0 ), address );
+                }
+            }
+
+            NESocket::socketClose( server );
+        }
+
+        ~LoopbackSockets( void )
+        {
+            mSender.closeSocket( );
+            mReceiver.closeSocket( );
+            NESocket::socketRelease( );
+        }
+
+        bool isValid( void ) const
+        {
+            return mSender.isValid( ) && mReceiver.isValid( );
+        }
+
+        SocketAccepted  mSender;
+        SocketAccepted  mReceiver;
+    };
+
+    //!< Creates the messages to send with the payload of specified size.
+    std::vector<RemoteMessage> createMessages( uint32_t count, uint32_t payload )
+    {
+        std::vector<unsigned char> data( payload );
+        std::vector<RemoteMessage> result( count );
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            for ( uint32_t j = 0; j < payload; ++ j )
+            {
+                data[j] = static_cast<unsigned char>(i + j);
+            }
+
+            RemoteMessage & msg = result[i];
+            msg.write( data.data( ), payload );
+            msg.setMessageId( i );
+            msg.setSource( static_cast<ITEM_ID>(i) );
+        }
+
+        return result;
+    }
+
+    //!< Sends the messages and receives them either with or without receive buffer,
+    //!< either calculating and verifying the checksum or not.
+    //!< Returns the rate and the number of messages received and validated.
+    double runReceive( const std::vector<RemoteMessage> & messages, bool useBuffer, bool checksum, uint32_t & validated )
+    {
+        LoopbackSockets sockets;
+        validated = 0;
+        if ( sockets.isValid( ) == false )
+            return 0.0;
+
+        BenchmarkConnection connection;
+        MessageReceiveBuffer buffer;
+        RemoteMessage msgReceived;
+
+        auto start = std::chrono::steady_clock::now( );
+        std::thread sender( [&]( )
+            {
+                constexpr uint32_t batch{ 32 };
+                for ( uint32_t i = 0; i < static_cast<uint32_t>(messages.size( )); i += batch )
+                {
+                    uint32_t count = MACRO_MIN( batch, static_cast<uint32_t>(messages.size( )) - i );
+                    connection.sendMessages( &messages[i], count, sockets.mSender, checksum );
+                }
+            } );
+
+        for ( uint32_t i = 0; i < static_cast<uint32_t>(messages.size( )); ++ i )
+        {
+            int received = useBuffer ? connection.receiveMessage( msgReceived, sockets.mReceiver, buffer, checksum )
+                                     : connection.receiveMessage( msgReceived, sockets.mReceiver, checksum );
+            if ( received <= 0 )
+                break;
+
+            const unsigned char * data = msgReceived.getBuffer( );
+            bool isValid = (msgReceived.getMessageId( ) == i) && (msgReceived.getSizeUsed( ) == messages[i].getSizeUsed( ));
+            isValid = isValid && (data != nullptr) && (data[0] == static_cast<unsigned char>(i));
+            validated += isValid ? 1 : 0;
+            msgReceived.invalidate( );
+        }
+
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+        sender.join( );
+
+        return (static_cast<double>(messages.size( )) / elapsed);
+    }
+}
+
+/**
+ * \brief   Measures the remote messages per second received over the loopback
+ *          connection by reading header and data separately, and by receiving
+ *          all available data in the receive buffer of the connection.
+ **/
+TEST( SocketConnectionBenchmark, MessagesPerSecond )
+{
+    constexpr uint32_t messageCount{ 50'000 };
+
+    for ( uint32_t payload : { 16u, 256u, 4'096u } )
+    {
+        std::vector<RemoteMessage> messages = createMessages( messageCount, payload );
+        for ( bool useBuffer : { false, true } )
+        {
+            uint32_t validated{ 0 };
+            double rate = runReceive( messages, useBuffer, true, validated );
+            std::cout << "[ BENCHMARK ] payload = " << payload
+                      << ", receive buffer = " << (useBuffer ? "yes" : "no")
+                      << ", messages = " << messageCount
+                      << ", messages/sec = " << static_cast<uint64_t>(rate) << std::endl;
+
+            EXPECT_EQ( validated, messageCount );
+        }
+    }
+}
+
+/**
+ * \brief   Measures the throughput of big remote messages received over the loopback
+ *          connection, when the checksum is calculated and verified, and when the
+ *          checksum is skipped as negotiated by the peers of the loopback connection.
+ **/
+TEST( SocketConnectionBenchmark, ChecksumModes )
+{
+    constexpr uint32_t messageCount{ 2'000 };
+
+    for ( uint32_t payload : { 4'096u, 65'536u } )
+    {
+        std::vector<RemoteMessage> messages = createMessages( messageCount, payload );
+        for ( bool checksum : { true, false } )
+        {
+            uint32_t validated{ 0 };
+            double rate = runReceive( messages, true, checksum, validated );
+            std::cout << "[ BENCHMARK ] payload = " << payload
+                      << ", checksum = " << (checksum ? "yes" : "no")
+                      << ", messages = " << messageCount
+                      << ", messages/sec = " << static_cast<uint64_t>(rate)
+                      << ", MB/sec = " << static_cast<uint64_t>(rate * payload / 1'000'000.0) << std::endl;
+
+            EXPECT_EQ( validated, messageCount );
+        }
+    }
+}
+
+/**
+ * \brief   Checks that the messages bigger than the capacity of the receive buffer
+ *          are received complete, and that the extracted messages keep the data valid
+ *          when the buffer continues to receive.
+ **/
+TEST( SocketConnectionBenchmark, ReceiveBufferLargeMessages )
+{
+    constexpr uint32_t messageCount{ 64 };
+
+    LoopbackSockets sockets;
+    ASSERT_TRUE( sockets.isValid( ) );
+
+    std::vector<RemoteMessage> messages = createMessages( messageCount, 100'000 );
+    BenchmarkConnection connection;
+    MessageReceiveBuffer buffer( 1'024 );
+
+    std::thread sender( [&]( )
+        {
+            connection.sendMessages( messages.data( ), messageCount, sockets.mSender );
+        } );
+
+    std::vector<RemoteMessage> received( messageCount );
+    for ( uint32_t i = 0; i < messageCount; ++ i )
+    {
+        ASSERT_GT( connection.receiveMessage( received[i], sockets.mReceiver, buffer ), 0 );
+    }
+
+    sender.join( );
+
+    for ( uint32_t i = 0; i < messageCount; ++ i )
+    {
+        ASSERT_EQ( received[i].getMessageId( ), i );
+        ASSERT_EQ( received[i].getSizeUsed( ), messages[i].getSizeUsed( ) );
+        EXPECT_EQ( ::memcmp( received[i].getBuffer( ), messages[i].getBuffer( ), received[i].getSizeUsed( ) ), 0 );
+    }
+}
@@ -0,0 +1,182 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/SynchEventBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of the wake latency and the wake throughput of
+ *              the synchronization events and the multi-lock.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //!< Two threads ping-pong over a pair of auto-reset events.
+    struct PingPong
+    {
+        PingPong( void )
+            : mPing ( true, true )
+            , mPong ( true, true )
+        {
+        }
+
+        //!< Runs the specified number of round trips, returns number of successful waits.
+        uint32_t run( uint32_t roundTrips )
+        {
+            uint32_t succeeded{ 0 };
+            std::thread peer( [this, roundTrips]( )
+                {
+                    for ( uint32_t i = 0; i < roundTrips; ++ i )
+                    {
+                        mPing.lock( NECommon::WAIT_INFINITE );
+                        mPong.setEvent( );
+                    }
+                } );
+
+            for ( uint32_t i = 0; i < roundTrips; ++ i )
+            {
+                mPing.setEvent( );
+                succeeded += mPong.lock( NECommon::WAIT_INFINITE ) ? 1 : 0;
+            }
+
+            peer.join( );
+            return succeeded;
+        }
+
+        SynchEvent  mPing;
+        SynchEvent  mPong;
+    };
+}
+
+/**
+ * \brief   Measures the average round trip time when two threads
+ *          wake each other by setting auto-reset events.
+ **/
+TEST( SynchEventBenchmark, WakeLatency )
+{
+    constexpr uint32_t roundTrips{ 20'000 };
+
+    PingPong pingPong;
+    auto start = std::chrono::steady_clock::now( );
+    uint32_t succeeded = pingPong.run( roundTrips );
+    auto elapsed = std::chrono::duration<double, std::micro>( std::chrono::steady_clock::now( ) - start ).count( );
+
+    std::cout << "[ BENCHMARK ] round trips = " << roundTrips
+              << ", average round trip = " << elapsed / roundTrips << " us" << std::endl;
+
+    EXPECT_EQ( succeeded, roundTrips );
+}
+
+/**
+ * \brief   Measures the wakeups per second when 1, 4 and 16 pairs of
+ *          threads ping-pong in parallel over their own events.
+ **/
+TEST( SynchEventBenchmark, WakeThroughput )
+{
+    constexpr uint32_t roundTrips{ 5'000 };
+
+    for ( uint32_t pairs : { 1u, 4u, 16u } )
+    {
+        std::vector<std::unique_ptr<PingPong>> list;
+        std::vector<std::thread> threads;
+        std::vector<uint32_t> succeeded( pairs, 0 );
+        for ( uint32_t i = 0; i < pairs; ++ i )
+        {
+            list.emplace_back( new PingPong( ) );
+        }
+
+        auto start = std::chrono::steady_clock::now( );
+        for ( uint32_t i = 0; i < pairs; ++ i )
+        {
+            threads.emplace_back( [i, roundTrips, &list, &succeeded]( )
+                {
+                    succeeded[i] = list[i]->run( roundTrips );
+                } );
+        }
+
+        for ( auto & thread : threads )
+        {
+            thread.join( );
+        }
+
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+        std::cout << "[ BENCHMARK ] pairs = " << pairs
+                  << ", wakeups = " << pairs * roundTrips * 2
+                  << ", wakeups/sec = " << static_cast<uint64_t>(pairs * roundTrips * 2 / elapsed) << std::endl;
+
+        for ( uint32_t count : succeeded )
+        {
+            EXPECT_EQ( count, roundTrips );
+        }
+    }
+}
+
+/**
+ * \brief   Measures the rate of waiting for any and for all events,
+ *          when the events are set by other thread.
+ **/
+TEST( SynchEventBenchmark, MultiLockWake )
+{
+    constexpr uint32_t iterations{ 5'000 };
+
+    for ( bool waitAll : { false, true } )
+    {
+        SynchEvent first( true, true );
+        SynchEvent second( true, true );
+        SynchEvent ready( true, true );
+        IESynchObject * objects[] = { &first, &second };
+        uint32_t succeeded{ 0 };
+
+        std::thread peer( [&]( )
+            {
+                for ( uint32_t i = 0; i < iterations; ++ i )
+                {
+                    ready.lock( NECommon::WAIT_INFINITE );
+                    first.setEvent( );
+                    second.setEvent( );
+                }
+            } );
+
+        auto start = std::chrono::steady_clock::now( );
+        for ( uint32_t i = 0; i < iterations; ++ i )
+        {
+            MultiLock multi( objects, 2, false );
+            ready.setEvent( );
+            int index = multi.lock( NECommon::WAIT_INFINITE, waitAll );
+            if ( waitAll )
+            {
+                succeeded += index == MultiLock::LOCK_INDEX_ALL ? 1 : 0;
+            }
+            else if ( (index == 0) || (index == 1) )
+            {
+                // wait for the other event to be set before next iteration.
+                succeeded += objects[1 - index]->lock( NECommon::WAIT_INFINITE ) ? 1 : 0;
+            }
+        }
+
+        peer.join( );
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start ).count( );
+        std::cout << "[ BENCHMARK ] multi-lock wait " << (waitAll ? "all" : "any")
+                  << ", iterations = " << iterations
+                  << ", iterations/sec = " << static_cast<uint64_t>(iterations / elapsed) << std::endl;
+
+        EXPECT_EQ( succeeded, iterations );
+    }
+}
@@ -0,0 +1,98 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/ThreadShutdownTest.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Tests of the shutdown of the thread, which already
+ *              released the handle, but did not complete the exit.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/base/Thread.hpp"
+#include "areg/base/IEThreadConsumer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    //!< The consumer of the thread, which exits immediately.
+    class ShutdownConsumer : public IEThreadConsumer
+    {
+    public:
+        ShutdownConsumer( void ) = default;
+        virtual ~ShutdownConsumer( void ) = default;
+
+    protected:
+        virtual void onThreadRuns( void ) override
+        {
+        }
+    };
+
+    //!< The thread, which can simulate the exit of the thread function after the handle is released.
+    class ExitingThread : public Thread
+    {
+    public:
+        ExitingThread( IEThreadConsumer & consumer )
+            : Thread( consumer, "ThreadShutdownTest" )
+        {
+        }
+
+        virtual ~ExitingThread( void ) = default;
+
+        //!< Simulates the thread function, which released the handle and is still exiting.
+        void setExiting( void )
+        {
+            mWaitForExit.resetEvent( );
+        }
+
+        //!< Simulates the end of the thread function.
+        void setExited( void )
+        {
+            mWaitForExit.setEvent( );
+        }
+    };
+}
+
+/**
+ * \brief   Checks that the shutdown of the thread, which released the handle,
+ *          waits until the thread function ends, so that the thread object
+ *          is not destroyed while the thread function is still exiting.
+ **/
+TEST( ThreadShutdownTest, WaitsForExitAfterHandleReleased )
+{
+    ShutdownConsumer consumer;
+    ExitingThread thread( consumer );
+    ASSERT_TRUE( thread.createThread( NECommon::WAIT_INFINITE ) );
+    ASSERT_TRUE( thread.completionWait( NECommon::WAIT_INFINITE ) );
+    ASSERT_FALSE( thread.isValid( ) );
+
+    thread.setExiting( );
+    std::atomic_bool exited{ false };
+    std::thread exiting( [&thread, &exited]( )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            exited = true;
+            thread.setExited( );
+        });
+
+    EXPECT_EQ( thread.shutdownThread( NECommon::WAIT_INFINITE ), Thread::eCompletionStatus::ThreadInvalid );
+    EXPECT_TRUE( exited );
+    exiting.join( );
+
+    // the thread is not waited if it is requested to not wait.
+    thread.setExiting( );
+    EXPECT_EQ( thread.shutdownThread( NECommon::DO_NOT_WAIT ), Thread::eCompletionStatus::ThreadInvalid );
+    thread.setExited( );
+}
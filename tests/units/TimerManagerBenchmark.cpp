@@ -0,0 +1,189 @@
+/************************************************************************
+ * This file is part of the AREG SDK core engine.
+ * AREG SDK is dual-licensed under Free open source (Apache version 2.0
+ * License) and Commercial (with various pricing models) licenses, depending
+ * on the nature of the project (commercial, research, academic or free).
+ * You should have received a copy of the AREG SDK license description in LICENSE.txt.
+ * If not, please contact to info[at]aregtech.com
+ *
+ * \copyright   (c) 2017-2023 Aregtech UG. All rights reserved.
+ * \file        units/TimerManagerBenchmark.cpp
+ * \ingroup     AREG SDK, Automated Real-time Event Grid Software Development Kit
+ * \author      Artak Avetyan
+ * \brief       AREG Platform, AREG framework unit test file.
+ *              Benchmark of the firing jitter and the CPU use of the
+ *              timer manager running 10'000 and 100'000 concurrent timers.
+ ************************************************************************/
+/************************************************************************
+ * Include files.
+ ************************************************************************/
+#include "units/GUnitTest.hpp"
+#include "areg/appbase/Application.hpp"
+#include "areg/component/DispatcherThread.hpp"
+#include "areg/component/IETimerConsumer.hpp"
+#include "areg/component/Timer.hpp"
+#include "areg/base/SynchObjects.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#if defined(_POSIX) || defined(POSIX)
+    #include <sys/resource.h>
+#endif // defined(_POSIX) || defined(POSIX)
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    //!< The timer, which remembers when it is expected to expire.
+    class BenchmarkTimer : public Timer
+    {
+    public:
+        BenchmarkTimer( IETimerConsumer & consumer )
+            : Timer     ( consumer, "BenchmarkTimer" )
+            , mExpected ( )
+            , mJitter   ( 0 )
+        {
+        }
+
+        Clock::time_point   mExpected;
+        int64_t             mJitter;
+    };
+
+    //!< Receives the timer events, measures the jitter and signals when all timers are fired.
+    class BenchmarkConsumer : public IETimerConsumer
+    {
+    public:
+        BenchmarkConsumer( uint32_t expected )
+            : IETimerConsumer( )
+            , mExpected ( expected )
+            , mFired    ( 0 )
+            , mDone     ( true, false )
+        {
+        }
+
+        virtual void processTimer( Timer & timer ) override
+        {
+            BenchmarkTimer & benchTimer = static_cast<BenchmarkTimer &>(timer);
+            benchTimer.mJitter = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now( ) - benchTimer.mExpected).count( );
+            if ( ++ mFired == mExpected )
+            {
+                mDone.setEvent( );
+            }
+        }
+
+        uint32_t    mExpected;
+        uint32_t    mFired;
+        SynchEvent  mDone;
+    };
+
+    //!< The dispatcher thread, which receives the timer events.
+    class BenchmarkThread : public DispatcherThread
+    {
+    public:
+        BenchmarkThread( void )
+            : DispatcherThread( "TimerManagerBenchmark" )
+        {
+        }
+
+    protected:
+        virtual bool postEvent( Event & eventElem ) override
+        {
+            return EventDispatcher::postEvent( eventElem );
+        }
+    };
+
+    //!< Returns the CPU time in microseconds used by the process.
+    int64_t processCpuTime( void )
+    {
+#if defined(_POSIX) || defined(POSIX)
+        rusage usage{ };
+        ::getrusage( RUSAGE_SELF, &usage );
+        return  (static_cast<int64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1'000'000) +
+                static_cast<int64_t>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+#else   // defined(_POSIX) || defined(POSIX)
+        return 0;
+#endif  // defined(_POSIX) || defined(POSIX)
+    }
+
+    //!< Starts the timers, which expire within one second and reports the jitter and the CPU use.
+    void runTimers( uint32_t count )
+    {
+        constexpr uint32_t minTimeout{ 200 };
+        constexpr uint32_t spread    { 1'000 };
+
+        BenchmarkThread dispatcher;
+        BenchmarkConsumer consumer( count );
+        dispatcher.createThread( NECommon::WAIT_INFINITE );
+
+        std::vector<std::unique_ptr<BenchmarkTimer>> timers;
+        timers.reserve( count );
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            timers.emplace_back( new BenchmarkTimer( consumer ) );
+        }
+
+        int64_t cpuStart = processCpuTime( );
+        Clock::time_point start = Clock::now( );
+        uint32_t started{ 0 };
+        for ( uint32_t i = 0; i < count; ++ i )
+        {
+            uint32_t timeout = minTimeout + (i * 7919u) % spread;
+            timers[i]->mExpected = Clock::now( ) + std::chrono::milliseconds( timeout );
+            started += timers[i]->startTimer( timeout, dispatcher, Timer::ONE_TIME ) ? 1 : 0;
+        }
+
+        Lock wait( consumer.mDone, false );
+        bool completed = wait.lock( 60'000 );
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>( Clock::now( ) - start ).count( );
+        int64_t cpuUsed = processCpuTime( ) - cpuStart;
+
+        std::vector<int64_t> jitter;
+        jitter.reserve( count );
+        for ( const auto & timer : timers )
+        {
+            jitter.push_back( timer->mJitter );
+        }
+
+        std::sort( jitter.begin( ), jitter.end( ) );
+        int64_t sum{ 0 };
+        for ( int64_t value : jitter )
+        {
+            sum += value;
+        }
+
+        std::cout << "[ BENCHMARK ] timers = " << count
+                  << ", fired = " << consumer.mFired
+                  << ", jitter us: avg = " << sum / static_cast<int64_t>(count)
+                  << ", p50 = " << jitter[count / 2]
+                  << ", p99 = " << jitter[(count * 99) / 100]
+                  << ", max = " << jitter.back( )
+                  << ", wall = " << elapsed << " ms"
+                  << ", cpu = " << cpuUsed / 1'000 << " ms" << std::endl;
+
+        timers.clear( );
+        dispatcher.shutdownThread( NECommon::WAIT_INFINITE );
+
+        EXPECT_EQ( started, count );
+        EXPECT_TRUE( completed );
+    }
+}
+
+/**
+ * \brief   Measures the firing jitter and the CPU use of 10'000 and 100'000
+ *          concurrent one-time timers expiring within one second.
+ **/
+TEST( TimerManagerBenchmark, ConcurrentTimers )
+{
+    Application::startTimerManager( );
+
+    for ( uint32_t count : { 10'000u, 100'000u } )
+    {
+        runTimers( count );
+    }
+
+    Application::stopTimerManager( );
+}